@@ -41,38 +41,101 @@ namespace Hypertable {
   /**
    * Provides application work queue and worker threads.  It maintains a queue
    * of requests and a pool of threads that pull requests off the queue and
-   * carry them out.
+   * carry them out.  Requests that share a thread group are kept in a FIFO
+   * per group and only one of them runs at a time.  Groups that have pending
+   * requests and nothing running are kept on a ready list (and an urgent
+   * ready list, if they have urgent requests), so a worker finds its next
+   * request in constant time regardless of how many requests are queued
+   * behind busy groups.
    */
   class ApplicationQueue : public ReferenceCount {
 
-    class UsageRec {
-    public:
-      UsageRec() : thread_group(0), running(false), outstanding(1) { return; }
-      uint64_t thread_group;
-      bool     running;
-      int      outstanding;
-    };
-
-    typedef hash_map<uint64_t, UsageRec *> UsageRecMap;
-
     class WorkRec {
     public:
-      WorkRec(ApplicationHandler *ah) : handler(ah), usage(0) { return; }
+      WorkRec(ApplicationHandler *ah) : handler(ah) { return; }
       ~WorkRec() { delete handler; }
       ApplicationHandler   *handler;
-      UsageRec             *usage;
     };
 
     typedef std::list<WorkRec *> WorkQueue;
 
-    class ApplicationQueueState {
+    class GroupRec;
+
+    typedef std::list<GroupRec *> ReadyList;
+
+    /**
+     * Pending requests of one thread group.  Requests with a thread group
+     * of 0 are not serialized, each one gets a group of its own.
+     */
+    class GroupRec {
     public:
-      ApplicationQueueState() : shutdown(false), paused(false) { return; }
+      GroupRec(uint64_t group) : thread_group(group), running(false),
+          ready(false), urgent_ready(false) { return; }
+      bool empty() const { return queue.empty() && urgent_queue.empty(); }
+      uint64_t            thread_group;
+      bool                running;
       WorkQueue           queue;
       WorkQueue           urgent_queue;
-      UsageRecMap         usage_map;
+      bool                ready;
+      bool                urgent_ready;
+      ReadyList::iterator ready_iter;
+      ReadyList::iterator urgent_ready_iter;
+    };
+
+    typedef hash_map<uint64_t, GroupRec *> GroupMap;
+
+    class ApplicationQueueState {
+    public:
+      ApplicationQueueState() : backlog(0), shutdown(false), paused(false) {
+        return;
+      }
+
+      /**
+       * Appends a group that is not running to the ready list(s) matching
+       * its pending requests.
+       */
+      void make_ready(GroupRec *group) {
+        if (!group->urgent_queue.empty() && !group->urgent_ready) {
+          group->urgent_ready_iter =
+              urgent_ready_list.insert(urgent_ready_list.end(), group);
+          group->urgent_ready = true;
+        }
+        if (!group->queue.empty() && !group->ready) {
+          group->ready_iter = ready_list.insert(ready_list.end(), group);
+          group->ready = true;
+        }
+      }
+
+      void remove_ready(GroupRec *group) {
+        if (group->urgent_ready) {
+          urgent_ready_list.erase(group->urgent_ready_iter);
+          group->urgent_ready = false;
+        }
+        if (group->ready) {
+          ready_list.erase(group->ready_iter);
+          group->ready = false;
+        }
+      }
+
+      /**
+       * Called when a group is no longer running.  Puts it back on the
+       * ready list(s) if it has more requests, otherwise deletes it.
+       */
+      void release(GroupRec *group) {
+        if (!group->empty())
+          make_ready(group);
+        else {
+          if (group->thread_group != 0)
+            group_map.erase(group->thread_group);
+          delete group;
+        }
+      }
+
+      ReadyList           ready_list;
+      ReadyList           urgent_ready_list;
+      GroupMap            group_map;
+      size_t              backlog;
       Mutex               queue_mutex;
-      Mutex               usage_mutex;
       boost::condition    cond;
       bool                shutdown;
       bool                paused;
@@ -84,87 +147,59 @@ namespace Hypertable {
       Worker(ApplicationQueueState &qstate) : m_state(qstate) { return; }
 
       void operator()() {
-        WorkRec *rec = 0;
-        WorkQueue::iterator iter;
+        GroupRec *group;
+        WorkRec *rec;
 
         while (true) {
 
-          {  // !!! maybe ditch this block specifier
+          {
             ScopedLock lock(m_state.queue_mutex);
 
-            while ((m_state.paused || m_state.queue.empty()) &&
-                   m_state.urgent_queue.empty()) {
-              if (m_state.shutdown)
-                return;
-              m_state.cond.wait(lock);
-            }
+            rec = 0;
+            while (rec == 0) {
+              if (!m_state.urgent_ready_list.empty())
+                group = m_state.urgent_ready_list.front();
+              else if (!m_state.paused && !m_state.ready_list.empty())
+                group = m_state.ready_list.front();
+              else {
+                if (m_state.shutdown)
+                  return;
+                m_state.cond.wait(lock);
+                continue;
+              }
 
-            {
-              ScopedLock ulock(m_state.usage_mutex);
-
-              rec = 0;
-
-              iter = m_state.urgent_queue.begin();
-              while (iter != m_state.urgent_queue.end()) {
-                rec = (*iter);
-                if (rec->handler->expired()) {
-                  iter = m_state.urgent_queue.erase(iter);
-                  continue;
-                }
-                if (rec->usage == 0 || !rec->usage->running) {
-                  if (rec->usage)
-                    rec->usage->running = true;
-                  m_state.urgent_queue.erase(iter);
-                  break;
-                }
-                rec = 0;
-                iter++;
+              m_state.remove_ready(group);
+
+              if (!group->urgent_queue.empty()) {
+                rec = group->urgent_queue.front();
+                group->urgent_queue.pop_front();
               }
+              else {
+                rec = group->queue.front();
+                group->queue.pop_front();
+              }
+              m_state.backlog--;
 
-              if (rec == 0 && !m_state.paused) {
-                iter = m_state.queue.begin();
-                while (iter != m_state.queue.end()) {
-                  rec = (*iter);
-                  if (rec->handler->expired()) {
-                    iter = m_state.queue.erase(iter);
-                    continue;
-                  }
-                  if (rec->usage == 0 || !rec->usage->running) {
-                    if (rec->usage)
-                      rec->usage->running = true;
-                    m_state.queue.erase(iter);
-                    break;
-                  }
-                  rec = 0;
-                  iter++;
-                }
+              if (rec->handler->expired()) {
+                delete rec;
+                rec = 0;
+                m_state.release(group);
+                continue;
               }
-            }
-            if (rec == 0) {
-              if (m_state.shutdown)
-                return;
-              m_state.cond.wait(lock);
-              if (m_state.shutdown)
-                return;
+
+              group->running = true;
             }
           }
 
-          if (rec) {
-            rec->handler->run();
-            if (rec->usage) {
-              ScopedLock ulock(m_state.usage_mutex);
-              rec->usage->running = false;
-              rec->usage->outstanding--;
-              if (rec->usage->outstanding == 0) {
-                m_state.usage_map.erase(rec->usage->thread_group);
-                delete rec->usage;
-              }
-            }
-            delete rec;
+          rec->handler->run();
+          delete rec;
+
+          {
+            ScopedLock lock(m_state.queue_mutex);
+            group->running = false;
+            m_state.release(group);
           }
         }
-
-        HT_INFO("thread exit");
       }
 
     private:
@@ -205,6 +240,7 @@ namespace Hypertable {
      * completion of the shutdown.
      */
     void shutdown() {
+      ScopedLock lock(m_state.queue_mutex);
       m_state.shutdown = true;
       m_state.cond.notify_all();
     }
@@ -233,6 +269,15 @@ namespace Hypertable {
       m_state.cond.notify_all();
     }
 
+    /**
+     * Returns the number of requests waiting in the queue, not counting the
+     * ones being carried out
+     */
+    size_t backlog() {
+      ScopedLock lock(m_state.queue_mutex);
+      return m_state.backlog;
+    }
+
     /**
      * Adds a request (application handler) to the request queue.  The request
      * queue is designed to support the serialization of related requests.
@@ -241,33 +286,34 @@ namespace Hypertable {
      * object
      */
     void add(ApplicationHandler *app_handler) {
-      UsageRecMap::iterator uiter;
+      GroupMap::iterator iter;
+      GroupRec *group;
+
+      HT_ASSERT(app_handler);
+
       uint64_t thread_group = app_handler->get_thread_group();
       WorkRec *rec = new WorkRec(app_handler);
-      rec->usage = 0;
 
-      HT_ASSERT(app_handler);
+      ScopedLock lock(m_state.queue_mutex);
 
-      if (thread_group != 0) {
-        ScopedLock ulock(m_state.usage_mutex);
-        if ((uiter = m_state.usage_map.find(thread_group))
-            != m_state.usage_map.end()) {
-          rec->usage = (*uiter).second;
-          rec->usage->outstanding++;
-        }
-        else {
-          rec->usage = new UsageRec();
-          rec->usage->thread_group = thread_group;
-          m_state.usage_map[thread_group] = rec->usage;
-        }
+      if (thread_group == 0)
+        group = new GroupRec(0);
+      else if ((iter = m_state.group_map.find(thread_group))
+               != m_state.group_map.end())
+        group = (*iter).second;
+      else {
+        group = new GroupRec(thread_group);
+        m_state.group_map[thread_group] = group;
       }
 
-      {
-        ScopedLock lock(m_state.queue_mutex);
-        if (app_handler->is_urgent())
-          m_state.urgent_queue.push_back(rec);
-        else
-          m_state.queue.push_back(rec);
+      if (app_handler->is_urgent())
+        group->urgent_queue.push_back(rec);
+      else
+        group->queue.push_back(rec);
+      m_state.backlog++;
+
+      if (!group->running) {
+        m_state.make_ready(group);
         m_state.cond.notify_one();
       }
     }
@@ -30,6 +30,7 @@
 #include "Common/ReferenceCount.h"
 
 #include "CommHeader.h"
+#include "ReceiveBufferPool.h"
 
 namespace Hypertable {
 
@@ -50,7 +51,7 @@ namespace Hypertable {
      */
     Event(Type ct, const sockaddr_in &a, int err = 0)
       : type(ct), addr(a), error(err), payload(0), payload_len(0),
-        thread_group(0) { }
+        payload_pool(0), payload_capacity(0), thread_group(0) { }
 
     /** Initializes the event object.
      *
@@ -58,12 +59,17 @@ namespace Hypertable {
      * @param err error code associated with this event
      */
     Event(Type ct, int err=0) : type(ct), error(err), payload(0),
-        payload_len(0), thread_group(0) { }
+        payload_len(0), payload_pool(0), payload_capacity(0),
+        thread_group(0) { }
 
-    /** Destroys event.  Deallocates message data
+    /** Destroys event.  Deallocates message data, or hands it back to the
+     * receive buffer pool it came from
      */
     ~Event() {
-      delete [] payload;
+      if (payload_pool)
+        payload_pool->release((uint8_t *)payload, payload_capacity);
+      else
+        delete [] payload;
     }
 
     /** Loads header object from serialized buffer.  This method
@@ -107,6 +113,12 @@ namespace Hypertable {
     /** Length of the message */
     size_t payload_len;
 
+    /** Receive buffer pool the payload was allocated from, if any */
+    ReceiveBufferPool *payload_pool;
+
+    /** Allocated size of the payload buffer when it came from a pool */
+    size_t payload_capacity;
+
     /** Thread group to which this message belongs.  Used to serialize
      * messages destined for the same object.  This value is created in
      * the constructor and is the combination of the socked descriptor from
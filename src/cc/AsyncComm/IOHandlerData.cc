@@ -327,7 +327,8 @@ void IOHandlerData::handle_message_header(clock_t arrival_clocks) {
   m_event->load_header(m_sd, m_message_header, header_len);
   m_event->arrival_clocks = arrival_clocks;
 
-  m_message = new uint8_t [m_event->header.total_len - header_len];
+  m_message = m_reactor_ptr->receive_buffer_pool.allocate(
+      m_event->header.total_len - header_len, &m_message_capacity);
   m_message_ptr = m_message;
   m_message_remaining = m_event->header.total_len - header_len;
   m_message_header_remaining = 0;
@@ -347,13 +348,15 @@ void IOHandlerData::handle_message_body() {
                "=%d,total_len=%d)", m_event->header.id, m_event->header.version,
                m_event->header.total_len);
     }
-    delete [] m_message;
+    m_reactor_ptr->receive_buffer_pool.release(m_message, m_message_capacity);
     delete m_event;
   }
   else {
     m_event->payload = m_message;
     m_event->payload_len = m_event->header.total_len
                            - m_event->header.header_len;
+    m_event->payload_pool = &m_reactor_ptr->receive_buffer_pool;
+    m_event->payload_capacity = m_message_capacity;
     deliver_event( m_event, dh );
   }
 
@@ -56,6 +56,7 @@ namespace Hypertable {
       m_message_header_ptr = m_message_header;
       m_message_header_remaining = m_event->header.fixed_length();
       m_message = 0;
+      m_message_capacity = 0;
       m_message_ptr = 0;
       m_message_remaining = 0;
     }
@@ -89,6 +90,7 @@ namespace Hypertable {
     size_t              m_message_header_remaining;
     bool                m_got_header;
     uint8_t            *m_message;
+    size_t              m_message_capacity;
     uint8_t            *m_message_ptr;
     size_t              m_message_remaining;
     std::list<CommBufPtr> m_send_queue;
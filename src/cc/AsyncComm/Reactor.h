@@ -31,6 +31,7 @@
 #include "Common/ReferenceCount.h"
 
 #include "PollTimeout.h"
+#include "ReceiveBufferPool.h"
 #include "RequestCache.h"
 #include "ExpireTimer.h"
 
@@ -100,6 +101,9 @@ namespace Hypertable {
     void poll_loop_interrupt();
     void poll_loop_continue();
 
+    /** Pool of message body buffers for the connections of this reactor */
+    ReceiveBufferPool receive_buffer_pool;
+
   protected:
     typedef std::priority_queue<ExpireTimer, std::vector<ExpireTimer>, LtTimer>
             TimerHeap;
@@ -0,0 +1,86 @@
+/**
+ * Copyright (C) 2008 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include "ReceiveBufferPool.h"
+
+using namespace Hypertable;
+
+
+ReceiveBufferPool::ReceiveBufferPool(size_t max_class_bytes)
+  : m_max_class_bytes(max_class_bytes) {
+}
+
+
+ReceiveBufferPool::~ReceiveBufferPool() {
+  for (int i=0; i<CLASS_COUNT; i++) {
+    for (size_t j=0; j<m_free_lists[i].size(); j++)
+      delete [] m_free_lists[i][j];
+  }
+}
+
+
+uint8_t *ReceiveBufferPool::allocate(size_t len, size_t *capacityp) {
+  int size_class = 0;
+
+  if (len > ((size_t)1 << MAX_CLASS_BITS)) {
+    *capacityp = len;
+    return new uint8_t [len];
+  }
+
+  while (((size_t)1 << (MIN_CLASS_BITS + size_class)) < len)
+    size_class++;
+
+  *capacityp = (size_t)1 << (MIN_CLASS_BITS + size_class);
+
+  {
+    ScopedLock lock(m_mutex);
+    std::vector<uint8_t *> &free_list = m_free_lists[size_class];
+    if (!free_list.empty()) {
+      uint8_t *buf = free_list.back();
+      free_list.pop_back();
+      return buf;
+    }
+  }
+
+  return new uint8_t [*capacityp];
+}
+
+
+void ReceiveBufferPool::release(uint8_t *buf, size_t capacity) {
+
+  if (capacity <= ((size_t)1 << MAX_CLASS_BITS)) {
+    int size_class = 0;
+    while (((size_t)1 << (MIN_CLASS_BITS + size_class)) < capacity)
+      size_class++;
+
+    ScopedLock lock(m_mutex);
+    std::vector<uint8_t *> &free_list = m_free_lists[size_class];
+    if ((free_list.size() + 1) * capacity <= m_max_class_bytes ||
+        free_list.size() < 4) {
+      free_list.push_back(buf);
+      return;
+    }
+  }
+
+  delete [] buf;
+}
@@ -0,0 +1,82 @@
+/** -*- c++ -*-
+ * Copyright (C) 2008 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_RECEIVEBUFFERPOOL_H
+#define HYPERTABLE_RECEIVEBUFFERPOOL_H
+
+#include <vector>
+
+#include "Common/Mutex.h"
+
+namespace Hypertable {
+
+  /**
+   * Pool of message receive buffers.  Buffers are handed out in power of two
+   * size classes between 1KB and 1MB and, when released, are kept on a free
+   * list for their class so that the next message of similar size can reuse
+   * them without going through malloc.  Larger messages are allocated and
+   * freed directly.  Pooled buffers are plain uint8_t arrays, so a buffer
+   * that is not returned to the pool can simply be freed with delete [].
+   */
+  class ReceiveBufferPool {
+  public:
+    enum {
+      MIN_CLASS_BITS = 10,
+      MAX_CLASS_BITS = 20,
+      CLASS_COUNT = MAX_CLASS_BITS - MIN_CLASS_BITS + 1
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param max_class_bytes maximum number of bytes held on the free
+     *        list of each size class
+     */
+    ReceiveBufferPool(size_t max_class_bytes = 8 * 1024 * 1024);
+    ~ReceiveBufferPool();
+
+    /**
+     * Returns a buffer of at least len bytes.
+     *
+     * @param len number of bytes needed
+     * @param capacityp address of variable to hold the actual buffer size,
+     *        which must be passed back to #release
+     * @return pointer to buffer
+     */
+    uint8_t *allocate(size_t len, size_t *capacityp);
+
+    /**
+     * Returns a buffer obtained from #allocate to the pool.
+     *
+     * @param buf buffer to release
+     * @param capacity capacity returned by #allocate
+     */
+    void release(uint8_t *buf, size_t capacity);
+
+  private:
+    Mutex                  m_mutex;
+    std::vector<uint8_t *> m_free_lists[CLASS_COUNT];
+    size_t                 m_max_class_bytes;
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_RECEIVEBUFFERPOOL_H
@@ -0,0 +1,162 @@
+/**
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include "Common/Logger.h"
+
+#include "AsyncComm/ReceiveBufferPool.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  const size_t KB = 1024;
+  const size_t MB = 1024 * 1024;
+
+  size_t capacity_of(ReceiveBufferPool &pool, size_t len) {
+    size_t capacity;
+    uint8_t *buf = pool.allocate(len, &capacity);
+    HT_ASSERT(capacity >= len);
+    memset(buf, 0, len);
+    pool.release(buf, capacity);
+    return capacity;
+  }
+
+  /**
+   * Releases count buffers of the given size to the pool, then checks that
+   * exactly the first kept of them come back, newest first
+   */
+  void check_kept(ReceiveBufferPool &pool, size_t len, size_t count,
+                  size_t kept) {
+    vector<uint8_t *> released, taken;
+    size_t capacity;
+
+    for (size_t i=0; i<count; i++)
+      released.push_back(pool.allocate(len, &capacity));
+    for (size_t i=0; i<count; i++)
+      pool.release(released[i], capacity);
+
+    // the released buffers that were freed may be handed out by new [] as
+    // well, so only the first kept allocations can be told apart
+    for (size_t i=0; i<kept; i++) {
+      taken.push_back(pool.allocate(len, &capacity));
+      HT_ASSERT(taken.back() == released[kept - 1 - i]);
+    }
+    taken.push_back(pool.allocate(len, &capacity));
+    for (size_t i=0; i<kept; i++)
+      HT_ASSERT(taken.back() != released[i]);
+
+    foreach(uint8_t *buf, taken)
+      pool.release(buf, capacity);
+  }
+
+  struct Worker {
+    Worker(ReceiveBufferPool &pool, int seed) : pool(pool), seed(seed) { }
+    void operator()() {
+      vector<pair<uint8_t *, size_t> > held;
+      size_t capacity;
+      for (int i=0; i<20000; i++) {
+        size_t len = ((i * 7919 + seed * 104729) % (2 * MB)) + 1;
+        uint8_t *buf = pool.allocate(len, &capacity);
+        buf[0] = buf[len - 1] = (uint8_t)seed;
+        held.push_back(make_pair(buf, capacity));
+        if (held.size() > 8 || i % 3 == 0) {
+          HT_ASSERT(held.front().first[0] == (uint8_t)seed);
+          pool.release(held.front().first, held.front().second);
+          held.erase(held.begin());
+        }
+      }
+      for (size_t i=0; i<held.size(); i++)
+        pool.release(held[i].first, held[i].second);
+    }
+    ReceiveBufferPool &pool;
+    int seed;
+  };
+
+}
+
+
+int main(int argc, char **argv) {
+
+  // size classes are powers of two from 1KB to 1MB, larger sizes are exact
+  {
+    ReceiveBufferPool pool;
+    HT_ASSERT(capacity_of(pool, 1) == KB);
+    HT_ASSERT(capacity_of(pool, KB) == KB);
+    HT_ASSERT(capacity_of(pool, KB + 1) == 2 * KB);
+    HT_ASSERT(capacity_of(pool, 100 * KB) == 128 * KB);
+    HT_ASSERT(capacity_of(pool, MB) == MB);
+    HT_ASSERT(capacity_of(pool, MB + 1) == MB + 1);
+  }
+
+  // released buffers are reused by their own size class only
+  {
+    ReceiveBufferPool pool;
+    size_t capacity, capacity2;
+    uint8_t *buf = pool.allocate(3 * KB, &capacity);
+    uint8_t *other = pool.allocate(KB, &capacity2);
+    pool.release(buf, capacity);
+    HT_ASSERT(pool.allocate(4 * KB, &capacity) == buf);
+    HT_ASSERT(capacity == 4 * KB);
+    pool.release(buf, capacity);
+    uint8_t *small = pool.allocate(KB, &capacity2);
+    HT_ASSERT(small != buf);
+    pool.release(small, capacity2);
+    pool.release(other, capacity2);
+    HT_ASSERT(pool.allocate(KB, &capacity2) == other);
+    pool.release(other, capacity2);
+  }
+
+  // each free list holds no more than max_class_bytes, but at least four
+  // buffers
+  {
+    ReceiveBufferPool pool(8 * KB);
+    check_kept(pool, KB, 12, 8);
+    check_kept(pool, 4 * KB, 6, 4);
+    check_kept(pool, MB, 6, 4);
+  }
+
+  // buffers above the largest class are never kept
+  {
+    ReceiveBufferPool pool;
+    check_kept(pool, 2 * MB, 2, 0);
+  }
+
+  // concurrent use
+  {
+    ReceiveBufferPool pool;
+    boost::thread_group threads;
+    for (int i=0; i<4; i++)
+      threads.create_thread(Worker(pool, i + 1));
+    threads.join_all();
+  }
+
+  cout << "ReceiveBufferPool test passed" << endl;
+
+  return 0;
+}
@@ -34,13 +34,28 @@ namespace Hypertable {
 /**
  * A space-efficent probabilistic set for membership test, false postives
  * are possible, but false negatives are not.
+ *
+ * Two bit layouts are supported.  The classic layout spreads the bits of a
+ * key over the whole filter, one chained hash computation per bit.  The
+ * blocked layout (LAYOUT_BLOCKED) derives all bits of a key from a single
+ * 64-bit hash and confines them to one 32 byte block, so a lookup costs one
+ * hash computation and touches a single cache line.  Each block consists of
+ * eight 32-bit words and a key sets exactly one bit in each of them, so the
+ * probe is a short branch free loop.  The layout is part of the on-disk
+ * format of the filter.
  */
 template <class HasherT = MurmurHash2>
 class BasicBloomFilter {
 public:
-  BasicBloomFilter(size_t element_count, float false_positive_prob) {
+  enum Layout { LAYOUT_CLASSIC = 0, LAYOUT_BLOCKED = 1 };
+
+  enum { BLOCK_WORDS = 8, BLOCK_BYTES = 32, CACHE_LINE_BYTES = 64 };
+
+  BasicBloomFilter(size_t element_count, float false_positive_prob,
+                   Layout layout = LAYOUT_CLASSIC) {
     m_element_count = element_count;
     m_false_positive_prob = false_positive_prob;
+    m_layout = layout;
     double num_hashes = -std::log(m_false_positive_prob) / std::log(2);
     m_num_hash_functions = (size_t)num_hashes;
     m_num_bits = (size_t)(m_element_count * num_hashes / std::log(2));
@@ -49,7 +64,24 @@ public:
                 (Lu)element_count, false_positive_prob);
     }
     m_num_bytes = (m_num_bits / CHAR_BIT) + (m_num_bits % CHAR_BIT ? 1 : 0);
-    m_bloom_bits = new uint8_t[m_num_bytes];
+
+    if (m_layout == LAYOUT_BLOCKED) {
+      // bits within a block are not independent, give it some slack
+      m_num_bytes += m_num_bytes / 8;
+      m_num_blocks = (m_num_bytes + BLOCK_BYTES - 1) / BLOCK_BYTES;
+      m_num_bytes = m_num_blocks * BLOCK_BYTES;
+      m_num_bits = m_num_bytes * CHAR_BIT;
+      m_num_hash_functions = BLOCK_WORDS;
+      // align so that a block never straddles a cache line
+      m_alloc = new uint8_t[m_num_bytes + CACHE_LINE_BYTES];
+      m_bloom_bits = m_alloc + (CACHE_LINE_BYTES -
+          ((uintptr_t)m_alloc & (CACHE_LINE_BYTES - 1)));
+    }
+    else {
+      m_num_blocks = 0;
+      m_alloc = new uint8_t[m_num_bytes];
+      m_bloom_bits = m_alloc;
+    }
 
     for(unsigned ii = 0; ii< m_num_bytes; ++ii)
       m_bloom_bits[ii] = 0x00;
@@ -57,11 +89,11 @@ public:
     HT_DEBUG_OUT <<"num funcs="<< m_num_hash_functions
                  <<" num bits="<< m_num_bits <<" num bytes="<< m_num_bytes
                  <<" bits per element="<< double(m_num_bits) / element_count
-                 << HT_END;
+                 <<" layout="<< (int)m_layout << HT_END;
   }
 
   ~BasicBloomFilter() {
-    delete[] m_bloom_bits;
+    delete[] m_alloc;
   }
 
   /* XXX/review static functions to expose the bloom filter parameters, given
@@ -71,6 +103,14 @@ public:
   */
 
   void insert(const void *key, size_t len) {
+    if (m_layout == LAYOUT_BLOCKED) {
+      uint32_t *block, mask[BLOCK_WORDS];
+      block_probe(key, len, &block, mask);
+      for (size_t i = 0; i < BLOCK_WORDS; ++i)
+        block[i] |= mask[i];
+      return;
+    }
+
     uint32_t hash = len;
 
     for (size_t i = 0; i < m_num_hash_functions; ++i) {
@@ -84,6 +124,9 @@ public:
   }
 
   bool may_contain(const void *key, size_t len) const {
+    if (m_layout == LAYOUT_BLOCKED)
+      return block_may_contain(key, len);
+
     uint32_t hash = len;
     uint8_t byte_mask;
     uint8_t byte;
@@ -116,16 +159,54 @@ public:
     return m_num_bytes;
   }
 
+  Layout layout() const { return m_layout; }
+
 private:
+  /**
+   * Locates the block for the given key and computes the bit to test in
+   * each of its words.  The upper half of the 64-bit hash selects the
+   * block, the lower half is multiplied by a different odd constant for
+   * each word and the top five bits of the product select the bit.
+   */
+  void block_probe(const void *key, size_t len, uint32_t **blockp,
+                   uint32_t *mask) const {
+    uint64_t hash = murmurhash64(key, len, len);
+    uint64_t index = ((hash >> 32) * (uint64_t)m_num_blocks) >> 32;
+    uint32_t lo = (uint32_t)hash;
+
+    *blockp = (uint32_t *)(m_bloom_bits + index * BLOCK_BYTES);
+    for (size_t i = 0; i < BLOCK_WORDS; ++i)
+      mask[i] = 1U << ((lo * ms_salt[i]) >> 27);
+  }
+
+  bool block_may_contain(const void *key, size_t len) const {
+    uint32_t *block, mask[BLOCK_WORDS], missing = 0;
+    block_probe(key, len, &block, mask);
+    for (size_t i = 0; i < BLOCK_WORDS; ++i)
+      missing |= ~block[i] & mask[i];
+    return missing == 0;
+  }
+
+  static const uint32_t ms_salt[BLOCK_WORDS];
+
   HasherT    m_hasher;
+  Layout     m_layout;
   size_t     m_element_count;
   float      m_false_positive_prob;
   size_t     m_num_hash_functions;
   size_t     m_num_bits;
   size_t     m_num_bytes;
+  size_t     m_num_blocks;
+  uint8_t   *m_alloc;
   uint8_t   *m_bloom_bits;
 };
 
+template <class HasherT>
+const uint32_t BasicBloomFilter<HasherT>::ms_salt[BLOCK_WORDS] = {
+  0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+  0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+};
+
 typedef BasicBloomFilter<> BloomFilter;
 
 } //namespace Hypertable
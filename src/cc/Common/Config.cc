@@ -214,6 +214,15 @@ void init_default_options() {
         "Hyperspace Grace period (see Chubby paper)")
     ("Hypertable.HqlInterpreter.Mutator.NoLogSync", boo()->default_value(false),
         "Suspends CommitLog sync operation on updates until command completion")
+    ("Hypertable.HqlInterpreter.LoadData.ParseThreads", i32()->default_value(1),
+        "Number of threads parsing the input of LOAD DATA INFILE")
+    ("Hypertable.HqlInterpreter.LoadData.Mutators", i32()->default_value(1),
+        "Number of mutators, each on its own thread, LOAD DATA INFILE feeds "
+        "the parsed cells to (1 parse thread and 1 mutator, the default, "
+        "loads serially)")
+    ("Hypertable.HqlInterpreter.LoadData.ChunkSize", i32()->default_value(4*M),
+        "Amount of input (bytes) handed to a LOAD DATA INFILE parse thread "
+        "at a time")
     ("Hypertable.Mutator.FlushDelay", i32()->default_value(0), "Number of "
         "milliseconds to wait prior to flushing scatter buffers (for testing)")
     ("Hypertable.Mutator.ScatterBuffer.FlushLimit.PerServer",
@@ -222,6 +231,17 @@ void init_default_options() {
     ("Hypertable.Mutator.ScatterBuffer.FlushLimit.Aggregate",
      i64()->default_value(40*M), "Amount of updates (bytes) accumulated for "
         "all servers to trigger a scatter buffer flush")
+    ("Hypertable.Mutator.Async.MaxOutstanding", i32()->default_value(4),
+        "Maximum number of scatter buffers an asynchronous mutator keeps in "
+        "flight before blocking")
+    ("Hypertable.Mutator.Async.MaxMemory", i64()->default_value(160*M),
+        "Maximum amount of updates (bytes) an asynchronous mutator keeps in "
+        "flight before blocking")
+    ("Hypertable.Scanner.Parallel.Workers", i32()->default_value(4),
+        "Number of ranges a parallel table scanner scans concurrently")
+    ("Hypertable.Scanner.Parallel.MaxMemory", i64()->default_value(16*M),
+        "Amount of cell data (bytes) a parallel table scanner buffers ahead "
+        "of the caller")
     ("Hypertable.LocationCache.MaxEntries", i64()->default_value(1*M),
         "Size of range location cache in number of entries")
     ("Hypertable.Master.Host", str(),
@@ -234,6 +254,21 @@ void init_default_options() {
         "Number of Hypertable Master communication reactor threads created")
     ("Hypertable.Master.Gc.Interval", i32()->default_value(300000),
         "Garbage collection interval in milliseconds by Master")
+    ("Hypertable.Master.RangeRecovery", boo()->default_value(true),
+        "Reassign the ranges of a RangeServer that has died to the remaining "
+        "RangeServers")
+    ("Hypertable.Master.Balancer.Enable", boo()->default_value(false),
+        "Periodically sample RangeServer load and log the range moves that "
+        "would rebalance the cluster (moves are not carried out)")
+    ("Hypertable.Master.Balancer.Policy", str()->default_value("load"),
+        "Policy used to place new ranges and detect imbalance "
+        "(load or range-count)")
+    ("Hypertable.Master.Balancer.Interval", i32()->default_value(60000),
+        "Interval in milliseconds at which the Master samples RangeServer "
+        "statistics for load balancing")
+    ("Hypertable.Master.Balancer.Imbalance", i32()->default_value(25),
+        "Percentage by which a RangeServer's load may exceed the cluster "
+        "mean before ranges are proposed to be moved off of it")
     ("Hypertable.RangeServer.MemoryLimit", i64(), "RangeServer memory limit")
     ("Hypertable.RangeServer.MemoryLimit.Percentage", i32()->default_value(60),
      "RangeServer memory limit specified as percentage of physical RAM")
@@ -241,20 +276,53 @@ void init_default_options() {
         "Port number on which range servers are or should be listening")
     ("Hypertable.RangeServer.AccessGroup.CellCache.PageSize",
      i32()->default_value(512*KiB), "Page size for CellCache pool allocator")
+    ("Hypertable.RangeServer.AccessGroup.CellCache.Type",
+     str()->default_value("map"), "Default cell cache data structure for "
+        "access groups that do not specify one (map or skiplist)")
     ("Hypertable.RangeServer.AccessGroup.MaxFiles", i32()->default_value(20),
         "Maximum number of cell store files to create before merging")
     ("Hypertable.RangeServer.AccessGroup.MaxMemory", i64()->default_value(1*G),
         "Maximum bytes consumed by an Access Group")
     ("Hypertable.RangeServer.AccessGroup.MergeFiles", i32()->default_value(5),
         "How many files to merge during a merging compaction")
+    ("Hypertable.RangeServer.AccessGroup.CompactionPolicy",
+        str()->default_value("merging"), "Policy that chooses the cell "
+        "stores merged by a compaction (merging, size-tiered or time-window)")
+    ("Hypertable.RangeServer.AccessGroup.CompactionPolicy.TombstoneRatio",
+        f64()->default_value(0.2), "Merge all of the cell stores of an "
+        "access group once delete records make up this fraction of their "
+        "entries (size-tiered and time-window policies)")
+    ("Hypertable.RangeServer.AccessGroup.CompactionPolicy.SizeTiered"
+        ".BucketRatio", f64()->default_value(1.5), "A cell store joins a "
+        "size tier if it is at most this many times the tier's average size")
+    ("Hypertable.RangeServer.AccessGroup.CompactionPolicy.SizeTiered"
+        ".MinSize", i64()->default_value(4*M), "Cell stores smaller than "
+        "this all belong to the smallest size tier")
+    ("Hypertable.RangeServer.AccessGroup.CompactionPolicy.TimeWindow.Size",
+        i32()->default_value(86400), "Length in seconds of the time windows "
+        "of the time-window compaction policy")
     ("Hypertable.RangeServer.CellStore.DefaultBlockSize",
         i32()->default_value(64*KiB), "Default block size for cell stores")
     ("Hypertable.RangeServer.CellStore.DefaultCompressor",
         str()->default_value("lzo"), "Default compressor for cell stores")
     ("Hypertable.RangeServer.CellStore.DefaultBloomFilter",
         str()->default_value("rows"), "Default bloom filter for cell stores")
+    ("Hypertable.RangeServer.CellStore.BloomFilter.Blocked",
+        boo()->default_value(false), "Write bloom filters of new cell stores "
+        "with the cache friendly blocked layout")
+    ("Hypertable.RangeServer.CellStore.PrefixCompressKeys",
+        boo()->default_value(false), "Prefix compress the keys within the "
+        "data blocks of new cell stores")
+    ("Hypertable.RangeServer.CellStore.CompressionThreads",
+        i32()->default_value(4), "Number of threads compressing the blocks "
+        "of cell stores being written (0 compresses on the writing thread)")
     ("Hypertable.RangeServer.BlockCache.MaxMemory", i64()->default_value(200*M),
         "Bytes to dedicate to the block cache")
+    ("Hypertable.RangeServer.BlockCache.Shards", i32()->default_value(16),
+        "Number of independently locked shards the block cache is split into")
+    ("Hypertable.RangeServer.BlockCache.Compressed.MaxMemory",
+        i64()->default_value(0), "Bytes to dedicate to the second tier "
+        "block cache, which holds compressed blocks (0 disables it)")
     ("Hypertable.RangeServer.Range.SplitSize", i64()->default_value(200*M),
         "Size of range in bytes before splitting")
     ("Hypertable.RangeServer.Range.MaximumSize", i64()->default_value(3*G),
@@ -281,6 +349,22 @@ void init_default_options() {
     ("Hypertable.RangeServer.CommitLog.Compressor",
         str()->default_value("quicklz"),
         "Commit log compressor to use (zlib, lzo, quicklz, bmz, none)")
+    ("Hypertable.RangeServer.CommitLog.GroupCommit.MaxWait",
+        i32()->default_value(0), "Number of milliseconds a group commit "
+        "leader waits for more updates before writing the batch to the "
+        "commit log")
+    ("Hypertable.RangeServer.CommitLog.GroupCommit.MaxBatchBytes",
+        i32()->default_value(4*M), "Maximum amount of update data (bytes) "
+        "coalesced into one commit log group commit")
+    ("Hypertable.RangeServer.CommitLog.Replay.DecompressThreads",
+        i32()->default_value(2), "Number of threads that decompress commit "
+        "log blocks during recovery")
+    ("Hypertable.RangeServer.CommitLog.Replay.ApplyThreads",
+        i32()->default_value(4), "Number of threads that apply replayed "
+        "updates to ranges during recovery")
+    ("Hypertable.RangeServer.CommitLog.Replay.BufferSize",
+        i64()->default_value(64*M), "Amount of commit log data (bytes) read "
+        "ahead of the threads applying it during recovery")
     ("Hypertable.CommitLog.RollLimit", i64()->default_value(100*M),
         "Roll commit log after this many bytes")
     ("Hypertable.CommitLog.Compressor", str()->default_value("quicklz"),
@@ -289,11 +373,21 @@ void init_default_options() {
         "Skip over any corruption encountered in the commit log")
     ("Hypertable.RangeServer.Scanner.Ttl", i32()->default_value(120000),
         "Number of milliseconds of inactivity before destroying scanners")
+    ("Hypertable.RangeServer.Scanner.BlockSize.Max", i32()->default_value(8*M),
+        "Maximum size in bytes that the scan block of a long running scanner "
+        "is allowed to grow to")
     ("Hypertable.RangeServer.Timer.Interval", i32()->default_value(20000),
         "Timer interval in milliseconds (reaping scanners, "
         "purging commit logs, etc.)")
     ("Hypertable.RangeServer.Maintenance.Interval", i32()->default_value(30000),
         "Maintenance scheduling interval in milliseconds")
+    ("Hypertable.RangeServer.Maintenance.GarbageCompaction.Threshold",
+        f64()->default_value(0.3), "Compact an access group to get rid of "
+        "deleted and expired cells once they are estimated to make up this "
+        "fraction of its disk usage")
+    ("Hypertable.RangeServer.Maintenance.GarbageCompaction.Budget",
+        i64()->default_value(1*G), "Maximum number of bytes rewritten by "
+        "garbage collecting compactions per maintenance interval")
     ("Hypertable.RangeServer.Workers", i32()->default_value(30),
         "Number of Range Server worker threads created")
     ("Hypertable.RangeServer.Reactors", i32(),
@@ -308,6 +402,10 @@ void init_default_options() {
         "thrift broker")
     ("ThriftBroker.NextLimit", i32()->default_value(100), "Iteration chunk "
         "size (number of cells) for thrift broker")
+    ("ThriftBroker.NextThreshold", i32()->default_value(128*K), "Iteration "
+        "chunk size (bytes) for serialized cells returned by thrift broker")
+    ("ThriftBroker.Workers", i32()->default_value(50), "Number of worker "
+        "threads for thrift broker")
     ("ThriftBroker.API.Logging", boo()->default_value(false), "Enable or "
         "disable Thrift API logging")
     ("ThriftBroker.Mutator.FlushInterval", i32()->default_value(1000),
@@ -21,6 +21,7 @@
 #ifndef HYPERTABLE_DYNAMICBUFFER_H
 #define HYPERTABLE_DYNAMICBUFFER_H
 
+#include <algorithm>
 #include <cstring>
 
 extern "C" {
@@ -110,6 +111,17 @@ namespace Hypertable {
       return rbuf;
     }
 
+    /**
+     * Exchanges the contents of two buffers without copying them.  The
+     * reference counts are left alone.
+     */
+    void swap(DynamicBuffer &other) {
+      std::swap(base, other.base);
+      std::swap(ptr, other.ptr);
+      std::swap(size, other.size);
+      std::swap(own, other.own);
+    }
+
     void grow(size_t new_size, bool nocopy = false) {
       uint8_t *new_buf = new uint8_t[new_size];
 
@@ -60,4 +60,44 @@ uint32_t murmurhash2(const void *key, size_t len, uint32_t seed) {
   return h;
 }
 
+uint64_t murmurhash64(const void *key, size_t len, uint64_t seed) {
+  const uint64_t m = 0xc6a4a7935bd1e995ULL;
+  const int r = 47;
+
+  uint64_t h = seed ^ (len * m);
+
+  const unsigned char * data = (const unsigned char *)key;
+
+  while (len >= 8) {
+    uint64_t k = *(uint64_t *)data;
+
+    k *= m;
+    k ^= k >> r;
+    k *= m;
+
+    h ^= k;
+    h *= m;
+
+    data += 8;
+    len -= 8;
+  }
+
+  switch (len) {
+    case 7: h ^= uint64_t(data[6]) << 48;
+    case 6: h ^= uint64_t(data[5]) << 40;
+    case 5: h ^= uint64_t(data[4]) << 32;
+    case 4: h ^= uint64_t(data[3]) << 24;
+    case 3: h ^= uint64_t(data[2]) << 16;
+    case 2: h ^= uint64_t(data[1]) << 8;
+    case 1: h ^= uint64_t(data[0]);
+            h *= m;
+  };
+
+  h ^= h >> r;
+  h *= m;
+  h ^= h >> r;
+
+  return h;
+}
+
 } // namespace Hypertable
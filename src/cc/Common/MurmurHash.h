@@ -33,6 +33,11 @@ namespace Hypertable {
  */
 uint32_t murmurhash2(const void *data, size_t len, uint32_t hash);
 
+/**
+ * The 64-bit MurmurHash 2 variant (MurmurHash64A), for 64-bit platforms.
+ */
+uint64_t murmurhash64(const void *data, size_t len, uint64_t hash);
+
 struct MurmurHash2 {
   uint32_t operator()(const String& s) const {
     return murmurhash2(s.c_str(), s.length(), 0);
@@ -51,6 +56,20 @@ struct MurmurHash2 {
   }
 };
 
+struct MurmurHash64 {
+  uint64_t operator()(const String& s) const {
+    return murmurhash64(s.c_str(), s.length(), 0);
+  }
+
+  uint64_t operator()(const void *start, size_t len) const {
+    return murmurhash64(start, len, 0);
+  }
+
+  uint64_t operator()(const void *start, size_t len, uint64_t seed) const {
+    return murmurhash64(start, len, seed);
+  }
+};
+
 } // namespace Hypertable
 
 #endif // HYPERTABLE_MURMURHASH_H
@@ -39,6 +39,7 @@ struct MyPolicy : Config::Policy {
       ("MurmurHash2", "Test with MurmurHash2 by Austin Appleby")
       ("Lookup3", "Test with Lookup3 by Bob Jenkins")
       ("SuperFastHash", "Test with SuperFastHash by Paul Hsieh")
+      ("Blocked", "Test the blocked (cache line) layout")
       ("length", i16()->default_value(32), "length of test strings")
       ("false-positive,p", f64()->default_value(0.01),
           "false positive probability for Bloomfilter")
@@ -80,7 +81,8 @@ struct BloomFilterTest {
   Items items;
 
   BloomFilterTest(int nitems, size_t len) {
-    has_choice = has("Lookup3") || has("SuperFastHash") || has("MurmurHash2");
+    has_choice = has("Lookup3") || has("SuperFastHash") || has("MurmurHash2")
+        || has("Blocked");
     fp_prob = get_f64("false-positive");
     double total = 0.;
     nitems *= 2;
@@ -95,9 +97,10 @@ struct BloomFilterTest {
   }
 
   template <class HashT>
-  void test(const String &label) {
+  void test(const String &label, typename BasicBloomFilter<HashT>::Layout
+            layout = BasicBloomFilter<HashT>::LAYOUT_CLASSIC) {
     size_t nitems = items.size() / 2;
-    BasicBloomFilter<HashT> filter(nitems, fp_prob);
+    BasicBloomFilter<HashT> filter(nitems, fp_prob, layout);
 
     cout << label << endl;
 
@@ -117,12 +120,17 @@ struct BloomFilterTest {
 
     cout << "  false positive rate: expected "<< fp_prob <<", got "
          << false_positives / nfalses << endl;
+
+    HT_ASSERT(false_positives / nfalses < fp_prob * 2);
   }
 
   void run() {
     TEST_IF(Lookup3);
     TEST_IF(SuperFastHash);
     TEST_IF(MurmurHash2);
+
+    if (!has_choice || has("Blocked"))
+      test<MurmurHash2>("Blocked", BloomFilter::LAYOUT_BLOCKED);
   }
 };
 
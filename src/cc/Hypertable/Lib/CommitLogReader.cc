@@ -168,6 +168,39 @@ CommitLogReader::next(const uint8_t **blockp, size_t *lenp,
 }
 
 
+bool
+CommitLogReader::next_compressed(DynamicBuffer &zblock,
+                                 BlockCompressionHeaderCommitLog *header) {
+  CommitLogBlockInfo binfo;
+
+  while (next_raw_block(&binfo, header)) {
+
+    if (binfo.error == Error::OK) {
+      zblock.set(binfo.block_ptr, binfo.block_len);
+
+      if (header->get_revision() > m_latest_revision)
+        m_latest_revision = header->get_revision();
+
+      if (header->get_revision() > m_revision)
+        m_revision = header->get_revision();
+
+      return true;
+    }
+
+    LogFragmentQueue::iterator iter = m_fragment_queue.begin() + m_fragment_queue_offset;
+    HT_WARNF("Corruption detected in CommitLog fragment %s starting at "
+             "postion %lld for %lld bytes - %s",
+             (*iter).block_stream->get_fname().c_str(),
+             (Lld)binfo.start_offset, (Lld)(binfo.end_offset
+             - binfo.start_offset), Error::get_text(binfo.error));
+  }
+
+  sort(m_fragment_queue.begin(), m_fragment_queue.end());
+
+  return false;
+}
+
+
 void CommitLogReader::load_fragments(String log_dir, bool mark_for_deletion) {
   vector<string> listing;
   CommitLogFileInfo file_info;
@@ -54,6 +54,18 @@ namespace Hypertable {
     bool next(const uint8_t **blockp, size_t *lenp,
               BlockCompressionHeaderCommitLog *);
 
+    /**
+     * Reads the next block without decompressing it, so that blocks can be
+     * inflated on other threads.  The compressed block is copied into
+     * zblock, which remains valid after subsequent calls.
+     *
+     * @param zblock buffer to receive the compressed block
+     * @param header receives the block header
+     * @return false when the end of the log has been reached
+     */
+    bool next_compressed(DynamicBuffer &zblock,
+                         BlockCompressionHeaderCommitLog *header);
+
     void reset() {
       m_fragment_queue_offset = 0;
       m_block_buffer.clear();
@@ -136,9 +136,9 @@ namespace {
           fprintf(stderr, "    Throughput:  %.2f cells/s\n",
                  total_cells / elapsed);
         }
-        if (mutator)
-          fprintf(stderr, "       Resends:  %llu\n",
-                  (Llu)mutator->get_resend_count());
+        if (mutator || total_resends)
+          fprintf(stderr, "       Resends:  %llu\n", (Llu)(total_resends
+                  + (mutator ? mutator->get_resend_count() : 0)));
 
         fflush(stderr);
       }
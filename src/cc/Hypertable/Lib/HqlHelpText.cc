@@ -88,6 +88,7 @@ namespace {
     "    cell_predicate",
     "    | row_predicate",
     "    | timestamp_predicate",
+    "    | filter_predicate",
     "",
     "relop: '=' | '<' | '<=' | '>' | '>=' | '=^'",
     "",
@@ -106,6 +107,11 @@ namespace {
     "timestamp_predicate: ",
     "    [timestamp relop] TIMESTAMP relop timestamp",
     "",
+    "filter_predicate: ",
+    "    (QUALIFIER | VALUE) ('=' | '=^' | '=~') string_literal",
+    "    | NOT filter_predicate",
+    "    | '(' filter_predicate ((AND | OR) filter_predicate)* ')'",
+    "",
     "options_spec:",
     "    (REVS = revision_count",
     "    | LIMIT = row_count",
@@ -249,6 +255,7 @@ namespace {
     "      | BLOCKSIZE '=' int",
     "      | COMPRESSOR '=' compressor_spec",
     "      | BLOOMFILTER '=' bloom_filter_spec",
+    "      | CELLCACHE '=' ( map | skiplist )",
     "",
     "    compressor_spec:",
     "      bmz [ bmz_options ]",
@@ -381,6 +388,7 @@ namespace {
     "      | BLOCKSIZE '=' int",
     "      | COMPRESSOR '=' compressor_spec",
     "      | BLOOMFILTER '=' bloom_filter_spec",
+    "      | CELLCACHE '=' ( map | skiplist )",
     "",
     "    compressor_spec:",
     "      bmz [ bmz_options ]",
@@ -516,6 +524,7 @@ namespace {
     "  * BLOCKSIZE '=' int",
     "  * COMPRESSOR '=' compressor_spec",
     "  * BLOOMFILTER '=' bloom_filter_spec",
+    "  * CELLCACHE '=' ( map | skiplist )",
     "",
     "The IN_MEMORY option indicates that all cell data for the access group should",
     "remain memory resident.  Queries against column families in IN_MEMORY access",
@@ -568,6 +577,13 @@ namespace {
     "  --max-approx-items arg  Number of cell store items used to guess the number",
     "                          of actual bloom filter entries (default = 1000)",
     "",
+    "The CELLCACHE option selects the in-memory data structure used for the cell",
+    "cache.  The map form (a balanced tree) is the default.  The skiplist form is",
+    "a concurrent skip list that lets scanners read the cell cache without",
+    "contending with updates, which can help write-heavy ranges.  The default for",
+    "access groups without this option comes from the",
+    "Hypertable.RangeServer.AccessGroup.CellCache.Type property.",
+    "",
     "Compressors",
     "-----------",
     "",
@@ -609,6 +625,7 @@ namespace {
     "      cell_predicate",
     "      | row_predicate",
     "      | timestamp_predicate",
+    "      | filter_predicate",
     "",
     "    relop: '=' | '<' | '<=' | '>' | '>=' | '=^'",
     "",
@@ -627,6 +644,11 @@ namespace {
     "    timestamp_predicate:",
     "      [timestamp relop] TIMESTAMP relop timestamp",
     "",
+    "    filter_predicate:",
+    "      (QUALIFIER | VALUE) ('=' | '=^' | '=~') string_literal",
+    "      | NOT filter_predicate",
+    "      | '(' filter_predicate ((AND | OR) filter_predicate)* ')'",
+    "",
     "    options_spec:",
     "      (REVS revision_count",
     "      | LIMIT row_count",
@@ -646,6 +668,16 @@ namespace {
     "\"starts with\" operator.  It will return all rows that have the same prefix as",
     "the operand.",
     "",
+    "A filter_predicate tests the column qualifier or the value of each cell",
+    "for equality, a prefix ('=^') or a POSIX extended regular expression",
+    "('=~').  The range servers drop the cells that do not match, so they are",
+    "never sent to the client.  Filter predicates are ANDed together and are",
+    "applied before REVS, so REVS returns the most recent matching versions.",
+    "For example:",
+    "",
+    "    SELECT * FROM t WHERE QUALIFIER =^ 'http' AND",
+    "        (VALUE = 'red' OR NOT VALUE =~ '^[0-9]+$')",
+    "",
     "Options",
     "-------",
     "",
@@ -49,6 +49,7 @@ extern "C" {
 #include "HqlParser.h"
 #include "Key.h"
 #include "LoadDataEscape.h"
+#include "LoadDataParallel.h"
 #include "LoadDataSource.h"
 #include "LoadDataSourceFactory.h"
 
@@ -340,7 +341,6 @@ cmd_load_data(Client *client, uint32_t mutator_flags,
     else
       fout.push(boost::iostreams::null_sink());
     table = client->open_table(state.table_name);
-    mutator = table->create_mutator(0, mutator_flags);
   }
 
   HT_ON_SCOPE_EXIT(&close_file, out_fd);
@@ -362,6 +362,23 @@ cmd_load_data(Client *client, uint32_t mutator_flags,
       fout << "row\tcolumn\tvalue\n";
   }
 
+  int parse_threads = Config::properties->get_i32(
+      "Hypertable.HqlInterpreter.LoadData.ParseThreads");
+  int mutators = Config::properties->get_i32(
+      "Hypertable.HqlInterpreter.LoadData.Mutators");
+
+  if (into_table && (parse_threads > 1 || mutators > 1)) {
+    LoadDataParallel loader(table, mutator_flags, state.escape, parse_threads,
+        mutators, Config::properties->get_i32(
+        "Hypertable.HqlInterpreter.LoadData.ChunkSize"));
+    loader.load(lds, cb);
+    cb.on_finish(0);
+    return;
+  }
+
+  if (into_table)
+    mutator = table->create_mutator(0, mutator_flags);
+
   KeySpec key;
   uint8_t *value;
   uint32_t value_len;
@@ -49,11 +49,12 @@ namespace Hypertable {
       uint64_t total_cells,
                total_keys_size,
                total_values_size,
+               total_resends,   // resends of mutators not passed to on_finish
                file_size;
 
       Callback(bool normal = true) : output(0), normal_mode(normal),
           format_ts_in_usecs(false), total_cells(0), total_keys_size(0),
-          total_values_size(0), file_size(0) { }
+          total_values_size(0), total_resends(0), file_size(0) { }
       virtual ~Callback() { }
 
       /** Called when the hql string is parsed successfully */
@@ -190,7 +190,7 @@ namespace Hypertable {
       ScanState() : display_timestamps(false), keys_only(false),
           current_rowkey_set(false), start_time_set(false),
           end_time_set(false), current_timestamp_set(false),
-          current_relop(0) { }
+          current_relop(0), filter_op(0), filter_predicates(0) { }
 
       void set_time_interval(int64_t start, int64_t end) {
         HQL_DEBUG("("<< start <<", "<< end <<")");
@@ -225,6 +225,8 @@ namespace Hypertable {
       int64_t current_timestamp;
       bool    current_timestamp_set;
       int current_relop;
+      int filter_op;
+      int filter_predicates;
     };
 
     class ParserState {
@@ -482,6 +484,16 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct set_access_group_cell_cache {
+      set_access_group_cell_cache(ParserState &state) : state(state) { }
+      void operator()(char const * str, char const *end) const {
+        state.ag->cell_cache = String(str, end-str);
+        trim_if(state.ag->cell_cache, boost::is_any_of("'\""));
+        to_lower(state.ag->cell_cache);
+      }
+      ParserState &state;
+    };
+
     struct add_column_family {
       add_column_family(ParserState &state) : state(state) { }
       void operator()(char const *str, char const *end) const {
@@ -1078,6 +1090,69 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct scan_set_filter_target {
+      scan_set_filter_target(ParserState &state, int op)
+        : state(state), op(op) { }
+      void operator()(char const *str, char const *end) const {
+        state.scan.filter_op = op;
+      }
+      ParserState &state;
+      int op;
+    };
+
+    /**
+     * Selects the exact (0), prefix (1) or regex (2) flavor of the
+     * qualifier or value match that is being parsed
+     */
+    struct scan_set_filter_relop {
+      scan_set_filter_relop(ParserState &state, int offset)
+        : state(state), offset(offset) { }
+      void operator()(char const *str, char const *end) const {
+        process();
+      }
+      void operator()(const char c) const {
+        process();
+      }
+      void process() const {
+        state.scan.filter_op = (state.scan.filter_op - 1) / 3 * 3 + 1 + offset;
+      }
+      ParserState &state;
+      int offset;
+    };
+
+    struct scan_add_filter_match {
+      scan_add_filter_match(ParserState &state) : state(state) { }
+      void operator()(char const *str, char const *end) const {
+        String pattern(str, end-str);
+        trim_if(pattern, is_any_of("'\""));
+        state.scan.builder.add_filter(state.scan.filter_op, pattern.c_str());
+        state.scan.filter_op = 0;
+      }
+      ParserState &state;
+    };
+
+    struct scan_add_filter_op {
+      scan_add_filter_op(ParserState &state, int op)
+        : state(state), op(op) { }
+      void operator()(char const *str, char const *end) const {
+        state.scan.builder.add_filter(op);
+      }
+      ParserState &state;
+      int op;
+    };
+
+    /**
+     * The filter predicates of a WHERE clause are ANDed together
+     */
+    struct scan_end_filter_predicate {
+      scan_end_filter_predicate(ParserState &state) : state(state) { }
+      void operator()(char const *str, char const *end) const {
+        if (++state.scan.filter_predicates > 1)
+          state.scan.builder.add_filter(CellPredicate::AND);
+      }
+      ParserState &state;
+    };
+
     struct scan_set_return_deletes {
       scan_set_return_deletes(ParserState &state) : state(state) { }
       void operator()(char const *str, char const *end) const {
@@ -1254,6 +1329,7 @@ namespace Hypertable {
           strlit<>    GE(">=");
           chlit<>     GT('>');
           strlit<>    SW("=^");
+          strlit<>    REGEXMATCH("=~");
           chlit<>     LPAREN('(');
           chlit<>     RPAREN(')');
           chlit<>     LBRACK('[');
@@ -1347,6 +1423,7 @@ namespace Hypertable {
           Token COMMIT       = as_lower_d["commit"];
           Token LOG          = as_lower_d["log"];
           Token BLOOMFILTER  = as_lower_d["bloomfilter"];
+          Token CELLCACHE    = as_lower_d["cellcache"];
           Token TRUE         = as_lower_d["true"];
           Token FALSE        = as_lower_d["false"];
           Token YES          = as_lower_d["yes"];
@@ -1355,6 +1432,9 @@ namespace Hypertable {
           Token AND          = as_lower_d["and"];
           Token OR           = as_lower_d["or"];
           Token LIKE         = as_lower_d["like"];
+          Token NOT          = as_lower_d["not"];
+          Token QUALIFIER    = as_lower_d["qualifier"];
+          Token VALUE        = as_lower_d["value"];
           Token NOESCAPE     = as_lower_d["noescape"];
           Token IDS          = as_lower_d["ids"];
           Token NOKEYS       = as_lower_d["nokeys"];
@@ -1646,6 +1726,8 @@ namespace Hypertable {
             | COMPRESSOR >> EQUAL >> string_literal[
                 set_access_group_compressor(self.state)]
             | bloom_filter_option
+            | CELLCACHE >> EQUAL >> string_literal[
+                set_access_group_cell_cache(self.state)]
             ;
 
           bloom_filter_option
@@ -1715,10 +1797,45 @@ namespace Hypertable {
             | LPAREN >> cell_interval >> *( OR >> cell_interval ) >> RPAREN
             ;
 
+          filter_relop
+            = SW[scan_set_filter_relop(self.state, 1)]
+            | REGEXMATCH[scan_set_filter_relop(self.state, 2)]
+            | EQUAL[scan_set_filter_relop(self.state, 0)]
+            ;
+
+          filter_match
+            = QUALIFIER[scan_set_filter_target(self.state,
+                CellPredicate::QUALIFIER_EXACT)]
+              >> filter_relop
+              >> string_literal[scan_add_filter_match(self.state)]
+            | VALUE[scan_set_filter_target(self.state,
+                CellPredicate::VALUE_EXACT)]
+              >> filter_relop
+              >> string_literal[scan_add_filter_match(self.state)]
+            ;
+
+          filter_primary
+            = filter_match
+            | NOT >> filter_primary[scan_add_filter_op(self.state,
+                CellPredicate::NOT)]
+            | LPAREN >> filter_expression >> RPAREN
+            ;
+
+          filter_conjunction
+            = filter_primary >> *(AND >> filter_primary[
+                scan_add_filter_op(self.state, CellPredicate::AND)])
+            ;
+
+          filter_expression
+            = filter_conjunction >> *(OR >> filter_conjunction[
+                scan_add_filter_op(self.state, CellPredicate::OR)])
+            ;
+
           where_predicate
             = cell_predicate
             | row_predicate
             | time_predicate
+            | filter_primary[scan_end_filter_predicate(self.state)]
             ;
 
           option_spec
@@ -1835,6 +1952,11 @@ namespace Hypertable {
           BOOST_SPIRIT_DEBUG_RULE(cell_interval);
           BOOST_SPIRIT_DEBUG_RULE(cell_predicate);
           BOOST_SPIRIT_DEBUG_RULE(cell_spec);
+          BOOST_SPIRIT_DEBUG_RULE(filter_relop);
+          BOOST_SPIRIT_DEBUG_RULE(filter_match);
+          BOOST_SPIRIT_DEBUG_RULE(filter_primary);
+          BOOST_SPIRIT_DEBUG_RULE(filter_conjunction);
+          BOOST_SPIRIT_DEBUG_RULE(filter_expression);
           BOOST_SPIRIT_DEBUG_RULE(relop);
           BOOST_SPIRIT_DEBUG_RULE(row_interval);
           BOOST_SPIRIT_DEBUG_RULE(row_predicate);
@@ -1900,7 +2022,8 @@ namespace Hypertable {
           close_statement, shutdown_statement, drop_range_statement,
           replay_start_statement, replay_log_statement,
           replay_commit_statement, cell_interval, cell_predicate,
-          cell_spec;
+          cell_spec, filter_relop, filter_match, filter_primary,
+          filter_conjunction, filter_expression;
       };
 
       ParserState &state;
@@ -0,0 +1,375 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Sanjit Jhala (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/MurmurHash.h"
+#include "Common/Time.h"
+
+#include "LoadDataParallel.h"
+
+using namespace Hypertable;
+
+
+LoadDataParallel::Chunk::~Chunk() {
+  foreach(SerializedCellsWriter *writer, partitions)
+    delete writer;
+}
+
+
+LoadDataParallel::LoadDataParallel(TablePtr &table, uint32_t mutator_flags,
+    bool escape, int parse_threads, int mutators, size_t chunk_size)
+  : m_table(table), m_escape(escape),
+    m_parse_threads(parse_threads > 0 ? parse_threads : 1),
+    m_chunk_size(chunk_size), m_next_sequence(0), m_next_dispatch(0),
+    m_chunks(0), m_input_done(false), m_parse_done(false),
+    m_error(Error::OK), m_cells(0), m_keys_size(0), m_values_size(0) {
+
+  if (mutators <= 0)
+    mutators = 1;
+
+  for (int i=0; i<mutators; i++) {
+    MutatorShard *shard = new MutatorShard;
+    shard->mutator = table->create_mutator(0, mutator_flags);
+    m_shards.push_back(shard);
+  }
+
+  // enough chunks to keep every stage busy without buffering the input
+  m_max_chunks = 2 * (m_parse_threads + m_shards.size());
+}
+
+
+LoadDataParallel::~LoadDataParallel() {
+  std::map<uint64_t, Chunk *>::iterator iter;
+
+  // only non-empty after an error
+  foreach(Chunk *chunk, m_parse_queue)
+    delete chunk;
+  for (iter = m_parsed.begin(); iter != m_parsed.end(); ++iter)
+    delete iter->second;
+  foreach(MutatorShard *shard, m_shards) {
+    foreach(Chunk *chunk, shard->queue) {
+      if (--chunk->pending == 0)
+        delete chunk;
+    }
+    delete shard;
+  }
+}
+
+
+void
+LoadDataParallel::load(LoadDataSourcePtr &lds, HqlInterpreter::Callback &cb) {
+  ThreadGroup parse_threads, mutator_threads;
+  std::vector<LoadDataSourcePtr> parsers;
+  boost::xtime start_time, stop_time;
+  uint32_t consumed = 0;
+  Chunk *chunk;
+
+  boost::xtime_get(&start_time, boost::TIME_UTC);
+
+  for (int i=0; i<m_parse_threads; i++) {
+    LoadDataSourceChunk *parser = new LoadDataSourceChunk(*lds);
+    parsers.push_back(parser);
+    parse_threads.create_thread(ParseWorker(this, parser));
+  }
+
+  for (size_t i=0; i<m_shards.size(); i++)
+    mutator_threads.create_thread(MutatorWorker(this, i));
+
+  try {
+    while (true) {
+      {
+        ScopedLock lock(m_mutex);
+        while (m_chunks >= m_max_chunks && m_error == Error::OK)
+          m_reader_cond.wait(lock);
+        if (m_error != Error::OK)
+          break;
+      }
+
+      chunk = new Chunk();
+      if (!lds->next_chunk(m_chunk_size, chunk->text, &chunk->start_line,
+                           &consumed)) {
+        delete chunk;
+        break;
+      }
+
+      if (cb.normal_mode)
+        cb.on_progress(consumed);
+
+      {
+        ScopedLock lock(m_mutex);
+        chunk->sequence = m_next_sequence++;
+        m_chunks++;
+        m_parse_queue.push_back(chunk);
+        m_parse_cond.notify_one();
+      }
+    }
+  }
+  catch (Exception &e) {
+    set_error(e.code(), e.what());
+  }
+
+  {
+    ScopedLock lock(m_mutex);
+    m_input_done = true;
+    m_parse_cond.notify_all();
+  }
+  parse_threads.join_all();
+
+  {
+    ScopedLock lock(m_mutex);
+    m_parse_done = true;
+    foreach(MutatorShard *shard, m_shards)
+      shard->cond.notify_all();
+  }
+  mutator_threads.join_all();
+
+  if (m_error != Error::OK)
+    HT_THROW(m_error, m_error_msg);
+
+  cb.total_cells += m_cells;
+  cb.total_keys_size += m_keys_size;
+  cb.total_values_size += m_values_size;
+  cb.total_resends += get_resend_count();
+
+  boost::xtime_get(&stop_time, boost::TIME_UTC);
+  double elapsed = (double)xtime_diff_millis(start_time, stop_time) / 1000.0;
+
+  HT_INFOF("Loaded %llu cells from %llu chunks with %d parse threads and "
+           "%d mutators in %.2f s (%.2f cells/s, %.2f bytes/s)",
+           (Llu)m_cells, (Llu)m_next_sequence, m_parse_threads,
+           (int)m_shards.size(), elapsed,
+           elapsed ? m_cells / elapsed : 0.0,
+           elapsed ? (m_keys_size + m_values_size) / elapsed : 0.0);
+}
+
+
+uint64_t LoadDataParallel::get_resend_count() {
+  uint64_t resends = 0;
+
+  foreach(MutatorShard *shard, m_shards)
+    resends += shard->mutator->get_resend_count();
+
+  return resends;
+}
+
+
+void LoadDataParallel::parse_loop(LoadDataSourceChunk *parser) {
+  LoadDataEscape escaper;
+  Chunk *chunk;
+
+  while (true) {
+    {
+      ScopedLock lock(m_mutex);
+      while (m_parse_queue.empty() && !m_input_done && m_error == Error::OK)
+        m_parse_cond.wait(lock);
+      if (m_error != Error::OK || m_parse_queue.empty())
+        return;
+      chunk = m_parse_queue.front();
+      m_parse_queue.pop_front();
+    }
+
+    try {
+      parse_chunk(*parser, escaper, chunk);
+    }
+    catch (Exception &e) {
+      delete chunk;
+      set_error(Error::HQL_BAD_LOAD_FILE_FORMAT,
+                format("line number %lld - %s - %s",
+                       (Lld)parser->get_current_lineno(),
+                       Error::get_text(e.code()), e.what()));
+      return;
+    }
+
+    {
+      ScopedLock lock(m_mutex);
+      m_parsed[chunk->sequence] = chunk;
+      dispatch_ready_chunks();
+    }
+  }
+}
+
+
+void LoadDataParallel::parse_chunk(LoadDataSourceChunk &parser,
+    LoadDataEscape &escaper, Chunk *chunk) {
+  KeySpec key;
+  uint8_t *value;
+  uint32_t value_len;
+  const char *escaped_buf;
+  size_t escaped_len;
+  size_t size_hint = chunk->text.fill() / m_shards.size() + 64;
+  Cell cell;
+
+  for (size_t i=0; i<m_shards.size(); i++)
+    chunk->partitions.push_back(new SerializedCellsWriter(size_hint));
+
+  parser.load((const char *)chunk->text.base, chunk->text.fill(),
+              chunk->start_line);
+
+  while (parser.next(0, &key, &value, &value_len, 0)) {
+    if (value_len == 0)
+      continue;
+
+    chunk->cells++;
+    chunk->keys_size += key.row_len;
+    chunk->values_size += value_len;
+
+    if (m_escape)
+      escaper.unescape((const char *)value, (size_t)value_len, &escaped_buf,
+                       &escaped_len);
+    else {
+      escaped_buf = (const char *)value;
+      escaped_len = (size_t)value_len;
+    }
+
+    cell.row_key = (const char *)key.row;
+    cell.column_family = key.column_family;
+    cell.column_qualifier = (const char *)key.column_qualifier;
+    cell.timestamp = key.timestamp;
+    cell.revision = key.revision;
+    cell.value = (const uint8_t *)escaped_buf;
+    cell.value_len = escaped_len;
+    cell.flag = FLAG_INSERT;
+
+    // a row always goes to the same mutator, which preserves its order
+    chunk->partitions[murmurhash2(key.row, key.row_len, 0) % m_shards.size()]
+        ->add(cell);
+  }
+
+  foreach(SerializedCellsWriter *writer, chunk->partitions)
+    writer->finalize();
+
+  chunk->text.free();
+}
+
+
+/**
+ * Hands the parsed chunks to the mutators in input order.  Caller must
+ * hold m_mutex.
+ */
+void LoadDataParallel::dispatch_ready_chunks() {
+  std::map<uint64_t, Chunk *>::iterator iter;
+
+  while ((iter = m_parsed.find(m_next_dispatch)) != m_parsed.end()) {
+    Chunk *chunk = iter->second;
+
+    m_parsed.erase(iter);
+    m_next_dispatch++;
+
+    chunk->pending = m_shards.size();
+    foreach(MutatorShard *shard, m_shards) {
+      shard->queue.push_back(chunk);
+      shard->cond.notify_one();
+    }
+  }
+}
+
+
+void LoadDataParallel::mutate_loop(size_t shard_index) {
+  MutatorShard *shard = m_shards[shard_index];
+  TableMutatorPtr &mutator = shard->mutator;
+  Chunk *chunk = 0;
+  Cells cells;
+
+  try {
+    while (true) {
+      {
+        ScopedLock lock(m_mutex);
+        while (shard->queue.empty() && !m_parse_done && m_error == Error::OK)
+          shard->cond.wait(lock);
+        if (m_error != Error::OK)
+          return;
+        if (shard->queue.empty())
+          break;
+        chunk = shard->queue.front();
+        shard->queue.pop_front();
+      }
+
+      SerializedCellsWriter *writer = chunk->partitions[shard_index];
+
+      if (!writer->empty()) {
+        SerializedCellsReader reader(writer->get_buffer(), writer->size());
+
+        cells.clear();
+        while (reader.next())
+          cells.push_back(reader.get_cell());
+
+        try {
+          mutator->set_cells(cells);
+        }
+        catch (Exception &e) {
+          do {
+            mutator->show_failed(e);
+          } while (!mutator->retry());
+        }
+      }
+
+      release_chunk(chunk);
+      chunk = 0;
+    }
+
+    try {
+      mutator->flush();
+    }
+    catch (Exception &e) {
+      do {
+        mutator->show_failed(e);
+      } while (!mutator->retry());
+    }
+  }
+  catch (Exception &e) {
+    if (chunk)
+      release_chunk(chunk);
+    set_error(e.code(), e.what());
+  }
+}
+
+
+void LoadDataParallel::release_chunk(Chunk *chunk) {
+  ScopedLock lock(m_mutex);
+
+  if (--chunk->pending == 0) {
+    m_cells += chunk->cells;
+    m_keys_size += chunk->keys_size;
+    m_values_size += chunk->values_size;
+    delete chunk;
+    m_chunks--;
+    m_reader_cond.notify_one();
+  }
+}
+
+
+void LoadDataParallel::set_error(int error, const String &msg) {
+  ScopedLock lock(m_mutex);
+
+  if (m_error == Error::OK) {
+    m_error = error;
+    m_error_msg = msg;
+  }
+
+  m_parse_cond.notify_all();
+  m_reader_cond.notify_all();
+  foreach(MutatorShard *shard, m_shards)
+    shard->cond.notify_all();
+}
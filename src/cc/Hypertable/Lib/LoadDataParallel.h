@@ -0,0 +1,152 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Sanjit Jhala (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_LOADDATAPARALLEL_H
+#define HYPERTABLE_LOADDATAPARALLEL_H
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <boost/thread/condition.hpp>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Mutex.h"
+#include "Common/String.h"
+#include "Common/Thread.h"
+
+#include "HqlInterpreter.h"
+#include "LoadDataEscape.h"
+#include "LoadDataSource.h"
+#include "LoadDataSourceChunk.h"
+#include "SerializedCells.h"
+#include "Table.h"
+#include "TableMutator.h"
+
+namespace Hypertable {
+
+  /**
+   * Loads the contents of a LoadDataSource into a table as a pipeline.  The
+   * calling thread reads the input in chunks of whole lines.  A pool of
+   * parse threads, each with its own LoadDataSourceChunk, turns the chunks
+   * into cells and partitions them by row.  Each partition is fed to its own
+   * mutator, running on its own thread.  Chunks are handed to the mutators
+   * in input order and a row always lands in the same partition, so updates
+   * to a cell reach the table in the order in which they appear in the
+   * input, exactly as with a single mutator.
+   */
+  class LoadDataParallel {
+  public:
+    LoadDataParallel(TablePtr &table, uint32_t mutator_flags, bool escape,
+                     int parse_threads, int mutators, size_t chunk_size);
+    ~LoadDataParallel();
+
+    /**
+     * Loads all of the remaining input of the given source and flushes the
+     * mutators.  Progress is reported to cb.on_progress() from the calling
+     * thread and the cell statistics are accumulated into cb.
+     *
+     * @param lds source positioned after its header
+     * @param cb interpreter callback
+     */
+    void load(LoadDataSourcePtr &lds, HqlInterpreter::Callback &cb);
+
+    /** Returns the number of updates resent by all of the mutators */
+    uint64_t get_resend_count();
+
+  private:
+
+    struct Chunk {
+      Chunk() : sequence(0), start_line(0), cells(0), keys_size(0),
+                values_size(0), pending(0) { }
+      ~Chunk();
+      uint64_t sequence;
+      int64_t  start_line;
+      DynamicBuffer text;
+      std::vector<SerializedCellsWriter *> partitions;
+      uint64_t cells;
+      uint64_t keys_size;
+      uint64_t values_size;
+      size_t   pending;     // mutators that have yet to consume the chunk
+    };
+
+    struct MutatorShard {
+      TableMutatorPtr    mutator;
+      std::deque<Chunk *> queue;
+      boost::condition   cond;
+    };
+
+    class ParseWorker {
+    public:
+      ParseWorker(LoadDataParallel *loader, LoadDataSourceChunk *parser)
+        : m_loader(loader), m_parser(parser) { }
+      void operator()() { m_loader->parse_loop(m_parser); }
+    private:
+      LoadDataParallel *m_loader;
+      LoadDataSourceChunk *m_parser;
+    };
+
+    class MutatorWorker {
+    public:
+      MutatorWorker(LoadDataParallel *loader, size_t shard)
+        : m_loader(loader), m_shard(shard) { }
+      void operator()() { m_loader->mutate_loop(m_shard); }
+    private:
+      LoadDataParallel *m_loader;
+      size_t m_shard;
+    };
+
+    void parse_loop(LoadDataSourceChunk *parser);
+    void parse_chunk(LoadDataSourceChunk &parser, LoadDataEscape &escaper,
+                     Chunk *chunk);
+    void mutate_loop(size_t shard);
+    void release_chunk(Chunk *chunk);
+    void dispatch_ready_chunks();
+    void set_error(int error, const String &msg);
+
+    TablePtr          m_table;
+    bool              m_escape;
+    int               m_parse_threads;
+    size_t            m_chunk_size;
+    size_t            m_max_chunks;
+
+    Mutex             m_mutex;
+    boost::condition  m_parse_cond;
+    boost::condition  m_reader_cond;
+    std::deque<Chunk *> m_parse_queue;
+    std::map<uint64_t, Chunk *> m_parsed;
+    std::vector<MutatorShard *> m_shards;
+    uint64_t          m_next_sequence;
+    uint64_t          m_next_dispatch;
+    size_t            m_chunks;
+    bool              m_input_done;
+    bool              m_parse_done;
+    int               m_error;
+    String            m_error_msg;
+
+    uint64_t          m_cells;
+    uint64_t          m_keys_size;
+    uint64_t          m_values_size;
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_LOADDATAPARALLEL_H
@@ -231,6 +231,55 @@ LoadDataSource::parse_header(const String &header, const std::vector<String> &ke
   m_cur_line = 1;
 }
 
+void LoadDataSource::copy_format(const LoadDataSource &other) {
+  HT_ASSERT(other.m_type_mask);
+
+  m_column_info = other.m_column_info;
+  m_key_comps = other.m_key_comps;
+  delete [] m_type_mask;
+  m_type_mask = new uint32_t [257];
+  memcpy(m_type_mask, other.m_type_mask, 257*sizeof(uint32_t));
+  m_hyperformat = other.m_hyperformat;
+  m_leading_timestamps = other.m_leading_timestamps;
+  m_timestamp_index = other.m_timestamp_index;
+  m_dupkeycols = other.m_dupkeycols;
+  m_row_uniquify_chars = other.m_row_uniquify_chars;
+  if (m_row_uniquify_chars && !m_rsgen)
+    m_rsgen = new FixedRandomStringGenerator(m_row_uniquify_chars);
+  m_next_value = m_column_info.size();
+  m_limit = 0;
+  m_cur_line = other.m_cur_line;
+}
+
+
+bool
+LoadDataSource::next_chunk(size_t target, DynamicBuffer &chunk,
+                           int64_t *start_linep, uint32_t *consumedp) {
+  String line;
+
+  chunk.clear();
+  *start_linep = m_cur_line;
+
+  if (consumedp)
+    *consumedp = 0;
+
+  while (chunk.fill() < target && getline(m_fin, line)) {
+    m_cur_line++;
+
+    chunk.ensure(line.length() + 1);
+    chunk.add_unchecked(line.data(), line.length());
+    *chunk.ptr++ = '\n';
+
+    if (consumedp && !m_zipped)
+      *consumedp += line.length() + 1;
+  }
+
+  if (m_zipped && consumedp)
+    *consumedp = incr_consumed();
+
+  return chunk.fill() > 0;
+}
+
 /**
  *
  */
@@ -67,6 +67,20 @@ namespace Hypertable {
 
     int64_t get_current_lineno() { return m_cur_line; }
 
+    /**
+     * Reads whole lines from the input, without parsing them, until at
+     * least target bytes have been collected or the input is exhausted.
+     * The lines can then be parsed by a LoadDataSourceChunk.
+     *
+     * @param target minimum number of bytes to collect
+     * @param chunk receives the lines, each terminated by a newline
+     * @param start_linep receives the number of the line preceding the chunk
+     * @param consumedp receives the number of input bytes consumed
+     * @return false if the input is exhausted
+     */
+    bool next_chunk(size_t target, DynamicBuffer &chunk, int64_t *start_linep,
+                    uint32_t *consumedp);
+
   protected:
 
     virtual void parse_header(const String& header,
@@ -101,6 +115,9 @@ namespace Hypertable {
 
     bool add_row_component(int index);
 
+    /** Takes the column layout parsed from the header of another source */
+    void copy_format(const LoadDataSource &other);
+
     struct ColumnInfo {
       String family;
       String qualifier;
@@ -0,0 +1,44 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Sanjit Jhala (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <boost/iostreams/device/array.hpp>
+
+#include "LoadDataSourceChunk.h"
+
+using namespace Hypertable;
+
+
+LoadDataSourceChunk::LoadDataSourceChunk(const LoadDataSource &format) {
+  copy_format(format);
+}
+
+
+void
+LoadDataSourceChunk::load(const char *buf, size_t len, int64_t start_line) {
+  m_fin.reset();
+  m_fin.clear();
+  m_fin.push(boost::iostreams::array_source(buf, len));
+  m_cur_line = start_line;
+  m_next_value = m_column_info.size();
+  m_limit = 0;
+}
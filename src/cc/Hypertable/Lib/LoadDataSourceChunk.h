@@ -0,0 +1,62 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Sanjit Jhala (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_LOADDATASOURCECHUNK_H
+#define HYPERTABLE_LOADDATASOURCECHUNK_H
+
+#include "LoadDataSource.h"
+
+namespace Hypertable {
+
+  /**
+   * Parses chunks of lines read by LoadDataSource::next_chunk, using the
+   * column layout of the source they were read from.  Each parsing thread
+   * of a parallel load owns one of these, so none of the parse state is
+   * shared between threads.
+   */
+  class LoadDataSourceChunk : public LoadDataSource {
+
+  public:
+    LoadDataSourceChunk(const LoadDataSource &format);
+
+    ~LoadDataSourceChunk() { };
+
+    /**
+     * Positions the source at the start of a chunk.  The chunk must stay
+     * valid until next() returns false.
+     *
+     * @param buf pointer to the lines of the chunk
+     * @param len length of the chunk
+     * @param start_line number of the line preceding the chunk, used for
+     *        error messages
+     */
+    void load(const char *buf, size_t len, int64_t start_line);
+
+    uint64_t incr_consumed() { return 0; }
+
+  protected:
+    String get_header() { return ""; }
+    void init_src() { }
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_LOADDATASOURCECHUNK_H
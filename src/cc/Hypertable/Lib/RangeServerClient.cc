@@ -125,6 +125,36 @@ RangeServerClient::create_scanner(const sockaddr_in &addr,
 }
 
 
+void
+RangeServerClient::get_rows(const sockaddr_in &addr,
+    const TableIdentifier &table, const RangeSpec &range,
+    const ScanSpec &scan_spec, DispatchHandler *handler) {
+  CommBufPtr cbp(RangeServerProtocol::create_request_get_rows(table,
+                 range, scan_spec));
+  send_message(addr, cbp, handler);
+}
+
+
+void
+RangeServerClient::get_rows(const sockaddr_in &addr,
+    const TableIdentifier &table, const RangeSpec &range,
+    const ScanSpec &scan_spec, ScanBlock &scan_block) {
+  DispatchHandlerSynchronizer sync_handler;
+  EventPtr event_ptr;
+  CommBufPtr cbp(RangeServerProtocol::create_request_get_rows(table,
+                 range, scan_spec));
+  send_message(addr, cbp, &sync_handler);
+
+  if (!sync_handler.wait_for_reply(event_ptr))
+    HT_THROW((int)Protocol::response_code(event_ptr),
+             String("RangeServer get_rows() failure : ")
+             + Protocol::string_format_message(event_ptr));
+  else {
+    HT_ASSERT(scan_block.load(event_ptr) == Error::OK);
+  }
+}
+
+
 void
 RangeServerClient::destroy_scanner(const sockaddr_in &addr, int scanner_id,
                                    DispatchHandler *handler) {
@@ -319,6 +349,24 @@ RangeServerClient::drop_range(const sockaddr_in &addr,
 }
 
 
+void
+RangeServerClient::load_cell_stores(const sockaddr_in &addr,
+    const TableIdentifier &table, const RangeSpec &range,
+    const std::vector<String> &access_groups,
+    const std::vector<String> &files) {
+  DispatchHandlerSynchronizer sync_handler;
+  EventPtr event_ptr;
+  CommBufPtr cbp(RangeServerProtocol::create_request_load_cell_stores(table,
+      range, access_groups, files));
+  send_message(addr, cbp, &sync_handler);
+
+  if (!sync_handler.wait_for_reply(event_ptr))
+    HT_THROW((int)Protocol::response_code(event_ptr),
+             String("RangeServer load_cell_stores() failure : ")
+             + Protocol::string_format_message(event_ptr));
+}
+
+
 void
 RangeServerClient::send_message(const sockaddr_in &addr, CommBufPtr &cbp,
                                 DispatchHandler *handler) {
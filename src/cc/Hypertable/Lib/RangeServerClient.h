@@ -144,6 +144,35 @@ namespace Hypertable {
                         const RangeSpec &range, const ScanSpec &scan_spec,
                         ScanBlock &scan_block);
 
+    /** Issues a "get rows" request asynchronously.  The response has the
+     * same layout as a "create scanner" response and can be loaded into a
+     * ScanBlock.  The response is capped at the block size of the scan
+     * specification and only holds whole rows; if it stops short of the
+     * last row, ScanBlock::eos() is false and ScanBlock::get_scanner_id()
+     * returns the number of leading rows it holds.
+     *
+     * @param addr remote address of RangeServer connection
+     * @param table table identifier
+     * @param range range specification
+     * @param scan_spec scan specification with one interval per row
+     * @param handler response handler
+     */
+    void get_rows(const sockaddr_in &addr, const TableIdentifier &table,
+                  const RangeSpec &range, const ScanSpec &scan_spec,
+                  DispatchHandler *handler);
+
+    /** Issues a "get rows" request.
+     *
+     * @param addr remote address of RangeServer connection
+     * @param table table identifier
+     * @param range range specification
+     * @param scan_spec scan specification with one interval per row
+     * @param scan_block block of return key/value pairs
+     */
+    void get_rows(const sockaddr_in &addr, const TableIdentifier &table,
+                  const RangeSpec &range, const ScanSpec &scan_spec,
+                  ScanBlock &scan_block);
+
     /** Issues a "destroy scanner" request asynchronously.
      *
      * @param addr remote address of RangeServer connection
@@ -291,6 +320,21 @@ namespace Hypertable {
     void drop_range(const sockaddr_in &addr, const TableIdentifier &table,
                     const RangeSpec &range, DispatchHandler *handler);
 
+    /** Issues a synchronous "load cell stores" request.  The RangeServer
+     * adds the given CellStore files to the range and records them in the
+     * 'Files' column of METADATA.
+     *
+     * @param addr remote address of RangeServer connection
+     * @param table table identifier
+     * @param range range specification
+     * @param access_groups access group of each file
+     * @param files CellStore files to load
+     */
+    void load_cell_stores(const sockaddr_in &addr, const TableIdentifier &table,
+                          const RangeSpec &range,
+                          const std::vector<String> &access_groups,
+                          const std::vector<String> &files);
+
   private:
 
     void send_message(const sockaddr_in &addr, CommBufPtr &cbp,
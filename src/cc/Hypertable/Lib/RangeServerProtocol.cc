@@ -49,6 +49,8 @@ namespace Hypertable {
     "update schema",
     "commit log sync",
     "close",
+    "load cell stores",
+    "get rows",
     (const char *)0
   };
 
@@ -120,6 +122,18 @@ namespace Hypertable {
     return cbuf;
   }
 
+  CommBuf *RangeServerProtocol::
+  create_request_get_rows(const TableIdentifier &table,
+      const RangeSpec &range, const ScanSpec &scan_spec) {
+    CommHeader header(COMMAND_GET_ROWS);
+    CommBuf *cbuf = new CommBuf(header, table.encoded_length()
+        + range.encoded_length() + scan_spec.encoded_length());
+    table.encode(cbuf->get_data_ptr_address());
+    range.encode(cbuf->get_data_ptr_address());
+    scan_spec.encode(cbuf->get_data_ptr_address());
+    return cbuf;
+  }
+
   CommBuf *RangeServerProtocol::create_request_destroy_scanner(int scanner_id) {
     CommHeader header(COMMAND_DESTROY_SCANNER);
     header.gid = scanner_id;
@@ -220,6 +234,30 @@ namespace Hypertable {
     return cbuf;
   }
 
+  CommBuf *RangeServerProtocol::create_request_load_cell_stores(
+      const TableIdentifier &table, const RangeSpec &range,
+      const std::vector<String> &access_groups,
+      const std::vector<String> &files) {
+    CommHeader header(COMMAND_LOAD_CELL_STORES);
+    size_t len = table.encoded_length() + range.encoded_length() + 4;
+
+    HT_ASSERT(access_groups.size() == files.size());
+
+    for (size_t i=0; i<files.size(); i++)
+      len += encoded_length_vstr(access_groups[i])
+             + encoded_length_vstr(files[i]);
+
+    CommBuf *cbuf = new CommBuf(header, len);
+    table.encode(cbuf->get_data_ptr_address());
+    range.encode(cbuf->get_data_ptr_address());
+    cbuf->append_i32(files.size());
+    for (size_t i=0; i<files.size(); i++) {
+      cbuf->append_vstr(access_groups[i]);
+      cbuf->append_vstr(files[i]);
+    }
+    return cbuf;
+  }
+
   CommBuf *RangeServerProtocol::create_request_get_statistics() {
     CommHeader header(COMMAND_GET_STATISTICS);
     header.flags |= CommHeader::FLAGS_BIT_URGENT;
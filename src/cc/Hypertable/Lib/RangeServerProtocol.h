@@ -22,6 +22,8 @@
 #ifndef HYPERTABLE_RANGESERVERPROTOCOL_H
 #define HYPERTABLE_RANGESERVERPROTOCOL_H
 
+#include <vector>
+
 #include "AsyncComm/Protocol.h"
 
 #include "RangeState.h"
@@ -53,7 +55,9 @@ namespace Hypertable {
     static const uint64_t COMMAND_UPDATE_SCHEMA     = 16;
     static const uint64_t COMMAND_COMMIT_LOG_SYNC   = 17;
     static const uint64_t COMMAND_CLOSE             = 18;
-    static const uint64_t COMMAND_MAX               = 19;
+    static const uint64_t COMMAND_LOAD_CELL_STORES  = 19;
+    static const uint64_t COMMAND_GET_ROWS          = 20;
+    static const uint64_t COMMAND_MAX               = 21;
 
     static const char *m_command_strings[];
 
@@ -122,6 +126,18 @@ namespace Hypertable {
     static CommBuf *create_request_create_scanner(const TableIdentifier &table,
         const RangeSpec &range, const ScanSpec &scan_spec);
 
+    /** Creates a "get rows" request message.  Each row interval of the
+     * scan specification must name a single row and the intervals must be
+     * sorted.
+     *
+     * @param table table identifier
+     * @param range range specification
+     * @param scan_spec scan specification
+     * @return protocol message
+     */
+    static CommBuf *create_request_get_rows(const TableIdentifier &table,
+        const RangeSpec &range, const ScanSpec &scan_spec);
+
     /** Creates a "destroy scanner" request message.
      *
      * @param scanner_id scanner ID returned from a "create scanner" request
@@ -207,6 +223,20 @@ namespace Hypertable {
     static CommBuf *create_request_drop_range(const TableIdentifier &table,
                                               const RangeSpec &range);
 
+    /** Creates a "load cell stores" request message.
+     *
+     * @param table table identifier
+     * @param range range specification
+     * @param access_groups access group of each file
+     * @param files CellStore files to add to the range
+     * @return protocol message
+     */
+    static CommBuf *
+    create_request_load_cell_stores(const TableIdentifier &table,
+                                    const RangeSpec &range,
+                                    const std::vector<String> &access_groups,
+                                    const std::vector<String> &files);
+
     /** Creates a "get statistics" request message.
      *
      * @return protocol message
@@ -77,6 +77,23 @@ void CellInterval::decode(const uint8_t **bufp, size_t *remainp) {
     end_inclusive = decode_bool(bufp, remainp));
 }
 
+size_t CellPredicate::encoded_length() const {
+  return 1 + (is_match() ? encoded_length_vstr(pattern) : 0);
+}
+
+void CellPredicate::encode(uint8_t **bufp) const {
+  encode_i8(bufp, op);
+  if (is_match())
+    encode_vstr(bufp, pattern);
+}
+
+
+void CellPredicate::decode(const uint8_t **bufp, size_t *remainp) {
+  HT_TRY("decoding cell predicate",
+    op = decode_i8(bufp, remainp);
+    pattern = is_match() ? decode_vstr(bufp, remainp) : 0);
+}
+
 size_t ScanSpec::encoded_length() const {
   size_t len = encoded_length_vi32(row_limit) +
                encoded_length_vi32(max_versions) +
@@ -86,7 +103,15 @@ size_t ScanSpec::encoded_length() const {
   foreach(const char *c, columns) len += encoded_length_vstr(c);
   foreach(const RowInterval &ri, row_intervals) len += ri.encoded_length();
   foreach(const CellInterval &ci, cell_intervals) len += ci.encoded_length();
-  return len + 8 + 8 + 2;
+  size_t ext_len = encoded_extensions_length();
+  return len + 8 + 8 + 2 + encoded_length_vi32(ext_len) + ext_len;
+}
+
+size_t ScanSpec::encoded_extensions_length() const {
+  size_t len = encoded_length_vi32(block_size)
+      + encoded_length_vi32(filter.size());
+  foreach(const CellPredicate &cp, filter) len += cp.encoded_length();
+  return len;
 }
 
 void ScanSpec::encode(uint8_t **bufp) const {
@@ -102,11 +127,16 @@ void ScanSpec::encode(uint8_t **bufp) const {
   encode_i64(bufp, time_interval.second);
   encode_bool(bufp, return_deletes);
   encode_bool(bufp, keys_only);
+  encode_vi32(bufp, encoded_extensions_length());
+  encode_vi32(bufp, block_size);
+  encode_vi32(bufp, filter.size());
+  foreach(const CellPredicate &cp, filter) cp.encode(bufp);
 }
 
 void ScanSpec::decode(const uint8_t **bufp, size_t *remainp) {
   RowInterval ri;
   CellInterval ci;
+  CellPredicate cp;
   HT_TRY("decoding scan spec",
     row_limit = decode_vi32(bufp, remainp);
     max_versions = decode_vi32(bufp, remainp);
@@ -124,6 +154,35 @@ void ScanSpec::decode(const uint8_t **bufp, size_t *remainp) {
     time_interval.second = decode_i64(bufp, remainp);
     return_deletes = decode_i8(bufp, remainp);
     keys_only = decode_i8(bufp, remainp));
+
+  block_size = 0;
+  filter.clear();
+
+  // Peers that predate the extension block end the spec here
+  if (*remainp == 0)
+    return;
+
+  size_t ext_len;
+  HT_TRY("decoding scan spec extensions",
+    ext_len = decode_vi32(bufp, remainp));
+  if (ext_len > *remainp)
+    HT_THROWF(Error::PROTOCOL_ERROR, "Scan spec extension length %u exceeds "
+              "the %u bytes remaining", (unsigned)ext_len, (unsigned)*remainp);
+
+  // Extensions this side does not know about are skipped
+  const uint8_t *ext_end = *bufp + ext_len;
+  size_t ext_remain = ext_len;
+  HT_TRY("decoding scan spec extensions",
+    if (ext_remain)
+      block_size = decode_vi32(bufp, &ext_remain);
+    if (ext_remain) {
+      for (size_t ncp = decode_vi32(bufp, &ext_remain); ncp--;) {
+        cp.decode(bufp, &ext_remain);
+        filter.push_back(cp);
+      }
+    });
+  *bufp = ext_end;
+  *remainp -= ext_len;
 }
 
 
@@ -172,11 +231,29 @@ ostream &Hypertable::operator<<(ostream &os, const CellInterval &ci) {
 }
 
 
+ostream &Hypertable::operator<<(ostream &os, const CellPredicate &cp) {
+  switch (cp.op) {
+  case CellPredicate::QUALIFIER_EXACT:  os << "qualifier = ";   break;
+  case CellPredicate::QUALIFIER_PREFIX: os << "qualifier =^ ";  break;
+  case CellPredicate::QUALIFIER_REGEX:  os << "qualifier =~ ";  break;
+  case CellPredicate::VALUE_EXACT:      os << "value = ";       break;
+  case CellPredicate::VALUE_PREFIX:     os << "value =^ ";      break;
+  case CellPredicate::VALUE_REGEX:      os << "value =~ ";      break;
+  case CellPredicate::AND:              return os << "AND";
+  case CellPredicate::OR:               return os << "OR";
+  case CellPredicate::NOT:              return os << "NOT";
+  default:                              return os << "op " << (int)cp.op;
+  }
+  return os << "\"" << cp.pattern << "\"";
+}
+
+
 ostream &Hypertable::operator<<(ostream &os, const ScanSpec &scan_spec) {
   os <<"\n{ScanSpec: row_limit="<< scan_spec.row_limit
      <<" max_versions="<< scan_spec.max_versions
      <<" return_deletes="<< scan_spec.return_deletes
-     <<" keys_only="<< scan_spec.keys_only;
+     <<" keys_only="<< scan_spec.keys_only
+     <<" block_size="<< scan_spec.block_size;
 
   if (!scan_spec.row_intervals.empty()) {
     os << "\n rows=";
@@ -194,6 +271,12 @@ ostream &Hypertable::operator<<(ostream &os, const ScanSpec &scan_spec) {
       os <<"'"<< c << "' ";
     os <<')';
   }
+  if (!scan_spec.filter.empty()) {
+    os << "\n filter=(";
+    foreach (const CellPredicate &cp, scan_spec.filter)
+      os << cp << " ";
+    os <<')';
+  }
   os <<"\n time_interval=(" << scan_spec.time_interval.first <<", "
      << scan_spec.time_interval.second <<")\n}\n";
 
@@ -207,10 +290,14 @@ ScanSpecBuilder::ScanSpecBuilder(const ScanSpec &ss) {
   set_time_interval(ss.time_interval.first, ss.time_interval.second);
   set_return_deletes(ss.return_deletes);
   set_keys_only(ss.keys_only);
+  set_block_size(ss.block_size);
 
   foreach(const char *c, ss.columns)
     add_column(c);
 
+  foreach(const CellPredicate &cp, ss.filter)
+    add_filter(cp.op, cp.pattern);
+
   foreach(const RowInterval &ri, ss.row_intervals)
     add_row_interval(ri.start, ri.start_inclusive,
                      ri.end, ri.end_inclusive);
@@ -89,19 +89,72 @@ namespace Hypertable {
   };
 
 
+  /**
+   * Represents one term of a cell filter expression.  A filter is a sequence
+   * of terms in postfix order: each match term tests the column qualifier or
+   * the value of a cell against its pattern, and the AND, OR and NOT terms
+   * combine the results of the preceding terms.  For example, "qualifier
+   * starts with 'a' and value is not 'x'" is
+   * QUALIFIER_PREFIX('a') VALUE_EXACT('x') NOT AND.  Regular expressions are
+   * POSIX extended.  c-string data members are not managed so caller must
+   * handle (de)allocation.
+   */
+  class CellPredicate {
+  public:
+    enum {
+      QUALIFIER_EXACT  = 1,
+      QUALIFIER_PREFIX = 2,
+      QUALIFIER_REGEX  = 3,
+      VALUE_EXACT      = 4,
+      VALUE_PREFIX     = 5,
+      VALUE_REGEX      = 6,
+      AND              = 7,
+      OR               = 8,
+      NOT              = 9
+    };
+    CellPredicate() : op(0), pattern(0) { }
+    CellPredicate(uint8_t op, const char *pattern=0)
+      : op(op), pattern(pattern) { }
+    CellPredicate(const uint8_t **bufp, size_t *remainp) {
+      decode(bufp, remainp);
+    }
+
+    /** Returns true if this term tests a cell rather than combining terms */
+    bool is_match() const { return op >= QUALIFIER_EXACT && op <= VALUE_REGEX; }
+
+    size_t encoded_length() const;
+    void encode(uint8_t **bufp) const;
+    void decode(const uint8_t **bufp, size_t *remainp);
+
+    uint8_t op;
+    const char *pattern;
+  };
+
+
   /**
    * Represents a scan predicate.
+   *
+   * The serialized form is the 0.9.2 layout, ending with keys_only,
+   * followed by an extension block: the vi32 length of the block, then
+   * block_size (vi32) and the filter (vi32 term count and the terms).  A
+   * spec that ends after keys_only decodes with no block size and no
+   * filter, and extension fields past the ones known to the decoder are
+   * skipped, so clients and servers of different versions can talk to
+   * each other.  A ScanSpec is always the last field of the requests that
+   * carry it (CREATE_SCANNER and GET_ROWS).  New fields must be appended
+   * to the extension block.
    */
   class ScanSpec {
   public:
     ScanSpec() : row_limit(0), max_versions(0),
                  time_interval(TIMESTAMP_MIN, TIMESTAMP_MAX),
-                 return_deletes(false), keys_only(false) { }
+                 return_deletes(false), keys_only(false), block_size(0) { }
     ScanSpec(const uint8_t **bufp, size_t *remainp) { decode(bufp, remainp); }
 
     size_t encoded_length() const;
     void encode(uint8_t **bufp) const;
     void decode(const uint8_t **bufp, size_t *remainp);
+    size_t encoded_extensions_length() const;
 
     void clear() {
       row_limit = 0;
@@ -113,6 +166,8 @@ namespace Hypertable {
       time_interval.second = TIMESTAMP_MAX;
       keys_only = false;
       return_deletes = false;
+      block_size = 0;
+      filter.clear();
     }
 
     /** Initialize 'other' ScanSpec with this copy sans the intervals */
@@ -123,6 +178,8 @@ namespace Hypertable {
       other.time_interval = time_interval;
       other.keys_only = keys_only;
       other.return_deletes = return_deletes;
+      other.block_size = block_size;
+      other.filter = filter;
       other.row_intervals.clear();
       other.cell_intervals.clear();
     }
@@ -135,6 +192,8 @@ namespace Hypertable {
       std::swap(time_interval, ss.time_interval);
       std::swap(return_deletes, ss.return_deletes);
       std::swap(keys_only, ss.keys_only);
+      std::swap(block_size, ss.block_size);
+      filter.swap(ss.filter);
     }
 
     int32_t row_limit;
@@ -145,6 +204,8 @@ namespace Hypertable {
     std::pair<int64_t,int64_t> time_interval;
     bool return_deletes;
     bool keys_only;
+    uint32_t block_size;
+    std::vector<CellPredicate> filter;
   };
 
   /**
@@ -284,6 +345,35 @@ namespace Hypertable {
       m_scan_spec.keys_only = val;
     }
 
+    /**
+     * Sets the initial size of the blocks of cells returned by the range
+     * servers for this scan.  The server grows the block size for scans that
+     * keep fetching, so this mostly matters for short scans.  A value of 0
+     * selects the server default.
+     *
+     * @param n block size in bytes
+     */
+    void set_block_size(uint32_t n) { m_scan_spec.block_size = n; }
+
+    /**
+     * Appends a term to the cell filter expression.  The range servers drop
+     * the cells that do not satisfy the filter before returning them, after
+     * deletes are applied but before the version and row limits are, so
+     * MAX_VERSIONS keeps the most recent versions that match.
+     *
+     * @param op one of the CellPredicate operators
+     * @param pattern pattern of a match term, ignored for AND, OR and NOT
+     */
+    void add_filter(uint8_t op, const char *pattern = 0) {
+      CellPredicate cp(op);
+      if (cp.is_match())
+        cp.pattern = m_alloc.dup(pattern ? pattern : "");
+      else if (op < CellPredicate::AND || op > CellPredicate::NOT)
+        HT_THROWF(Error::BAD_SCAN_SPEC, "Bad cell filter operator %d",
+                  (int)op);
+      m_scan_spec.filter.push_back(cp);
+    }
+
     /**
      * Internal use only.
      */
@@ -323,6 +413,8 @@ namespace Hypertable {
 
   std::ostream &operator<<(std::ostream &os, const CellInterval &ci);
 
+  std::ostream &operator<<(std::ostream &os, const CellPredicate &cp);
+
   std::ostream &operator<<(std::ostream &os, const ScanSpec &scan_spec);
 
 } // namespace Hypertable
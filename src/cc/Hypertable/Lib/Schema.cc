@@ -145,6 +145,7 @@ Schema::Schema(const Schema &src_schema)
     ag->blocksize = src_ag->blocksize;
     ag->compressor = src_ag->compressor;
     ag->bloom_filter = src_ag->bloom_filter;
+    ag->cell_cache = src_ag->cell_cache;
 
     m_access_group_map.insert(make_pair(ag->name, ag));
     m_access_groups.push_back(ag);
@@ -273,6 +274,15 @@ void Schema::validate_bloom_filter(const String &bloom_filter) {
 }
 
 
+void Schema::validate_cell_cache(const String &cell_cache) {
+  if (cell_cache.empty() || cell_cache == "map" || cell_cache == "skiplist")
+    return;
+
+  set_error_string((String)"Invalid cell cache type '" + cell_cache
+                   + "' (must be 'map' or 'skiplist')");
+}
+
+
 /**
  */
 void Schema::start_element_handler(void *userdata,
@@ -458,6 +468,11 @@ void Schema::set_access_group_parameter(const char *param, const char *value) {
       boost::trim(m_open_access_group->bloom_filter);
       validate_bloom_filter(m_open_access_group->bloom_filter);
     }
+    else if (!strcasecmp(param, "cellCache")) {
+      m_open_access_group->cell_cache = value;
+      boost::trim(m_open_access_group->cell_cache);
+      validate_cell_cache(m_open_access_group->cell_cache);
+    }
     else
       set_error_string((string)"Invalid AccessGroup attribute '" + param + "'");
   }
@@ -553,6 +568,9 @@ void Schema::render(String &output, bool with_ids) {
     if (ag->bloom_filter != "")
       output += (String)" bloomFilter=\"" + ag->bloom_filter + "\"";
 
+    if (ag->cell_cache != "")
+      output += (String)" cellCache=\"" + ag->cell_cache + "\"";
+
     output += ">\n";
 
     foreach(const ColumnFamily *cf, ag->columns) {
@@ -640,6 +658,9 @@ void Schema::render_hql_create_table(const String &table_name, String &output) {
       ag_string += format(" BLOOMFILTER=\"%s\"",
           ag->bloom_filter.c_str());
 
+    if (ag->cell_cache != "")
+      ag_string += format(" CELLCACHE=\"%s\"", ag->cell_cache.c_str());
+
     if (!ag->columns.empty()) {
       bool display_comma = false;
       ag_string += " (";
@@ -0,0 +1,166 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+
+#include "Common/Error.h"
+#include "Common/Serialization.h"
+
+#include "SerializedCells.h"
+
+using namespace Hypertable;
+using namespace Hypertable::Serialization;
+
+namespace {
+
+  const char *decode_cstr(const uint8_t **bufp, size_t *remainp) {
+    const uint8_t *end = (const uint8_t *)memchr(*bufp, 0, *remainp);
+    const char *str = (const char *)*bufp;
+
+    if (end == 0)
+      HT_THROW(Error::SERIALIZATION_INPUT_OVERRUN,
+               "Unterminated string in serialized cells");
+
+    *remainp -= (end + 1) - *bufp;
+    *bufp = end + 1;
+    return str;
+  }
+
+}
+
+
+SerializedCellsWriter::SerializedCellsWriter(size_t size_hint)
+  : m_buf(size_hint ? size_hint : 4), m_count(0), m_finalized(false) {
+  encode_i32(&m_buf.ptr, SerializedCells::VERSION);
+}
+
+
+void SerializedCellsWriter::add(const Cell &cell) {
+  const char *row = cell.row_key ? cell.row_key : "";
+  const char *family = cell.column_family ? cell.column_family : "";
+  const char *qualifier = cell.column_qualifier ? cell.column_qualifier : "";
+  size_t row_len = strlen(row);
+  size_t family_len = strlen(family);
+  size_t qualifier_len = strlen(qualifier);
+  uint8_t flags = 0;
+
+  HT_ASSERT(!m_finalized);
+
+  if (cell.timestamp != (uint64_t)AUTO_ASSIGN)
+    flags |= SerializedCells::HAVE_TIMESTAMP;
+  if (cell.revision != (uint64_t)AUTO_ASSIGN)
+    flags |= SerializedCells::HAVE_REVISION;
+
+  if (m_count && row_len == m_previous_row.length()
+      && !memcmp(row, m_previous_row.data(), row_len))
+    row_len = 0;
+  else
+    m_previous_row = row;
+
+  m_buf.ensure(1 + 8 + 8 + row_len + family_len + qualifier_len + 3 + 4
+               + cell.value_len + 1);
+
+  encode_i8(&m_buf.ptr, flags);
+  if (flags & SerializedCells::HAVE_TIMESTAMP)
+    encode_i64(&m_buf.ptr, cell.timestamp);
+  if (flags & SerializedCells::HAVE_REVISION)
+    encode_i64(&m_buf.ptr, cell.revision);
+  m_buf.add_unchecked(row, row_len);
+  *m_buf.ptr++ = 0;
+  m_buf.add_unchecked(family, family_len + 1);
+  m_buf.add_unchecked(qualifier, qualifier_len + 1);
+  encode_i32(&m_buf.ptr, cell.value_len);
+  if (cell.value_len)
+    m_buf.add_unchecked(cell.value, cell.value_len);
+  encode_i8(&m_buf.ptr, cell.flag);
+  m_count++;
+}
+
+
+void SerializedCellsWriter::finalize() {
+  if (!m_finalized) {
+    m_buf.ensure(1);
+    encode_i8(&m_buf.ptr, SerializedCells::END_OF_BLOCK);
+    m_finalized = true;
+  }
+}
+
+
+void SerializedCellsWriter::clear() {
+  m_buf.clear();
+  encode_i32(&m_buf.ptr, SerializedCells::VERSION);
+  m_previous_row.clear();
+  m_count = 0;
+  m_finalized = false;
+}
+
+
+SerializedCellsReader::SerializedCellsReader(const void *buf, size_t len)
+  : m_ptr((const uint8_t *)buf), m_remaining(len), m_previous_row(""),
+    m_eob(false) {
+  uint32_t version = decode_i32(&m_ptr, &m_remaining);
+
+  if (version != SerializedCells::VERSION)
+    HT_THROWF(Error::PROTOCOL_ERROR, "Unsupported serialized cells version "
+              "%u", (unsigned)version);
+}
+
+
+bool SerializedCellsReader::next() {
+  uint8_t flags;
+
+  if (m_eob)
+    return false;
+
+  flags = decode_i8(&m_ptr, &m_remaining);
+
+  if (flags & SerializedCells::END_OF_BLOCK) {
+    m_eob = true;
+    return false;
+  }
+
+  m_cell.timestamp = (flags & SerializedCells::HAVE_TIMESTAMP)
+      ? decode_i64(&m_ptr, &m_remaining) : AUTO_ASSIGN;
+  m_cell.revision = (flags & SerializedCells::HAVE_REVISION)
+      ? decode_i64(&m_ptr, &m_remaining) : AUTO_ASSIGN;
+
+  m_cell.row_key = decode_cstr(&m_ptr, &m_remaining);
+  if (*m_cell.row_key == 0)
+    m_cell.row_key = m_previous_row;
+  else
+    m_previous_row = m_cell.row_key;
+
+  m_cell.column_family = decode_cstr(&m_ptr, &m_remaining);
+  m_cell.column_qualifier = decode_cstr(&m_ptr, &m_remaining);
+
+  m_cell.value_len = decode_i32(&m_ptr, &m_remaining);
+  if (m_cell.value_len > m_remaining)
+    HT_THROW(Error::SERIALIZATION_INPUT_OVERRUN,
+             "Value extends past end of serialized cells");
+  m_cell.value = m_ptr;
+  m_ptr += m_cell.value_len;
+  m_remaining -= m_cell.value_len;
+
+  m_cell.flag = decode_i8(&m_ptr, &m_remaining);
+
+  return true;
+}
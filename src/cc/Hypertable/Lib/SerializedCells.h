@@ -0,0 +1,105 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_SERIALIZEDCELLS_H
+#define HYPERTABLE_SERIALIZEDCELLS_H
+
+#include "Common/DynamicBuffer.h"
+#include "Common/String.h"
+
+#include "Cell.h"
+
+namespace Hypertable {
+
+  /**
+   * Compact encoding of a sequence of cells as a single byte string, used
+   * to move cells in bulk between the ThriftBroker and its clients.  All
+   * integers are little endian.
+   *
+   * <pre>
+   *   block := version:i32 cell* terminator
+   *   cell  := flags:u8 [timestamp:i64] [revision:i64]
+   *            row '\0' column_family '\0' column_qualifier '\0'
+   *            value_length:i32 value cell_flag:u8
+   *   terminator := END_OF_BLOCK:u8
+   * </pre>
+   *
+   * The timestamp and revision are only present if the corresponding flag
+   * is set, otherwise they are AUTO_ASSIGN.  An empty row means the cell
+   * has the same row as the previous cell.
+   */
+  namespace SerializedCells {
+    enum {
+      VERSION        = 1,
+      HAVE_TIMESTAMP = 0x01,
+      HAVE_REVISION  = 0x02,
+      END_OF_BLOCK   = 0x80
+    };
+  }
+
+  class SerializedCellsWriter {
+  public:
+    SerializedCellsWriter(size_t size_hint = 0);
+
+    void add(const Cell &cell);
+
+    /** Appends the terminator, after which no more cells can be added */
+    void finalize();
+
+    bool empty() const { return m_count == 0; }
+    size_t count() const { return m_count; }
+    size_t size() const { return m_buf.fill(); }
+    const uint8_t *get_buffer() const { return m_buf.base; }
+
+    void clear();
+
+  private:
+    DynamicBuffer m_buf;
+    String        m_previous_row;
+    size_t        m_count;
+    bool          m_finalized;
+  };
+
+  class SerializedCellsReader {
+  public:
+    SerializedCellsReader(const void *buf, size_t len);
+
+    /**
+     * Decodes the next cell.  The decoded cell points into the buffer
+     * passed to the constructor.
+     *
+     * @return false once the terminator has been reached
+     */
+    bool next();
+
+    const Cell &get_cell() const { return m_cell; }
+
+  private:
+    const uint8_t *m_ptr;
+    size_t         m_remaining;
+    const char    *m_previous_row;
+    Cell           m_cell;
+    bool           m_eob;
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_SERIALIZEDCELLS_H
@@ -64,13 +64,36 @@ void RangeStat::decode(const uint8_t **bufp, size_t *remainp) {
     memory_usage = decode_i64(bufp, remainp));
 }
 
+void BlockCacheStat::encode(uint8_t **bufp) const {
+  encode_i64(bufp, hits);
+  encode_i64(bufp, misses);
+  encode_i64(bufp, evictions);
+  encode_i64(bufp, memory_used);
+}
+
+void BlockCacheStat::decode(const uint8_t **bufp, size_t *remainp) {
+  HT_TRY("decoding block cache statistics",
+    hits = decode_i64(bufp, remainp);
+    misses = decode_i64(bufp, remainp);
+    evictions = decode_i64(bufp, remainp);
+    memory_used = decode_i64(bufp, remainp));
+}
+
 size_t RangeServerStat::encoded_length() const {
-  size_t length = 28;
+  size_t length = 28 + 48 + 8 + 24 + 8;
 
   for (size_t i = 0; i < range_stats.size(); ++i) {
     length += range_stats[i].encoded_length();
   }
 
+  for (size_t i = 0; i < block_cache_stats.size(); ++i) {
+    length += block_cache_stats[i].encoded_length();
+  }
+
+  for (size_t i = 0; i < compressed_block_cache_stats.size(); ++i) {
+    length += compressed_block_cache_stats[i].encoded_length();
+  }
+
   return length;
 }
 
@@ -80,6 +103,30 @@ void RangeServerStat::encode(uint8_t **bufp) const {
   for (size_t i = 0; i < range_stats.size(); ++i) {
     range_stats[i].encode(bufp);
   }
+
+  encode_i64(bufp, group_commit_batches);
+  encode_i64(bufp, group_commit_requests);
+  encode_i64(bufp, group_commit_bytes);
+  encode_i64(bufp, group_commit_max_batch);
+  encode_i64(bufp, group_commit_latency);
+  encode_i64(bufp, group_commit_max_latency);
+
+  encode_i32(bufp, block_cache_stats.size());
+
+  for (size_t i = 0; i < block_cache_stats.size(); ++i) {
+    block_cache_stats[i].encode(bufp);
+  }
+
+  encode_i32(bufp, compressed_block_cache_stats.size());
+
+  for (size_t i = 0; i < compressed_block_cache_stats.size(); ++i) {
+    compressed_block_cache_stats[i].encode(bufp);
+  }
+
+  encode_i64(bufp, scan_blocks);
+  encode_i64(bufp, scan_block_bytes);
+  encode_i64(bufp, scan_max_block_size);
+  encode_i64(bufp, request_backlog);
 }
 
 void RangeServerStat::decode(const uint8_t **bufp, size_t *remainp) {
@@ -91,6 +138,32 @@ void RangeServerStat::decode(const uint8_t **bufp, size_t *remainp) {
   for (size_t i = 0; i < n; ++i) {
     range_stats.push_back(RangeStat(bufp, remainp));
   }
+
+  HT_TRY("decoding range server statistics",
+    group_commit_batches = decode_i64(bufp, remainp);
+    group_commit_requests = decode_i64(bufp, remainp);
+    group_commit_bytes = decode_i64(bufp, remainp);
+    group_commit_max_batch = decode_i64(bufp, remainp);
+    group_commit_latency = decode_i64(bufp, remainp);
+    group_commit_max_latency = decode_i64(bufp, remainp);
+    n = decode_i32(bufp, remainp));
+
+  for (size_t i = 0; i < n; ++i) {
+    block_cache_stats.push_back(BlockCacheStat(bufp, remainp));
+  }
+
+  HT_TRY("decoding range server statistics",
+    n = decode_i32(bufp, remainp));
+
+  for (size_t i = 0; i < n; ++i) {
+    compressed_block_cache_stats.push_back(BlockCacheStat(bufp, remainp));
+  }
+
+  HT_TRY("decoding range server statistics",
+    scan_blocks = decode_i64(bufp, remainp);
+    scan_block_bytes = decode_i64(bufp, remainp);
+    scan_max_block_size = decode_i64(bufp, remainp);
+    request_backlog = decode_i64(bufp, remainp));
 }
 
 ostream &Hypertable::operator<<(ostream &os, const RangeStat &stat) {
@@ -109,6 +182,13 @@ ostream &Hypertable::operator<<(ostream &os, const RangeStat &stat) {
   return os;
 }
 
+ostream &Hypertable::operator<<(ostream &os, const BlockCacheStat &stat) {
+  os << "{hits = " << stat.hits << "  misses = " << stat.misses
+     << "  evictions = " << stat.evictions
+     << "  memory_used = " << stat.memory_used << "}";
+  return os;
+}
+
 ostream &Hypertable::operator<<(ostream &os, const RangeServerStat &stat) {
   os << "{RangeServerStat: range_stats_number = " << stat.range_stats.size()
      <<'\n';
@@ -116,6 +196,32 @@ ostream &Hypertable::operator<<(ostream &os, const RangeServerStat &stat) {
     os << " range_stats[" << i << "] = " << stat.range_stats[i] <<'\n';
   }
 
+  os << " group_commit = {" << endl
+     << "  batches = " << stat.group_commit_batches
+     << "  requests = " << stat.group_commit_requests
+     << "  bytes = " << stat.group_commit_bytes
+     << "  max_batch = " << stat.group_commit_max_batch << endl
+     << "  latency_us = " << stat.group_commit_latency
+     << "  max_latency_us = " << stat.group_commit_max_latency << endl
+     << " }" << '\n';
+
+  for (size_t i = 0; i < stat.block_cache_stats.size(); ++i) {
+    os << " block_cache[" << i << "] = " << stat.block_cache_stats[i] <<'\n';
+  }
+
+  for (size_t i = 0; i < stat.compressed_block_cache_stats.size(); ++i) {
+    os << " compressed_block_cache[" << i << "] = "
+       << stat.compressed_block_cache_stats[i] <<'\n';
+  }
+
+  os << " scan_blocks = {" << endl
+     << "  blocks = " << stat.scan_blocks
+     << "  bytes = " << stat.scan_block_bytes
+     << "  max_block_size = " << stat.scan_max_block_size << endl
+     << " }" << '\n';
+
+  os << " request_backlog = " << stat.request_backlog << '\n';
+
   os << "}";
 
   return os;
@@ -50,10 +50,35 @@ namespace Hypertable {
     uint64_t memory_usage;
   };
 
+  /** Statistics of one shard of the RangeServer block cache */
+  class BlockCacheStat {
+  public:
+    BlockCacheStat() : hits(0), misses(0), evictions(0), memory_used(0) {
+      return;
+    }
+    BlockCacheStat(const uint8_t **bufp, size_t *remainp) {
+      decode(bufp, remainp);
+    }
+
+    size_t encoded_length() const { return 32; }
+    void encode(uint8_t **bufp) const;
+    void decode(const uint8_t **bufp, size_t *remainp);
+
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t memory_used;
+  };
+
   /** Statistics of a RangeServer */
   class RangeServerStat {
   public:
-    RangeServerStat() { return; }
+    RangeServerStat() : group_commit_batches(0), group_commit_requests(0),
+      group_commit_bytes(0), group_commit_max_batch(0),
+      group_commit_latency(0), group_commit_max_latency(0), scan_blocks(0),
+      scan_block_bytes(0), scan_max_block_size(0), request_backlog(0) {
+      return;
+    }
     RangeServerStat(const uint8_t **bufp, size_t *remainp) {
       decode(bufp, remainp);
     }
@@ -63,10 +88,31 @@ namespace Hypertable {
     void decode(const uint8_t **bufp, size_t *remainp);
 
     std::vector<RangeStat> range_stats;
+
+    // commit log group commit (latencies are in microseconds)
+    uint64_t group_commit_batches;
+    uint64_t group_commit_requests;
+    uint64_t group_commit_bytes;
+    uint64_t group_commit_max_batch;
+    uint64_t group_commit_latency;
+    uint64_t group_commit_max_latency;
+
+    std::vector<BlockCacheStat> block_cache_stats;
+    std::vector<BlockCacheStat> compressed_block_cache_stats;
+
+    // scan blocks returned to clients (sizes are in bytes)
+    uint64_t scan_blocks;
+    uint64_t scan_block_bytes;
+    uint64_t scan_max_block_size;
+
+    // requests waiting in the application queue
+    uint64_t request_backlog;
   };
 
   std::ostream &operator<<(std::ostream &os, const RangeStat &stat);
 
+  std::ostream &operator<<(std::ostream &os, const BlockCacheStat &stat);
+
   std::ostream &operator<<(std::ostream &os, const RangeServerStat &stat);
 
 } // namespace Hypertable
@@ -20,16 +20,29 @@
  */
 
 #include "Common/Compat.h"
+#include <algorithm>
 #include <cstring>
 
+#include <boost/shared_ptr.hpp>
+
+#include <poll.h>
+
 #include "Common/String.h"
 #include "Common/DynamicBuffer.h"
 #include "Common/Error.h"
 #include "Common/Logger.h"
+#include "Common/Timer.h"
+
+#include "AsyncComm/DispatchHandlerSynchronizer.h"
+#include "AsyncComm/Protocol.h"
 
 #include "Hyperspace/HandleCallback.h"
 #include "Hyperspace/Session.h"
 
+#include "Key.h"
+#include "LocationCache.h"
+#include "RangeServerClient.h"
+#include "ScanBlock.h"
 #include "Table.h"
 #include "TableScanner.h"
 #include "TableMutatorShared.h"
@@ -37,6 +50,31 @@
 using namespace Hypertable;
 using namespace Hyperspace;
 
+namespace {
+
+  /** Rows of one range fetched with a single "get rows" request */
+  struct RowBatch {
+    RowBatch() : sent(false), ok(false), error(Error::OK) { }
+    RangeLocationInfo range_info;
+    sockaddr_in addr;
+    std::vector<const char *> rows;
+    DispatchHandlerSynchronizer sync_handler;
+    EventPtr event;
+    bool sent;
+    bool ok;
+    int error;
+  };
+
+  typedef boost::shared_ptr<RowBatch> RowBatchPtr;
+
+  struct LtCellRow {
+    bool operator()(const Cell &x, const Cell &y) const {
+      return strcmp(x.row_key, y.row_key) < 0;
+    }
+  };
+
+}
+
 
 Table::Table(PropertiesPtr &props, ConnectionManagerPtr &conn_manager,
              Hyperspace::SessionPtr &hyperspace, const String &name)
@@ -163,10 +201,192 @@ Table::create_mutator(uint32_t timeout_ms, uint32_t flags,
 }
 
 
+TableMutator *
+Table::create_mutator_async(TableMutatorCallback *callback,
+                            uint32_t timeout_ms, uint32_t flags) {
+  HT_ASSERT(callback);
+  return new TableMutator(m_props, m_comm, this, m_range_locator,
+                          timeout_ms ? timeout_ms : m_timeout_ms, flags,
+                          callback);
+}
+
+
 TableScanner *
 Table::create_scanner(const ScanSpec &scan_spec, uint32_t timeout_ms,
-                      bool retry_table_not_found) {
-  return new TableScanner(m_comm, this, m_range_locator, scan_spec,
+                      bool retry_table_not_found, uint32_t flags) {
+  return new TableScanner(m_props, m_comm, this, m_range_locator, scan_spec,
                           timeout_ms ? timeout_ms : m_timeout_ms,
-                          retry_table_not_found);
+                          retry_table_not_found, flags);
+}
+
+
+void
+Table::get_rows(const std::vector<String> &rows,
+                const std::vector<String> &columns, CellsBuilder &cells,
+                uint32_t max_versions, uint32_t timeout_ms) {
+  Timer timer(timeout_ms ? timeout_ms : m_timeout_ms, true);
+  RangeServerClient client(m_comm);
+  TableIdentifierManaged table;
+  SchemaPtr schema;
+  std::vector<String> pending(rows);
+  std::vector<String> retry;
+  std::vector<String> remaining;
+  size_t first_cell = cells.get().size();
+  bool in_order = true;
+
+  get(table, schema);
+
+  sort(pending.begin(), pending.end());
+  pending.erase(unique(pending.begin(), pending.end()), pending.end());
+
+  while (!pending.empty()) {
+    std::vector<RowBatchPtr> batches;
+    bool refresh_schema = false;
+
+    // group the (sorted) rows by the range that holds them
+    foreach(const String &row, pending) {
+      if (batches.empty() ||
+          row.compare(batches.back()->range_info.end_row) > 0) {
+        RowBatchPtr batch(new RowBatch());
+        m_range_locator->find_loop(&table, row.c_str(), &batch->range_info,
+                                   timer, false);
+        if (!LocationCache::location_to_addr(
+            batch->range_info.location.c_str(), batch->addr))
+          HT_THROWF(Error::INVALID_METADATA, "Invalid location found in "
+                    "METADATA entry range [%s..%s] - %s",
+                    batch->range_info.start_row.c_str(),
+                    batch->range_info.end_row.c_str(),
+                    batch->range_info.location.c_str());
+        batches.push_back(batch);
+      }
+      batches.back()->rows.push_back(row.c_str());
+    }
+
+    // send all of the batches before waiting on any of them
+    foreach(RowBatchPtr &batch, batches) {
+      RangeSpec range;
+      ScanSpec scan_spec;
+
+      range.start_row = batch->range_info.start_row.c_str();
+      range.end_row = batch->range_info.end_row.c_str();
+      scan_spec.max_versions = max_versions;
+      foreach(const String &column, columns)
+        scan_spec.columns.push_back(column.c_str());
+      foreach(const char *row, batch->rows)
+        scan_spec.row_intervals.push_back(RowInterval(row, true, row, true));
+
+      try {
+        client.set_timeout(timer.remaining());
+        client.get_rows(batch->addr, table, range, scan_spec, &batch->sync_handler);
+        batch->sent = true;
+      }
+      catch (Exception &e) {
+        batch->error = e.code();
+      }
+    }
+
+    // collect every reply before acting on any, so that no handler is
+    // destroyed with its request still outstanding
+    foreach(RowBatchPtr &batch, batches) {
+      if (batch->sent)
+        batch->ok = batch->sync_handler.wait_for_reply(batch->event);
+    }
+
+    retry.clear();
+    remaining.clear();
+
+    foreach(RowBatchPtr &batch, batches) {
+      int error;
+
+      if (batch->sent) {
+        if (batch->ok) {
+          ScanBlock scan_block;
+          SerializedKey serkey;
+          ByteString value;
+          Key key;
+          Cell cell;
+          Schema::ColumnFamily *cf;
+
+          scan_block.load(batch->event);
+          while (scan_block.next(serkey, value)) {
+            if (!key.load(serkey))
+              HT_THROW(Error::BAD_KEY, "");
+            if ((cf = schema->get_column_family(key.column_family_code)) == 0)
+              HT_THROWF(Error::BAD_KEY, "Unexpected column family code %d",
+                        (int)key.column_family_code);
+            cell.row_key = key.row;
+            cell.column_family = cf->name.c_str();
+            cell.column_qualifier = key.column_qualifier;
+            cell.timestamp = key.timestamp;
+            cell.value_len = value.decode_length(&cell.value);
+            cell.flag = key.flag;
+            cells.add(cell);
+          }
+
+          // the response was capped, ask again for the rows it left out
+          if (!scan_block.eos()) {
+            size_t rows_done = scan_block.get_scanner_id();
+            if (rows_done == 0 || rows_done >= batch->rows.size())
+              HT_THROWF(Error::PROTOCOL_ERROR, "get_rows() on range [%s..%s] "
+                        "of '%s' returned %d of %d rows",
+                        batch->range_info.start_row.c_str(),
+                        batch->range_info.end_row.c_str(), table.name,
+                        (int)rows_done, (int)batch->rows.size());
+            for (size_t i=rows_done; i<batch->rows.size(); ++i)
+              remaining.push_back(batch->rows[i]);
+          }
+          continue;
+        }
+        error = (int)Protocol::response_code(batch->event);
+      }
+      else
+        error = batch->error;
+
+      if (error == Error::RANGESERVER_GENERATION_MISMATCH)
+        refresh_schema = true;
+      else if (error != Error::RANGESERVER_RANGE_NOT_FOUND &&
+               error != Error::RANGESERVER_OUT_OF_RANGE &&
+               error != Error::COMM_NOT_CONNECTED &&
+               error != Error::COMM_BROKEN_CONNECTION &&
+               error != Error::REQUEST_TIMEOUT) {
+        String msg = batch->sent
+            ? Protocol::string_format_message(batch->event)
+            : String(Error::get_text(error));
+        HT_THROWF(error, "get_rows() on range [%s..%s] of '%s' failed - %s",
+                  batch->range_info.start_row.c_str(),
+                  batch->range_info.end_row.c_str(), table.name, msg.c_str());
+      }
+
+      m_range_locator->invalidate(&table, batch->rows[0]);
+      foreach(const char *row, batch->rows)
+        retry.push_back(row);
+    }
+
+    if (!retry.empty() || !remaining.empty())
+      in_order = false;
+
+    if (retry.empty()) {
+      pending.swap(remaining);
+      continue;
+    }
+
+    if (timer.expired())
+      HT_THROWF(Error::REQUEST_TIMEOUT, "get_rows() on '%s' timed out with "
+                "%d rows outstanding", table.name, (int)retry.size());
+
+    if (refresh_schema)
+      refresh(table, schema);
+    else
+      poll(0, 0, 1000);
+
+    retry.insert(retry.end(), remaining.begin(), remaining.end());
+    sort(retry.begin(), retry.end());
+    pending.swap(retry);
+  }
+
+  // rows fetched again came back after the rows that follow them, the cells
+  // of each row are still together and in order
+  if (!in_order)
+    std::stable_sort(cells.get().begin() + first_cell, cells.get().end(),
+                     LtCellRow());
 }
@@ -27,6 +27,7 @@
 
 #include "AsyncComm/ApplicationQueue.h"
 
+#include "Cells.h"
 #include "Schema.h"
 #include "RangeLocator.h"
 #include "Types.h"
@@ -40,6 +41,7 @@ namespace Hypertable {
   class ConnectionManager;
   class TableScanner;
   class TableMutator;
+  class TableMutatorCallback;
 
   /** Represents an open table.
    */
@@ -67,6 +69,22 @@ namespace Hypertable {
                                  uint32_t flags = 0,
                                  uint32_t flush_interval_ms = 0);
 
+    /**
+     * Creates an asynchronous mutator on this table.  Updates are sent in
+     * batches, several of which may be in flight at once, and the outcome
+     * of each batch is reported to the callback.
+     *
+     * @param callback receives batch completions and failures; must
+     *        outlive the mutator
+     * @param timeout_ms maximum time in milliseconds to allow
+     *        mutator methods to execute before throwing an exception
+     * @param flags mutator flags
+     * @return newly constructed mutator object
+     */
+    TableMutator *create_mutator_async(TableMutatorCallback *callback,
+                                       uint32_t timeout_ms = 0,
+                                       uint32_t flags = 0);
+
     /**
      * Creates a scanner on this table
      *
@@ -75,11 +93,33 @@ namespace Hypertable {
      *        scanner methods to execute before throwing an exception
      * @param retry_table_not_found whether to retry upon errors caused by
      *        drop/create tables with the same name
+     * @param flags scanner flags (see TableScanner::FLAG_PARALLEL)
      * @return pointer to scanner object
      */
     TableScanner *create_scanner(const ScanSpec &scan_spec,
                                  uint32_t timeout_ms = 0,
-                                 bool retry_table_not_found = false);
+                                 bool retry_table_not_found = false,
+                                 uint32_t flags = 0);
+
+    /**
+     * Fetches a batch of rows with point lookups.  The rows are grouped by
+     * the range that holds them and each group is fetched with a single
+     * "get rows" request, all groups being in flight at once.  A range
+     * server caps each response at the scan block size, in which case the
+     * rows left out are requested again.  Cells are returned in row order;
+     * rows that do not exist produce no cells.
+     *
+     * @param rows row keys to fetch, in any order
+     * @param columns column families to return, all if empty
+     * @param cells receives copies of the cells found
+     * @param max_versions maximum revisions of each cell to return, 0 for
+     *        the column family default
+     * @param timeout_ms maximum time in milliseconds to allow, 0 for the
+     *        table default
+     */
+    void get_rows(const std::vector<String> &rows,
+                  const std::vector<String> &columns, CellsBuilder &cells,
+                  uint32_t max_versions = 0, uint32_t timeout_ms = 0);
 
     void get_identifier(TableIdentifier *table_id_p) {
       memcpy(table_id_p, &m_table, sizeof(TableIdentifier));
@@ -30,6 +30,7 @@ extern "C" {
 
 #include "Common/Config.h"
 #include "Common/StringExt.h"
+#include "Common/Time.h"
 
 #include "Defaults.h"
 #include "Key.h"
@@ -69,11 +70,13 @@ void TableMutator::handle_exceptions() {
 
 
 TableMutator::TableMutator(PropertiesPtr & props, Comm *comm, Table *table,
-    RangeLocatorPtr &range_locator, uint32_t timeout_ms, uint32_t flags)
+    RangeLocatorPtr &range_locator, uint32_t timeout_ms, uint32_t flags,
+    TableMutatorCallback *callback)
   : m_comm(comm), m_table(table), m_range_locator(range_locator),
-    m_memory_used(0), m_resends(0), m_timeout_ms(timeout_ms), m_flags(flags),
-    m_prev_buffer_flags(0), m_flush_delay(0), m_last_error(Error::OK),
-    m_last_op(0) {
+    m_memory_used(0), m_buffer_cells(0), m_resends(0),
+    m_timeout_ms(timeout_ms), m_flags(flags), m_prev_buffer_flags(0),
+    m_flush_delay(0), m_last_error(Error::OK), m_last_op(0),
+    m_callback(callback), m_outstanding_memory(0), m_last_batch_id(0) {
 
   HT_ASSERT(timeout_ms);
 
@@ -81,6 +84,10 @@ TableMutator::TableMutator(PropertiesPtr & props, Comm *comm, Table *table,
 
   m_flush_delay = props->get_i32("Hypertable.Mutator.FlushDelay");
   m_max_memory = props->get_i64("Hypertable.Mutator.ScatterBuffer.FlushLimit.Aggregate");
+  m_max_outstanding = props->get_i32("Hypertable.Mutator.Async.MaxOutstanding");
+  m_max_outstanding_memory = props->get_i64("Hypertable.Mutator.Async.MaxMemory");
+  if (m_max_outstanding == 0)
+    m_max_outstanding = 1;
   m_buffer = new TableMutatorScatterBuffer(m_comm, &m_table_identifier,
       m_schema, m_range_locator, timeout_ms);
 }
@@ -103,6 +110,7 @@ TableMutator::set(const KeySpec &key, const void *value, uint32_t value_len) {
     to_full_key(key, full_key);
     m_buffer->set(full_key, value, value_len, timer);
     m_memory_used += 20 + key.row_len + key.column_qualifier_len + value_len;
+    m_buffer_cells++;
   }
   catch (...) {
     handle_exceptions();
@@ -138,6 +146,7 @@ TableMutator::set_cells(Cells::const_iterator it, Cells::const_iterator end) {
       m_buffer->set(full_key, cell.value, cell.value_len, timer);
       m_memory_used += 20 + strlen(cell.row_key)
           + (cell.column_qualifier ? strlen(cell.column_qualifier) : 0);
+      m_buffer_cells++;
     }
   }
   catch (...) {
@@ -167,6 +176,7 @@ void TableMutator::set_delete(const KeySpec &key) {
 
     m_buffer->set_delete(full_key, timer);
     m_memory_used += 20 + key.row_len + key.column_qualifier_len;
+    m_buffer_cells++;
   }
   catch (...) {
     handle_exceptions();
@@ -198,6 +208,18 @@ TableMutator::to_full_key(const void *row, const char *column_family,
 
 
 void TableMutator::auto_flush(Timer &timer) {
+  if (m_callback) {
+    try {
+      reap_batches(timer, false);
+      if (m_buffer->full() || m_memory_used > m_max_memory) {
+        m_last_op = FLUSH;
+        send_batch(timer, m_flags);
+      }
+    }
+    HT_RETHROW("auto flushing")
+    return;
+  }
+
   if (m_buffer->full() || m_memory_used > m_max_memory) {
     try {
       m_last_op = FLUSH;
@@ -215,15 +237,155 @@ void TableMutator::auto_flush(Timer &timer) {
       m_buffer = new TableMutatorScatterBuffer(m_comm, &m_table_identifier,
           m_schema, m_range_locator, m_timeout_ms);
       m_memory_used = 0;
+      m_buffer_cells = 0;
     }
     HT_RETHROW("auto flushing")
   }
 }
 
 
+void TableMutator::send_batch(Timer &timer, uint32_t flags) {
+  OutstandingBatch batch;
+
+  timer.start();
+
+  // block until there is room for another batch in flight
+  while (!m_outstanding.empty() &&
+         (m_outstanding.size() >= m_max_outstanding ||
+          m_outstanding_memory + m_memory_used > m_max_outstanding_memory))
+    reap_batches(timer, true);
+
+  if (m_flush_delay)
+    poll(0, 0, m_flush_delay);
+
+  m_buffer->send(m_rangeserver_flags_map, flags);
+
+  batch.id = ++m_last_batch_id;
+  batch.buffer = m_buffer;
+  batch.flags = flags;
+  batch.memory = m_memory_used;
+  batch.cells = m_buffer_cells;
+  batch.redo_time = 0;
+  batch.redo_wait = 1000;
+  m_outstanding.push_back(batch);
+  m_outstanding_memory += m_memory_used;
+
+  m_buffer = new TableMutatorScatterBuffer(m_comm, &m_table_identifier,
+      m_schema, m_range_locator, m_timeout_ms);
+  m_memory_used = 0;
+  m_buffer_cells = 0;
+}
+
+
+/**
+ * Retires the batches that have completed, in whatever order they complete.
+ * If wait is true, blocks until at least the oldest batch has been retired.
+ */
+void TableMutator::reap_batches(Timer &timer, bool wait) {
+  std::deque<OutstandingBatch>::iterator iter = m_outstanding.begin();
+
+  while (iter != m_outstanding.end()) {
+    if (retire_batch(*iter, timer, wait)) {
+      m_outstanding_memory -= iter->memory;
+      iter = m_outstanding.erase(iter);
+    }
+    else
+      ++iter;
+    wait = false;
+  }
+}
+
+
+/**
+ * Reports the outcome of a batch to the callback once it has completed.
+ * Updates that were rejected because their range split or moved are resent
+ * after a growing delay, as wait_for_previous_buffer() does.
+ *
+ * @return true if the batch has been reported and can be dropped
+ */
+bool
+TableMutator::retire_batch(OutstandingBatch &batch, Timer &timer, bool wait) {
+  while (true) {
+    if (batch.redo_time) {
+      int64_t delay = batch.redo_time - (int64_t)(get_ts64() / 1000000LL);
+
+      if (delay > 0) {
+        if (!wait)
+          return false;
+        if (timer.remaining() < delay)
+          HT_THROW_(Error::REQUEST_TIMEOUT);
+        poll(0, 0, delay);
+      }
+
+      TableMutatorScatterBufferPtr redo_buffer =
+          batch.buffer->create_redo_buffer(timer);
+      m_resends += batch.buffer->get_resend_count();
+      batch.buffer = redo_buffer;
+      batch.buffer->send(m_rangeserver_flags_map, batch.flags);
+      batch.redo_time = 0;
+    }
+
+    if (!wait && !batch.buffer->completed())
+      return false;
+
+    try {
+      if (batch.buffer->wait_for_completion(timer)) {
+        m_callback->completed(batch.id, batch.cells);
+        return true;
+      }
+    }
+    catch (Exception &e) {
+      if (batch.buffer->get_failure_count() == 0)
+        throw;
+      FailedMutations failed_mutations;
+      batch.buffer->get_failed_mutations(failed_mutations);
+      m_callback->failed(batch.id, e.code(), failed_mutations);
+      return true;
+    }
+
+    batch.redo_time = get_ts64() / 1000000LL + batch.redo_wait;
+    batch.redo_wait += 2000;
+  }
+}
+
+
+void TableMutator::poll_completions() {
+  Timer timer(m_timeout_ms);
+
+  if (!m_callback)
+    return;
+
+  try {
+    reap_batches(timer, false);
+  }
+  catch (...) {
+    handle_exceptions();
+    throw;
+  }
+}
+
+
 void TableMutator::flush() {
   Timer timer(m_timeout_ms, true);
 
+  if (m_callback) {
+    try {
+      // send whatever is buffered (forcing a log sync), then drain
+      if (m_memory_used > 0)
+        send_batch(timer, 0);
+      while (!m_outstanding.empty())
+        reap_batches(timer, true);
+      sync();
+      m_rangeserver_flags_map.clear();
+    }
+    catch (...) {
+      handle_exceptions();
+      m_last_op = FLUSH;
+      throw;
+    }
+    return;
+  }
+
   try {
     if (m_prev_buffer)
       wait_for_previous_buffer(timer);
@@ -244,6 +406,7 @@ void TableMutator::flush() {
     }
 
     m_buffer->reset();
+    m_buffer_cells = 0;
     m_prev_buffer = 0;
 
   }
@@ -22,6 +22,7 @@
 #ifndef HYPERTABLE_TABLEMUTATOR_H
 #define HYPERTABLE_TABLEMUTATOR_H
 
+#include <deque>
 #include <iostream>
 
 #include "AsyncComm/ConnectionManager.h"
@@ -33,6 +34,7 @@
 #include "Cells.h"
 #include "KeySpec.h"
 #include "Table.h"
+#include "TableMutatorCallback.h"
 #include "TableMutatorScatterBuffer.h"
 #include "RangeLocator.h"
 #include "RangeServerClient.h"
@@ -47,6 +49,22 @@ namespace Hypertable {
    * periodically flush them to the appropriate range servers.  There is a 1 MB
    * buffer of mutations for each range server.  When one of the buffers fills
    * up all the buffers are flushed to their respective range servers.
+   *
+   * If constructed with a TableMutatorCallback, the mutator runs in
+   * asynchronous mode.  Several scatter buffers may then be in flight at
+   * once, bounded by Hypertable.Mutator.Async.MaxOutstanding and
+   * Hypertable.Mutator.Async.MaxMemory, and the outcome of each one is
+   * reported to the callback instead of through flush(), need_retry() and
+   * get_failed().  The mutator only blocks when one of the limits is hit.
+   *
+   * The asynchronous mode does not preserve the order of updates across
+   * batches.  Batches in flight at the same time may be applied by the
+   * range servers in any order, and updates of a batch that are resent
+   * after a range split or move are applied after those of later batches.
+   * If two batches set the same cell with an automatically assigned
+   * timestamp, either value may end up as the newest.  Callers that need
+   * ordered updates to a cell should give the cells explicit timestamps, or
+   * call flush() between the updates.
    */
   class TableMutator : public ReferenceCount {
 
@@ -62,10 +80,12 @@ namespace Hypertable {
      * @param timeout_ms maximum time in milliseconds to allow methods
      *        to execute before throwing an exception
      * @param flags rangeserver client update command flags
+     * @param callback if non-null, runs the mutator in asynchronous mode
+     *        and receives the outcome of each batch; must outlive the mutator
      */
     TableMutator(PropertiesPtr &props, Comm *comm, Table *table,
                  RangeLocatorPtr &range_locator, uint32_t timeout_ms,
-                 uint32_t flags = 0);
+                 uint32_t flags = 0, TableMutatorCallback *callback = 0);
 
     /**
      * Destructor for TableMutator object
@@ -122,6 +142,20 @@ namespace Hypertable {
      */
     virtual void flush();
 
+    /**
+     * In asynchronous mode, delivers the callbacks of the batches that have
+     * completed since the last call into the mutator and resends the updates
+     * of batches that hit ranges which have since moved.  Never blocks on
+     * outstanding batches.
+     */
+    void poll_completions();
+
+    /**
+     * Returns the number of batches sent but not yet reported to the
+     * callback (always 0 in synchronous mode)
+     */
+    size_t outstanding_batches() { return m_outstanding.size(); }
+
     /**
      * Retries the last operation
      *
@@ -194,7 +228,21 @@ namespace Hypertable {
      */
     void sync();
 
+    /** Scatter buffer sent in asynchronous mode and not yet reported */
+    struct OutstandingBatch {
+      uint64_t id;
+      TableMutatorScatterBufferPtr buffer;
+      uint32_t flags;
+      uint64_t memory;
+      size_t   cells;
+      int64_t  redo_time;    // when to resend retried updates (ms), 0 if none
+      uint32_t redo_wait;
+    };
+
     void wait_for_previous_buffer(Timer &timer);
+    void send_batch(Timer &timer, uint32_t flags);
+    void reap_batches(Timer &timer, bool wait);
+    bool retire_batch(OutstandingBatch &batch, Timer &timer, bool wait);
     void to_full_key(const void *row, const char *cf, const void *cq,
                      int64_t ts, int64_t rev, uint8_t flag, Key &full_key);
     void to_full_key(const KeySpec &key, Key &full_key) {
@@ -228,6 +276,7 @@ namespace Hypertable {
     TableIdentifierManaged m_table_identifier;
     uint64_t             m_memory_used;
     uint64_t             m_max_memory;
+    size_t               m_buffer_cells;
     TableMutatorScatterBufferPtr  m_buffer;
     TableMutatorScatterBufferPtr  m_prev_buffer;
     uint64_t             m_resends;
@@ -243,6 +292,12 @@ namespace Hypertable {
     uint32_t    m_last_value_len;
     Cells::const_iterator m_last_cells_it;
     Cells::const_iterator m_last_cells_end;
+    TableMutatorCallback *m_callback;
+    std::deque<OutstandingBatch> m_outstanding;
+    uint64_t    m_outstanding_memory;
+    uint64_t    m_max_outstanding_memory;
+    size_t      m_max_outstanding;
+    uint64_t    m_last_batch_id;
     const static uint32_t ms_max_sync_retries = 5;
   };
 
@@ -0,0 +1,68 @@
+/** -*- c++ -*-
+ * Copyright (C) 2008 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_TABLEMUTATORCALLBACK_H
+#define HYPERTABLE_TABLEMUTATORCALLBACK_H
+
+#include "TableMutatorScatterBuffer.h"
+
+namespace Hypertable {
+
+  /**
+   * Receives the outcome of the update batches sent by an asynchronous
+   * TableMutator (see Table::create_mutator_async).  Each time the mutator
+   * sends its scatter buffer, the updates accumulated so far become a batch
+   * with a new, increasing id.  Exactly one of the methods below is called
+   * for every batch, from the thread that is calling into the mutator, so
+   * implementations need no locking of their own.  Batches are not reported
+   * in id order, and completed() says nothing about the batches before it:
+   * a batch whose updates had to be resent after a range split or move can
+   * be committed after later batches, and its updates then override theirs
+   * (see TableMutator).
+   */
+  class TableMutatorCallback {
+  public:
+    virtual ~TableMutatorCallback() { }
+
+    /**
+     * Called when all of the updates of a batch have been committed
+     *
+     * @param batch_id id of the batch
+     * @param cells number of cells in the batch
+     */
+    virtual void completed(uint64_t batch_id, size_t cells) = 0;
+
+    /**
+     * Called when some of the updates of a batch could not be committed.
+     * The cells in failed_mutations point into the batch's buffer and are
+     * only valid for the duration of the call.
+     *
+     * @param batch_id id of the batch
+     * @param error code of the first failure
+     * @param failed_mutations cells that failed, with their error codes
+     */
+    virtual void failed(uint64_t batch_id, int error,
+                        FailedMutations &failed_mutations) = 0;
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_TABLEMUTATORCALLBACK_H
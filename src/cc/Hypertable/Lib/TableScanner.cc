@@ -26,6 +26,7 @@
 #include "Common/String.h"
 
 #include "Defaults.h"
+#include "Key.h"
 #include "Table.h"
 #include "TableScanner.h"
 
@@ -36,13 +37,35 @@ extern "C" {
 using namespace Hypertable;
 
 
+namespace {
+  // amount of cell data collected before a batch is handed to the consumer
+  const size_t PARALLEL_BATCH_SIZE = 64 * 1024;
+
+  size_t cell_size(const Cell &cell) {
+    size_t size = cell.value_len + 32;
+    if (cell.row_key)
+      size += strlen(cell.row_key);
+    if (cell.column_family)
+      size += strlen(cell.column_family);
+    if (cell.column_qualifier)
+      size += strlen(cell.column_qualifier);
+    return size;
+  }
+}
+
+
 /**
  * TODO: Asynchronously destroy dangling scanners on EOS
  */
-TableScanner::TableScanner(Comm *comm, Table *table,
+TableScanner::TableScanner(PropertiesPtr &props, Comm *comm, Table *table,
     RangeLocatorPtr &range_locator, const ScanSpec &scan_spec,
-    uint32_t timeout_ms, bool retry_table_not_found)
-  : m_eos(false), m_scanneri(0), m_rows_seen(0) {
+    uint32_t timeout_ms, bool retry_table_not_found, uint32_t flags)
+  : m_eos(false), m_scanneri(0), m_rows_seen(0), m_comm(comm),
+    m_table(table), m_range_locator(range_locator), m_scan_spec(scan_spec),
+    m_timeout_ms(timeout_ms), m_retry_table_not_found(retry_table_not_found),
+    m_parallel(false), m_ordered((flags & FLAG_UNORDERED) == 0),
+    m_next_slice(0), m_slicei(0), m_buffered(0), m_max_memory(0),
+    m_shutdown(false), m_batch(0), m_batch_pos(0) {
 
   HT_ASSERT(timeout_ms);
 
@@ -50,6 +73,58 @@ TableScanner::TableScanner(Comm *comm, Table *table,
   ScanSpec interval_scan_spec;
   Timer timer(timeout_ms);
 
+  /**
+   * Slices of an unordered scan interleave, so rows can't be counted
+   * against a limit.  A row limited ordered scan reads a prefix of the
+   * table, which the sequential path does without fetching whole slices
+   * that would be thrown away.
+   */
+  if ((flags & FLAG_PARALLEL) && scan_spec.row_limit > 0) {
+    if (flags & FLAG_UNORDERED)
+      HT_THROW(Error::BAD_SCAN_SPEC,
+               "row limit not supported by unordered parallel scans");
+    flags &= ~FLAG_PARALLEL;
+  }
+
+  if (flags & FLAG_PARALLEL) {
+    SchemaPtr schema;
+    table->get(m_table_identifier, schema);
+
+    if (!scan_spec.cell_intervals.empty()) {
+      for (size_t i=0; i<scan_spec.cell_intervals.size(); i++) {
+        ScanSlice *slice = new ScanSlice();
+        slice->cell_interval = (int)i;
+        m_slices.push_back(slice);
+      }
+    }
+    else if (!scan_spec.row_intervals.empty()) {
+      for (size_t i=0; i<scan_spec.row_intervals.size(); i++) {
+        const RowInterval &ri = scan_spec.row_intervals[i];
+        add_slices(ri.start ? ri.start : "", ri.start_inclusive,
+                   ri.end ? ri.end : Key::END_ROW_MARKER, ri.end_inclusive,
+                   timer);
+      }
+    }
+    else
+      add_slices("", false, Key::END_ROW_MARKER, false, timer);
+
+    if (m_slices.size() > 1) {
+      int32_t workers = props->get_i32("Hypertable.Scanner.Parallel.Workers");
+      m_max_memory = props->get_i64("Hypertable.Scanner.Parallel.MaxMemory");
+      if (workers > (int32_t)m_slices.size())
+        workers = m_slices.size();
+      m_parallel = true;
+      ParallelWorker worker(this);
+      for (int32_t i=0; i<workers; i++)
+        m_threads.create_thread(worker);
+      return;
+    }
+
+    foreach(ScanSlice *slice, m_slices)
+      delete slice;
+    m_slices.clear();
+  }
+
   if (scan_spec.row_intervals.empty()) {
     if (scan_spec.cell_intervals.empty()) {
       ri_scanner = new IntervalScanner(comm, table, range_locator, scan_spec,
@@ -79,6 +154,70 @@ TableScanner::TableScanner(Comm *comm, Table *table,
 }
 
 
+TableScanner::~TableScanner() {
+  if (m_parallel) {
+    {
+      ScopedLock lock(m_mutex);
+      m_shutdown = true;
+      m_cond.notify_all();
+    }
+    m_threads.join_all();
+  }
+
+  foreach(ScanSlice *slice, m_slices) {
+    foreach(CellsBuilder *batch, slice->batches)
+      delete batch;
+    delete slice;
+  }
+  delete m_batch;
+}
+
+
+/**
+ * Splits a row interval into one slice per range that it touches.
+ */
+void
+TableScanner::add_slices(const char *start_row, bool start_inclusive,
+                         const char *end_row, bool end_inclusive,
+                         Timer &timer) {
+  LocationCachePtr loc_cache = m_range_locator->location_cache();
+  RangeLocationInfo range_info;
+  String row = start_row;
+  bool inclusive = start_inclusive;
+
+  timer.start();
+
+  while (true) {
+    ScanSlice *slice = new ScanSlice();
+    slice->start_row = row;
+    slice->start_inclusive = inclusive;
+    m_slices.push_back(slice);
+
+    if (!strcmp(row.c_str(), end_row)) {
+      slice->end_row = end_row;
+      slice->end_inclusive = end_inclusive;
+      break;
+    }
+
+    if (!loc_cache->lookup(m_table_identifier.id, row.c_str(), &range_info))
+      m_range_locator->find_loop(&m_table_identifier, row.c_str(),
+                                 &range_info, timer, false);
+
+    if (range_info.end_row == Key::END_ROW_MARKER ||
+        strcmp(end_row, range_info.end_row.c_str()) <= 0) {
+      slice->end_row = end_row;
+      slice->end_inclusive = end_inclusive;
+      break;
+    }
+
+    slice->end_row = range_info.end_row;
+    slice->end_inclusive = true;
+    row = range_info.end_row;
+    inclusive = false;
+  }
+}
+
+
 bool TableScanner::next(Cell &cell) {
 
   if (m_eos)
@@ -90,6 +229,9 @@ bool TableScanner::next(Cell &cell) {
     return true;
   }
 
+  if (m_parallel)
+    return next_parallel(cell);
+
   do {
     if (m_interval_scanners[m_scanneri]->next(cell))
       return true;
@@ -109,6 +251,176 @@ bool TableScanner::next(Cell &cell) {
 }
 
 
+/**
+ * Returns the next cell of a parallel scan.  Cells are taken from batches
+ * filled by the worker threads.  In ordered mode the batches of slice i are
+ * all returned before those of slice i+1, otherwise any available batch is
+ * used.  Parallel scans never have a row limit (see the constructor).
+ */
+bool TableScanner::next_parallel(Cell &cell) {
+
+  while (true) {
+
+    if (m_batch && m_batch_pos < m_batch->get().size()) {
+      cell = m_batch->get()[m_batch_pos++];
+      return true;
+    }
+
+    ScopedLock lock(m_mutex);
+
+    delete m_batch;
+    m_batch = 0;
+    m_batch_pos = 0;
+
+    while (m_batch == 0) {
+      ScanSlice *slice = 0;
+
+      // retire finished slices at the head
+      while (m_slicei < m_slices.size() && m_slices[m_slicei]->done &&
+             m_slices[m_slicei]->batches.empty()) {
+        if (m_slices[m_slicei]->error != Error::OK)
+          HT_THROW(m_slices[m_slicei]->error, m_slices[m_slicei]->error_msg);
+        m_slicei++;
+        m_cond.notify_all();
+      }
+
+      if (m_slicei == m_slices.size()) {
+        m_eos = true;
+        return false;
+      }
+
+      if (m_ordered) {
+        if (!m_slices[m_slicei]->batches.empty())
+          slice = m_slices[m_slicei];
+      }
+      else {
+        for (size_t i=m_slicei; i<m_next_slice; i++) {
+          if (m_slices[i]->error != Error::OK)
+            HT_THROW(m_slices[i]->error, m_slices[i]->error_msg);
+          if (!m_slices[i]->batches.empty()) {
+            slice = m_slices[i];
+            break;
+          }
+        }
+      }
+
+      if (slice == 0) {
+        m_cond.wait(lock);
+        continue;
+      }
+
+      m_batch = slice->batches.front();
+      slice->batches.pop_front();
+      m_buffered -= slice->batch_sizes.front();
+      slice->batch_sizes.pop_front();
+      m_cond.notify_all();
+    }
+  }
+}
+
+
+/**
+ * Worker thread body of a parallel scan.  Repeatedly takes the next slice
+ * that has not been started and scans it into batches of cells.
+ */
+void TableScanner::scan_slices() {
+  ScanSpec interval_scan_spec;
+  IntervalScannerPtr scanner;
+  CellsBuilder *batch;
+  size_t slicei, batch_size;
+  Cell cell;
+
+  while (true) {
+
+    {
+      ScopedLock lock(m_mutex);
+      if (m_shutdown || m_next_slice == m_slices.size())
+        return;
+      slicei = m_next_slice++;
+    }
+
+    ScanSlice *slice = m_slices[slicei];
+    batch = 0;
+    batch_size = 0;
+
+    try {
+      m_scan_spec.get().base_copy(interval_scan_spec);
+      if (slice->cell_interval >= 0)
+        interval_scan_spec.cell_intervals.push_back(
+            m_scan_spec.get().cell_intervals[slice->cell_interval]);
+      else {
+        RowInterval ri;
+        ri.start = slice->start_row.c_str();
+        ri.start_inclusive = slice->start_inclusive;
+        ri.end = slice->end_row.c_str();
+        ri.end_inclusive = slice->end_inclusive;
+        interval_scan_spec.row_intervals.push_back(ri);
+      }
+
+      scanner = new IntervalScanner(m_comm, m_table, m_range_locator,
+          interval_scan_spec, m_timeout_ms, m_retry_table_not_found);
+
+      while (scanner->next(cell)) {
+        if (batch == 0)
+          batch = new CellsBuilder();
+        batch->add(cell);
+        batch_size += cell_size(cell);
+        if (batch_size >= PARALLEL_BATCH_SIZE) {
+          bool pushed = push_batch(slicei, batch, batch_size);
+          batch = 0;
+          batch_size = 0;
+          if (!pushed)
+            break;
+        }
+      }
+
+      if (batch)
+        push_batch(slicei, batch, batch_size);
+      scanner = 0;
+    }
+    catch (Exception &e) {
+      delete batch;
+      scanner = 0;
+      ScopedLock lock(m_mutex);
+      slice->error = e.code();
+      slice->error_msg = e.what();
+    }
+
+    ScopedLock lock(m_mutex);
+    slice->done = true;
+    m_cond.notify_all();
+  }
+}
+
+
+/**
+ * Hands a batch of cells to the consumer, first waiting until it fits in
+ * the memory budget.  The slice the consumer is waiting on in ordered mode
+ * is exempt from the budget so that the scan can always make progress.
+ *
+ * @return false if the scanner is being destroyed
+ */
+bool TableScanner::push_batch(size_t slicei, CellsBuilder *batch,
+                              size_t size) {
+  ScopedLock lock(m_mutex);
+
+  while (!m_shutdown && m_buffered > 0 && m_buffered + size > m_max_memory
+         && !(m_ordered && slicei == m_slicei))
+    m_cond.wait(lock);
+
+  if (m_shutdown) {
+    delete batch;
+    return false;
+  }
+
+  m_slices[slicei]->batches.push_back(batch);
+  m_slices[slicei]->batch_sizes.push_back(size);
+  m_buffered += size;
+  m_cond.notify_all();
+  return true;
+}
+
+
 void TableScanner::unget(const Cell &cell) {
   if (m_ungot.row_key)
     HT_THROW_(Error::DOUBLE_UNGET);
@@ -22,7 +22,14 @@
 #ifndef HYPERTABLE_TABLESCANNER_H
 #define HYPERTABLE_TABLESCANNER_H
 
+#include <deque>
+
+#include <boost/thread/condition.hpp>
+
+#include "Common/Mutex.h"
+#include "Common/Properties.h"
 #include "Common/ReferenceCount.h"
+#include "Common/Thread.h"
 
 #include "AsyncComm/DispatchHandlerSynchronizer.h"
 
@@ -41,9 +48,24 @@ namespace Hypertable {
   class TableScanner : public ReferenceCount {
 
   public:
+    enum {
+      /* Scan the ranges of the table in parallel */
+      FLAG_PARALLEL = 0x0001,
+      /* Parallel scan returns cells in arrival order instead of key order */
+      FLAG_UNORDERED = 0x0002
+    };
+
     /**
-     * Constructs a TableScanner object.
+     * Constructs a TableScanner object.  If the FLAG_PARALLEL flag is given,
+     * the scan is split into one piece per range and up to
+     * Hypertable.Scanner.Parallel.Workers of those pieces are scanned
+     * concurrently, buffering up to Hypertable.Scanner.Parallel.MaxMemory
+     * bytes of cells.  Cells are still returned in key order, unless
+     * FLAG_UNORDERED is also given.  A parallel scan with a row limit is
+     * run sequentially, or rejected with Error::BAD_SCAN_SPEC if it is
+     * unordered.
      *
+     * @param props reference to properties smart pointer
      * @param comm pointer to the Comm layer
      * @param table pointer to the table object
      * @param range_locator smart pointer to range locator
@@ -52,10 +74,14 @@ namespace Hypertable {
      *        methods to execute before throwing an exception
      * @param retry_table_not_found whether to retry upon errors caused by
      *        drop/create tables with the same name
+     * @param flags scanner flags (FLAG_PARALLEL, FLAG_UNORDERED)
      */
-    TableScanner(Comm *comm, Table *table, RangeLocatorPtr &range_locator,
-                 const ScanSpec &scan_spec, uint32_t timeout_ms,
-                 bool retry_table_not_found);
+    TableScanner(PropertiesPtr &props, Comm *comm, Table *table,
+                 RangeLocatorPtr &range_locator, const ScanSpec &scan_spec,
+                 uint32_t timeout_ms, bool retry_table_not_found,
+                 uint32_t flags = 0);
+
+    virtual ~TableScanner();
 
     /**
      * Get the next cell.
@@ -78,12 +104,69 @@ namespace Hypertable {
     void unget(const Cell &cell);
 
   private:
+
+    /**
+     * Part of a parallel scan: a row interval confined to a single range,
+     * or one cell interval of the scan spec.
+     */
+    class ScanSlice {
+    public:
+      ScanSlice() : start_inclusive(false), end_inclusive(false),
+          cell_interval(-1), done(false), error(Error::OK) { }
+      String    start_row;
+      String    end_row;
+      bool      start_inclusive;
+      bool      end_inclusive;
+      int       cell_interval;
+      bool      done;
+      int       error;
+      String    error_msg;
+      std::deque<CellsBuilder *> batches;
+      std::deque<size_t> batch_sizes;
+    };
+
+    class ParallelWorker {
+    public:
+      ParallelWorker(TableScanner *scanner) : m_scanner(scanner) { }
+      void operator()() { m_scanner->scan_slices(); }
+    private:
+      TableScanner *m_scanner;
+    };
+
+    void add_slices(const char *start_row, bool start_inclusive,
+                    const char *end_row, bool end_inclusive, Timer &timer);
+    bool next_parallel(Cell &cell);
+    void scan_slices();
+    bool push_batch(size_t slicei, CellsBuilder *batch, size_t size);
+
     std::vector<IntervalScannerPtr>  m_interval_scanners;
 
     bool      m_eos;
     size_t    m_scanneri;
     int64_t   m_rows_seen;
     Cell      m_ungot;
+
+    // parallel scan state
+    Comm               *m_comm;
+    Table              *m_table;
+    RangeLocatorPtr     m_range_locator;
+    TableIdentifierManaged m_table_identifier;
+    ScanSpecBuilder     m_scan_spec;
+    uint32_t            m_timeout_ms;
+    bool                m_retry_table_not_found;
+    bool                m_parallel;
+    bool                m_ordered;
+    std::vector<ScanSlice *> m_slices;
+    size_t              m_next_slice;
+    size_t              m_slicei;
+    size_t              m_buffered;
+    size_t              m_max_memory;
+    bool                m_shutdown;
+    Mutex               m_mutex;
+    boost::condition    m_cond;
+    ThreadGroup         m_threads;
+    CellsBuilder       *m_batch;
+    size_t              m_batch_pos;
   };
 
   typedef intrusive_ptr<TableScanner> TableScannerPtr;
@@ -56,6 +56,13 @@ namespace Hypertable {
     TableIdentifierManaged(const TableIdentifier &identifier) {
       operator=(identifier);
     }
+    TableIdentifierManaged(const TableIdentifierManaged &identifier)
+      : TableIdentifier() {
+      operator=(identifier);
+    }
+    TableIdentifierManaged &operator=(const TableIdentifierManaged &other) {
+      return operator=((const TableIdentifier &)other);
+    }
     TableIdentifierManaged &operator=(const TableIdentifier &identifier) {
       id = identifier.id;
       generation = identifier.generation;
@@ -99,6 +106,12 @@ namespace Hypertable {
   public:
     RangeSpecManaged() { start_row = end_row = 0; }
     RangeSpecManaged(const RangeSpec &range) { operator=(range); }
+    RangeSpecManaged(const RangeSpecManaged &range) : RangeSpec() {
+      operator=(range);
+    }
+    RangeSpecManaged &operator=(const RangeSpecManaged &other) {
+      return operator=((const RangeSpec &)other);
+    }
 
     RangeSpecManaged &operator=(const RangeSpec &range) {
       if (range.start_row) {
@@ -0,0 +1,162 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <unistd.h>
+
+#include <boost/thread/thread.hpp>
+
+#include "Hypertable/Lib/Config.h"
+#include "Hypertable/Lib/Client.h"
+#include "Hypertable/Lib/HqlInterpreter.h"
+#include "Hypertable/Lib/TableMutatorCallback.h"
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+const int ROWS = 5000;
+const int FAILED_ROWS = 100;
+
+/**
+ * Records the batches reported by an asynchronous mutator and checks that
+ * each one is reported once, on the thread that calls into the mutator
+ */
+class Callback : public TableMutatorCallback {
+public:
+  Callback() : completed_cells(0), failed_cells(0),
+               thread_id(boost::this_thread::get_id()) { }
+
+  virtual void completed(uint64_t batch_id, size_t cells) {
+    HT_ASSERT(boost::this_thread::get_id() == thread_id);
+    HT_ASSERT(completed_ids.insert(batch_id).second);
+    HT_ASSERT(failed_ids.count(batch_id) == 0);
+    completed_cells += cells;
+  }
+
+  virtual void failed(uint64_t batch_id, int error,
+                      FailedMutations &failed_mutations) {
+    HT_ASSERT(boost::this_thread::get_id() == thread_id);
+    HT_ASSERT(failed_ids.insert(batch_id).second);
+    HT_ASSERT(completed_ids.count(batch_id) == 0);
+    HT_ASSERT(error != Error::OK);
+    foreach(const FailedMutation &fm, failed_mutations) {
+      HT_ASSERT(fm.second != Error::OK);
+      HT_ASSERT(!strncmp(fm.first.row_key, "row", 3));
+    }
+    failed_cells += failed_mutations.size();
+  }
+
+  size_t batches() { return completed_ids.size() + failed_ids.size(); }
+
+  set<uint64_t> completed_ids;
+  set<uint64_t> failed_ids;
+  size_t completed_cells;
+  size_t failed_cells;
+  boost::thread::id thread_id;
+};
+
+void insert(TableMutator *mutator, int begin, int end) {
+  char row[32], value[128];
+  for (int i=begin; i<end; i++) {
+    sprintf(row, "row%05d", i);
+    sprintf(value, "value%05d........................................"
+            "..................................................", i);
+    mutator->set(KeySpec(row, "a", ""), value);
+    if (i % 100 == 0)
+      mutator->poll_completions();
+  }
+}
+
+} // local namespace
+
+
+int main(int argc, char *argv[]) {
+  try {
+    init_with_policy<DefaultClientPolicy>(argc, argv);
+
+    // small scatter buffers, so that the inserts make many batches
+    properties->set("Hypertable.Mutator.ScatterBuffer.FlushLimit.Aggregate",
+                    int64_t(16000));
+    properties->set("Hypertable.Mutator.Async.MaxOutstanding", int32_t(3));
+
+    ClientPtr client = new Hypertable::Client();
+    HqlInterpreterPtr hql = client->create_hql_interpreter();
+
+    hql->execute("drop table if exists async_mutator_test");
+    hql->execute("create table async_mutator_test(a)");
+
+    TablePtr table = client->open_table("async_mutator_test");
+    Callback cb;
+
+    {
+      TableMutatorPtr mutator = table->create_mutator_async(&cb);
+
+      // every batch completes, and batch ids are handed out from 1 up
+      insert(mutator.get(), 0, ROWS);
+      mutator->flush();
+      HT_ASSERT(mutator->outstanding_batches() == 0);
+      HT_ASSERT(cb.failed_ids.empty());
+      HT_ASSERT(cb.completed_cells == (size_t)ROWS);
+      HT_ASSERT(cb.completed_ids.size() > 10);
+      HT_ASSERT(*cb.completed_ids.begin() == 1);
+      HT_ASSERT(*cb.completed_ids.rbegin() == cb.completed_ids.size());
+
+      // flushing again with nothing buffered reports nothing
+      mutator->flush();
+      HT_ASSERT(cb.batches() == cb.completed_ids.size());
+
+      {
+        ScanSpecBuilder ssb;
+        TableScannerPtr scanner = table->create_scanner(ssb.get());
+        Cell cell;
+        int count = 0;
+        while (scanner->next(cell))
+          count++;
+        HT_ASSERT(count == ROWS);
+      }
+
+      // the RangeServers reject updates to a table that has been dropped,
+      // which the mutator reports as failed batches
+      size_t completed = cb.completed_ids.size();
+      hql->execute("drop table async_mutator_test");
+      insert(mutator.get(), 0, FAILED_ROWS);
+      mutator->flush();
+      HT_ASSERT(mutator->outstanding_batches() == 0);
+      HT_ASSERT(cb.completed_ids.size() == completed);
+      HT_ASSERT(!cb.failed_ids.empty());
+      HT_ASSERT(*cb.failed_ids.begin() == completed + 1);
+      HT_ASSERT(cb.failed_cells == (size_t)FAILED_ROWS);
+    }
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    _exit(1);
+  }
+  _exit(0);
+}
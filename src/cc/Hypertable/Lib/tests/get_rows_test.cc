@@ -0,0 +1,254 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <vector>
+
+extern "C" {
+#include <poll.h>
+}
+
+#include "Hypertable/Lib/Config.h"
+#include "Hypertable/Lib/Client.h"
+#include "Hypertable/Lib/HqlInterpreter.h"
+#include "Hypertable/Lib/Key.h"
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+/**
+ * Meant to run against RangeServers with a small split size (see
+ * tests/integration/get-rows), so that the table spans several ranges
+ */
+const int ROWS = 20000;
+const char *VALUE_PADDING =
+  "..............................................................";
+
+String row_key(int i) {
+  return format("row%06d", i);
+}
+
+/** Writes the even rows in [begin, end) with a cell in 'a' and in 'b:q' */
+void insert(TablePtr &table, int begin, int end, const char *tag) {
+  TableMutatorPtr mutator = table->create_mutator();
+  for (int i=begin; i<end; i+=2) {
+    String row = row_key(i);
+    String value = format("%s%d%s", tag, i, VALUE_PADDING);
+    mutator->set(KeySpec(row.c_str(), "a", ""), value.c_str());
+    mutator->set(KeySpec(row.c_str(), "b", "q"), value.c_str());
+  }
+  mutator->flush();
+}
+
+size_t range_count(ClientPtr &client, const String &table_name) {
+  TablePtr metadata = client->open_table("METADATA");
+  uint32_t table_id = client->get_table_id(table_name);
+  String start_row = format("%u:", (unsigned)table_id);
+  String end_row = format("%u:%s", (unsigned)table_id, Key::END_ROW_MARKER);
+  ScanSpecBuilder ssb;
+  Cell cell;
+  size_t count = 0;
+
+  ssb.add_row_interval(start_row.c_str(), true, end_row.c_str(), true);
+  ssb.add_column("StartRow");
+  ssb.set_max_versions(1);
+
+  TableScannerPtr scanner = metadata->create_scanner(ssb.get());
+  while (scanner->next(cell))
+    count++;
+  return count;
+}
+
+void wait_for_ranges(ClientPtr &client, const String &table_name,
+                     size_t min_ranges) {
+  size_t count = 0;
+  for (int i=0; i<180; i++) {
+    if ((count = range_count(client, table_name)) >= min_ranges)
+      return;
+    poll(0, 0, 1000);
+  }
+  HT_FATALF("Table %s still has %d ranges, expected at least %d",
+            table_name.c_str(), (int)count, (int)min_ranges);
+}
+
+vector<String> get_rows(TablePtr &table, const vector<String> &rows,
+                        const vector<String> &columns,
+                        uint32_t max_versions = 0) {
+  CellsBuilder cb;
+  vector<String> cells;
+
+  table->get_rows(rows, columns, cb, max_versions);
+  foreach(const Cell &cell, cb.get())
+    cells.push_back(format("%s %s%s%s %s", cell.row_key, cell.column_family,
+        *cell.column_qualifier ? ":" : "", cell.column_qualifier,
+        String((const char *)cell.value, cell.value_len).c_str()));
+  return cells;
+}
+
+/**
+ * The cells get_rows() should return for the given rows, where
+ * values[i] lists the values of row i in 'a' from newest to oldest
+ */
+vector<String> expected_cells(const vector<String> &rows, bool want_a,
+                              bool want_b,
+                              const vector< vector<String> > &values,
+                              size_t max_versions) {
+  vector<String> sorted(rows);
+  vector<String> cells;
+
+  sort(sorted.begin(), sorted.end());
+  sorted.erase(unique(sorted.begin(), sorted.end()), sorted.end());
+
+  foreach(const String &row, sorted) {
+    int i = atoi(row.c_str() + 3);
+    if (row.compare(0, 3, "row") || i >= (int)values.size()
+        || values[i].empty())
+      continue;
+    if (want_a)
+      for (size_t v=0; v<values[i].size() && (max_versions == 0
+           || v < max_versions); v++)
+        cells.push_back(format("%s a %s", row.c_str(), values[i][v].c_str()));
+    if (want_b)
+      cells.push_back(format("%s b:q %s", row.c_str(),
+                             values[i].back().c_str()));
+  }
+  return cells;
+}
+
+void record(vector< vector<String> > &values, int begin, int end,
+            const char *tag) {
+  if ((int)values.size() < end)
+    values.resize(end);
+  for (int i=begin; i<end; i+=2)
+    values[i].insert(values[i].begin(),
+                     format("%s%d%s", tag, i, VALUE_PADDING));
+}
+
+void check(const vector<String> &cells, const vector<String> &expected) {
+  if (cells != expected) {
+    HT_ERRORF("get_rows() returned %d cells, expected %d",
+              (int)cells.size(), (int)expected.size());
+    for (size_t i=0; i<cells.size() && i<expected.size(); i++) {
+      if (cells[i] != expected[i]) {
+        HT_ERRORF("first difference at %d: '%s' != '%s'", (int)i,
+                  cells[i].c_str(), expected[i].c_str());
+        break;
+      }
+    }
+    _exit(1);
+  }
+}
+
+} // local namespace
+
+
+int main(int argc, char *argv[]) {
+  try {
+    init_with_policy<DefaultClientPolicy>(argc, argv);
+
+    ClientPtr client = new Hypertable::Client();
+    HqlInterpreterPtr hql = client->create_hql_interpreter();
+    vector< vector<String> > values;
+    vector<String> rows, all_columns, b_column(1, "b");
+
+    hql->execute("drop table if exists get_rows_test");
+    hql->execute("create table get_rows_test(a, b)");
+
+    TablePtr table = client->open_table("get_rows_test");
+
+    insert(table, 0, ROWS, "v");
+    record(values, 0, ROWS, "v");
+    wait_for_ranges(client, "get_rows_test", 3);
+
+    // rows from every range, out of order, with duplicates and with rows
+    // that do not exist before, between and after the stored ones
+    srand(1);
+    for (int i=0; i<ROWS; i+=97) {
+      rows.push_back(row_key(i));
+      if (i % 3 == 0)
+        rows.push_back(row_key(i));
+    }
+    rows.push_back("aaa");
+    rows.push_back(row_key(1));
+    rows.push_back(row_key(ROWS / 2 + 1));
+    rows.push_back(row_key(ROWS + 10));
+    rows.push_back("zzz");
+    random_shuffle(rows.begin(), rows.end());
+
+    vector<String> expected = expected_cells(rows, true, true, values, 0);
+    HT_ASSERT(expected.size() > 100);
+    check(get_rows(table, rows, all_columns), expected);
+
+    // a single missing row and an empty batch return nothing
+    check(get_rows(table, vector<String>(1, row_key(3)), all_columns),
+          vector<String>());
+    check(get_rows(table, vector<String>(), all_columns), vector<String>());
+
+    // column restriction
+    check(get_rows(table, rows, b_column),
+          expected_cells(rows, false, true, values, 0));
+
+    // a newer version of 'a' for the first half of the rows
+    {
+      TableMutatorPtr mutator = table->create_mutator();
+      for (int i=0; i<ROWS/2; i+=2) {
+        String row = row_key(i);
+        String value = format("w%d%s", i, VALUE_PADDING);
+        mutator->set(KeySpec(row.c_str(), "a", ""), value.c_str());
+      }
+      mutator->flush();
+      for (int i=0; i<ROWS/2; i+=2)
+        values[i].insert(values[i].begin(),
+                         format("w%d%s", i, VALUE_PADDING));
+    }
+    check(get_rows(table, rows, all_columns, 1),
+          expected_cells(rows, true, true, values, 1));
+    check(get_rows(table, rows, all_columns),
+          expected_cells(rows, true, true, values, 0));
+
+    // grow the table so that the ranges cached by the first lookups split
+    // again, the stale locations have to be detected and retried
+    size_t ranges = range_count(client, "get_rows_test");
+    insert(table, ROWS, 3 * ROWS, "x");
+    record(values, ROWS, 3 * ROWS, "x");
+    wait_for_ranges(client, "get_rows_test", ranges + 2);
+
+    for (int i=ROWS; i<3*ROWS; i+=101)
+      rows.push_back(row_key(i));
+    random_shuffle(rows.begin(), rows.end());
+    check(get_rows(table, rows, all_columns),
+          expected_cells(rows, true, true, values, 0));
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    _exit(1);
+  }
+  _exit(0);
+}
@@ -0,0 +1,104 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <iostream>
+
+#include "Hypertable/Lib/HqlParser.h"
+
+using namespace Hypertable;
+using namespace Hql;
+using namespace std;
+
+namespace {
+
+  const char *op_names[] = { "", "QE", "QP", "QR", "VE", "VP", "VR",
+                             "AND", "OR", "NOT" };
+
+  /**
+   * Parses a SELECT statement and returns its cell filter in postfix
+   * order, e.g. "QP:a VE:x AND"
+   */
+  String parse_filter(const char *where) {
+    ParserState state;
+    Hql::Parser parser(state);
+    String line = format("SELECT * FROM t WHERE %s", where);
+    parse_info<> info = parse(line.c_str(), parser, space_p);
+    String result;
+
+    HT_ASSERT(info.full);
+    HT_ASSERT(state.command == COMMAND_SELECT);
+
+    foreach(const CellPredicate &cp, state.scan.builder.get().filter) {
+      if (!result.empty())
+        result += " ";
+      result += op_names[cp.op];
+      if (cp.is_match())
+        result += format(":%s", cp.pattern);
+    }
+    return result;
+  }
+
+  void check(const char *where, const char *expected) {
+    String filter = parse_filter(where);
+    if (filter != expected) {
+      cout << "WHERE " << where << "\n  got '" << filter
+           << "', expected '" << expected << "'" << endl;
+      HT_ASSERT(filter == expected);
+    }
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+
+  // each relop selects the exact, prefix or regex flavor of its target
+  check("QUALIFIER = 'a'", "QE:a");
+  check("QUALIFIER =^ 'a'", "QP:a");
+  check("QUALIFIER =~ '^a.*z$'", "QR:^a.*z$");
+  check("VALUE = 'x'", "VE:x");
+  check("VALUE =^ 'x'", "VP:x");
+  check("VALUE =~ 'x|y'", "VR:x|y");
+
+  // a match does not leak its flavor into the next one
+  check("VALUE =~ 'x' AND QUALIFIER = 'a'", "VR:x QE:a AND");
+  check("QUALIFIER =^ 'a' AND VALUE = 'x'", "QP:a VE:x AND");
+
+  // the filter predicates of a WHERE clause are ANDed together
+  check("QUALIFIER = 'a' AND VALUE =^ 'b' AND VALUE =~ 'c'",
+        "QE:a VP:b AND VR:c AND");
+
+  // row and time predicates do not take part in the filter
+  check("ROW = 'r' AND VALUE = 'x'", "VE:x");
+  check("VALUE = 'x' AND ROW =^ 'r' AND QUALIFIER =^ 'q'",
+        "VE:x QP:q AND");
+
+  // parenthesized expressions, OR and NOT stay in postfix order
+  check("(QUALIFIER = 'a' OR NOT VALUE =^ 'b') AND VALUE = 'c'",
+        "QE:a VP:b NOT OR VE:c AND");
+  check("NOT (QUALIFIER =~ 'a' AND VALUE = 'b')", "QR:a VE:b AND NOT");
+
+  cout << "HQL filter test passed" << endl;
+
+  return 0;
+}
@@ -33,6 +33,7 @@ extern "C" {
 
 #include "Hypertable/Lib/KeySpec.h"
 #include "Hypertable/Lib/LoadDataSource.h"
+#include "Hypertable/Lib/LoadDataSourceChunk.h"
 #include "Hypertable/Lib/LoadDataSourceFactory.h"
 
 using namespace Hypertable;
@@ -79,6 +80,39 @@ int main(int argc, char **argv) {
     String sys_cmd = "diff " + output_fn + " " + golden_fn;
     if (system(sys_cmd.c_str()) != 0)
       return 1;
+
+    /**
+     * Parse again in small chunks, as a parallel load does, and make sure
+     * the output is the same
+     */
+    if ((fd = open(output_fn.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0644)) < 0) {
+      perror("open");
+      return 1;
+    }
+
+    close(2);
+    dup(fd);
+
+    lds = LoadDataSourceFactory::create(dat_fn.c_str(), LOCAL_FILE, "", LOCAL_FILE,
+                                        key_columns, "");
+    LoadDataSourcePtr parser = new LoadDataSourceChunk(*lds);
+    LoadDataSourceChunk *chunk_parser = (LoadDataSourceChunk *)parser.get();
+    DynamicBuffer chunk;
+    int64_t start_line;
+
+    while (lds->next_chunk(64, chunk, &start_line, 0)) {
+      chunk_parser->load((const char *)chunk.base, chunk.fill(), start_line);
+      while (parser->next(0, &key, &value, &value_len, 0)) {
+        cerr << "row=" << (const char *)key.row
+             << " column_family=" << key.column_family;
+        if (key.column_qualifier_len > 0)
+          cerr << " column_qualifier=" << (const char *)key.column_qualifier;
+        cerr << " value=" << (const char *)value << endl;
+      }
+    }
+
+    if (system(sys_cmd.c_str()) != 0)
+      return 1;
   }
 
   return 0;
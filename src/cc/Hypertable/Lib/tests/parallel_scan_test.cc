@@ -0,0 +1,134 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <unistd.h>
+#include <vector>
+
+#include "Hypertable/Lib/Config.h"
+#include "Hypertable/Lib/Client.h"
+#include "Hypertable/Lib/HqlInterpreter.h"
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+const int ROWS = 2000;
+const int INTERVALS = 8;
+
+vector<String> scan(Table *table, ScanSpecBuilder &ssb, uint32_t flags) {
+  TableScannerPtr scanner = table->create_scanner(ssb.get(), 0, false, flags);
+  vector<String> cells;
+  Cell cell;
+
+  while (scanner->next(cell))
+    cells.push_back(format("%s %s:%s %s", cell.row_key, cell.column_family,
+        cell.column_qualifier, String((const char *)cell.value,
+                                      cell.value_len).c_str()));
+  return cells;
+}
+
+void add_intervals(ScanSpecBuilder &ssb) {
+  char start[32], end[32];
+  for (int i=0; i<INTERVALS; i++) {
+    sprintf(start, "row%05d", i * ROWS / INTERVALS);
+    sprintf(end, "row%05d", (i + 1) * ROWS / INTERVALS);
+    ssb.add_row_interval(start, true, end, false);
+  }
+}
+
+} // local namespace
+
+
+int main(int argc, char *argv[]) {
+  try {
+    init_with_policy<DefaultClientPolicy>(argc, argv);
+
+    ClientPtr client = new Hypertable::Client();
+    HqlInterpreterPtr hql = client->create_hql_interpreter();
+
+    hql->execute("drop table if exists parallel_scan_test");
+    hql->execute("create table parallel_scan_test(a, b)");
+
+    TablePtr table = client->open_table("parallel_scan_test");
+
+    {
+      TableMutatorPtr mutator = table->create_mutator();
+      char row[32], value[32];
+      for (int i=0; i<ROWS; i++) {
+        sprintf(row, "row%05d", i);
+        sprintf(value, "value%d", i);
+        mutator->set(KeySpec(row, "a", "q"), value);
+        mutator->set(KeySpec(row, "b", ""), value);
+      }
+      mutator->flush();
+    }
+
+    ScanSpecBuilder ssb;
+    add_intervals(ssb);
+    vector<String> expected = scan(table.get(), ssb, 0);
+    HT_ASSERT(expected.size() == (size_t)ROWS * 2);
+
+    // ordered parallel scans return the cells of a sequential scan
+    vector<String> cells = scan(table.get(), ssb,
+                                TableScanner::FLAG_PARALLEL);
+    HT_ASSERT(cells == expected);
+
+    // unordered parallel scans return the same cells in any order
+    cells = scan(table.get(), ssb,
+        TableScanner::FLAG_PARALLEL | TableScanner::FLAG_UNORDERED);
+    HT_ASSERT(cells.size() == expected.size());
+    sort(cells.begin(), cells.end());
+    {
+      vector<String> sorted = expected;
+      sort(sorted.begin(), sorted.end());
+      HT_ASSERT(cells == sorted);
+    }
+
+    // a row limit spanning several intervals is applied across them
+    ssb.set_row_limit(ROWS / INTERVALS + 10);
+    expected = scan(table.get(), ssb, 0);
+    HT_ASSERT(expected.size() == (size_t)(ROWS / INTERVALS + 10) * 2);
+    cells = scan(table.get(), ssb, TableScanner::FLAG_PARALLEL);
+    HT_ASSERT(cells == expected);
+
+    // and is rejected for unordered scans
+    try {
+      scan(table.get(), ssb,
+           TableScanner::FLAG_PARALLEL | TableScanner::FLAG_UNORDERED);
+      HT_ASSERT(!"unordered scan with row limit accepted");
+    }
+    catch (Exception &e) {
+      HT_ASSERT(e.code() == Error::BAD_SCAN_SPEC);
+    }
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    _exit(1);
+  }
+  _exit(0);
+}
@@ -0,0 +1,172 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+#include <iostream>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/ScanSpec.h"
+
+using namespace Hypertable;
+using namespace Serialization;
+using namespace std;
+
+namespace {
+
+  /** Encodes the fields of a spec that every version of the protocol has */
+  void encode_base(const ScanSpec &ss, uint8_t **bufp) {
+    encode_vi32(bufp, ss.row_limit);
+    encode_vi32(bufp, ss.max_versions);
+    encode_vi32(bufp, ss.columns.size());
+    foreach(const char *c, ss.columns) encode_vstr(bufp, c);
+    encode_vi32(bufp, ss.row_intervals.size());
+    foreach(const RowInterval &ri, ss.row_intervals) ri.encode(bufp);
+    encode_vi32(bufp, ss.cell_intervals.size());
+    foreach(const CellInterval &ci, ss.cell_intervals) ci.encode(bufp);
+    encode_i64(bufp, ss.time_interval.first);
+    encode_i64(bufp, ss.time_interval.second);
+    encode_bool(bufp, ss.return_deletes);
+    encode_bool(bufp, ss.keys_only);
+  }
+
+  void check_base(const ScanSpec &a, const ScanSpec &b) {
+    HT_ASSERT(a.row_limit == b.row_limit);
+    HT_ASSERT(a.max_versions == b.max_versions);
+    HT_ASSERT(a.columns.size() == b.columns.size());
+    for (size_t i=0; i<a.columns.size(); i++)
+      HT_ASSERT(!strcmp(a.columns[i], b.columns[i]));
+    HT_ASSERT(a.row_intervals.size() == b.row_intervals.size());
+    for (size_t i=0; i<a.row_intervals.size(); i++) {
+      HT_ASSERT(!strcmp(a.row_intervals[i].start, b.row_intervals[i].start));
+      HT_ASSERT(!strcmp(a.row_intervals[i].end, b.row_intervals[i].end));
+    }
+    HT_ASSERT(a.time_interval == b.time_interval);
+    HT_ASSERT(a.return_deletes == b.return_deletes);
+    HT_ASSERT(a.keys_only == b.keys_only);
+  }
+
+  void check_filter(const ScanSpec &a, const ScanSpec &b) {
+    HT_ASSERT(a.block_size == b.block_size);
+    HT_ASSERT(a.filter.size() == b.filter.size());
+    for (size_t i=0; i<a.filter.size(); i++) {
+      HT_ASSERT(a.filter[i].op == b.filter[i].op);
+      if (a.filter[i].is_match())
+        HT_ASSERT(!strcmp(a.filter[i].pattern, b.filter[i].pattern));
+    }
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  ScanSpecBuilder ssb;
+
+  ssb.set_row_limit(10);
+  ssb.set_max_versions(2);
+  ssb.add_column("a");
+  ssb.add_column("b");
+  ssb.add_row_interval("bar", true, "foo", false);
+  ssb.set_time_interval(100, 200);
+  ssb.set_keys_only(true);
+  ssb.set_block_size(65536);
+  ssb.add_filter(CellPredicate::QUALIFIER_PREFIX, "q");
+  ssb.add_filter(CellPredicate::VALUE_EXACT, "x");
+  ssb.add_filter(CellPredicate::NOT);
+  ssb.add_filter(CellPredicate::AND);
+
+  const ScanSpec &ss = ssb.get();
+
+  // round trip
+  {
+    DynamicBuffer buf(ss.encoded_length());
+    ss.encode(&buf.ptr);
+    HT_ASSERT(buf.fill() == ss.encoded_length());
+
+    const uint8_t *ptr = buf.base;
+    size_t remain = buf.fill();
+    ScanSpec decoded(&ptr, &remain);
+    HT_ASSERT(remain == 0 && ptr == buf.ptr);
+    check_base(ss, decoded);
+    check_filter(ss, decoded);
+  }
+
+  // a spec from a peer that predates the extension block
+  {
+    DynamicBuffer buf(ss.encoded_length());
+    encode_base(ss, &buf.ptr);
+
+    const uint8_t *ptr = buf.base;
+    size_t remain = buf.fill();
+    ScanSpec decoded(&ptr, &remain);
+    HT_ASSERT(remain == 0);
+    check_base(ss, decoded);
+    HT_ASSERT(decoded.block_size == 0);
+    HT_ASSERT(decoded.filter.empty());
+  }
+
+  // a spec from a newer peer whose extension block has fields unknown here
+  {
+    size_t ext_len = ss.encoded_extensions_length() + 3;
+    DynamicBuffer buf(ss.encoded_length() + 8);
+    encode_base(ss, &buf.ptr);
+    encode_vi32(&buf.ptr, ext_len);
+    encode_vi32(&buf.ptr, ss.block_size);
+    encode_vi32(&buf.ptr, ss.filter.size());
+    foreach(const CellPredicate &cp, ss.filter) cp.encode(&buf.ptr);
+    encode_i8(&buf.ptr, 1);
+    encode_i16(&buf.ptr, 2);
+
+    const uint8_t *ptr = buf.base;
+    size_t remain = buf.fill();
+    ScanSpec decoded(&ptr, &remain);
+    HT_ASSERT(remain == 0 && ptr == buf.ptr);
+    check_base(ss, decoded);
+    check_filter(ss, decoded);
+  }
+
+  // an extension block that claims more bytes than the message holds
+  {
+    DynamicBuffer buf(ss.encoded_length() + 8);
+    encode_base(ss, &buf.ptr);
+    encode_vi32(&buf.ptr, 100);
+    encode_vi32(&buf.ptr, ss.block_size);
+
+    const uint8_t *ptr = buf.base;
+    size_t remain = buf.fill();
+    bool thrown = false;
+    try {
+      ScanSpec decoded(&ptr, &remain);
+    }
+    catch (Exception &e) {
+      HT_ASSERT(e.code() == Error::PROTOCOL_ERROR);
+      thrown = true;
+    }
+    HT_ASSERT(thrown);
+  }
+
+  cout << "ScanSpec test passed" << endl;
+
+  return 0;
+}
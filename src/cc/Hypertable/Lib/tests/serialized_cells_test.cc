@@ -0,0 +1,104 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/SerializedCells.h"
+
+using namespace Hypertable;
+using namespace std;
+
+int main(int argc, char **argv) {
+  SerializedCellsWriter writer;
+  char row[32], value[32];
+  int n = 0;
+
+  for (int r = 0; r < 100; r++) {
+    sprintf(row, "row%05d", r);
+    for (int q = 0; q < 3; q++) {
+      Cell cell;
+      sprintf(value, "value-%d-%d", r, q);
+      cell.row_key = row;
+      cell.column_family = "cf";
+      cell.column_qualifier = q ? (q == 1 ? "a" : "b") : "";
+      cell.value = (const uint8_t *)value;
+      cell.value_len = (r % 10) ? strlen(value) : 0;
+      if (r % 2)
+        cell.timestamp = 1000 + r;
+      if (r % 3)
+        cell.revision = 2000 + r;
+      if (q == 2 && r % 7 == 0)
+        cell.flag = FLAG_DELETE_CELL;
+      writer.add(cell);
+    }
+  }
+  writer.finalize();
+  HT_ASSERT(writer.count() == 300);
+
+  SerializedCellsReader reader(writer.get_buffer(), writer.size());
+
+  while (reader.next()) {
+    const Cell &cell = reader.get_cell();
+    int r = n / 3, q = n % 3;
+
+    sprintf(row, "row%05d", r);
+    sprintf(value, "value-%d-%d", r, q);
+    HT_ASSERT(!strcmp(cell.row_key, row));
+    HT_ASSERT(!strcmp(cell.column_family, "cf"));
+    HT_ASSERT(!strcmp(cell.column_qualifier, q ? (q == 1 ? "a" : "b") : ""));
+    if (r % 10) {
+      HT_ASSERT(cell.value_len == strlen(value));
+      HT_ASSERT(!memcmp(cell.value, value, cell.value_len));
+    }
+    else
+      HT_ASSERT(cell.value_len == 0);
+    HT_ASSERT(cell.timestamp == (r % 2 ? (uint64_t)(1000 + r)
+                                       : (uint64_t)AUTO_ASSIGN));
+    HT_ASSERT(cell.revision == (r % 3 ? (uint64_t)(2000 + r)
+                                      : (uint64_t)AUTO_ASSIGN));
+    HT_ASSERT(cell.flag == ((q == 2 && r % 7 == 0) ? FLAG_DELETE_CELL
+                                                   : FLAG_INSERT));
+    n++;
+  }
+  HT_ASSERT(n == 300);
+  HT_ASSERT(!reader.next());
+
+  // a truncated block must be rejected rather than read past its end
+  try {
+    SerializedCellsReader truncated(writer.get_buffer(), writer.size() / 2);
+    while (truncated.next())
+      ;
+    HT_ASSERT(!"truncated block was accepted");
+  }
+  catch (Exception &e) {
+    HT_ASSERT(e.code() == Error::SERIALIZATION_INPUT_OVERRUN);
+  }
+
+  cout << "serialized " << n << " cells in " << writer.size() << " bytes"
+       << endl;
+
+  return 0;
+}
@@ -0,0 +1,319 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <algorithm>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Time.h"
+
+#include "Hypertable/Lib/RangeServerClient.h"
+
+#include "LoadBalancer.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  struct LoadMetric {
+    LoadMetric() : total(0), max(0) { }
+    void add(double value) { total += value; if (value > max) max = value; }
+    double normalize(double value) const { return max > 0 ? value / max : 0; }
+    double total;
+    double max;
+  };
+
+  struct HigherScore {
+    bool operator()(const RangeServerLoad *a, const RangeServerLoad *b) const {
+      return a->score > b->score;
+    }
+  };
+
+  struct LargerRange {
+    bool operator()(const RangeStat *a, const RangeStat *b) const {
+      return a->memory_usage + a->disk_usage > b->memory_usage + b->disk_usage;
+    }
+  };
+
+}
+
+
+/**
+ * A range assigned since the last sample is expected to carry the average
+ * per-range write rate, memory and disk usage of the cluster.
+ */
+void BalancePolicyLoad::compute_scores(vector<RangeServerLoad *> &loads) {
+  LoadMetric write_rate, memory, disk, backlog, ranges;
+  double total_ranges = 0;
+  double avg_write_rate, avg_memory, avg_disk;
+
+  foreach(RangeServerLoad *load, loads) {
+    write_rate.total += load->write_rate;
+    memory.total += load->memory_usage;
+    disk.total += load->disk_usage;
+    total_ranges += load->range_count;
+  }
+
+  if (total_ranges == 0)
+    total_ranges = 1;
+  avg_write_rate = write_rate.total / total_ranges;
+  avg_memory = memory.total / total_ranges;
+  avg_disk = disk.total / total_ranges;
+
+  write_rate = memory = disk = LoadMetric();
+
+  foreach(RangeServerLoad *load, loads) {
+    write_rate.add(load->write_rate + load->assigned * avg_write_rate);
+    memory.add(load->memory_usage + load->assigned * avg_memory);
+    disk.add(load->disk_usage + load->assigned * avg_disk);
+    backlog.add(load->request_backlog);
+    ranges.add(load->range_count + load->assigned);
+  }
+
+  foreach(RangeServerLoad *load, loads) {
+    load->score =
+        write_rate.normalize(load->write_rate + load->assigned * avg_write_rate)
+        + memory.normalize(load->memory_usage + load->assigned * avg_memory)
+        + disk.normalize(load->disk_usage + load->assigned * avg_disk)
+        + backlog.normalize(load->request_backlog)
+        + ranges.normalize(load->range_count + load->assigned);
+  }
+}
+
+
+/**
+ * Each overloaded server sheds its largest user ranges to the least loaded
+ * server, as long as that brings the two closer together.  A range is
+ * assumed to account for a share of its server's score proportional to its
+ * memory and disk usage.
+ */
+void BalancePolicyLoad::plan_moves(vector<RangeServerLoad *> &loads,
+                                   vector<RangeMove> &moves) {
+  double mean = 0, threshold;
+
+  if (loads.size() < 2)
+    return;
+
+  foreach(RangeServerLoad *load, loads)
+    mean += load->score;
+  mean /= loads.size();
+  threshold = mean * (100 + m_imbalance_pct) / 100.0;
+
+  sort(loads.begin(), loads.end(), HigherScore());
+
+  foreach(RangeServerLoad *source, loads) {
+    RangeServerLoad *dest = loads.back();
+    vector<const RangeStat *> candidates;
+    double source_weight = 0;
+
+    if (source->score <= threshold || source == dest)
+      break;
+
+    foreach(const RangeStat &stat, source->range_stats) {
+      source_weight += stat.memory_usage + stat.disk_usage + 1;
+      if (stat.table_identifier.id != 0)
+        candidates.push_back(&stat);
+    }
+    sort(candidates.begin(), candidates.end(), LargerRange());
+
+    foreach(const RangeStat *stat, candidates) {
+      double share = source->score *
+          (stat->memory_usage + stat->disk_usage + 1) / source_weight;
+
+      if (source->score <= threshold || dest->score + share >= source->score)
+        continue;
+
+      RangeMove move;
+      move.table = stat->table_identifier;
+      move.range = stat->range_spec;
+      move.source = source->location;
+      move.destination = dest->location;
+      moves.push_back(move);
+
+      source->score -= share;
+      dest->score += share;
+    }
+  }
+}
+
+
+void BalancePolicyRangeCount::compute_scores(vector<RangeServerLoad *> &loads) {
+  foreach(RangeServerLoad *load, loads)
+    load->score = load->range_count + load->assigned;
+}
+
+
+LoadBalancer::LoadBalancer(PropertiesPtr &props, Comm *comm)
+  : m_comm(comm) {
+  String policy = props->get_str("Hypertable.Master.Balancer.Policy");
+  int32_t imbalance = props->get_i32("Hypertable.Master.Balancer.Imbalance");
+
+  m_interval = props->get_i32("Hypertable.Master.Balancer.Interval");
+  m_timeout = props->get_i32("Hypertable.Request.Timeout");
+
+  if (policy == "load")
+    m_policy = new BalancePolicyLoad(imbalance);
+  else if (policy == "range-count")
+    m_policy = new BalancePolicyRangeCount(imbalance);
+  else
+    HT_THROWF(Error::CONFIG_BAD_VALUE, "Unknown balancer policy '%s'",
+              policy.c_str());
+
+  HT_INFOF("Load balancer using policy '%s', sampling every %d milliseconds",
+           m_policy->name(), m_interval);
+}
+
+
+LoadBalancer::~LoadBalancer() {
+  foreach(LoadMap::value_type &v, m_loads)
+    delete v.second;
+}
+
+
+void LoadBalancer::sample(vector<RangeServerStatePtr> &servers) {
+  RangeServerClient rsc(m_comm, m_timeout);
+  LoadMap loads;
+
+  foreach(RangeServerStatePtr &server, servers) {
+    RangeServerStat stat;
+
+    try {
+      rsc.get_statistics(server->addr, stat);
+    }
+    catch (Exception &e) {
+      HT_WARNF("Unable to fetch statistics from %s - %s",
+               server->location.c_str(), e.what());
+      continue;
+    }
+
+    int64_t now = get_ts64();
+    ScopedLock lock(m_mutex);
+    LoadMap::iterator iter = m_loads.find(server->location);
+    RangeServerLoad *load;
+
+    if (iter == m_loads.end()) {
+      load = new RangeServerLoad();
+      load->location = server->location;
+    }
+    else {
+      load = (*iter).second;
+      m_loads.erase(iter);
+    }
+
+    if (load->sampled && now > load->timestamp &&
+        stat.group_commit_bytes >= load->group_commit_bytes)
+      load->write_rate = (double)(stat.group_commit_bytes
+          - load->group_commit_bytes) * 1000000000.0
+          / (double)(now - load->timestamp);
+
+    load->sampled = true;
+    load->timestamp = now;
+    load->group_commit_bytes = stat.group_commit_bytes;
+    load->cached_cells = 0;
+    load->memory_usage = 0;
+    load->disk_usage = 0;
+    foreach(const RangeStat &rstat, stat.range_stats) {
+      load->cached_cells += rstat.cached_cells;
+      load->memory_usage += rstat.memory_usage;
+      load->disk_usage += rstat.disk_usage;
+    }
+    load->request_backlog = stat.request_backlog;
+    load->range_count = stat.range_stats.size();
+    load->range_stats.swap(stat.range_stats);
+    load->assigned = 0;
+
+    loads[load->location] = load;
+  }
+
+  /**
+   * Keep the previous model of servers that could not be sampled this time
+   * around, drop the ones that are gone.
+   */
+  ScopedLock lock(m_mutex);
+  foreach(RangeServerStatePtr &server, servers) {
+    LoadMap::iterator iter = m_loads.find(server->location);
+    if (iter != m_loads.end()) {
+      loads[server->location] = (*iter).second;
+      m_loads.erase(iter);
+    }
+  }
+  foreach(LoadMap::value_type &v, m_loads)
+    delete v.second;
+  m_loads.swap(loads);
+}
+
+
+size_t LoadBalancer::choose_server(vector<RangeServerStatePtr> &servers) {
+  ScopedLock lock(m_mutex);
+  vector<RangeServerLoad *> loads;
+  size_t best = 0;
+  double best_score = 0;
+
+  HT_ASSERT(!servers.empty());
+
+  /**
+   * Servers that have not been sampled yet get an empty model, which
+   * makes newly joined servers the preferred target for new ranges.
+   */
+  foreach(RangeServerStatePtr &server, servers) {
+    LoadMap::iterator iter = m_loads.find(server->location);
+    if (iter == m_loads.end()) {
+      RangeServerLoad *load = new RangeServerLoad();
+      load->location = server->location;
+      iter = m_loads.insert(LoadMap::value_type(server->location, load)).first;
+    }
+    loads.push_back((*iter).second);
+  }
+
+  m_policy->compute_scores(loads);
+
+  for (size_t i = 0; i < loads.size(); i++) {
+    if (i == 0 || loads[i]->score < best_score) {
+      best = i;
+      best_score = loads[i]->score;
+    }
+  }
+
+  loads[best]->assigned++;
+  return best;
+}
+
+
+void LoadBalancer::rebalance(vector<RangeMove> &moves) {
+  ScopedLock lock(m_mutex);
+  vector<RangeServerLoad *> loads;
+
+  foreach(LoadMap::value_type &v, m_loads) {
+    if (v.second->sampled)
+      loads.push_back(v.second);
+  }
+
+  m_policy->compute_scores(loads);
+  m_policy->plan_moves(loads, moves);
+
+  foreach(RangeMove &move, moves)
+    HT_INFOF("Balancer (%s): proposing move of %s[%s..%s] from %s to %s",
+             m_policy->name(), move.table.name, move.range.start_row,
+             move.range.end_row, move.source.c_str(),
+             move.destination.c_str());
+}
@@ -0,0 +1,185 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_LOADBALANCER_H
+#define HYPERTABLE_LOADBALANCER_H
+
+#include <vector>
+
+#include "Common/HashMap.h"
+#include "Common/Mutex.h"
+#include "Common/Properties.h"
+#include "Common/ReferenceCount.h"
+#include "Common/String.h"
+
+#include "AsyncComm/Comm.h"
+
+#include "Hypertable/Lib/Stat.h"
+#include "Hypertable/Lib/Types.h"
+
+#include "RangeServerState.h"
+
+namespace Hypertable {
+
+  /**
+   * Load model of one RangeServer, built from the RangeServerStat it
+   * returned for the last get_statistics request
+   */
+  class RangeServerLoad {
+  public:
+    RangeServerLoad() : sampled(false), timestamp(0), group_commit_bytes(0),
+        write_rate(0), cached_cells(0), memory_usage(0), disk_usage(0),
+        request_backlog(0), range_count(0), assigned(0), score(0) { }
+
+    String location;
+    bool sampled;
+    int64_t timestamp;              // time of the last sample (ns)
+    uint64_t group_commit_bytes;    // bytes committed as of the last sample
+    double write_rate;              // bytes committed per second
+    uint64_t cached_cells;
+    uint64_t memory_usage;
+    uint64_t disk_usage;
+    uint64_t request_backlog;
+    uint32_t range_count;
+    uint32_t assigned;              // ranges assigned since the last sample
+    std::vector<RangeStat> range_stats;
+    double score;
+  };
+
+  /** A proposed move of a range from one server to another */
+  class RangeMove {
+  public:
+    TableIdentifierManaged table;
+    RangeSpecManaged range;
+    String source;
+    String destination;
+  };
+
+  /**
+   * Interface of the policies that decide how load is measured and when a
+   * cluster is out of balance.
+   */
+  class BalancePolicy : public ReferenceCount {
+  public:
+    virtual ~BalancePolicy() { }
+
+    virtual const char *name() = 0;
+
+    /**
+     * Computes the score of every server, higher meaning more loaded.
+     */
+    virtual void compute_scores(std::vector<RangeServerLoad *> &loads) = 0;
+
+    /**
+     * Appends the range moves needed to bring the cluster back into
+     * balance to moves.  Scores are up to date when this is called.
+     */
+    virtual void plan_moves(std::vector<RangeServerLoad *> &loads,
+                            std::vector<RangeMove> &moves) = 0;
+  };
+
+  typedef intrusive_ptr<BalancePolicy> BalancePolicyPtr;
+
+  /**
+   * Scores servers by a weighted sum of their write rate, memory usage,
+   * disk usage, request backlog and range count, each normalized to the
+   * largest value in the cluster.  Moves ranges off of servers whose score
+   * exceeds the mean by more than the configured imbalance.
+   */
+  class BalancePolicyLoad : public BalancePolicy {
+  public:
+    BalancePolicyLoad(int32_t imbalance_pct) : m_imbalance_pct(imbalance_pct) {}
+    virtual const char *name() { return "load"; }
+    virtual void compute_scores(std::vector<RangeServerLoad *> &loads);
+    virtual void plan_moves(std::vector<RangeServerLoad *> &loads,
+                            std::vector<RangeMove> &moves);
+
+  private:
+    int32_t m_imbalance_pct;
+  };
+
+  /**
+   * Scores servers by their range count only
+   */
+  class BalancePolicyRangeCount : public BalancePolicyLoad {
+  public:
+    BalancePolicyRangeCount(int32_t imbalance_pct)
+      : BalancePolicyLoad(imbalance_pct) { }
+    virtual const char *name() { return "range-count"; }
+    virtual void compute_scores(std::vector<RangeServerLoad *> &loads);
+  };
+
+
+  /**
+   * Placement engine of the Master.  Periodically collects RangeServerStat
+   * from every server to maintain a per-server load model, picks the least
+   * loaded server for new ranges and computes the range moves that would
+   * rebalance a skewed cluster.
+   */
+  class LoadBalancer : public ReferenceCount {
+  public:
+    LoadBalancer(PropertiesPtr &props, Comm *comm);
+    ~LoadBalancer();
+
+    /**
+     * Fetches statistics from each of the given servers and updates their
+     * load model.  Servers that are no longer listed are forgotten.
+     *
+     * @param servers current set of servers
+     */
+    void sample(std::vector<RangeServerStatePtr> &servers);
+
+    /**
+     * Chooses the least loaded of the given servers to receive a new range.
+     * Ranges assigned since the last sample count towards a server's load,
+     * so a burst of splits is spread out.
+     *
+     * @param servers candidate servers, must not be empty
+     * @return index of the chosen server in servers
+     */
+    size_t choose_server(std::vector<RangeServerStatePtr> &servers);
+
+    /**
+     * Computes the range moves that would rebalance the cluster and logs
+     * them.
+     *
+     * @param moves vector to receive the proposed moves
+     */
+    void rebalance(std::vector<RangeMove> &moves);
+
+    int32_t interval() const { return m_interval; }
+
+  private:
+    typedef hash_map<String, RangeServerLoad *> LoadMap;
+
+    Mutex m_mutex;
+    Comm *m_comm;
+    BalancePolicyPtr m_policy;
+    int32_t m_interval;
+    uint32_t m_timeout;
+    LoadMap m_loads;
+  };
+
+  typedef intrusive_ptr<LoadBalancer> LoadBalancerPtr;
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_LOADBALANCER_H
@@ -28,11 +28,14 @@
 
 #include "Common/FileUtils.h"
 #include "Common/InetAddr.h"
+#include "Common/Stopwatch.h"
 #include "Common/SystemInfo.h"
+#include "Common/Time.h"
 
 #include "DfsBroker/Lib/Client.h"
 #include "Hypertable/Lib/LocationCache.h"
 #include "Hypertable/Lib/RangeServerClient.h"
+#include "Hypertable/Lib/RangeServerProtocol.h"
 #include "Hypertable/Lib/RangeState.h"
 #include "Hypertable/Lib/Schema.h"
 #include "Hypertable/Lib/Client.h"
@@ -44,12 +47,35 @@
 #include "ServersDirectoryHandler.h"
 #include "ServerLockFileHandler.h"
 #include "RangeServerState.h"
+#include "RangeServerRecovery.h"
 
 using namespace Hyperspace;
 using namespace Hypertable;
 using namespace Hypertable::DfsBroker;
 using namespace std;
 
+namespace {
+
+  struct RecoverServerWorker {
+    RecoverServerWorker(Master *master, const String &location,
+                        uint64_t handle)
+      : m_master(master), m_location(location), m_handle(handle) { }
+
+    void operator()() { m_master->recover_server(m_location, m_handle); }
+
+    Master *m_master;
+    String m_location;
+    uint64_t m_handle;
+  };
+
+  struct BalancerWorker {
+    BalancerWorker(Master *master) : m_master(master) { }
+    void operator()() { m_master->balance_loop(); }
+    Master *m_master;
+  };
+
+}
+
 namespace Hypertable {
 
 Master::Master(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
@@ -58,8 +84,6 @@ Master::Master(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
     m_app_queue_ptr(app_queue), m_verbose(false), m_dfs_client(0),
     m_initialized(false), m_root_server_connected(false) {
 
-  m_server_map_iter = m_server_map.begin();
-
   m_hyperspace_ptr = new Hyperspace::Session(conn_mgr->get_comm(), props,
                                              &m_hyperspace_session_handler);
   uint32_t timeout = props->get_i32("Hyperspace.Timeout");
@@ -72,6 +96,10 @@ Master::Master(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   m_verbose = props->get_bool("Hypertable.Verbose");
   uint16_t port = props->get_i16("Hypertable.Master.Port");
   m_max_range_bytes = props->get_i64("Hypertable.RangeServer.Range.SplitSize");
+  m_range_recovery = props->get_bool("Hypertable.Master.RangeRecovery");
+  m_balance = props->get_bool("Hypertable.Master.Balancer.Enable");
+  m_shutdown = false;
+  m_balancer = new LoadBalancer(props, conn_mgr->get_comm());
 
   /**
    * Create DFS Client connection
@@ -145,6 +173,9 @@ Master::Master(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   scan_servers_directory();
 
   master_gc_start(props, m_threads, m_metadata_table_ptr, m_dfs_client);
+
+  if (m_balance)
+    m_threads.create_thread(BalancerWorker(this));
 }
 
 
@@ -188,11 +219,6 @@ void Master::server_left(const String &location) {
     return;
   }
 
-  // if we're about to delete the item pointing to the server map iterator,
-  // then advance the iterator
-  if (iter == m_server_map_iter)
-    ++m_server_map_iter;
-
   m_hyperspace_ptr->try_lock((*iter).second->hyperspace_handle,
       LOCK_MODE_EXCLUSIVE, &lock_status, &lock_sequencer);
 
@@ -203,12 +229,23 @@ void Master::server_left(const String &location) {
     return;
   }
 
-  try {
-    m_hyperspace_ptr->close((*iter).second->hyperspace_handle);
-    m_hyperspace_ptr->unlink(hsfname);
-  }
-  catch (Exception &e) {
-    HT_WARN_OUT "Problem closing file '" << hsfname << "' - " << e << HT_END;
+  /**
+   * While the server file is locked the server cannot rejoin and append to
+   * its commit logs, so recovery keeps holding the lock until it has moved
+   * the logs aside.
+   */
+  uint64_t handle = (*iter).second->hyperspace_handle;
+  if (!m_range_recovery)
+    remove_server_file(handle, location);
+
+  // ranges pinned to the failed server get reassigned on the next retry
+  RangeToAddrMap::iterator range_iter = m_range_to_server_map.begin();
+  while (range_iter != m_range_to_server_map.end()) {
+    if (!memcmp(&(*range_iter).second, &(*iter).second->addr,
+                sizeof(struct sockaddr_in)))
+      m_range_to_server_map.erase(range_iter++);
+    else
+      ++range_iter;
   }
 
   m_server_map.erase(iter);
@@ -220,8 +257,163 @@ void Master::server_left(const String &location) {
   cout << flush;
 
   /**
-   *  Do (or schedule) tablet re-assignment here
+   * Reassign the server's ranges to the remaining servers
    */
+  if (m_range_recovery)
+    m_threads.create_thread(RecoverServerWorker(this, location, handle));
+}
+
+
+
+void Master::remove_server_file(uint64_t handle, const String &location) {
+  String hsfname = (String)"/hypertable/servers/" + location;
+
+  try {
+    m_hyperspace_ptr->close(handle);
+    m_hyperspace_ptr->unlink(hsfname);
+  }
+  catch (Exception &e) {
+    HT_WARN_OUT "Problem closing file '" << hsfname << "' - " << e << HT_END;
+  }
+}
+
+
+
+/**
+ * Reads the failed server's RangeServerMetaLog, splits its commit logs into
+ * per-range transfer logs and loads the ranges on the remaining servers.
+ * The ROOT range is recovered first, then the other METADATA ranges and
+ * then the user ranges, since loading a range requires updating the level
+ * of METADATA above it.  The failed server's lock file is removed once its
+ * logs have been moved aside.
+ */
+void Master::recover_server(const String &location, uint64_t handle) {
+  RangeServerRecovery recovery(m_props_ptr, m_conn_manager_ptr->get_comm(),
+                               m_dfs_client, location);
+  vector<RangeServerStatePtr> servers;
+  int groups[] = { RangeServerProtocol::GROUP_METADATA_ROOT,
+                   RangeServerProtocol::GROUP_METADATA,
+                   RangeServerProtocol::GROUP_USER };
+  Stopwatch stopwatch;
+  bool prepared;
+
+  try {
+
+    {
+      ScopedLock lock(m_mutex);
+      if (m_server_map.empty()) {
+        HT_ERRORF("No servers available to take over the ranges of %s, "
+                  "they will be recovered when it restarts", location.c_str());
+        remove_server_file(handle, location);
+        return;
+      }
+    }
+
+    try {
+      prepared = recovery.prepare();
+    }
+    catch (Exception &e) {
+      remove_server_file(handle, location);
+      throw;
+    }
+    remove_server_file(handle, location);
+
+    if (!prepared) {
+      HT_INFOF("No ranges to recover for %s", location.c_str());
+      return;
+    }
+
+    for (size_t i = 0; i < sizeof(groups) / sizeof(groups[0]); i++) {
+
+      recovery.split_log(groups[i]);
+
+      {
+        ScopedLock lock(m_mutex);
+        servers.clear();
+        foreach(ServerMap::value_type &v, m_server_map)
+          servers.push_back(v.second);
+      }
+
+      if (!recovery.load_ranges(groups[i], servers)) {
+        HT_ERRORF("Recovery of %s incomplete, remaining logs left in "
+                  "/hypertable/servers/%s/log/recover", location.c_str(),
+                  location.c_str());
+        return;
+      }
+
+      if (groups[i] == RangeServerProtocol::GROUP_METADATA_ROOT &&
+          !recovery.root_location().empty()) {
+        ScopedLock lock(m_root_server_mutex);
+        m_root_server_location = recovery.root_location();
+        m_root_server_connected = true;
+        m_root_server_cond.notify_all();
+      }
+    }
+
+    recovery.finish();
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << "Problem recovering ranges of " << location << " - "
+                 << e << HT_END;
+    return;
+  }
+
+  HT_INFOF("Recovered ranges of %s in %.3f seconds", location.c_str(),
+           stopwatch.elapsed());
+}
+
+
+
+/**
+ * Moving a range requires the source server to relinquish it, which the
+ * RangeServer does not support yet, so the proposed moves are only logged.
+ */
+void Master::balance_loop() {
+  vector<RangeServerStatePtr> servers;
+  vector<RangeMove> moves;
+
+  while (true) {
+    {
+      ScopedLock lock(m_mutex);
+      boost::xtime expire_time;
+
+      boost::xtime_get(&expire_time, boost::TIME_UTC);
+      xtime_add_millis(expire_time, m_balancer->interval());
+      while (!m_shutdown && m_balancer_cond.timed_wait(lock, expire_time))
+        ;
+      if (m_shutdown)
+        break;
+
+      servers.clear();
+      foreach(ServerMap::value_type &v, m_server_map)
+        servers.push_back(v.second);
+    }
+
+    try {
+      m_balancer->sample(servers);
+      moves.clear();
+      m_balancer->rebalance(moves);
+    }
+    catch (Exception &e) {
+      HT_ERROR_OUT << "Problem balancing load - " << e << HT_END;
+    }
+  }
+}
+
+
+
+/**
+ * Chooses the server that receives a new range.  Caller must hold m_mutex.
+ */
+RangeServerStatePtr Master::choose_server() {
+  vector<RangeServerStatePtr> servers;
+
+  HT_ASSERT(!m_server_map.empty());
+
+  foreach(ServerMap::value_type &v, m_server_map)
+    servers.push_back(v.second);
+
+  return servers[m_balancer->choose_server(servers)];
 }
 
 
@@ -762,15 +954,10 @@ Master::report_split(ResponseCallback *cb, const TableIdentifier &table,
       server_pinned = true;
     }
     else {
-      if (m_server_map_iter == m_server_map.end())
-        m_server_map_iter = m_server_map.begin();
-      assert(m_server_map_iter != m_server_map.end());
-      memcpy(&addr, &((*m_server_map_iter).second->addr),
-             sizeof(struct sockaddr_in));
+      RangeServerStatePtr server = choose_server();
+      memcpy(&addr, &server->addr, sizeof(struct sockaddr_in));
       HT_INFOF("Assigning newly reported range %s[%s:%s] to %s", table.name,
-               range.start_row, range.end_row,
-               (*m_server_map_iter).first.c_str());
-      ++m_server_map_iter;
+               range.start_row, range.end_row, server->location.c_str());
     }
   }
 
@@ -966,6 +1153,9 @@ Master::drop_table(ResponseCallback *cb, const char *table_name,
       ScopedLock lock(m_mutex);
       boost::xtime expire_time;
 
+      m_shutdown = true;
+      m_balancer_cond.notify_all();
+
       // issue shutdown commands
       for (ServerMap::iterator iter = m_server_map.begin();
            iter != m_server_map.end(); ++iter)
@@ -1108,14 +1298,10 @@ Master::create_table(const char *tablename, const char *schemastr) {
 
     {
       ScopedLock lock(m_mutex);
-      if (m_server_map_iter == m_server_map.end())
-        m_server_map_iter = m_server_map.begin();
-      assert(m_server_map_iter != m_server_map.end());
-      memcpy(&addr, &((*m_server_map_iter).second->addr),
-             sizeof(struct sockaddr_in));
+      RangeServerStatePtr server = choose_server();
+      memcpy(&addr, &server->addr, sizeof(struct sockaddr_in));
       HT_INFOF("Assigning first range %s[%s:%s] to %s", table.name,
-          range.start_row, range.end_row, (*m_server_map_iter).first.c_str());
-      ++m_server_map_iter;
+          range.start_row, range.end_row, server->location.c_str());
       soft_limit = m_max_range_bytes / std::min(64, (int)m_server_map.size()*2);
     }
 
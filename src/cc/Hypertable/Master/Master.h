@@ -55,6 +55,7 @@ extern "C" {
 #include "HyperspaceSessionHandler.h"
 #include "RangeServerState.h"
 #include "ResponseCallbackGetSchema.h"
+#include "LoadBalancer.h"
 #include "MasterGc.h"
 
 namespace Hypertable {
@@ -83,6 +84,28 @@ namespace Hypertable {
     void server_joined(const String &location);
     void server_left(const String &location);
 
+    /**
+     * Reassigns the ranges of a RangeServer that has died to the remaining
+     * servers.  Called from a separate thread by server_left.
+     *
+     * @param location location of the failed server
+     * @param handle exclusively locked handle of the server's Hyperspace file
+     */
+    void recover_server(const String &location, uint64_t handle);
+
+    /**
+     * Periodically samples the load of every RangeServer and logs the range
+     * moves that would rebalance the cluster.  Runs in its own thread when
+     * Hypertable.Master.Balancer.Enable is set, until shutdown.
+     */
+    void balance_loop();
+
+    /**
+     * Closes the handle of a server's Hyperspace file, releasing its lock,
+     * and removes the file.
+     */
+    void remove_server_file(uint64_t handle, const String &location);
+
     void join();
 
   protected:
@@ -93,6 +116,7 @@ namespace Hypertable {
     void scan_servers_directory();
     bool create_hyperspace_dir(const String &dir);
     void wait_for_root_metadata_server();
+    RangeServerStatePtr choose_server();
 
     Mutex        m_mutex;
     PropertiesPtr m_props_ptr;
@@ -109,6 +133,9 @@ namespace Hypertable {
     HandleCallbackPtr m_servers_dir_callback_ptr;
     TablePtr m_metadata_table_ptr;
     uint64_t m_max_range_bytes;
+    bool m_range_recovery;
+    bool m_balance;
+    bool m_shutdown;
 
     /** temporary vairables **/
     bool m_initialized;
@@ -122,7 +149,8 @@ namespace Hypertable {
                      QualifiedRangeHash, QualifiedRangeEqual> RangeToAddrMap;
 
     ServerMap  m_server_map;
-    ServerMap::iterator m_server_map_iter;
+    LoadBalancerPtr m_balancer;
+    boost::condition  m_balancer_cond;
     boost::condition  m_no_servers_cond;
 
     RangeToAddrMap m_range_to_server_map;
@@ -0,0 +1,388 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+#include <set>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/md5.h"
+
+#include "AsyncComm/DispatchHandlerSynchronizer.h"
+#include "AsyncComm/Protocol.h"
+
+#include "Hypertable/Lib/BlockCompressionHeaderCommitLog.h"
+#include "Hypertable/Lib/CommitLogReader.h"
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/RangeServerClient.h"
+#include "Hypertable/Lib/RangeServerProtocol.h"
+
+#include "RangeServerRecovery.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  /**
+   * Commit log directory of each range group, indexed by
+   * RangeServerProtocol::GROUP_*
+   */
+  const char *group_log_dirs[] = { "root", "metadata", "user" };
+  const char *group_names[] = { "ROOT", "METADATA", "user" };
+
+}
+
+
+RangeServerRecovery::RangeServerRecovery(PropertiesPtr &props, Comm *comm,
+    Filesystem *fs, const String &location)
+  : m_props(props), m_comm(comm), m_fs(fs), m_location(location),
+    m_next_server(0) {
+  m_log_dir = (String)"/hypertable/servers/" + location + "/log";
+  m_recover_dir = m_log_dir + "/recover";
+}
+
+
+RangeServerRecovery::~RangeServerRecovery() {
+  for (int group = 0; group < 3; group++) {
+    foreach(RecoveredRange *rr, m_groups[group])
+      delete rr;
+  }
+}
+
+
+bool RangeServerRecovery::prepare() {
+  const char *dirs[] = { "range_txn", "root", "metadata", "user" };
+  String src, dst;
+  char md5DigestStr[33];
+
+  m_fs->mkdirs(m_recover_dir);
+
+  /**
+   * If a previous recovery attempt was interrupted, pick up the logs it
+   * already moved aside.
+   */
+  for (size_t i = 0; i < sizeof(dirs) / sizeof(dirs[0]); i++) {
+    src = m_log_dir + "/" + dirs[i];
+    dst = m_recover_dir + "/" + dirs[i];
+    if (m_fs->exists(dst))
+      HT_INFOF("Resuming interrupted recovery of '%s'", dst.c_str());
+    else if (m_fs->exists(src))
+      m_fs->rename(src, dst);
+  }
+
+  src = m_recover_dir + "/range_txn";
+  if (!m_fs->exists(src))
+    return false;
+
+  m_rsml_reader = new RangeServerMetaLogReader(m_fs, src);
+  if (m_rsml_reader->empty())
+    return false;
+
+  const RangeStates &range_states = m_rsml_reader->load_range_states();
+
+  foreach(RangeStateInfo *i, range_states) {
+    RecoveredRange *rr = new RecoveredRange();
+    int group;
+
+    if (i->table.id != 0)
+      group = RangeServerProtocol::GROUP_USER;
+    else if (i->range.end_row && !strcmp(i->range.end_row, Key::END_ROOT_ROW))
+      group = RangeServerProtocol::GROUP_METADATA_ROOT;
+    else
+      group = RangeServerProtocol::GROUP_METADATA;
+
+    if (!i->transactions.empty())
+      HT_INFO_OUT << "Recovering range with pending transaction "
+                  << *i << HT_END;
+
+    md5_string(i->range.end_row, md5DigestStr);
+    md5DigestStr[24] = 0;
+
+    rr->info = i;
+    rr->transfer_log = format("%s/transfer/%u-%s", m_recover_dir.c_str(),
+                              (unsigned)i->table.id, md5DigestStr);
+    m_groups[group].push_back(rr);
+  }
+
+  HT_INFOF("Recovering %lu ROOT, %lu METADATA and %lu user ranges of %s",
+           (Lu)m_groups[RangeServerProtocol::GROUP_METADATA_ROOT].size(),
+           (Lu)m_groups[RangeServerProtocol::GROUP_METADATA].size(),
+           (Lu)m_groups[RangeServerProtocol::GROUP_USER].size(),
+           m_location.c_str());
+
+  return true;
+}
+
+
+/**
+ * Finds the range of the table that contains row, i.e. the first range
+ * whose end row is >= row, provided its start row is < row.
+ */
+RangeServerRecovery::RecoveredRange *
+RangeServerRecovery::find_range(TableMap::iterator &table_iter,
+                                const char *row) {
+  EndRowMap::iterator iter = (*table_iter).second.lower_bound(row);
+
+  if (iter == (*table_iter).second.end())
+    return 0;
+
+  const char *start_row = (*iter).second->info->range.start_row;
+  if (start_row && strcmp(row, start_row) <= 0)
+    return 0;
+
+  return (*iter).second;
+}
+
+
+void RangeServerRecovery::split_log(int group) {
+  String log_dir = m_recover_dir + "/" + group_log_dirs[group];
+  BlockCompressionHeaderCommitLog header;
+  CommitLogReaderPtr log_reader;
+  const uint8_t *base, *ptr, *end;
+  size_t len;
+  TableIdentifier table_id;
+  SerializedKey key;
+  ByteString value;
+  TableMap tables;
+  vector<RecoveredRange *> touched;
+  size_t block_count = 0, cell_count = 0;
+  int error;
+
+  if (m_groups[group].empty() || !m_fs->exists(log_dir))
+    return;
+
+  foreach(RecoveredRange *rr, m_groups[group])
+    tables[rr->info->table.id][rr->info->range.end_row] = rr;
+
+  log_reader = new CommitLogReader(m_fs, log_dir);
+
+  while (log_reader->next(&base, &len, &header)) {
+
+    ptr = base;
+    end = base + len;
+
+    table_id.decode(&ptr, &len);
+
+    TableMap::iterator table_iter = tables.find(table_id.id);
+    if (table_iter == tables.end())
+      continue;
+
+    while (ptr < end) {
+
+      key.ptr = ptr;
+      ptr += key.length();
+      if (ptr > end)
+        HT_THROW(Error::REQUEST_TRUNCATED, "Problem decoding key");
+
+      value.ptr = ptr;
+      ptr += value.length();
+      if (ptr > end)
+        HT_THROW(Error::REQUEST_TRUNCATED, "Problem decoding value");
+
+      // updates for rows the server no longer owned are dropped
+      RecoveredRange *rr = find_range(table_iter, key.row());
+      if (rr == 0)
+        continue;
+
+      if (rr->buf.fill() == 0) {
+        rr->buf.reserve(table_id.encoded_length());
+        table_id.encode(&rr->buf.ptr);
+        touched.push_back(rr);
+      }
+      rr->buf.add(key.ptr, ptr - key.ptr);
+      cell_count++;
+    }
+
+    /**
+     * Append the updates of this block to the transfer log of each range
+     * they belong to, creating the transfer log on first use
+     */
+    foreach(RecoveredRange *rr, touched) {
+      if (!rr->log) {
+        if (m_fs->exists(rr->transfer_log))
+          m_fs->rmdir(rr->transfer_log);
+        m_fs->mkdirs(rr->transfer_log);
+        rr->log = new CommitLog(m_fs, rr->transfer_log, m_props);
+      }
+      if ((error = rr->log->write(rr->buf, header.get_revision(), false))
+          != Error::OK)
+        HT_THROWF(error, "Problem writing %lu bytes to transfer log '%s'",
+                  (Lu)rr->buf.fill(), rr->transfer_log.c_str());
+      rr->buf.clear();
+    }
+    touched.clear();
+    block_count++;
+  }
+
+  foreach(RecoveredRange *rr, m_groups[group]) {
+    if (rr->log) {
+      if ((error = rr->log->close()) != Error::OK)
+        HT_THROWF(error, "Problem closing transfer log '%s'",
+                  rr->transfer_log.c_str());
+      rr->log = 0;
+    }
+    else
+      rr->transfer_log = "";
+    rr->buf.free();
+  }
+
+  HT_INFOF("Split %lu updates (%lu blocks) from '%s' into per-range transfer "
+           "logs", (Lu)cell_count, (Lu)block_count, log_dir.c_str());
+}
+
+
+bool RangeServerRecovery::load_ranges(int group,
+                                      vector<RangeServerStatePtr> &servers) {
+  RangeServerClient rsc(m_comm);
+  vector<RecoveredRange *> pending = m_groups[group];
+  vector<RecoveredRange *> failed;
+  vector<DispatchHandlerSynchronizer *> handlers;
+  EventPtr event_ptr;
+  int error;
+
+  if (pending.empty())
+    return true;
+
+  if (servers.empty()) {
+    HT_ERRORF("No servers available to take over %lu %s ranges of %s",
+              (Lu)pending.size(), group_names[group], m_location.c_str());
+    return false;
+  }
+
+  /**
+   * Each attempt fans the pending ranges out to the servers in parallel,
+   * then waits for all of the responses.  A range that fails to load is
+   * retried on a different server in the next attempt.
+   */
+  for (size_t attempt = 0; attempt < servers.size() && !pending.empty();
+       attempt++) {
+
+    for (size_t i = 0; i < pending.size(); i++) {
+      RecoveredRange *rr = pending[i];
+      RangeServerStatePtr &server =
+          servers[(m_next_server + i + attempt) % servers.size()];
+      DispatchHandlerSynchronizer *handler = new DispatchHandlerSynchronizer();
+
+      rr->location = server->location;
+      HT_INFOF("Assigning %s[%s..%s] of %s to %s", rr->info->table.name,
+               rr->info->range.start_row, rr->info->range.end_row,
+               m_location.c_str(), server->location.c_str());
+      try {
+        rsc.load_range(server->addr, rr->info->table, rr->info->range,
+                       rr->transfer_log.c_str(), rr->info->range_state,
+                       handler);
+      }
+      catch (Exception &e) {
+        HT_ERROR_OUT << e << HT_END;
+        delete handler;
+        handler = 0;
+      }
+      handlers.push_back(handler);
+    }
+
+    for (size_t i = 0; i < pending.size(); i++) {
+      RecoveredRange *rr = pending[i];
+
+      if (handlers[i] == 0) {
+        failed.push_back(rr);
+        continue;
+      }
+
+      if (!handlers[i]->wait_for_reply(event_ptr)) {
+        if (event_ptr->type == Event::MESSAGE)
+          error = Protocol::response_code(event_ptr);
+        else
+          error = event_ptr->error;
+
+        if (error != Error::RANGESERVER_RANGE_ALREADY_LOADED) {
+          HT_ERRORF("Problem loading %s[%s..%s] at %s - %s",
+                    rr->info->table.name, rr->info->range.start_row,
+                    rr->info->range.end_row, rr->location.c_str(),
+                    Error::get_text(error));
+          failed.push_back(rr);
+        }
+      }
+      delete handlers[i];
+    }
+
+    m_next_server += pending.size();
+    handlers.clear();
+    pending.swap(failed);
+    failed.clear();
+  }
+
+  if (!pending.empty()) {
+    HT_ERRORF("Unable to reassign %lu %s ranges of %s", (Lu)pending.size(),
+              group_names[group], m_location.c_str());
+    return false;
+  }
+
+  if (group == RangeServerProtocol::GROUP_METADATA_ROOT)
+    m_root_location = m_groups[group].front()->location;
+
+  HT_INFOF("Reassigned %lu %s ranges of %s", (Lu)m_groups[group].size(),
+           group_names[group], m_location.c_str());
+  return true;
+}
+
+
+void RangeServerRecovery::finish() {
+  const char *dirs[] = { "range_txn", "root", "metadata", "user" };
+  String dir, transfer_dir = m_recover_dir + "/transfer";
+  std::set<String> linked;
+  std::vector<String> listing;
+
+  for (size_t i = 0; i < sizeof(dirs) / sizeof(dirs[0]); i++) {
+    dir = m_recover_dir + "/" + dirs[i];
+    if (m_fs->exists(dir))
+      m_fs->rmdir(dir);
+  }
+
+  /**
+   * Transfer logs of loaded ranges belong to the commit logs they were
+   * linked into and get purged from there; anything else under transfer/
+   * is left over from an interrupted attempt.
+   */
+  for (int group = 0; group < 3; group++) {
+    foreach(RecoveredRange *rr, m_groups[group]) {
+      if (!rr->transfer_log.empty())
+        linked.insert(rr->transfer_log);
+    }
+  }
+
+  if (m_fs->exists(transfer_dir)) {
+    m_fs->readdir(transfer_dir, listing);
+    foreach(const String &entry, listing) {
+      dir = transfer_dir + "/" + entry;
+      if (linked.count(dir) == 0)
+        m_fs->rmdir(dir);
+    }
+    if (linked.empty())
+      m_fs->rmdir(transfer_dir);
+  }
+
+  listing.clear();
+  m_fs->readdir(m_recover_dir, listing);
+  if (listing.empty())
+    m_fs->rmdir(m_recover_dir);
+}
@@ -0,0 +1,134 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_RANGESERVERRECOVERY_H
+#define HYPERTABLE_RANGESERVERRECOVERY_H
+
+#include <map>
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/HashMap.h"
+#include "Common/Properties.h"
+#include "Common/String.h"
+
+#include "AsyncComm/Comm.h"
+
+#include "Hypertable/Lib/CommitLog.h"
+#include "Hypertable/Lib/Filesystem.h"
+#include "Hypertable/Lib/RangeServerMetaLogReader.h"
+
+#include "RangeServerState.h"
+
+namespace Hypertable {
+
+  /**
+   * Reassigns the ranges of a RangeServer that has died to the remaining
+   * servers.  The failed server's RangeServerMetaLog is read to determine
+   * the ranges it owned, its commit logs are split into one transfer log per
+   * range, and the ranges are loaded, along with their transfer logs, on
+   * the surviving servers.  Recovery proceeds one range group at a time
+   * (ROOT, then METADATA, then user ranges), and all of the ranges of a
+   * group are loaded in parallel.
+   */
+  class RangeServerRecovery {
+  public:
+    RangeServerRecovery(PropertiesPtr &props, Comm *comm, Filesystem *fs,
+                        const String &location);
+    ~RangeServerRecovery();
+
+    /**
+     * Moves the failed server's commit logs and RangeServerMetaLog aside,
+     * so that the server won't reload the ranges if it is restarted, and
+     * reads the set of ranges to be recovered.
+     *
+     * @return false if the server had no ranges to recover
+     */
+    bool prepare();
+
+    /**
+     * Splits the commit log of the given range group into per-range
+     * transfer logs.
+     *
+     * @param group range group (RangeServerProtocol::GROUP_*)
+     */
+    void split_log(int group);
+
+    /**
+     * Loads all of the ranges of the given group in parallel, assigning
+     * them to the supplied servers round-robin.  Ranges that fail to load
+     * are retried on the next server.
+     *
+     * @param group range group (RangeServerProtocol::GROUP_*)
+     * @param servers servers that can take on ranges
+     * @return true if every range of the group was loaded
+     */
+    bool load_ranges(int group, std::vector<RangeServerStatePtr> &servers);
+
+    /**
+     * Removes the failed server's commit logs and RangeServerMetaLog along
+     * with any transfer logs that were not handed to a server, then the
+     * transfer and recover directories once they are empty.  Transfer logs
+     * linked into the commit logs of the servers that took over the ranges
+     * are removed by those servers when they purge them.
+     */
+    void finish();
+
+    /**
+     * Returns the location of the server that took over the root range, or
+     * the empty string if the failed server did not hold it.
+     */
+    const String &root_location() const { return m_root_location; }
+
+    size_t range_count(int group) const { return m_groups[group].size(); }
+
+  private:
+
+    struct RecoveredRange {
+      RecoveredRange() : info(0) { }
+      RangeStateInfo *info;
+      String          transfer_log;
+      CommitLogPtr    log;
+      DynamicBuffer   buf;
+      String          location;
+    };
+
+    typedef std::map<String, RecoveredRange *> EndRowMap;
+    typedef hash_map<uint32_t, EndRowMap> TableMap;
+
+    RecoveredRange *find_range(TableMap::iterator &table_iter,
+                               const char *row);
+
+    PropertiesPtr m_props;
+    Comm *m_comm;
+    Filesystem *m_fs;
+    String m_location;
+    String m_log_dir;
+    String m_recover_dir;
+    size_t m_next_server;
+    RangeServerMetaLogReaderPtr m_rsml_reader;
+    std::vector<RecoveredRange *> m_groups[3];
+    String m_root_location;
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_RANGESERVERRECOVERY_H
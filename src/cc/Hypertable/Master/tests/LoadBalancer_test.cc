@@ -0,0 +1,172 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+
+#include <iostream>
+#include <vector>
+
+#include "Hypertable/Lib/Config.h"
+
+#include "../LoadBalancer.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  void add_range(RangeServerLoad &load, uint32_t table_id, const char *end_row,
+                 uint64_t memory_usage) {
+    RangeStat stat;
+    TableIdentifier table;
+    table.name = table_id ? "test" : "METADATA";
+    table.id = table_id;
+    table.generation = 1;
+    stat.table_identifier = table;
+    stat.range_spec = RangeSpec("", end_row);
+    stat.memory_usage = memory_usage;
+    stat.disk_usage = 0;
+    load.range_stats.push_back(stat);
+    load.range_count++;
+    load.sampled = true;
+  }
+
+  RangeServerStatePtr make_server(const char *location) {
+    RangeServerStatePtr server = new RangeServerState();
+    server->location = location;
+    return server;
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  Config::init(argc, argv);
+
+  // range-count scores count ranges assigned since the last sample
+  {
+    BalancePolicyRangeCount policy(25);
+    RangeServerLoad a, b;
+    vector<RangeServerLoad *> loads;
+    add_range(a, 1, "m", 10);
+    add_range(a, 1, "z", 10);
+    b.assigned = 3;
+    loads.push_back(&a);
+    loads.push_back(&b);
+    policy.compute_scores(loads);
+    HT_ASSERT(a.score == 2);
+    HT_ASSERT(b.score == 3);
+  }
+
+  // load scores weigh every metric, and assigned ranges carry the average
+  {
+    BalancePolicyLoad policy(25);
+    RangeServerLoad a, b, c;
+    vector<RangeServerLoad *> loads;
+    a.write_rate = 1000;
+    a.memory_usage = 100;
+    a.disk_usage = 100;
+    a.request_backlog = 10;
+    a.range_count = 2;
+    b.write_rate = 500;
+    b.memory_usage = 50;
+    b.disk_usage = 50;
+    b.request_backlog = 5;
+    b.range_count = 1;
+    loads.push_back(&a);
+    loads.push_back(&b);
+    loads.push_back(&c);
+    policy.compute_scores(loads);
+    HT_ASSERT(a.score == 5);
+    HT_ASSERT(b.score == 2.5);
+    HT_ASSERT(c.score == 0);
+
+    c.assigned = 1;
+    policy.compute_scores(loads);
+    HT_ASSERT(c.score > 0 && c.score < b.score);
+  }
+
+  // the overloaded server sheds its largest user ranges to the least loaded
+  {
+    BalancePolicyRangeCount policy(25);
+    RangeServerLoad a, b, c;
+    vector<RangeServerLoad *> loads;
+    vector<RangeMove> moves;
+    a.location = "a";
+    add_range(a, 0, "meta", 1000);
+    add_range(a, 1, "r100", 100);
+    add_range(a, 1, "r400", 400);
+    add_range(a, 1, "r200", 200);
+    add_range(a, 1, "r300", 300);
+    b.location = "b";
+    add_range(b, 1, "b", 100);
+    c.location = "c";
+    loads.push_back(&c);
+    loads.push_back(&a);
+    loads.push_back(&b);
+    policy.compute_scores(loads);
+    policy.plan_moves(loads, moves);
+    HT_ASSERT(moves.size() == 4);
+    HT_ASSERT(!strcmp(moves[0].range.end_row, "r400"));
+    HT_ASSERT(!strcmp(moves[3].range.end_row, "r100"));
+    foreach(RangeMove &move, moves) {
+      HT_ASSERT(move.table.id != 0);
+      HT_ASSERT(move.source == "a" && move.destination == "c");
+    }
+  }
+
+  // balanced clusters and single servers need no moves
+  {
+    BalancePolicyRangeCount policy(25);
+    RangeServerLoad a, b;
+    vector<RangeServerLoad *> loads;
+    vector<RangeMove> moves;
+    add_range(a, 1, "m", 100);
+    add_range(b, 1, "z", 100);
+    loads.push_back(&a);
+    policy.compute_scores(loads);
+    policy.plan_moves(loads, moves);
+    HT_ASSERT(moves.empty());
+    loads.push_back(&b);
+    policy.compute_scores(loads);
+    policy.plan_moves(loads, moves);
+    HT_ASSERT(moves.empty());
+  }
+
+  // new ranges are spread over servers that have not been sampled yet
+  {
+    LoadBalancer balancer(Config::properties, 0);
+    vector<RangeServerStatePtr> servers;
+    vector<RangeMove> moves;
+    servers.push_back(make_server("a"));
+    servers.push_back(make_server("b"));
+    servers.push_back(make_server("c"));
+    for (size_t i = 0; i < 6; i++)
+      HT_ASSERT(balancer.choose_server(servers) == i % 3);
+    balancer.rebalance(moves);
+    HT_ASSERT(moves.empty());
+  }
+
+  cout << "LoadBalancer test passed" << endl;
+
+  return 0;
+}
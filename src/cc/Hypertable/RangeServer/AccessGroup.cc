@@ -26,10 +26,13 @@
 
 #include "Common/Error.h"
 #include "Common/md5.h"
+#include "Common/Time.h"
 
 #include "AccessGroup.h"
 #include "CellCache.h"
+#include "CellCacheMap.h"
 #include "CellCacheScanner.h"
+#include "CellCacheSkipList.h"
 #include "CellStoreFactory.h"
 #include "CellStoreReleaseCallback.h"
 #include "CellStoreV1.h"
@@ -41,6 +44,27 @@
 
 using namespace Hypertable;
 
+namespace {
+
+  /**
+   * Returns the TTL in nanoseconds after which every cell of the access
+   * group has expired, or 0 if some column family keeps its cells forever
+   */
+  int64_t access_group_ttl(Schema::AccessGroup *ag) {
+    int64_t ttl = 0;
+    foreach(Schema::ColumnFamily *cf, ag->columns) {
+      if (cf->deleted)
+        continue;
+      if (cf->ttl == 0)
+        return 0;
+      if ((int64_t)cf->ttl * 1000000000LL > ttl)
+        ttl = (int64_t)cf->ttl * 1000000000LL;
+    }
+    return ttl;
+  }
+
+}
+
 
 AccessGroup::AccessGroup(const TableIdentifier *identifier,
     SchemaPtr &schema, Schema::AccessGroup *ag, const RangeSpec *range)
@@ -50,16 +74,25 @@ AccessGroup::AccessGroup(const TableIdentifier *identifier,
     m_earliest_cached_revision(TIMESTAMP_MAX),
     m_earliest_cached_revision_saved(TIMESTAMP_MAX),
     m_latest_stored_revision(TIMESTAMP_MIN), m_collisions(0),
-    m_needs_compaction(false), m_drop(false),
+    m_needs_compaction(false), m_needs_gc_compaction(false), m_drop(false),
     m_file_tracker(identifier, schema, range, ag->name),
-    m_recovering(false) {
+    m_recovering(false), m_compaction_bytes_read(0),
+    m_compaction_bytes_written(0), m_cellstores_scanned(0),
+    m_cellstores_pruned(0), m_ttl(access_group_ttl(ag)) {
 
   m_table_name = m_identifier.name;
   m_start_row = range->start_row;
   m_end_row = range->end_row;
   m_range_name = m_table_name + "[" + m_start_row + ".." + m_end_row + "]";
   m_full_name = m_range_name + "(" + m_name + ")";
-  m_cell_cache = new CellCache();
+
+  assert(Config::properties); // requires Config::init* first
+  String cell_cache_type = ag->cell_cache.size() ? ag->cell_cache :
+      Config::get_str("Hypertable.RangeServer.AccessGroup.CellCache.Type");
+  m_skip_list_cache = (cell_cache_type == "skiplist");
+  m_cell_cache = new_cell_cache();
+  m_compaction_policy = CompactionPolicy::create(Config::get_str(
+      "Hypertable.RangeServer.AccessGroup.CompactionPolicy"));
 
   foreach(Schema::ColumnFamily *cf, ag->columns)
     m_column_families.insert(cf->id);
@@ -144,6 +177,7 @@ void AccessGroup::update_schema(SchemaPtr &schema_ptr,
     }
     // Update schema ptr
     m_schema = schema_ptr;
+    m_ttl = access_group_ttl(ag);
   }
 }
 
@@ -167,8 +201,8 @@ void AccessGroup::add(const Key &key, const ByteString value) {
 }
 
 
-CellListScanner *AccessGroup::create_scanner(ScanContextPtr &scan_context) {
-  MergeScanner *scanner = new MergeScanner(scan_context);
+void
+AccessGroup::add_scanners(MergeScanner *mscanner, ScanContextPtr &scan_context) {
   CellStoreReleaseCallback callback(this);
 
   {
@@ -179,26 +213,33 @@ CellListScanner *AccessGroup::create_scanner(ScanContextPtr &scan_context) {
   try {
     ScopedLock lock(m_mutex);
 
-    scanner->add_scanner(m_cell_cache->create_scanner(scan_context));
+    mscanner->add_scanner(m_cell_cache->create_scanner(scan_context));
 
     if (m_immutable_cache)
-      scanner->add_scanner(m_immutable_cache->create_scanner(scan_context));
+      mscanner->add_scanner(m_immutable_cache->create_scanner(scan_context));
 
     if (!m_in_memory) {
 
       for (size_t i=0; i<m_stores.size(); ++i) {
 
+        // Skip stores whose row and time bounds miss the scan
+        if (!m_stores[i]->may_intersect(scan_context)) {
+          m_cellstores_pruned++;
+          continue;
+        }
+        m_cellstores_scanned++;
+
         // Query bloomfilter only if it is enabled and a start row has been specified
         // (ie query is not something like select bar from foo;)
 
         if (m_bloom_filter_disabled ||
             !scan_context->single_row ||
             scan_context->start_row == "") {
-          scanner->add_scanner(m_stores[i]->create_scanner(scan_context));
+          mscanner->add_scanner(m_stores[i]->create_scanner(scan_context));
           callback.add_file(m_stores[i]->get_filename());
         }
         else if (m_stores[i]->may_contain(scan_context)) {
-          scanner->add_scanner(m_stores[i]->create_scanner(scan_context));
+          mscanner->add_scanner(m_stores[i]->create_scanner(scan_context));
           callback.add_file(m_stores[i]->get_filename());
         }
       }
@@ -207,17 +248,71 @@ CellListScanner *AccessGroup::create_scanner(ScanContextPtr &scan_context) {
   catch (Exception &e) {
     ScopedLock lock(m_outstanding_scanner_mutex);
     m_outstanding_scanner_count--;
-    delete scanner;
     HT_THROW2F(e.code(), e, "Problem creating scanner on access group %s",
                m_full_name.c_str());
   }
 
   m_file_tracker.add_references(callback.get_file_vector());
-  scanner->install_release_callback(callback);
+  mscanner->install_release_callback(callback);
+}
+
+void
+AccessGroup::add_scanners(std::vector<MergeScanner *> &mscanners,
+                          std::vector<ScanContextPtr> &scan_ctxs) {
+  size_t count = scan_ctxs.size();
+  std::vector<CellStoreReleaseCallback> callbacks(count,
+      CellStoreReleaseCallback(this));
+
+  HT_ASSERT(mscanners.size() == count);
+
+  {
+    ScopedLock lock(m_outstanding_scanner_mutex);
+    m_outstanding_scanner_count += count;
+  }
+
+  try {
+    ScopedLock lock(m_mutex);
+
+    for (size_t r=0; r<count; ++r) {
+      mscanners[r]->add_scanner(m_cell_cache->create_scanner(scan_ctxs[r]));
+      if (m_immutable_cache)
+        mscanners[r]->add_scanner(
+            m_immutable_cache->create_scanner(scan_ctxs[r]));
+    }
+
+    if (!m_in_memory) {
+      for (size_t i=0; i<m_stores.size(); ++i) {
+        for (size_t r=0; r<count; ++r) {
+          if (!m_stores[i]->may_intersect(scan_ctxs[r])) {
+            m_cellstores_pruned++;
+            continue;
+          }
+          m_cellstores_scanned++;
+          if (m_bloom_filter_disabled || scan_ctxs[r]->start_row == "" ||
+              m_stores[i]->may_contain(scan_ctxs[r])) {
+            mscanners[r]->add_scanner(m_stores[i]->create_scanner(scan_ctxs[r]));
+            callbacks[r].add_file(m_stores[i]->get_filename());
+          }
+        }
+      }
+    }
+  }
+  catch (Exception &e) {
+    {
+      ScopedLock lock(m_outstanding_scanner_mutex);
+      m_outstanding_scanner_count -= count;
+    }
+    HT_THROW2F(e.code(), e, "Problem creating scanners on access group %s",
+               m_full_name.c_str());
+  }
 
-  return scanner;
+  for (size_t r=0; r<count; ++r) {
+    m_file_tracker.add_references(callbacks[r].get_file_vector());
+    mscanners[r]->install_release_callback(callbacks[r]);
+  }
 }
 
+
 bool AccessGroup::include_in_scan(ScanContextPtr &scan_context) {
   ScopedLock lock(m_mutex);
   for (std::set<uint8_t>::iterator iter = m_column_families.begin();
@@ -257,6 +352,22 @@ AccessGroup::get_split_rows(std::vector<String> &split_rows,
   }
 }
 
+void AccessGroup::get_split_samples(std::vector<SplitSample> &samples) {
+  ScopedLock lock(m_mutex);
+  size_t first_cache_sample;
+
+  for (size_t i=0; i<m_stores.size(); i++)
+    m_stores[i]->get_split_samples(samples);
+
+  first_cache_sample = samples.size();
+  if (m_immutable_cache)
+    m_immutable_cache->get_split_samples(samples);
+  m_cell_cache->get_split_samples(samples);
+
+  for (size_t i=first_cache_sample; i<samples.size(); i++)
+    samples[i].bytes = (int64_t)(m_compression_ratio * (float)samples[i].bytes);
+}
+
 void AccessGroup::get_cached_rows(std::vector<String> &rows) {
   ScopedLock lock(m_mutex);
   if (m_immutable_cache &&
@@ -339,6 +450,11 @@ AccessGroup::MaintenanceData *AccessGroup::get_maintenance_data(ByteArena &arena
   mdata->outstanding_scanners = m_outstanding_scanner_count;
   mdata->in_memory = m_in_memory;
   mdata->deletes = m_cell_cache->get_delete_count();
+  mdata->compaction_bytes_read = m_compaction_bytes_read;
+  mdata->compaction_bytes_written = m_compaction_bytes_written;
+  mdata->cellstores_scanned = m_cellstores_scanned;
+  mdata->cellstores_pruned = m_cellstores_pruned;
+  mdata->garbage_bytes = m_in_memory ? 0 : estimate_garbage();
 
   // add TTL stuff
 
@@ -346,6 +462,18 @@ AccessGroup::MaintenanceData *AccessGroup::get_maintenance_data(ByteArena &arena
 }
 
 
+/**
+ * Estimates how many bytes of the CellStores a major compaction would
+ * drop, from their trailers (see CompactionPolicy::estimate_garbage())
+ */
+int64_t AccessGroup::estimate_garbage() {
+  std::vector<CompactionPolicy::StoreInfo> info;
+
+  CompactionPolicy::get_store_info(m_stores, info);
+  return CompactionPolicy::estimate_garbage(info, m_ttl, (int64_t)get_ts64());
+}
+
+
 void AccessGroup::add_cell_store(CellStorePtr &cellstore, uint32_t id) {
   ScopedLock lock(m_mutex);
 
@@ -370,7 +498,7 @@ void AccessGroup::add_cell_store(CellStorePtr &cellstore, uint32_t id) {
     CellListScannerPtr scanner = cellstore->create_scanner(scan_context);
     ByteString key, value;
     Key key_comps;
-    m_cell_cache = new CellCache();
+    m_cell_cache = new_cell_cache();
     while (scanner->get(key_comps, value)) {
       m_cell_cache->add(key_comps, value);
       scanner->forward();
@@ -382,14 +510,24 @@ void AccessGroup::add_cell_store(CellStorePtr &cellstore, uint32_t id) {
   m_file_tracker.add_live_noupdate(cellstore->get_filename());
 }
 
-namespace {
-  struct LtCellStore {
-    bool operator()(const CellStorePtr &x, const CellStorePtr &y) const {
-      return x->disk_usage() > y->disk_usage();
-    }
-  };
-}
+void AccessGroup::load_cell_store(CellStorePtr &cellstore) {
+  uint32_t id;
+
+  {
+    ScopedLock lock(m_mutex);
+    id = m_next_cs_id++;
+  }
 
+  add_cell_store(cellstore, id);
+  m_file_tracker.add_live(cellstore->get_filename());
+  m_file_tracker.update_files_column();
+
+  ScopedLock lock(m_mutex);
+  if (m_latest_stored_revision >= m_earliest_cached_revision)
+    HT_ERRORF("Revision (clock) skew detected loading %s into %s! May "
+              "result in data loss.", cellstore->get_filename().c_str(),
+              m_full_name.c_str());
+}
 
 void AccessGroup::run_compaction(bool major) {
   ByteString bskey;
@@ -400,6 +538,16 @@ void AccessGroup::run_compaction(bool major) {
   CellStorePtr cellstore;
   CellCachePtr filtered_cache;
   String metadata_key_str;
+  uint64_t bytes_read = 0;
+  bool gc;
+
+  {
+    ScopedLock lock(m_mutex);
+    gc = m_needs_gc_compaction;
+    m_needs_gc_compaction = false;
+  }
+  if (gc)
+    major = true;
 
   try {
 
@@ -418,19 +566,40 @@ void AccessGroup::run_compaction(bool major) {
                  m_range_name.c_str(), m_name.c_str());
       }
       else if (major) {
-        if (m_immutable_cache->memory_used()==0 && m_stores.size() <= (size_t)1)
+        // a single store is still worth rewriting to drop its garbage
+        if (m_immutable_cache->memory_used()==0 &&
+            m_stores.size() <= (size_t)(gc ? 0 : 1))
           HT_THROW(Error::OK, "");
         tableidx = 0;
-        HT_INFOF("Starting Major Compaction of %s(%s)",
+        HT_INFOF("Starting %s Compaction of %s(%s)",
+                 gc ? "Garbage Collecting" : "Major",
                  m_range_name.c_str(), m_name.c_str());
       }
       else {
-        if (m_stores.size() > (size_t)Global::access_group_max_files) {
-          LtCellStore descending;
-          sort(m_stores.begin(), m_stores.end(), descending);
-          tableidx = m_stores.size() - Global::access_group_merge_files;
-          HT_INFOF("Starting Merging Compaction of %s(%s)",
-                   m_range_name.c_str(), m_name.c_str());
+        std::vector<size_t> merge;
+
+        m_compaction_policy->select(m_stores, merge);
+
+        if (!merge.empty()) {
+          std::vector<CellStorePtr> stores;
+          std::vector<bool> chosen(m_stores.size(), false);
+
+          // Move the chosen stores to the end, where they get merged from
+          foreach(size_t i, merge)
+            chosen[i] = true;
+          for (size_t i=0; i<m_stores.size(); i++)
+            if (!chosen[i])
+              stores.push_back(m_stores[i]);
+          tableidx = stores.size();
+          for (size_t i=0; i<m_stores.size(); i++)
+            if (chosen[i])
+              stores.push_back(m_stores[i]);
+          m_stores.swap(stores);
+
+          HT_INFOF("Starting Merging Compaction of %s(%s) - %s policy chose "
+                   "%u of %u stores", m_range_name.c_str(), m_name.c_str(),
+                   m_compaction_policy->name(), (unsigned)merge.size(),
+                   (unsigned)m_stores.size());
         }
         else {
           if (m_immutable_cache->memory_used() == 0)
@@ -482,7 +651,7 @@ void AccessGroup::run_compaction(bool major) {
         MergeScanner *mscanner = new MergeScanner(scan_context, false);
         scanner = mscanner;
         mscanner->add_scanner(m_immutable_cache->create_scanner(scan_context));
-        filtered_cache = new CellCache();
+        filtered_cache = new_cell_cache();
       }
       else if (major || tableidx < m_stores.size()) {
         bool return_everything = (major) ? false : (tableidx > 0);
@@ -494,6 +663,7 @@ void AccessGroup::run_compaction(bool major) {
           mscanner->add_scanner(m_stores[i]->create_scanner(scan_context));
           max_num_entries += boost::any_cast<int64_t>
               (m_stores[i]->get_trailer()->get("total_entries"));
+          bytes_read += m_stores[i]->disk_usage();
         }
       }
       else {
@@ -571,14 +741,18 @@ void AccessGroup::run_compaction(bool major) {
       }
       m_compression_ratio /= m_disk_usage;
 
+      m_compaction_bytes_read += bytes_read;
+      if (cellstore)
+        m_compaction_bytes_written += cellstore->disk_usage();
     }
 
     m_file_tracker.update_files_column();
 
     m_earliest_cached_revision_saved = TIMESTAMP_MAX;
 
-    HT_INFOF("Finished Compaction of %s(%s)", m_range_name.c_str(),
-             m_name.c_str());
+    HT_INFOF("Finished Compaction of %s(%s) - read %llu bytes, wrote %llu "
+             "bytes", m_range_name.c_str(), m_name.c_str(), (Llu)bytes_read,
+             (Llu)(cellstore ? cellstore->disk_usage() : 0));
 
   }
   catch (Exception &e) {
@@ -603,7 +777,7 @@ void AccessGroup::run_compaction(bool major) {
 void AccessGroup::shrink(String &split_row, bool drop_high) {
   ScopedLock lock(m_mutex);
   CellCachePtr old_cell_cache = m_cell_cache;
-  CellCachePtr new_cell_cache;
+  CellCachePtr new_cache;
   ScanContextPtr scan_context = new ScanContext(m_schema);
   CellListScannerPtr cell_cache_scanner;
   ByteString key;
@@ -633,10 +807,10 @@ void AccessGroup::shrink(String &split_row, bool drop_high) {
 
     m_file_tracker.change_range(m_start_row, m_end_row);
 
-    new_cell_cache = new CellCache();
-    new_cell_cache->lock();
+    new_cache = new_cell_cache();
+    new_cache->lock();
 
-    m_cell_cache = new_cell_cache;
+    m_cell_cache = new_cache;
 
     cell_cache_scanner = old_cell_cache->create_scanner(scan_context);
 
@@ -667,7 +841,7 @@ void AccessGroup::shrink(String &split_row, bool drop_high) {
       cell_cache_scanner->forward();
     }
 
-    new_cell_cache->unlock();
+    new_cache->unlock();
 
     /**
      * Shrink the CellStores
@@ -715,7 +889,7 @@ void AccessGroup::initiate_compaction() {
   HT_ASSERT(!m_immutable_cache);
   m_immutable_cache = m_cell_cache;
   m_immutable_cache->freeze();
-  m_cell_cache = new CellCache();
+  m_cell_cache = new_cell_cache();
   m_earliest_cached_revision_saved = m_earliest_cached_revision;
   m_earliest_cached_revision = TIMESTAMP_MAX;
 }
@@ -743,7 +917,7 @@ void AccessGroup::merge_caches() {
 
   Key key;
   ByteString value;
-  CellCachePtr merged_cache = new CellCache();
+  CellCachePtr merged_cache = new_cell_cache();
   ScanContextPtr scan_context = new ScanContext(m_schema);
   CellListScannerPtr scanner = m_immutable_cache->create_scanner(scan_context);
   while (scanner->get(key, value)) {
@@ -761,6 +935,15 @@ void AccessGroup::merge_caches() {
   m_cell_cache = merged_cache;
 }
 
+/**
+ * Creates an empty cell cache of the type selected for this access group
+ */
+CellCache *AccessGroup::new_cell_cache() {
+  if (m_skip_list_cache)
+    return new CellCacheSkipList();
+  return new CellCacheMap();
+}
+
 void AccessGroup::dump_keys(std::ofstream &out) {
   ScopedLock lock(m_mutex);
   Schema::ColumnFamily *cf;
@@ -42,11 +42,14 @@
 
 #include "CellCache.h"
 #include "CellStore.h"
+#include "CompactionPolicy.h"
 #include "LiveFileTracker.h"
 
 
 namespace Hypertable {
 
+  class MergeScanner;
+
   class AccessGroup : public CellList {
 
   public:
@@ -64,6 +67,11 @@ namespace Hypertable {
       int64_t log_space_pinned;
       uint32_t deletes;
       uint32_t outstanding_scanners;
+      uint64_t compaction_bytes_read;
+      uint64_t compaction_bytes_written;
+      uint64_t cellstores_scanned;
+      uint64_t cellstores_pruned;
+      int64_t garbage_bytes;
       void *user_data;
       bool in_memory;
     };
@@ -78,6 +86,13 @@ namespace Hypertable {
                                 bool include_cache);
     virtual void get_cached_rows(std::vector<String> &rows);
 
+    /**
+     * Appends the size weighted row samples of the cell stores and of the
+     * cell caches.  Cache samples are scaled by the compression ratio of the
+     * stores so that all samples are in on-disk bytes.
+     */
+    virtual void get_split_samples(std::vector<SplitSample> &samples);
+
     virtual int64_t get_total_entries() {
       boost::mutex::scoped_lock lock(m_mutex);
       int64_t total = m_cell_cache->get_total_entries();
@@ -95,13 +110,43 @@ namespace Hypertable {
     void lock() { m_mutex.lock(); m_cell_cache->lock(); }
     void unlock() { m_cell_cache->unlock(); m_mutex.unlock(); }
 
-    CellListScanner *create_scanner(ScanContextPtr &scan_ctx);
+    /**
+     * Adds scanners over the cell caches and the cell stores of this access
+     * group directly to the given merge scanner, so that a range scan merges
+     * the cells of all of its access groups in a single pass.  The merge
+     * scanner takes ownership of the scanners and releases the cell stores
+     * when it is destroyed.
+     *
+     * @param mscanner range level merge scanner
+     * @param scan_ctx scan context
+     */
+    void add_scanners(MergeScanner *mscanner, ScanContextPtr &scan_ctx);
+
+    /**
+     * Adds the scanners of a batch of single row lookups, one merge scanner
+     * per row.  The stores are walked once under a single acquisition of
+     * the access group lock and each store's bloom filter is probed for
+     * every row of the batch, so a store only gets a scanner for the rows
+     * it may contain.
+     *
+     * @param mscanners merge scanner of each row
+     * @param scan_ctxs single row scan contexts, one per row
+     */
+    void add_scanners(std::vector<MergeScanner *> &mscanners,
+                      std::vector<ScanContextPtr> &scan_ctxs);
 
     bool include_in_scan(ScanContextPtr &scan_ctx);
     uint64_t disk_usage();
     uint64_t memory_usage();
     void space_usage(int64_t *memp, int64_t *diskp);
     void add_cell_store(CellStorePtr &cellstore, uint32_t id);
+
+    /**
+     * Adds a CellStore written outside of the RangeServer and records it
+     * in the 'Files' column of METADATA.  The store is given the next
+     * CellStore ID of the access group.
+     */
+    void load_cell_store(CellStorePtr &cellstore);
     void run_compaction(bool major);
 
     int64_t purgeable_index_memory(uint64_t access_counter) {
@@ -119,6 +164,20 @@ namespace Hypertable {
 
     bool needs_compaction() { return m_needs_compaction; }
 
+    /**
+     * Requests that the next compaction rewrites all of the stores, to get
+     * rid of deleted and expired cells
+     */
+    void set_gc_compaction_bit() {
+      ScopedLock lock(m_mutex);
+      m_needs_gc_compaction = true;
+    }
+
+    bool needs_gc_compaction() {
+      ScopedLock lock(m_mutex);
+      return m_needs_gc_compaction;
+    }
+
     void initiate_compaction();
 
     bool compaction_initiated() {
@@ -131,6 +190,8 @@ namespace Hypertable {
 
     const char *get_full_name() { return m_full_name.c_str(); }
 
+    bool in_memory() { return m_in_memory; }
+
     void shrink(String &split_row, bool drop_high);
 
     uint64_t get_collision_count() {
@@ -157,8 +218,10 @@ namespace Hypertable {
     void dump_keys(std::ofstream &out);
 
   private:
+    int64_t estimate_garbage();
     void update_files_column(const String &end_row, const String &file_list);
     void merge_caches();
+    CellCache *new_cell_cache();
 
     Mutex                m_mutex;
     Mutex                m_outstanding_scanner_mutex;
@@ -186,11 +249,19 @@ namespace Hypertable {
     int64_t              m_latest_stored_revision;
     uint64_t             m_collisions;
     bool                 m_needs_compaction;
+    bool                 m_needs_gc_compaction;
     bool                 m_in_memory;
+    bool                 m_skip_list_cache;
     bool                 m_drop;
     LiveFileTracker      m_file_tracker;
     bool                 m_recovering;
     bool                 m_bloom_filter_disabled;
+    CompactionPolicyPtr  m_compaction_policy;
+    uint64_t             m_compaction_bytes_read;
+    uint64_t             m_compaction_bytes_written;
+    uint64_t             m_cellstores_scanned;
+    uint64_t             m_cellstores_pruned;
+    int64_t              m_ttl;
 
   };
   typedef boost::intrusive_ptr<AccessGroup> AccessGroupPtr;
@@ -22,7 +22,6 @@
 #ifndef HYPERTABLE_CELLCACHE_H
 #define HYPERTABLE_CELLCACHE_H
 
-#include <map>
 #include <set>
 
 #include "Common/Mutex.h"
@@ -33,7 +32,6 @@
 #include "Hypertable/Lib/SerializedKey.h"
 
 #include "CellCachePool.h"
-#include "CellCachePoolAllocator.h"
 
 namespace Hypertable {
 
@@ -49,43 +47,39 @@ namespace Hypertable {
   /**
    * Represents  a sorted list of key/value pairs in memory.
    * All updates get written to the CellCache and later get "compacted"
-   * into a CellStore on disk.
+   * into a CellStore on disk.  This is the abstract base of CellCacheMap,
+   * which keeps the pairs in a std::map, and CellCacheSkipList, the
+   * concurrent skip list variant.  It owns the memory pool, the lock and
+   * the counters that both share.
    */
   class CellCache : public CellList {
 
   public:
+    enum { SPLIT_SAMPLES = 64 };
+
     CellCache();
     virtual ~CellCache() { }
-    /**
-     * Adds a key/value pair to the CellCache.  This method assumes that
-     * the CellCache has been locked by a call to #lock.  Copies of
-     * the key and value are created and inserted into the underlying cell map
-     *
-     * @param key key to be inserted
-     * @param value value to inserted
-     */
-    virtual void add(const Key &key, const ByteString value);
 
     virtual const char *get_split_row();
 
-    virtual void get_split_rows(std::vector<std::string> &split_rows);
-
-    virtual void get_rows(std::vector<std::string> &rows);
-
-    virtual int64_t get_total_entries() { return m_cell_map.size(); }
+    virtual void get_split_rows(std::vector<std::string> &split_rows) = 0;
 
-    /** Creates a CellCacheScanner object that contains an shared pointer
-     * (intrusive_ptr) to this CellCache.
+    /**
+     * Appends row samples of roughly 1/SPLIT_SAMPLES of the cache each,
+     * weighted by the lengths of their keys and values.  Samples only end on
+     * row boundaries.
      */
-    virtual CellListScanner *create_scanner(ScanContextPtr &scan_ctx);
+    virtual void get_split_samples(std::vector<SplitSample> &samples) = 0;
+
+    virtual void get_rows(std::vector<std::string> &rows) = 0;
 
     void lock()   { if (!m_frozen) m_mutex.lock(); }
     void unlock() { if (!m_frozen) m_mutex.unlock(); }
 
-    size_t size() { return m_cell_map.size(); }
+    virtual size_t size() = 0;
 
     /** Returns the amount of memory used by the CellCache.  This is the
-     * summation of the lengths of all the keys and values in the map.
+     * summation of the lengths of all the keys and values in the cache.
      */
     uint64_t memory_used() {
       ScopedLock lock(m_mutex);
@@ -99,27 +93,12 @@ namespace Hypertable {
     void freeze() { m_frozen = true; }
     void unfreeze() { m_frozen = false; }
 
-    void populate_key_set(KeySet &keys) {
-      Key key;
-      for (CellMap::const_iterator iter = m_cell_map.begin();
-	   iter != m_cell_map.end(); ++iter) {
-	key.load((*iter).first);
-	keys.insert(key);
-      }
-    }
-
-    friend class CellCacheScanner;
-
-    typedef std::pair<const SerializedKey, uint32_t> Value;
-    typedef CellCachePoolAllocator<Value> Alloc;
-    typedef std::map<const SerializedKey, uint32_t,
-                     std::less<const SerializedKey>, Alloc> CellMap;
+    virtual void populate_key_set(KeySet &keys) = 0;
 
   protected:
 
     Mutex              m_mutex;
     CellCachePool      m_alloc;
-    CellMap            m_cell_map;
     uint32_t           m_deletes;
     uint32_t           m_collisions;
     bool               m_frozen;
@@ -0,0 +1,91 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_CELLCACHEMAP_H
+#define HYPERTABLE_CELLCACHEMAP_H
+
+#include <map>
+
+#include "CellCache.h"
+#include "CellCachePoolAllocator.h"
+
+namespace Hypertable {
+
+  /**
+   * CellCache that keeps its key/value pairs in a std::map whose nodes are
+   * allocated from the CellCachePool.  Scanners hold the cell cache lock
+   * while they position their iterators.
+   */
+  class CellCacheMap : public CellCache {
+
+  public:
+    CellCacheMap();
+    virtual ~CellCacheMap() { }
+    /**
+     * Adds a key/value pair to the CellCache.  This method assumes that
+     * the CellCache has been locked by a call to #lock.  Copies of
+     * the key and value are created and inserted into the underlying cell map
+     *
+     * @param key key to be inserted
+     * @param value value to inserted
+     */
+    virtual void add(const Key &key, const ByteString value);
+
+    virtual void get_split_rows(std::vector<std::string> &split_rows);
+
+    virtual void get_split_samples(std::vector<SplitSample> &samples);
+
+    virtual void get_rows(std::vector<std::string> &rows);
+
+    virtual int64_t get_total_entries() { return m_cell_map.size(); }
+
+    /** Creates a CellCacheScanner object that contains an shared pointer
+     * (intrusive_ptr) to this CellCache.
+     */
+    virtual CellListScanner *create_scanner(ScanContextPtr &scan_ctx);
+
+    virtual size_t size() { return m_cell_map.size(); }
+
+    virtual void populate_key_set(KeySet &keys) {
+      Key key;
+      for (CellMap::const_iterator iter = m_cell_map.begin();
+	   iter != m_cell_map.end(); ++iter) {
+	key.load((*iter).first);
+	keys.insert(key);
+      }
+    }
+
+    friend class CellCacheScanner;
+
+    typedef std::pair<const SerializedKey, uint32_t> Value;
+    typedef CellCachePoolAllocator<Value> Alloc;
+    typedef std::map<const SerializedKey, uint32_t,
+                     std::less<const SerializedKey>, Alloc> CellMap;
+
+  private:
+    CellMap            m_cell_map;
+  };
+
+  typedef intrusive_ptr<CellCacheMap> CellCacheMapPtr;
+
+} // namespace Hypertable;
+
+#endif // HYPERTABLE_CELLCACHEMAP_H
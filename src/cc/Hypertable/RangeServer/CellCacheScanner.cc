@@ -34,7 +34,7 @@ using namespace Hypertable;
 /**
  *
  */
-CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
+CellCacheScanner::CellCacheScanner(CellCacheMapPtr &cellcache,
                                    ScanContextPtr &scan_ctx)
   : CellListScanner(scan_ctx), m_cell_cache_ptr(cellcache),
     m_cell_cache_mutex(cellcache->m_mutex), m_cur_value(0), m_in_deletes(false),
@@ -60,7 +60,7 @@ CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
    * ie, the scan contains a qualified column.
    */
   if (scan_ctx->has_cell_interval) {
-    CellCache::CellMap::iterator iter;
+    CellCacheMap::CellMap::iterator iter;
 
     /**
      * Look for any DELETE_ROW records for this row and add them
@@ -78,7 +78,7 @@ CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
       if (current.flag != FLAG_DELETE_ROW ||
           strcmp(current.row, scan_ctx->start_key.row))
         break;
-      m_deletes.insert(CellCache::CellMap::value_type(iter->first, iter->second));
+      m_deletes.insert(CellCacheMap::CellMap::value_type(iter->first, iter->second));
     }
 
     if (scan_ctx->has_start_cf_qualifier) {
@@ -98,7 +98,7 @@ CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
             current.column_family_code != scan_ctx->start_key.column_family_code ||
             strcmp(current.row, scan_ctx->start_key.row))
           break;
-        m_deletes.insert(CellCache::CellMap::value_type(iter->first, iter->second));
+        m_deletes.insert(CellCacheMap::CellMap::value_type(iter->first, iter->second));
       }
     }
   }
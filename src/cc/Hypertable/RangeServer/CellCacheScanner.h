@@ -22,7 +22,7 @@
 #ifndef HYPERTABLE_CELLCACHESCANNER_H
 #define HYPERTABLE_CELLCACHESCANNER_H
 
-#include "CellCache.h"
+#include "CellCacheMap.h"
 #include "CellListScanner.h"
 #include "ScanContext.h"
 
@@ -34,27 +34,27 @@ namespace Hypertable {
    */
   class CellCacheScanner : public CellListScanner {
   public:
-    CellCacheScanner(CellCachePtr &cellcache, ScanContextPtr &scan_ctx);
+    CellCacheScanner(CellCacheMapPtr &cellcache, ScanContextPtr &scan_ctx);
     virtual ~CellCacheScanner() { return; }
     virtual void forward();
     virtual bool get(Key &key, ByteString &value);
 
-    typedef std::map<const SerializedKey, uint32_t> CellCacheMap;
+    typedef std::map<const SerializedKey, uint32_t> DeleteMap;
 
 
   private:
-    CellCache::CellMap::iterator   m_start_iter;
-    CellCache::CellMap::iterator   m_end_iter;
-    CellCache::CellMap::iterator   m_cur_iter;
-    CellCacheMap::iterator         m_delete_iter;
-    CellCachePtr                   m_cell_cache_ptr;
-    Mutex                         &m_cell_cache_mutex;
-    Key                            m_cur_key;
-    ByteString                     m_cur_value;
-    CellCacheMap                   m_deletes;
-    bool                           m_in_deletes;
-    bool                           m_eos;
-    bool                           m_keys_only;
+    CellCacheMap::CellMap::iterator   m_start_iter;
+    CellCacheMap::CellMap::iterator   m_end_iter;
+    CellCacheMap::CellMap::iterator   m_cur_iter;
+    DeleteMap::iterator               m_delete_iter;
+    CellCacheMapPtr                   m_cell_cache_ptr;
+    Mutex                            &m_cell_cache_mutex;
+    Key                               m_cur_key;
+    ByteString                        m_cur_value;
+    DeleteMap                         m_deletes;
+    bool                              m_in_deletes;
+    bool                              m_eos;
+    bool                              m_keys_only;
   };
 }
 
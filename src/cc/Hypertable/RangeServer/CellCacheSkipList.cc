@@ -0,0 +1,202 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cassert>
+#include <cstring>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "CellCacheSkipList.h"
+#include "CellCacheSkipListScanner.h"
+
+using namespace Hypertable;
+using namespace std;
+
+
+CellCacheSkipList::CellCacheSkipList()
+  : m_max_height(1), m_count(0), m_random_state(0x9e3779b9) {
+  m_head = new_node(MAX_HEIGHT);
+  m_head->key.ptr = 0;
+  m_head->key_len = 0;
+}
+
+
+/**
+ * Node memory comes from the tail end of the pool, the same region the
+ * std::map nodes of CellCache use.  The pointer is aligned by hand since the
+ * tail of an oversized pool buffer is not guaranteed to be.
+ */
+CellCacheSkipList::Node *CellCacheSkipList::new_node(uint32_t height) {
+  size_t size = sizeof(Node) + (height - 1) * sizeof(Node *);
+  uintptr_t addr = (uintptr_t)m_alloc.allocate(size + sizeof(Node *), true);
+  addr = (addr + sizeof(Node *) - 1) & ~(uintptr_t)(sizeof(Node *) - 1);
+  Node *node = (Node *)addr;
+  node->height = height;
+  for (uint32_t i=0; i<height; i++)
+    node->next[i] = 0;
+  return node;
+}
+
+
+/**
+ * Returns a height with a 1 in 4 chance of growing each level
+ */
+uint32_t CellCacheSkipList::random_height() {
+  uint32_t height = 1;
+  while (height < MAX_HEIGHT) {
+    m_random_state ^= m_random_state << 13;
+    m_random_state ^= m_random_state >> 17;
+    m_random_state ^= m_random_state << 5;
+    if ((m_random_state & 3) != 0)
+      break;
+    height++;
+  }
+  return height;
+}
+
+
+/**
+ * Assumes the cell cache has been locked by a call to #lock, which
+ * serializes writers.  Readers may be traversing the list concurrently.
+ */
+void CellCacheSkipList::add(const Key &key, const ByteString value) {
+  Node *prev[MAX_HEIGHT];
+  Node *x = m_head, *next;
+  uint32_t max_height = m_max_height;
+  size_t total_len = key.length + value.length();
+  uint8_t *ptr;
+
+  assert(!m_frozen);
+
+  for (int level = (int)max_height - 1; level >= 0; level--) {
+    while ((next = x->next[level]) != 0 && next->key < key.serial)
+      x = next;
+    prev[level] = x;
+  }
+
+  next = prev[0]->next[0];
+  if (next && next->key == key.serial) {
+    m_collisions++;
+    HT_WARNF("Collision detected key insert (row = %s)", key.row);
+    return;
+  }
+
+  uint32_t height = random_height();
+  for (uint32_t level = max_height; level < height; level++)
+    prev[level] = m_head;
+
+  ptr = (uint8_t *)m_alloc.allocate(total_len);
+  memcpy(ptr, key.serial.ptr, key.length);
+  value.write(ptr + key.length);
+
+  Node *node = new_node(height);
+  node->key.ptr = ptr;
+  node->key_len = key.length;
+  for (uint32_t level = 0; level < height; level++)
+    node->next[level] = prev[level]->next[level];
+
+  // make the node contents visible before linking it in
+  __sync_synchronize();
+
+  for (uint32_t level = 0; level < height; level++)
+    prev[level]->next[level] = node;
+
+  if (height > max_height)
+    m_max_height = height;
+
+  m_count++;
+
+  if (key.flag <= FLAG_DELETE_CELL)
+    m_deletes++;
+}
+
+
+CellCacheSkipList::Node *
+CellCacheSkipList::lower_bound(const SerializedKey key) const {
+  Node *x = m_head, *next;
+
+  for (int level = (int)m_max_height - 1; level >= 0; level--) {
+    while ((next = x->next[level]) != 0 && next->key < key)
+      x = next;
+  }
+  return x->next[0];
+}
+
+
+void CellCacheSkipList::get_split_rows(std::vector<std::string> &split_rows) {
+  size_t count = m_count;
+  if (count > 2) {
+    Node *node = first();
+    for (size_t i=0; i<count/2 && node->next[0]; i++)
+      node = node->next[0];
+    split_rows.push_back(node->key.row());
+  }
+}
+
+
+void
+CellCacheSkipList::get_split_samples(std::vector<SplitSample> &samples) {
+  int64_t bucket = m_alloc.memory_used() / SPLIT_SAMPLES + 1;
+  int64_t bytes = 0;
+  const char *row, *last_row = 0;
+
+  for (Node *node = first(); node; node = node->next[0]) {
+    row = node->key.row();
+    if (bytes >= bucket && strcmp(row, last_row)) {
+      samples.push_back(SplitSample(last_row, bytes));
+      bytes = 0;
+    }
+    last_row = row;
+    bytes += node->key_len + ByteString(node->key.ptr + node->key_len).length();
+  }
+  if (bytes)
+    samples.push_back(SplitSample(last_row, bytes));
+}
+
+
+void CellCacheSkipList::get_rows(std::vector<std::string> &rows) {
+  const char *row, *last_row = "";
+  for (Node *node = first(); node; node = node->next[0]) {
+    row = node->key.row();
+    if (strcmp(row, last_row)) {
+      rows.push_back(row);
+      last_row = row;
+    }
+  }
+}
+
+
+void CellCacheSkipList::populate_key_set(KeySet &keys) {
+  Key key;
+  for (Node *node = first(); node; node = node->next[0]) {
+    key.load(node->key);
+    keys.insert(key);
+  }
+}
+
+
+CellListScanner *CellCacheSkipList::create_scanner(ScanContextPtr &scan_ctx) {
+  CellCachePtr cellcache(this);
+  return new CellCacheSkipListScanner(cellcache, scan_ctx);
+}
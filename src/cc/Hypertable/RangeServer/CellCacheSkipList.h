@@ -0,0 +1,96 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_CELLCACHESKIPLIST_H
+#define HYPERTABLE_CELLCACHESKIPLIST_H
+
+#include "CellCache.h"
+
+namespace Hypertable {
+
+  /**
+   * CellCache variant that keeps its key/value pairs in a concurrent skip
+   * list instead of a std::map.  Nodes, keys and values are all allocated
+   * from the CellCachePool and are never freed individually.  Writers are
+   * serialized by the cell cache mutex (see #lock), but readers traverse the
+   * list without taking any lock: a new node is fully initialized before it
+   * is linked in, one level at a time starting from the bottom, so a reader
+   * either sees it completely or not at all.
+   */
+  class CellCacheSkipList : public CellCache {
+
+  public:
+    enum { MAX_HEIGHT = 16 };
+
+    struct Node {
+      SerializedKey   key;
+      uint32_t        key_len;
+      uint32_t        height;
+      Node * volatile next[1];
+    };
+
+    CellCacheSkipList();
+    virtual ~CellCacheSkipList() { }
+
+    virtual void add(const Key &key, const ByteString value);
+
+    virtual void get_split_rows(std::vector<std::string> &split_rows);
+
+    virtual void get_split_samples(std::vector<SplitSample> &samples);
+
+    virtual void get_rows(std::vector<std::string> &rows);
+
+    virtual int64_t get_total_entries() { return m_count; }
+
+    virtual CellListScanner *create_scanner(ScanContextPtr &scan_ctx);
+
+    virtual size_t size() { return m_count; }
+
+    virtual void populate_key_set(KeySet &keys);
+
+    /**
+     * Returns the first node whose key is greater than or equal to the
+     * given key, or 0 if there is no such node.  May be called without
+     * holding the cell cache lock.
+     *
+     * @param key key to search for
+     * @return pointer to node or 0
+     */
+    Node *lower_bound(const SerializedKey key) const;
+
+    /**
+     * Returns the first node of the list, or 0 if the list is empty.
+     */
+    Node *first() const { return m_head->next[0]; }
+
+  private:
+    Node *new_node(uint32_t height);
+    uint32_t random_height();
+
+    Node             *m_head;
+    volatile uint32_t m_max_height;
+    volatile uint32_t m_count;
+    uint32_t          m_random_state;
+  };
+
+} // namespace Hypertable;
+
+#endif // HYPERTABLE_CELLCACHESKIPLIST_H
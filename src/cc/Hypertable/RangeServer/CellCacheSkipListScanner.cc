@@ -0,0 +1,163 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cassert>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "CellCacheSkipListScanner.h"
+
+using namespace Hypertable;
+
+/**
+ *
+ */
+CellCacheSkipListScanner::CellCacheSkipListScanner(CellCachePtr &cellcache,
+                                                   ScanContextPtr &scan_ctx)
+  : CellListScanner(scan_ctx), m_cell_cache_ptr(cellcache),
+    m_skip_list(static_cast<CellCacheSkipList *>(cellcache.get())),
+    m_end_node(0), m_cur_node(0), m_cur_value(0), m_in_deletes(false),
+    m_eos(false), m_keys_only(false) {
+  DynamicBuffer current_buf;
+  Key current;
+  CellCacheSkipList::Node *node;
+
+  m_keys_only = (scan_ctx->spec) ? scan_ctx->spec->keys_only : false;
+
+  current_buf.grow(scan_ctx->start_key.row_len +
+                   scan_ctx->start_key.column_qualifier_len +
+                   scan_ctx->end_key.row_len +
+                   scan_ctx->end_key.column_qualifier_len + 32);
+
+  /**
+   * Collect any DELETE_ROW and DELETE_COLUMN_FAMILY records that precede
+   * the start of the scan (see CellCacheScanner)
+   */
+  if (scan_ctx->has_cell_interval) {
+
+    create_key_and_append(current_buf, FLAG_DELETE_ROW,
+                          scan_ctx->start_key.row, 0,
+                          "", TIMESTAMP_MAX, 0);
+
+    current.serial.ptr = current_buf.base;
+
+    for (node = m_skip_list->lower_bound(current.serial); node;
+         node = node->next[0]) {
+      current.load(node->key);
+      if (current.flag != FLAG_DELETE_ROW ||
+          strcmp(current.row, scan_ctx->start_key.row))
+        break;
+      m_deletes.insert(DeleteMap::value_type(node->key, node->key_len));
+    }
+
+    if (scan_ctx->has_start_cf_qualifier) {
+
+      current_buf.clear();
+      create_key_and_append(current_buf, FLAG_DELETE_COLUMN_FAMILY,
+                            scan_ctx->start_key.row,
+                            scan_ctx->start_key.column_family_code,
+                            "", TIMESTAMP_MAX, 0);
+
+      current.serial.ptr = current_buf.base;
+
+      for (node = m_skip_list->lower_bound(current.serial); node;
+           node = node->next[0]) {
+        current.load(node->key);
+        if (current.flag != FLAG_DELETE_COLUMN_FAMILY ||
+            current.column_family_code != scan_ctx->start_key.column_family_code ||
+            strcmp(current.row, scan_ctx->start_key.row))
+          break;
+        m_deletes.insert(DeleteMap::value_type(node->key, node->key_len));
+      }
+    }
+  }
+
+  m_cur_node = m_skip_list->lower_bound(scan_ctx->start_serkey);
+  if (m_cur_node)
+    m_end_node = m_skip_list->lower_bound(scan_ctx->end_serkey);
+
+  if (!m_deletes.empty()) {
+    m_in_deletes = true;
+    m_delete_iter = m_deletes.begin();
+  }
+
+  skip_to_visible();
+}
+
+
+/**
+ * Advances m_cur_node to the first node at or after the current one that
+ * belongs to a family included in the scan
+ */
+void CellCacheSkipListScanner::skip_to_visible() {
+  while (m_cur_node != m_end_node) {
+    m_cur_key.load(m_cur_node->key);
+    if (m_cur_key.flag == FLAG_DELETE_ROW
+        || m_scan_context_ptr->family_mask[m_cur_key.column_family_code]) {
+      m_cur_value.ptr = m_cur_key.serial.ptr + m_cur_node->key_len;
+      return;
+    }
+    m_cur_node = m_cur_node->next[0];
+  }
+  m_eos = true;
+}
+
+
+bool CellCacheSkipListScanner::get(Key &key, ByteString &value) {
+
+  if (m_in_deletes) {
+    m_cur_key.load( (*m_delete_iter).first );
+    key = m_cur_key;
+    value = 0;
+    return true;
+  }
+
+  if (!m_eos) {
+    key = m_cur_key;
+    value = m_keys_only ? (ByteString)0 : m_cur_value;
+    return true;
+  }
+
+  return false;
+}
+
+
+void CellCacheSkipListScanner::forward() {
+
+  if (m_in_deletes) {
+    ++m_delete_iter;
+    if (m_delete_iter == m_deletes.end()) {
+      m_in_deletes = false;
+      if (!m_eos)
+        m_cur_key.load(m_cur_node->key);
+    }
+    return;
+  }
+
+  if (m_eos)
+    return;
+
+  m_cur_node = m_cur_node->next[0];
+  skip_to_visible();
+}
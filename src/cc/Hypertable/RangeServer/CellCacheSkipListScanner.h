@@ -0,0 +1,64 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_CELLCACHESKIPLISTSCANNER_H
+#define HYPERTABLE_CELLCACHESKIPLISTSCANNER_H
+
+#include <map>
+
+#include "CellCacheSkipList.h"
+#include "CellListScanner.h"
+#include "ScanContext.h"
+
+
+namespace Hypertable {
+
+  /**
+   * Provides a scanning interface to a CellCacheSkipList.  Unlike
+   * CellCacheScanner, this scanner never takes the cell cache lock.
+   */
+  class CellCacheSkipListScanner : public CellListScanner {
+  public:
+    CellCacheSkipListScanner(CellCachePtr &cellcache, ScanContextPtr &scan_ctx);
+    virtual ~CellCacheSkipListScanner() { return; }
+    virtual void forward();
+    virtual bool get(Key &key, ByteString &value);
+
+    typedef std::map<const SerializedKey, uint32_t> DeleteMap;
+
+  private:
+    void skip_to_visible();
+
+    CellCachePtr                   m_cell_cache_ptr;
+    CellCacheSkipList             *m_skip_list;
+    CellCacheSkipList::Node       *m_end_node;
+    CellCacheSkipList::Node       *m_cur_node;
+    DeleteMap::iterator            m_delete_iter;
+    Key                            m_cur_key;
+    ByteString                     m_cur_value;
+    DeleteMap                      m_deletes;
+    bool                           m_in_deletes;
+    bool                           m_eos;
+    bool                           m_keys_only;
+  };
+}
+
+#endif // HYPERTABLE_CELLCACHESKIPLISTSCANNER_H
@@ -22,9 +22,12 @@
 #ifndef HYPERTABLE_CELLLIST_H
 #define HYPERTABLE_CELLLIST_H
 
+#include <vector>
+
 #include "Common/atomic.h"
 #include "Common/ByteString.h"
 #include "Common/ReferenceCount.h"
+#include "Common/String.h"
 
 #include "ScanContext.h"
 
@@ -35,6 +38,19 @@ namespace Hypertable {
   class CellList;
   class CellListScanner;
 
+  /**
+   * Number of bytes of a cell list that lie in a segment ending at a row,
+   * i.e. bytes whose rows are less than or equal to the row and greater than
+   * the row of the previous sample of the same list.  Used to pick split
+   * rows that divide a range by size rather than by key count.
+   */
+  struct SplitSample {
+    SplitSample(const char *row, int64_t bytes) : row(row), bytes(bytes) { }
+    bool operator<(const SplitSample &other) const { return row < other.row; }
+    String row;
+    int64_t bytes;
+  };
+
   /**
    * Abstract base class for cell lists (sorted lists of key/value
    * pairs).  Cell lists include cell stores and cell caches.
@@ -68,6 +84,14 @@ namespace Hypertable {
      */
     virtual const char *get_split_row() = 0;
 
+    /**
+     * Appends size weighted row samples of this cell list (see SplitSample)
+     * in row order.  The default implementation appends nothing.
+     *
+     * @param samples vector to append the samples to
+     */
+    virtual void get_split_samples(std::vector<SplitSample> &samples) { }
+
     /**
      * Returns the start row of this cell list.  This value is used to restrict
      * the start range of the cell list to values that are greater than this
@@ -115,6 +115,29 @@ namespace Hypertable {
      */
     virtual bool may_contain(ScanContextPtr &) = 0;
 
+    /**
+     * Tests whether the row and timestamp bounds recorded for this cell
+     * store overlap the row interval and time interval of a scan.  A false
+     * return means the store cannot hold a cell the scan would return, so
+     * it need not be opened.
+     *
+     * @param scan_ctx scan context
+     * @return false if the store can be skipped for this scan
+     */
+    virtual bool may_intersect(ScanContextPtr &scan_ctx) { return true; }
+
+    /**
+     * Returns the first and last row of the cells in this store, if they
+     * are known
+     *
+     * @param first_row receives the first row
+     * @param last_row receives the last row
+     * @return false if the row bounds are not known
+     */
+    virtual bool get_row_bounds(String &first_row, String &last_row) {
+      return false;
+    }
+
     /**
      * Returns the disk used by this cell store.  If the cell store is opened
      * with a restricted range, then it returns an estimate of the disk used by
@@ -225,6 +248,14 @@ namespace Hypertable {
      */
     virtual bool restricted_range() = 0;
 
+    /**
+     * Returns true if the keys in the data blocks of this cell store are
+     * prefix compressed (see CellStoreBlock.h)
+     *
+     * @return true if data blocks have prefix compressed keys
+     */
+    virtual bool prefix_compressed_keys() { return false; }
+
     static const char DATA_BLOCK_MAGIC[10];
     static const char INDEX_FIXED_BLOCK_MAGIC[10];
     static const char INDEX_VARIABLE_BLOCK_MAGIC[10];
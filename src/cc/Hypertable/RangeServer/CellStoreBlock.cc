@@ -0,0 +1,197 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "CellStoreBlock.h"
+
+using namespace Hypertable;
+using namespace Serialization;
+
+namespace {
+  // room reserved in front of a reconstructed key for its length prefix
+  const size_t KEY_HEADROOM = 5;
+}
+
+
+void
+CellStoreBlockBuilder::add(DynamicBuffer &buf, const SerializedKey key,
+                           const ByteString value) {
+  const uint8_t *kptr = key.ptr;
+  uint32_t klen = decode_vi32(&kptr);
+  size_t key_len = (kptr - key.ptr) + klen;
+  size_t value_len = value.length();
+  uint32_t shared = 0;
+
+  if (m_count % RESTART_INTERVAL == 0)
+    m_restarts.push_back(buf.fill());
+  else {
+    const uint8_t *lptr = m_last_key.base;
+    uint32_t llen = decode_vi32(&lptr);
+    uint32_t max_shared = (llen < klen) ? llen : klen;
+    while (shared < max_shared && lptr[shared] == kptr[shared])
+      shared++;
+  }
+
+  buf.ensure(10 + (klen - shared) + value_len);
+  encode_vi32(&buf.ptr, shared);
+  encode_vi32(&buf.ptr, klen - shared);
+  buf.add_unchecked(kptr + shared, klen - shared);
+  buf.add_unchecked(value.ptr, value_len);
+
+  m_last_key.clear();
+  m_last_key.ensure(key_len);
+  m_last_key.add_unchecked(key.ptr, key_len);
+  m_count++;
+}
+
+
+void CellStoreBlockBuilder::finish(DynamicBuffer &buf) {
+  buf.ensure(4 * (m_restarts.size() + 1));
+  for (size_t i = 0; i < m_restarts.size(); i++)
+    encode_i32(&buf.ptr, m_restarts[i]);
+  encode_i32(&buf.ptr, m_restarts.size());
+  m_restarts.clear();
+  m_count = 0;
+}
+
+
+bool
+CellStoreBlockDecoder::load(const uint8_t *base, size_t len,
+                            bool prefix_compressed) {
+  m_base = base;
+  m_ptr = base;
+  m_end = base + len;
+  m_prefix_compressed = prefix_compressed;
+  m_restarts = 0;
+  m_num_restarts = 0;
+  m_key_len = 0;
+
+  if (m_prefix_compressed) {
+    const uint8_t *p = m_end - 4;
+    size_t remaining = 4;
+    if (len < 4)
+      HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE, "Truncated block");
+    m_num_restarts = decode_i32(&p, &remaining);
+    if ((size_t)m_num_restarts > (len - 4) / 4)
+      HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
+                "Bad restart count %u in block of length %lu",
+                m_num_restarts, (Lu)len);
+    m_restarts = m_end - 4 - (4 * m_num_restarts);
+    m_end = m_restarts;
+  }
+
+  if (m_ptr >= m_end)
+    return false;
+
+  decode_entry();
+  return true;
+}
+
+
+uint32_t CellStoreBlockDecoder::restart_offset(uint32_t i) const {
+  const uint8_t *p = m_restarts + (4 * i);
+  size_t remaining = 4;
+  return decode_i32(&p, &remaining);
+}
+
+
+/**
+ * Decodes the entry at m_ptr.  For prefix compressed blocks the unshared
+ * key bytes are copied over the tail of the previous key in m_key_buf and
+ * the length prefix is written in front of it.
+ */
+void CellStoreBlockDecoder::decode_entry() {
+
+  if (!m_prefix_compressed) {
+    m_key.ptr = m_ptr;
+    m_value.ptr = m_ptr + m_key.length();
+    return;
+  }
+
+  const uint8_t *p = m_ptr;
+  uint32_t shared = decode_vi32(&p);
+  uint32_t unshared = decode_vi32(&p);
+  size_t total = shared + unshared;
+
+  if (shared > m_key_len)
+    HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE, "Bad shared key length "
+              "%u (previous key length %lu)", shared, (Lu)m_key_len);
+
+  if (KEY_HEADROOM + total > m_key_buf.size) {
+    m_key_buf.ptr = m_key_buf.base + KEY_HEADROOM + shared;
+    m_key_buf.grow((KEY_HEADROOM + total) * 3 / 2);
+  }
+
+  uint8_t *kbase = m_key_buf.base + KEY_HEADROOM;
+  memcpy(kbase + shared, p, unshared);
+  m_key_len = total;
+
+  uint8_t lenbuf[KEY_HEADROOM], *lptr = lenbuf;
+  encode_vi32(&lptr, total);
+  size_t lenlen = lptr - lenbuf;
+  memcpy(kbase - lenlen, lenbuf, lenlen);
+
+  m_key.ptr = kbase - lenlen;
+  m_value.ptr = p + unshared;
+}
+
+
+bool CellStoreBlockDecoder::seek(const SerializedKey key) {
+
+  if (!(m_key < key))
+    return true;
+
+  /**
+   * Binary search for the last restart point past the current entry whose
+   * key is less than the key being sought.
+   */
+  if (m_prefix_compressed && m_num_restarts) {
+    uint32_t cur_offset = m_ptr - m_base;
+    uint32_t lo = 0, hi = m_num_restarts;
+
+    while (lo < hi) {
+      uint32_t mid = lo + (hi - lo) / 2;
+      if (restart_offset(mid) <= cur_offset || restart_key(mid) < key)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+    // lo is the first restart whose key is >= key, start from the one before
+    if (lo > 0 && restart_offset(lo - 1) > cur_offset) {
+      m_ptr = m_base + restart_offset(lo - 1);
+      m_key_len = 0;
+      decode_entry();
+    }
+  }
+
+  while (m_key < key) {
+    if (!next())
+      return false;
+  }
+  return true;
+}
@@ -0,0 +1,156 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_CELLSTOREBLOCK_H
+#define HYPERTABLE_CELLSTOREBLOCK_H
+
+#include <vector>
+
+#include "Common/ByteString.h"
+#include "Common/DynamicBuffer.h"
+
+#include "Hypertable/Lib/SerializedKey.h"
+
+namespace Hypertable {
+
+  /**
+   * Layout of a CellStore data block with prefix compressed keys.  Each
+   * entry is encoded as
+   *
+   *   vint shared | vint unshared | key bytes [shared..] | value
+   *
+   * where the key bytes are the serialized key without its length prefix
+   * and 'shared' is the number of leading bytes it has in common with the
+   * previous key of the block.  Every RESTART_INTERVAL entries the key is
+   * stored in full (shared == 0), which makes the remainder of the entry a
+   * plain SerializedKey.  The block ends with the offsets of the restart
+   * entries (i32 each) followed by the number of restart entries (i32).
+   */
+  class CellStoreBlockBuilder {
+  public:
+    enum { RESTART_INTERVAL = 16 };
+
+    CellStoreBlockBuilder() : m_count(0) { }
+
+    /**
+     * Appends a key/value pair to the block being built in buf
+     *
+     * @param buf block buffer
+     * @param key serialized key
+     * @param value value
+     */
+    void add(DynamicBuffer &buf, const SerializedKey key,
+             const ByteString value);
+
+    /**
+     * Appends the restart point array to buf and resets the builder for the
+     * next block.
+     *
+     * @param buf block buffer
+     */
+    void finish(DynamicBuffer &buf);
+
+    /**
+     * Returns the last key added, which stays valid until the next call to
+     * #add.
+     */
+    SerializedKey last_key() { return SerializedKey(m_last_key.base); }
+
+  private:
+    DynamicBuffer         m_last_key;
+    std::vector<uint32_t> m_restarts;
+    size_t                m_count;
+  };
+
+
+  /**
+   * Iterates over the key/value pairs of an uncompressed CellStore data
+   * block, either in the original layout (plain serialized key followed by
+   * value) or in the prefix compressed layout written by
+   * CellStoreBlockBuilder.  In the latter case keys are reconstructed
+   * incrementally into an internal buffer, so the key returned by #key is
+   * only valid until the next call to #next or #seek.
+   */
+  class CellStoreBlockDecoder {
+  public:
+    CellStoreBlockDecoder() : m_base(0), m_ptr(0), m_end(0), m_restarts(0),
+                              m_num_restarts(0), m_prefix_compressed(false),
+                              m_key_len(0) { }
+
+    /**
+     * Loads a block and positions the decoder at its first entry
+     *
+     * @param base pointer to start of uncompressed block
+     * @param len length of block
+     * @param prefix_compressed true if the block has prefix compressed keys
+     * @return false if the block is empty
+     */
+    bool load(const uint8_t *base, size_t len, bool prefix_compressed);
+
+    /**
+     * Advances to the next entry of the block
+     *
+     * @return false if the end of the block has been reached
+     */
+    bool next() {
+      m_ptr = m_value.ptr + m_value.length();
+      if (m_ptr >= m_end)
+        return false;
+      decode_entry();
+      return true;
+    }
+
+    /**
+     * Positions the decoder at the first entry whose key is greater than or
+     * equal to the given key, starting from the current entry.  Restart
+     * points are used to skip ahead with a binary search.
+     *
+     * @param key key to seek to
+     * @return false if all remaining keys in the block are less than key
+     */
+    bool seek(const SerializedKey key);
+
+    SerializedKey key() const { return m_key; }
+    ByteString value() const { return m_value; }
+
+  private:
+    void decode_entry();
+    uint32_t restart_offset(uint32_t i) const;
+    SerializedKey restart_key(uint32_t i) const {
+      // the shared count of a restart entry is a single zero byte
+      return SerializedKey(m_base + restart_offset(i) + 1);
+    }
+
+    const uint8_t *m_base;
+    const uint8_t *m_ptr;
+    const uint8_t *m_end;
+    const uint8_t *m_restarts;
+    uint32_t       m_num_restarts;
+    bool           m_prefix_compressed;
+    SerializedKey  m_key;
+    ByteString     m_value;
+    DynamicBuffer  m_key_buf;
+    size_t         m_key_len;
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_CELLSTOREBLOCK_H
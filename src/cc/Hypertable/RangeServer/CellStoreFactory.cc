@@ -67,10 +67,13 @@ CellStore *CellStoreFactory::open(const String &name,
 
   version = Serialization::decode_i16(&ptr, &remaining);
 
-  if (version == 1) {
+  if (version >= 1 && version <= 3) {
     CellStoreTrailerV1 trailer_v1;
     CellStoreV1 *cellstore_v1;
 
+    // the trailer length depends on its version
+    trailer_v1.version = version;
+
     if (amount < trailer_v1.size())
       HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
                 "Bad length of CellStoreV1 file '%s' - %llu",
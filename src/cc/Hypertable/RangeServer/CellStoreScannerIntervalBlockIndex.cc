@@ -42,6 +42,7 @@ CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(C
 
   memset(&m_block, 0, sizeof(m_block));
   m_file_id = m_cellstore->get_file_id();
+  m_prefix_compressed = m_cellstore->prefix_compressed_keys();
   m_zcodec = m_cellstore->create_block_compression_codec();
 
   m_end_row = (m_end_key) ? m_end_key.row() : Key::END_ROW_MARKER;
@@ -56,10 +57,8 @@ CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(C
   }
 
   if (m_start_key) {
-    while (m_cur_key < m_start_key) {
-      m_cur_key.ptr = m_cur_value.ptr + m_cur_value.length();
-      m_cur_value.ptr = m_cur_key.ptr + m_cur_key.length();
-      if (m_cur_key.ptr >= m_block.end && !fetch_next_block()) {
+    while (!m_decoder.seek(m_start_key)) {
+      if (!fetch_next_block()) {
         m_iter = m_index->end();
         return;
       }
@@ -69,7 +68,7 @@ CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(C
   /**
    * End of range check
    */
-  if (m_end_key && m_cur_key >= m_end_key) {
+  if (m_end_key && m_decoder.key() >= m_end_key) {
     m_iter = m_index->end();
     return;
   }
@@ -77,7 +76,7 @@ CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(C
   /**
    * Column family check
    */
-  if (!m_key.load(m_cur_key))
+  if (!m_key.load(m_decoder.key()))
     HT_ERROR("Problem parsing key!");
   else if (m_key.flag != FLAG_DELETE_ROW &&
            !m_scan_ctx->family_mask[m_key.column_family_code])
@@ -101,7 +100,7 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::get(Key &key, ByteString &value
     return false;
 
   key = m_key;
-  value = m_cur_value;
+  value = m_decoder.value();
 
   return true;
 }
@@ -116,22 +115,18 @@ void CellStoreScannerIntervalBlockIndex<IndexT>::forward() {
     if (m_iter == m_index->end())
       return;
 
-    m_cur_key.ptr = m_cur_value.ptr + m_cur_value.length();
-
-    if (m_cur_key.ptr >= m_block.end && !fetch_next_block())
+    if (!m_decoder.next() && !fetch_next_block())
       return;
 
-    if (m_check_for_range_end && m_cur_key >= m_end_key) {
+    if (m_check_for_range_end && m_decoder.key() >= m_end_key) {
       m_iter = m_index->end();
       return;
     }
 
-    m_cur_value.ptr = m_cur_key.ptr + m_cur_key.length();
-
     /**
      * Column family check
      */
-    if (!m_key.load(m_cur_key))
+    if (!m_key.load(m_decoder.key()))
       HT_ERROR("Problem parsing key!");
     if (m_key.flag == FLAG_DELETE_ROW
         || m_scan_ctx->family_mask[m_key.column_family_code])
@@ -147,8 +142,8 @@ void CellStoreScannerIntervalBlockIndex<IndexT>::forward() {
  *
  * Preconditions required to call this method: 1. m_block is cleared and m_iter
  * points to the m_index entry of the first block to fetch 'or' 2. m_block is
- * loaded with the current block and m_iter points to the m_index entry of the
- * current block
+ * loaded with the current block, all of its entries have been consumed and
+ * m_iter points to the m_index entry of the current block
  *
  * @return true if next block successfully fetched, false if no next block
  */
@@ -156,7 +151,7 @@ template <typename IndexT>
 bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block() {
 
   // If we're at the end of the current block, deallocate and move to next
-  if (m_block.base != 0 && m_cur_key.ptr >= m_block.end) {
+  if (m_block.base != 0) {
     Global::block_cache->checkin(m_file_id, m_block.offset);
     memset(&m_block, 0, sizeof(m_block));
     ++m_iter;
@@ -184,20 +179,33 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block() {
     /**
      * Cache lookup / block read
      */
-    if (!Global::block_cache->checkout(m_file_id, (uint32_t)m_block.offset,
+    if (!Global::block_cache->checkout(m_file_id, m_block.offset,
                                       (uint8_t **)&m_block.base, &len)) {
       bool second_try = false;
     try_again:
       try {
         DynamicBuffer buf(m_block.zlength);
+        FileBlockCache *zcache = Global::compressed_block_cache;
+        bool insert_compressed = false;
+        uint8_t *zblock;
+        uint32_t zlen;
 
         if (second_try)
           m_fd = m_cellstore->reopen_fd();
 
-        /** Read compressed block **/
-        Global::dfs->pread(m_fd, buf.ptr, m_block.zlength, m_block.offset);
+        if (zcache && !second_try &&
+            zcache->checkout(m_file_id, m_block.offset, &zblock, &zlen)) {
+          /** Copy compressed block out of the second tier cache **/
+          buf.add_unchecked(zblock, zlen);
+          zcache->checkin(m_file_id, m_block.offset);
+        }
+        else {
+          /** Read compressed block **/
+          Global::dfs->pread(m_fd, buf.ptr, m_block.zlength, m_block.offset);
+          buf.ptr += m_block.zlength;
+          insert_compressed = zcache != 0;
+        }
 
-        buf.ptr += m_block.zlength;
         /** inflate compressed block **/
         BlockCompressionHeader header;
 
@@ -206,6 +214,17 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block() {
         if (!header.check_magic(CellStore::DATA_BLOCK_MAGIC))
           HT_THROW(Error::BLOCK_COMPRESSOR_BAD_MAGIC,
                    "Error inflating cell store block - magic string mismatch");
+
+        /** Hand the verified compressed block to the second tier cache **/
+        if (insert_compressed) {
+          size_t zfill;
+          zblock = buf.release(&zfill);
+          if (zcache->insert_and_checkout(m_file_id, m_block.offset, zblock,
+                                          zfill))
+            zcache->checkin(m_file_id, m_block.offset);
+          else
+            delete [] zblock;
+        }
       }
       catch (Exception &e) {
         HT_ERROR_OUT <<"Error reading cell store ("
@@ -238,8 +257,9 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block() {
       }
     }
     m_block.end = m_block.base + len;
-    m_cur_key.ptr = m_block.base;
-    m_cur_value.ptr = m_cur_key.ptr + m_cur_key.length();
+
+    if (!m_decoder.load(m_block.base, len, m_prefix_compressed))
+      return fetch_next_block();
 
     return true;
   }
@@ -25,6 +25,7 @@
 #include "Common/DynamicBuffer.h"
 
 #include "CellStore.h"
+#include "CellStoreBlock.h"
 #include "CellStoreScannerInterval.h"
 #include "ScanContext.h"
 
@@ -53,9 +54,8 @@ namespace Hypertable {
     IndexT               *m_index;
     IndexIteratorT        m_iter;
     BlockInfo             m_block;
+    CellStoreBlockDecoder m_decoder;
     Key                   m_key;
-    SerializedKey         m_cur_key;
-    ByteString            m_cur_value;
     SerializedKey         m_start_key;
     SerializedKey         m_end_key;
     const char *          m_end_row;
@@ -64,6 +64,7 @@ namespace Hypertable {
     int32_t               m_fd;
     bool                  m_check_for_range_end;
     int                   m_file_id;
+    bool                  m_prefix_compressed;
     ScanContextPtr         m_scan_ctx;
 
   };
@@ -47,6 +47,7 @@ CellStoreScannerIntervalReadahead<IndexT>::CellStoreScannerIntervalReadahead(Cel
   int64_t start_offset;
 
   memset(&m_block, 0, sizeof(m_block));
+  m_prefix_compressed = m_cellstore->prefix_compressed_keys();
   m_zcodec = m_cellstore->create_block_compression_codec();
 
   if (index) {
@@ -101,14 +102,10 @@ CellStoreScannerIntervalReadahead<IndexT>::CellStoreScannerIntervalReadahead(Cel
    */
 
   if (start_key) {
-    while (m_cur_key < start_key) {
-      m_cur_key.ptr = m_cur_value.ptr + m_cur_value.length();
-      m_cur_value.ptr = m_cur_key.ptr + m_cur_key.length();
-      if (m_cur_key.ptr >= m_block.end) {
-        if (!fetch_next_block_readahead()) {
-          m_eos = true;
-          return;
-        }
+    while (!m_decoder.seek(start_key)) {
+      if (!fetch_next_block_readahead()) {
+        m_eos = true;
+        return;
       }
     }
   }
@@ -116,7 +113,7 @@ CellStoreScannerIntervalReadahead<IndexT>::CellStoreScannerIntervalReadahead(Cel
   /**
    * End of range check
    */
-  if (end_key && m_cur_key >= end_key) {
+  if (end_key && m_decoder.key() >= end_key) {
     m_eos = true;
     return;
   }
@@ -125,7 +122,7 @@ CellStoreScannerIntervalReadahead<IndexT>::CellStoreScannerIntervalReadahead(Cel
   /**
    * Column family check
    */
-  if (!m_key.load(m_cur_key))
+  if (!m_key.load(m_decoder.key()))
     HT_ERROR("Problem parsing key!");
   else if (m_key.flag != FLAG_DELETE_ROW &&
            !m_scan_ctx->family_mask[m_key.column_family_code])
@@ -159,7 +156,7 @@ bool CellStoreScannerIntervalReadahead<IndexT>::get(Key &key, ByteString &value)
     return false;
 
   key = m_key;
-  value = m_cur_value;
+  value = m_decoder.value();
 
   return true;
 }
@@ -175,22 +172,18 @@ void CellStoreScannerIntervalReadahead<IndexT>::forward() {
       return;
 
 
-    m_cur_key.ptr = m_cur_value.ptr + m_cur_value.length();
-
-    if (m_cur_key.ptr >= m_block.end && !fetch_next_block_readahead())
+    if (!m_decoder.next() && !fetch_next_block_readahead())
       return;
 
-    if (m_check_for_range_end && m_cur_key >= m_end_key) {
+    if (m_check_for_range_end && m_decoder.key() >= m_end_key) {
       m_eos = true;
       return;
     }
 
-    m_cur_value.ptr = m_cur_key.ptr + m_cur_key.length();
-
     /**
      * Column family check
      */
-    if (!m_key.load(m_cur_key))
+    if (!m_key.load(m_decoder.key()))
       HT_ERROR("Problem parsing key!");
     if (m_key.flag == FLAG_DELETE_ROW
         || m_scan_ctx->family_mask[m_key.column_family_code])
@@ -209,8 +202,9 @@ void CellStoreScannerIntervalReadahead<IndexT>::forward() {
  *  1. m_block is cleared and m_iter points to the m_index entry of the first
  *     block to fetch
  *    'or'
- *  2. m_block is loaded with the current block and m_iter points to the
- *     m_index entry of the current block
+ *  2. m_block is loaded with the current block, all of its entries have
+ *     been consumed and m_iter points to the m_index entry of the current
+ *     block
  *
  * @return true if next block successfully fetched, false if no next block
  */
@@ -218,7 +212,7 @@ template <typename IndexT>
 bool CellStoreScannerIntervalReadahead<IndexT>::fetch_next_block_readahead() {
 
   // If we're at the end of the current block, deallocate and move to next
-  if (m_block.base != 0 && m_cur_key.ptr >= m_block.end) {
+  if (m_block.base != 0) {
     delete [] m_block.base;
     memset(&m_block, 0, sizeof(m_block));
   }
@@ -273,8 +267,9 @@ bool CellStoreScannerIntervalReadahead<IndexT>::fetch_next_block_readahead() {
     len = fill;
 
     m_block.end = m_block.base + len;
-    m_cur_key.ptr = m_block.base;
-    m_cur_value.ptr = m_cur_key.ptr + m_cur_key.length();
+
+    if (!m_decoder.load(m_block.base, len, m_prefix_compressed))
+      return fetch_next_block_readahead();
 
     return true;
   }
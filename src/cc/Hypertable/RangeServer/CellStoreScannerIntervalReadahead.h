@@ -25,6 +25,7 @@
 #include "Common/DynamicBuffer.h"
 
 #include "CellStore.h"
+#include "CellStoreBlock.h"
 #include "CellStoreScannerInterval.h"
 #include "ScanContext.h"
 
@@ -51,16 +52,16 @@ namespace Hypertable {
 
     CellStorePtr           m_cellstore;
     BlockInfo              m_block;
+    CellStoreBlockDecoder  m_decoder;
     Key                    m_key;
-    SerializedKey          m_cur_key;
     SerializedKey          m_end_key;
-    ByteString             m_cur_value;
     BlockCompressionCodec *m_zcodec;
     int32_t                m_fd;
     int64_t                m_offset;
     int64_t                m_end_offset;
     bool                   m_check_for_range_end;
     bool                   m_eos;
+    bool                   m_prefix_compressed;
     ScanContextPtr         m_scan_ctx;
 
   };
@@ -59,12 +59,14 @@ void CellStoreTrailerV1::clear() {
   timestamp_min = TIMESTAMP_MAX;
   timestamp_max = TIMESTAMP_MIN;
   create_time = 0;
+  delete_count = 0;
+  row_bounds_offset = 0;
   table_id = 0xffffffff;
   table_generation = 0;
   flags = 0;
   compression_ratio = 0.0;
   compression_type = 0;
-  version = 1;
+  version = 3;
 }
 
 
@@ -89,9 +91,13 @@ void CellStoreTrailerV1::serialize(uint8_t *buf) {
   encode_i32(&buf, table_generation);
   encode_i32(&buf, flags);
   encode_i32(&buf, compression_ratio_i32);
+  if (version >= 2)
+    encode_i64(&buf, delete_count);
+  if (version >= 3)
+    encode_i64(&buf, row_bounds_offset);
   encode_i16(&buf, compression_type);
   encode_i16(&buf, version);
-  assert(version == 1);
+  assert(version >= 1 && version <= 3);
   assert((buf-base) == (int)CellStoreTrailerV1::size());
   (void)base;
 }
@@ -119,6 +125,10 @@ void CellStoreTrailerV1::deserialize(const uint8_t *buf) {
     table_generation = decode_i32(&buf, &remaining);
     flags = decode_i32(&buf, &remaining);
     compression_ratio_i32 = decode_i32(&buf, &remaining);
+    if (version >= 2)
+      delete_count = decode_i64(&buf, &remaining);
+    if (version >= 3)
+      row_bounds_offset = decode_i64(&buf, &remaining);
     compression_type = decode_i16(&buf, &remaining);
     version = decode_i16(&buf, &remaining));
 }
@@ -142,12 +152,19 @@ void CellStoreTrailerV1::display(std::ostream &os) {
   os << ", timestamp_min=" << timestamp_min;
   os << ", timestamp_max=" << timestamp_max;
   os << ", create_time=" << create_time;
+  if (version >= 2)
+    os << ", delete_count=" << delete_count;
+  if (version >= 3)
+    os << ", row_bounds_offset=" << row_bounds_offset;
   os << ", table_id=" << table_id;
   os << ", table_generation=" << table_generation;
+  os << ", flags=" << flags;
   if (flags & INDEX_64BIT)
-    os << ", flags=64BIT_INDEX";
-  else
-    os << ", flags=" << flags;
+    os << " 64BIT_INDEX";
+  if (flags & BLOOM_FILTER_BLOCKED)
+    os << " BLOOM_FILTER_BLOCKED";
+  if (flags & PREFIX_COMPRESSED_KEYS)
+    os << " PREFIX_COMPRESSED_KEYS";
   os << ", compression_ratio=" << compression_ratio;
   os << ", compression_type=" << compression_type;
   os << ", version=" << version << "}";
@@ -170,12 +187,20 @@ void CellStoreTrailerV1::display_multiline(std::ostream &os) {
   os << "  timestamp_min: " << timestamp_min << "\n";
   os << "  timestamp_max: " << timestamp_max << "\n";
   os << "  create_time: " << create_time << "\n";
+  if (version >= 2)
+    os << "  delete_count: " << delete_count << "\n";
+  if (version >= 3)
+    os << "  row_bounds_offset: " << row_bounds_offset << "\n";
   os << "  table_id: " << table_id << "\n";
   os << "  table_generation: " << table_generation << "\n";
+  os << "  flags: " << flags;
   if (flags & INDEX_64BIT)
-    os << "  flags: 64BIT_INDEX\n";
-  else
-    os << "  flags=" << flags << "\n";
+    os << " 64BIT_INDEX";
+  if (flags & BLOOM_FILTER_BLOCKED)
+    os << " BLOOM_FILTER_BLOCKED";
+  if (flags & PREFIX_COMPRESSED_KEYS)
+    os << " PREFIX_COMPRESSED_KEYS";
+  os << "\n";
   os << "  compression_ratio: " << compression_ratio << "\n";
   os << "  compression_type: " << compression_type << "\n";
   os << "  version: " << version << std::endl;
@@ -33,7 +33,13 @@ namespace Hypertable {
     CellStoreTrailerV1();
     virtual ~CellStoreTrailerV1() { return; }
     virtual void clear();
-    virtual size_t size() { return 112; }
+    /**
+     * Version 2 adds delete_count to the version 1 layout and version 3
+     * adds row_bounds_offset
+     */
+    virtual size_t size() {
+      return (version >= 3) ? 128 : (version == 2) ? 120 : 112;
+    }
     virtual void serialize(uint8_t *buf);
     virtual void deserialize(const uint8_t *buf);
     virtual void display(std::ostream &os);
@@ -54,6 +60,8 @@ namespace Hypertable {
     int64_t  timestamp_min;
     int64_t  timestamp_max;
     int64_t  create_time;
+    int64_t  delete_count;
+    int64_t  row_bounds_offset;
     uint32_t table_id;
     uint32_t table_generation;
     uint32_t flags;
@@ -64,7 +72,11 @@ namespace Hypertable {
     uint16_t  compression_type;
     uint16_t  version;
 
-    enum Flags { INDEX_64BIT = 0x00000001 };
+    enum Flags {
+      INDEX_64BIT            = 0x00000001,
+      BLOOM_FILTER_BLOCKED   = 0x00000002,
+      PREFIX_COMPRESSED_KEYS = 0x00000004
+    };
 
     boost::any get(const String& prop) {
       if     (prop == "version")                return version;
@@ -81,6 +93,9 @@ namespace Hypertable {
       else if (prop == "timestamp_min")         return timestamp_min;
       else if (prop == "timestamp_max")         return timestamp_max;
       else if (prop == "create_time")           return create_time;
+      else if (prop == "delete_count" && version >= 2) return delete_count;
+      else if (prop == "row_bounds_offset" && version >= 3)
+          return row_bounds_offset;
       else if (prop == "table_id")              return table_id;
       else if (prop == "table_generation")      return table_generation;
       else if (prop == "flags")                 return flags;
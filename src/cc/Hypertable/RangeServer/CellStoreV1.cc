@@ -28,8 +28,11 @@
 #include "Common/Config.h"
 #include "Common/Error.h"
 #include "Common/Logger.h"
+#include "Common/Serialization.h"
 #include "Common/System.h"
 
+#include "AsyncComm/ApplicationHandler.h"
+#include "AsyncComm/ApplicationQueue.h"
 #include "AsyncComm/Protocol.h"
 
 #include "Hypertable/Lib/BlockCompressionHeader.h"
@@ -50,23 +53,61 @@ using namespace Hypertable;
 
 namespace {
   const uint32_t MAX_APPENDS_OUTSTANDING = 3;
+
+  /**
+   * Appends one sample per block of the index, weighted by the on-disk size
+   * of the block.  Index entries hold the last key of each block.
+   */
+  template <typename IndexMapT>
+  void add_block_samples(IndexMapT &index, std::vector<SplitSample> &samples) {
+    typename IndexMapT::iterator iter = index.begin();
+    typename IndexMapT::iterator end = index.end();
+    int64_t offset, next_offset;
+
+    while (iter != end) {
+      SerializedKey key = iter.key();
+      offset = iter.value();
+      ++iter;
+      next_offset = (iter == end) ? index.end_of_last_block() : iter.value();
+      samples.push_back(SplitSample(key.row(), next_offset - offset));
+    }
+  }
 }
 
 
+class CellStoreV1::CompressHandler : public ApplicationHandler {
+public:
+  CompressHandler(CellStoreV1 *cellstore, CompressJob *job)
+    : m_cellstore(cellstore), m_job(job) { }
+  virtual void run() { m_cellstore->compress_block(m_job); }
+private:
+  CellStoreV1 *m_cellstore;
+  CompressJob *m_job;
+};
+
+
 CellStoreV1::CellStoreV1(Filesystem *filesys)
   : m_filesys(filesys), m_fd(-1), m_filename(), m_64bit_index(false),
-    m_compressor(0), m_buffer(0), m_outstanding_appends(0), m_offset(0),
+    m_compressor(0), m_buffer(0), m_prefix_compressed(false),
+    m_outstanding_appends(0), m_offset(0),
     m_last_key(0), m_file_length(0), m_disk_usage(0), m_file_id(0),
     m_uncompressed_blocksize(0), m_bloom_filter_mode(BLOOM_FILTER_DISABLED),
     m_bloom_filter(0), m_bloom_filter_items(0), m_bloom_filter_memory(0),
     m_block_index_memory(0), m_bloom_filter_access_counter(0),
-    m_block_index_access_counter(0), m_restricted_range(false) {
+    m_block_index_access_counter(0), m_restricted_range(false),
+    m_have_row_bounds(false), m_max_pending_blocks(0) {
   m_file_id = FileBlockCache::get_next_file_id();
   assert(sizeof(float) == 4);
 }
 
 
 CellStoreV1::~CellStoreV1() {
+  wait_for_compressions();
+  foreach(CompressJob *job, m_pending_blocks)
+    delete job;
+  foreach(CompressJob *job, m_free_jobs)
+    delete job;
+
   try {
     delete m_compressor;
     delete m_bloom_filter;
@@ -96,6 +137,17 @@ const char *CellStoreV1::get_split_row() {
   return 0;
 }
 
+void CellStoreV1::get_split_samples(std::vector<SplitSample> &samples) {
+  m_block_index_access_counter = ++Global::access_counter;
+  if (m_block_index_memory == 0)
+    load_block_index();
+
+  if (m_64bit_index)
+    add_block_samples(m_index_map64, samples);
+  else
+    add_block_samples(m_index_map32, samples);
+}
+
 CellListScanner *CellStoreV1::create_scanner(ScanContextPtr &scan_ctx) {
   bool need_index =  m_restricted_range || scan_ctx->restricted_range;
 
@@ -138,6 +190,8 @@ CellStoreV1::create(const char *fname, size_t max_entries,
   m_fd = -1;
   m_offset = 0;
   m_last_key = 0;
+  m_first_row.clear();
+  m_last_row.clear();
 
   m_index_builder.fixed_buf().reserve(4*4096);
   m_index_builder.variable_buf().reserve(1024*1024);
@@ -147,6 +201,12 @@ CellStoreV1::create(const char *fname, size_t max_entries,
 
   m_trailer.clear();
   m_trailer.blocksize = blocksize;
+  if (Config::get_bool("Hypertable.RangeServer.CellStore.BloomFilter.Blocked"))
+    m_trailer.flags |= CellStoreTrailerV1::BLOOM_FILTER_BLOCKED;
+  m_prefix_compressed =
+      Config::get_bool("Hypertable.RangeServer.CellStore.PrefixCompressKeys");
+  if (m_prefix_compressed)
+    m_trailer.flags |= CellStoreTrailerV1::PREFIX_COMPRESSED_KEYS;
   m_uncompressed_blocksize = blocksize;
 
   m_filename = fname;
@@ -163,6 +223,12 @@ CellStoreV1::create(const char *fname, size_t max_entries,
 
   m_fd = m_filesys->create(m_filename, true, -1, -1, -1);
 
+  // Keep a couple of blocks per compression thread in flight
+  m_max_pending_blocks = 0;
+  if (Global::compression_queue)
+    m_max_pending_blocks = 2 * Config::get_i32("Hypertable.RangeServer"
+                                               ".CellStore.CompressionThreads");
+
   m_bloom_filter_mode = props->get<BloomFilterMode>("bloom-filter-mode");
   m_max_approx_items = props->get_i32("max-approx-items");
   m_trailer.filter_false_positive_prob = props->get_f64("false-positive");
@@ -184,7 +250,7 @@ void CellStoreV1::create_bloom_filter(bool is_approx) {
     << m_trailer.num_filter_items << " items"<< HT_END;
   try {
     m_bloom_filter = new BloomFilter(m_trailer.num_filter_items,
-        m_trailer.filter_false_positive_prob);
+        m_trailer.filter_false_positive_prob, bloom_filter_layout());
   }
   catch(Exception &e) {
     HT_FATAL_OUT << "Error creating new BloomFilter for CellStore '"
@@ -213,7 +279,8 @@ void CellStoreV1::load_bloom_filter() {
                << " items"<< HT_END;
   try {
     m_bloom_filter = new BloomFilter(m_trailer.num_filter_items,
-                                     m_trailer.filter_false_positive_prob);
+                                     m_trailer.filter_false_positive_prob,
+                                     bloom_filter_layout());
   }
   catch(Exception &e) {
     HT_FATAL_OUT << "Error loading BloomFilter for CellStore '"
@@ -221,7 +288,8 @@ void CellStoreV1::load_bloom_filter() {
                  << " items -"<< e << HT_END;
   }
 
-  amount = (m_file_length - m_trailer.size()) - m_trailer.filter_offset;
+  amount = ((m_trailer.version >= 3) ? m_trailer.row_bounds_offset
+            : (m_file_length - m_trailer.size())) - m_trailer.filter_offset;
   if (amount > 0) {
     len = m_filesys->pread(m_fd, m_bloom_filter->ptr(), amount,
                            m_trailer.filter_offset);
@@ -277,63 +345,42 @@ void CellStoreV1::maybe_purge_indexes(uint64_t access_counter) {
 
 
 void CellStoreV1::add(const Key &key, const ByteString value) {
-  EventPtr event_ptr;
-  DynamicBuffer zbuf;
 
   if (key.revision > m_trailer.revision)
     m_trailer.revision = key.revision;
 
+  if (key.flag != FLAG_INSERT)
+    m_trailer.delete_count++;
+
   if (key.timestamp != TIMESTAMP_NULL) {
     if (key.timestamp < m_trailer.timestamp_min)
       m_trailer.timestamp_min = key.timestamp;
-    else if (key.timestamp > m_trailer.timestamp_max)
+    if (key.timestamp > m_trailer.timestamp_max)
       m_trailer.timestamp_max = key.timestamp;
   }
 
-  if (m_buffer.fill() > (size_t)m_uncompressed_blocksize) {
-    BlockCompressionHeader header(DATA_BLOCK_MAGIC);
-
-    m_index_builder.add_entry(m_last_key, m_offset);
-
-    m_uncompressed_data += (float)m_buffer.fill();
-    m_compressor->deflate(m_buffer, zbuf, header);
-    m_compressed_data += (float)zbuf.fill();
-    m_buffer.clear();
-
-    uint64_t llval = ((uint64_t)m_trailer.blocksize
-        * (uint64_t)m_uncompressed_data) / (uint64_t)m_compressed_data;
-    m_uncompressed_blocksize = (int64_t)llval;
-
-    if (m_outstanding_appends >= MAX_APPENDS_OUTSTANDING) {
-      if (!m_sync_handler.wait_for_reply(event_ptr)) {
-        if (event_ptr->type == Event::MESSAGE)
-          HT_THROWF(Hypertable::Protocol::response_code(event_ptr),
-             "Problem writing to DFS file '%s' : %s", m_filename.c_str(),
-             Hypertable::Protocol::string_format_message(event_ptr).c_str());
-        HT_THROWF(event_ptr->error,
-                  "Problem writing to DFS file '%s'", m_filename.c_str());
-      }
-      m_outstanding_appends--;
-    }
+  // keys arrive in order, so the first and last rows bound the store
+  if (m_trailer.total_entries == 0)
+    m_first_row.assign(key.row, key.row_len);
+  if (m_last_row.length() != key.row_len ||
+      memcmp(m_last_row.data(), key.row, key.row_len))
+    m_last_row.assign(key.row, key.row_len);
 
-    size_t zlen = zbuf.fill();
-    StaticBuffer send_buf(zbuf);
+  if (m_buffer.fill() > (size_t)m_uncompressed_blocksize)
+    flush_block();
 
-    try { m_filesys->append(m_fd, send_buf, 0, &m_sync_handler); }
-    catch (Exception &e) {
-      HT_THROW2F(e.code(), e, "Problem writing to DFS file '%s'",
-                 m_filename.c_str());
-    }
-    m_outstanding_appends++;
-    m_offset += zlen;
+  if (m_prefix_compressed) {
+    m_block_builder.add(m_buffer, key.serial, value);
+    m_last_key = m_block_builder.last_key();
   }
+  else {
+    size_t value_len = value.length();
 
-  size_t value_len = value.length();
-
-  m_buffer.ensure(key.length + value_len);
+    m_buffer.ensure(key.length + value_len);
 
-  m_last_key.ptr = m_buffer.add_unchecked(key.serial.ptr, key.length);
-  m_buffer.add_unchecked(value.ptr, value_len);
+    m_last_key.ptr = m_buffer.add_unchecked(key.serial.ptr, key.length);
+    m_buffer.add_unchecked(value.ptr, value_len);
+  }
 
   if (m_bloom_filter_mode != BLOOM_FILTER_DISABLED) {
     if (m_trailer.total_entries < m_max_approx_items) {
@@ -362,40 +409,166 @@ void CellStoreV1::add(const Key &key, const ByteString value) {
 }
 
 
-void CellStoreV1::finalize(TableIdentifier *table_identifier) {
-  EventPtr event_ptr;
-  size_t zlen;
-  DynamicBuffer zbuf(0);
-  SerializedKey key;
-  StaticBuffer send_buf;
-  int64_t index_memory = 0;
+/**
+ * Hands the current block to the compression queue, or compresses and
+ * writes it inline when there is no queue.  Blocks are written to the
+ * file in the order in which they were filled.
+ */
+void CellStoreV1::flush_block() {
+  CompressJob *job;
 
-  if (m_buffer.fill() > 0) {
+  if (m_prefix_compressed)
+    m_block_builder.finish(m_buffer);
+
+  if (m_max_pending_blocks == 0) {
     BlockCompressionHeader header(DATA_BLOCK_MAGIC);
+    DynamicBuffer zbuf;
+    m_compressor->deflate(m_buffer, zbuf, header);
+    write_block(zbuf, m_buffer.fill(), m_last_key);
+    m_buffer.clear();
+    return;
+  }
 
-    m_index_builder.add_entry(m_last_key, m_offset);
+  write_completed_blocks(m_max_pending_blocks - 1);
 
-    m_uncompressed_data += (float)m_buffer.fill();
-    m_compressor->deflate(m_buffer, zbuf, header);
-    m_compressed_data += (float)zbuf.fill();
-
-    zlen = zbuf.fill();
-    send_buf = zbuf;
-
-    if (m_outstanding_appends >= MAX_APPENDS_OUTSTANDING) {
-      if (!m_sync_handler.wait_for_reply(event_ptr))
-        HT_THROWF(Protocol::response_code(event_ptr),
-                  "Problem finalizing CellStore file '%s' : %s",
-                  m_filename.c_str(),
-                  Protocol::string_format_message(event_ptr).c_str());
-      m_outstanding_appends--;
+  if (m_free_jobs.empty()) {
+    job = new CompressJob();
+    job->codec = CompressorFactory::create_block_codec(
+        (BlockCompressionCodec::Type)m_trailer.compression_type,
+        m_compressor_args);
+  }
+  else {
+    job = m_free_jobs.back();
+    m_free_jobs.pop_back();
+  }
+
+  // The filled block is handed to the job rather than copied, m_buffer
+  // takes over the (already sized) buffer of a recycled job
+  job->last_key.set(m_last_key.ptr, m_last_key.length());
+  job->buf.clear();
+  job->buf.swap(m_buffer);
+  job->done = false;
+  job->error = Error::OK;
+  if (m_buffer.size == 0)
+    m_buffer.reserve(job->buf.size);
+
+  m_pending_blocks.push_back(job);
+  Global::compression_queue->add(new CompressHandler(this, job));
+}
+
+
+void CellStoreV1::compress_block(CompressJob *job) {
+  BlockCompressionHeader header(DATA_BLOCK_MAGIC);
+  int error = Error::OK;
+  String error_msg;
+
+  try {
+    job->codec->deflate(job->buf, job->zbuf, header);
+  }
+  catch (Exception &e) {
+    error = e.code();
+    error_msg = e.what();
+  }
+
+  ScopedLock lock(m_compress_mutex);
+  job->error = error;
+  job->error_msg = error_msg;
+  job->done = true;
+  m_compress_cond.notify_all();
+}
+
+
+/**
+ * Writes out compressed blocks from the head of the pending queue, waiting
+ * for their compression to finish until no more than max_pending remain.
+ */
+void CellStoreV1::write_completed_blocks(size_t max_pending) {
+
+  while (!m_pending_blocks.empty()) {
+    CompressJob *job = m_pending_blocks.front();
+
+    {
+      ScopedLock lock(m_compress_mutex);
+      if (m_pending_blocks.size() > max_pending) {
+        while (!job->done)
+          m_compress_cond.wait(lock);
+      }
+      else if (!job->done)
+        return;
     }
 
-    m_filesys->append(m_fd, send_buf, 0, &m_sync_handler);
+    m_pending_blocks.pop_front();
+    m_free_jobs.push_back(job);
 
-    m_outstanding_appends++;
-    m_offset += zlen;
+    if (job->error != Error::OK)
+      HT_THROWF(job->error, "Problem compressing block of CellStore '%s' - %s",
+                m_filename.c_str(), job->error_msg.c_str());
+
+    write_block(job->zbuf, job->buf.fill(), SerializedKey(job->last_key.base));
+    job->buf.clear();
   }
+}
+
+
+void CellStoreV1::write_block(DynamicBuffer &zbuf, size_t uncompressed_len,
+                              const SerializedKey last_key) {
+  EventPtr event_ptr;
+
+  m_index_builder.add_entry(last_key, m_offset);
+
+  m_uncompressed_data += (float)uncompressed_len;
+  m_compressed_data += (float)zbuf.fill();
+
+  uint64_t llval = ((uint64_t)m_trailer.blocksize
+      * (uint64_t)m_uncompressed_data) / (uint64_t)m_compressed_data;
+  m_uncompressed_blocksize = (int64_t)llval;
+
+  if (m_outstanding_appends >= MAX_APPENDS_OUTSTANDING) {
+    if (!m_sync_handler.wait_for_reply(event_ptr)) {
+      if (event_ptr->type == Event::MESSAGE)
+        HT_THROWF(Hypertable::Protocol::response_code(event_ptr),
+           "Problem writing to DFS file '%s' : %s", m_filename.c_str(),
+           Hypertable::Protocol::string_format_message(event_ptr).c_str());
+      HT_THROWF(event_ptr->error,
+                "Problem writing to DFS file '%s'", m_filename.c_str());
+    }
+    m_outstanding_appends--;
+  }
+
+  size_t zlen = zbuf.fill();
+  StaticBuffer send_buf(zbuf);
+
+  try { m_filesys->append(m_fd, send_buf, 0, &m_sync_handler); }
+  catch (Exception &e) {
+    HT_THROW2F(e.code(), e, "Problem writing to DFS file '%s'",
+               m_filename.c_str());
+  }
+  m_outstanding_appends++;
+  m_offset += zlen;
+}
+
+
+void CellStoreV1::wait_for_compressions() {
+  ScopedLock lock(m_compress_mutex);
+  foreach(CompressJob *job, m_pending_blocks) {
+    while (!job->done)
+      m_compress_cond.wait(lock);
+  }
+}
+
+
+
+void CellStoreV1::finalize(TableIdentifier *table_identifier) {
+  size_t zlen;
+  DynamicBuffer zbuf(0);
+  SerializedKey key;
+  StaticBuffer send_buf;
+  int64_t index_memory = 0;
+
+  if (m_buffer.fill() > 0)
+    flush_block();
+
+  write_completed_blocks(0);
 
   m_buffer.free();
 
@@ -461,6 +634,25 @@ void CellStoreV1::finalize(TableIdentifier *table_identifier) {
     m_offset += m_bloom_filter->size();
   }
 
+  /**
+   * Write row bounds
+   */
+  m_trailer.row_bounds_offset = m_offset;
+  zbuf.clear();
+  zbuf.reserve(Serialization::encoded_length_vstr(m_first_row)
+               + Serialization::encoded_length_vstr(m_last_row));
+  Serialization::encode_vstr(&zbuf.ptr, m_first_row);
+  Serialization::encode_vstr(&zbuf.ptr, m_last_row);
+
+  zlen = zbuf.fill();
+  send_buf = zbuf;
+
+  m_filesys->append(m_fd, send_buf, 0, &m_sync_handler);
+
+  m_outstanding_appends++;
+  m_offset += zlen;
+  m_have_row_bounds = m_trailer.total_entries > 0;
+
   m_64bit_index = m_index_builder.big_int();
 
   /** Set up index **/
@@ -598,11 +790,14 @@ CellStoreV1::open(const String &fname, const String &start_row,
   m_trailer = *static_cast<CellStoreTrailerV1 *>(trailer);
 
   /** Sanity check trailer **/
-  HT_ASSERT(m_trailer.version == 1);
+  HT_ASSERT(m_trailer.version >= 1 && m_trailer.version <= 3);
 
   if (m_trailer.flags & CellStoreTrailerV1::INDEX_64BIT)
     m_64bit_index = true;
 
+  if (m_trailer.flags & CellStoreTrailerV1::PREFIX_COMPRESSED_KEYS)
+    m_prefix_compressed = true;
+
   if (!(m_trailer.fix_index_offset < m_trailer.var_index_offset &&
         m_trailer.var_index_offset < m_file_length))
     HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
@@ -610,12 +805,82 @@ CellStoreV1::open(const String &fname, const String &start_row,
               "length=%llu, file='%s'", (Lld)m_trailer.fix_index_offset,
            (Lld)m_trailer.var_index_offset, (Llu)m_file_length, fname.c_str());
 
+  if (m_trailer.version >= 3)
+    load_row_bounds();
+
   if (!(start_row == "" && end_row == Key::END_ROW_MARKER))
     load_block_index();
 
 }
 
 
+void CellStoreV1::load_row_bounds() {
+  int64_t amount = (m_file_length - m_trailer.size())
+                   - m_trailer.row_bounds_offset;
+
+  if (amount <= 0 || m_trailer.row_bounds_offset < m_trailer.filter_offset)
+    HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE, "Bad row bounds offset "
+              "in CellStore trailer %lld, length=%llu, file='%s'",
+              (Lld)m_trailer.row_bounds_offset, (Llu)m_file_length,
+              m_filename.c_str());
+
+  DynamicBuffer buf(amount);
+  const uint8_t *ptr = buf.base;
+  size_t remaining = amount;
+
+  if (m_filesys->pread(m_fd, buf.base, amount, m_trailer.row_bounds_offset)
+      != (size_t)amount)
+    HT_THROWF(Error::DFSBROKER_IO_ERROR, "Problem reading row bounds of "
+              "CellStore '%s'", m_filename.c_str());
+
+  HT_TRY("decoding cellstore row bounds",
+    m_first_row = Serialization::decode_vstr<String>(&ptr, &remaining);
+    m_last_row = Serialization::decode_vstr<String>(&ptr, &remaining));
+
+  m_have_row_bounds = m_trailer.total_entries > 0;
+}
+
+
+/**
+ * Cells outside the time interval of a scan are dropped by the MergeScanner
+ * before delete processing or version counting, so a store whose cells all
+ * fall outside the interval contributes nothing, deletes included.  Scans
+ * that return deletes see every cell and are never pruned on time.  The
+ * timestamp bounds of stores older than trailer version 3 are not trusted,
+ * since they may have been written without updating timestamp_max.
+ */
+bool CellStoreV1::may_intersect(ScanContextPtr &scan_ctx) {
+  bool return_deletes = scan_ctx->spec ? scan_ctx->spec->return_deletes
+                                       : false;
+
+  if (!return_deletes && m_trailer.version >= 3 &&
+      m_trailer.timestamp_min <= m_trailer.timestamp_max &&
+      (m_trailer.timestamp_max < scan_ctx->time_interval.first ||
+       m_trailer.timestamp_min >= scan_ctx->time_interval.second))
+    return false;
+
+  /**
+   * For cell intervals the inclusive flags apply to the cell, not the row,
+   * so a store ending (or starting) on the boundary row may still hold
+   * other columns of that row.
+   */
+  if (m_have_row_bounds && scan_ctx->restricted_range) {
+    bool start_inclusive = scan_ctx->has_cell_interval ||
+                           scan_ctx->start_inclusive;
+    bool end_inclusive = scan_ctx->has_cell_interval ||
+                         scan_ctx->end_inclusive;
+    int cmp = m_last_row.compare(scan_ctx->start_row);
+    if (cmp < 0 || (cmp == 0 && !start_inclusive))
+      return false;
+    cmp = m_first_row.compare(scan_ctx->end_row);
+    if (cmp > 0 || (cmp == 0 && !end_inclusive))
+      return false;
+  }
+
+  return true;
+}
+
+
 void CellStoreV1::load_block_index() {
   int64_t amount, index_amount;
   int64_t len = 0;
@@ -22,10 +22,13 @@
 #ifndef HYPERTABLE_CELLSTOREV1_H
 #define HYPERTABLE_CELLSTOREV1_H
 
+#include <deque>
 #include <map>
 #include <string>
 #include <vector>
 
+#include <boost/thread/condition.hpp>
+
 #ifdef _GOOGLE_SPARSE_HASH
 #include <google/sparse_hash_set>
 #else
@@ -45,6 +48,7 @@
 #include "Hypertable/Lib/SerializedKey.h"
 
 #include "CellStore.h"
+#include "CellStoreBlock.h"
 #include "CellStoreTrailerV1.h"
 
 
@@ -92,10 +96,19 @@ namespace Hypertable {
       return may_contain(key.data(), key.size());
     }
     virtual bool may_contain(ScanContextPtr &);
+    virtual bool may_intersect(ScanContextPtr &scan_ctx);
+    virtual bool get_row_bounds(String &first_row, String &last_row) {
+      if (!m_have_row_bounds)
+        return false;
+      first_row = m_first_row;
+      last_row = m_last_row;
+      return true;
+    }
 
     virtual uint64_t disk_usage() { return m_disk_usage; }
     virtual float compression_ratio() { return m_trailer.compression_ratio; }
     virtual const char *get_split_row();
+    virtual void get_split_samples(std::vector<SplitSample> &samples);
     virtual int64_t get_total_entries() { return m_trailer.total_entries; }
     virtual std::string &get_filename() { return m_filename; }
     virtual int get_file_id() { return m_file_id; }
@@ -109,6 +122,7 @@ namespace Hypertable {
     virtual void maybe_purge_indexes(uint64_t access_counter);
     virtual int64_t purgeable_index_memory(uint64_t access_counter);
     virtual bool restricted_range() { return m_restricted_range; }
+    virtual bool prefix_compressed_keys() { return m_prefix_compressed; }
 
     virtual int32_t get_fd() {
       ScopedLock lock(m_mutex);
@@ -126,10 +140,44 @@ namespace Hypertable {
     virtual CellStoreTrailer *get_trailer() { return &m_trailer; }
 
   protected:
+
+    /**
+     * A full data block on its way through the compression queue.  Each
+     * job owns a codec, so blocks of the same CellStore can be compressed
+     * concurrently.
+     */
+    struct CompressJob {
+      CompressJob() : codec(0), buf(0), zbuf(0), last_key(0), done(false),
+                      error(Error::OK) { }
+      ~CompressJob() { delete codec; }
+      BlockCompressionCodec *codec;
+      DynamicBuffer buf;
+      DynamicBuffer zbuf;
+      DynamicBuffer last_key;
+      bool          done;
+      int           error;
+      String        error_msg;
+    };
+
+    class CompressHandler;
+
+    void flush_block();
+    void compress_block(CompressJob *job);
+    void write_completed_blocks(size_t max_pending);
+    void write_block(DynamicBuffer &zbuf, size_t uncompressed_len,
+                     const SerializedKey last_key);
+    void wait_for_compressions();
+
     void record_split_row(const SerializedKey key);
     void create_bloom_filter(bool is_approx = false);
     void load_bloom_filter();
+
+    BloomFilter::Layout bloom_filter_layout() {
+      return (m_trailer.flags & CellStoreTrailerV1::BLOOM_FILTER_BLOCKED) ?
+          BloomFilter::LAYOUT_BLOCKED : BloomFilter::LAYOUT_CLASSIC;
+    }
     void load_block_index();
+    void load_row_bounds();
 
     typedef BlobHashSet<> BloomFilterItems;
 
@@ -144,6 +192,8 @@ namespace Hypertable {
     BlockCompressionCodec *m_compressor;
     DynamicBuffer          m_buffer;
     IndexBuilder           m_index_builder;
+    CellStoreBlockBuilder  m_block_builder;
+    bool                   m_prefix_compressed;
     DispatchHandlerSynchronizer  m_sync_handler;
     uint32_t               m_outstanding_appends;
     int64_t                m_offset;
@@ -167,6 +217,15 @@ namespace Hypertable {
     uint64_t               m_bloom_filter_access_counter;
     uint64_t               m_block_index_access_counter;
     bool                   m_restricted_range;
+    String                 m_first_row;
+    String                 m_last_row;
+    bool                   m_have_row_bounds;
+
+    Mutex                  m_compress_mutex;
+    boost::condition       m_compress_cond;
+    std::deque<CompressJob *> m_pending_blocks;
+    std::vector<CompressJob *> m_free_jobs;
+    size_t                 m_max_pending_blocks;
   };
 
   typedef intrusive_ptr<CellStoreV1> CellStoreV1Ptr;
@@ -0,0 +1,374 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Stopwatch.h"
+
+#include "Hypertable/Lib/CompressorFactory.h"
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/Types.h"
+
+#include "CommitLogReplayer.h"
+
+using namespace Hypertable;
+using namespace std;
+
+
+CommitLogReplayer::Block::~Block() {
+  foreach(Fragment *fragment, fragments)
+    delete fragment;
+}
+
+
+CommitLogReplayer::CommitLogReplayer(TableInfoMapPtr &replay_map,
+    int decompress_threads, int apply_threads, size_t buffer_limit)
+  : m_replay_map(replay_map), m_decompress_threads(decompress_threads),
+    m_buffer_limit(buffer_limit), m_next_dispatch(0), m_buffered(0),
+    m_input_done(false), m_decompressors_running(0), m_error(Error::OK),
+    m_zbytes(0), m_bytes(0), m_cells(0) {
+  HT_ASSERT(decompress_threads > 0 && apply_threads > 0);
+  for (int i = 0; i < apply_threads; i++)
+    m_apply_shards.push_back(new ApplyShard());
+}
+
+
+CommitLogReplayer::~CommitLogReplayer() {
+  foreach(ApplyShard *shard, m_apply_shards) {
+    foreach(Fragment *fragment, shard->queue)
+      delete fragment;
+    delete shard;
+  }
+}
+
+
+void CommitLogReplayer::replay(CommitLogReaderPtr &log_reader) {
+  ThreadGroup threads;
+  uint64_t sequence = 0;
+  Stopwatch stopwatch;
+
+  m_next_dispatch = 0;
+  m_buffered = 0;
+  m_input_done = false;
+  m_decompressors_running = m_decompress_threads;
+  m_error = Error::OK;
+  m_zbytes = m_bytes = m_cells = 0;
+
+  for (int i = 0; i < m_decompress_threads; i++)
+    threads.create_thread(DecompressWorker(this));
+  for (size_t i = 0; i < m_apply_shards.size(); i++)
+    threads.create_thread(ApplyWorker(this, i));
+
+  /**
+   * Read stage, runs ahead of decompression by up to m_buffer_limit bytes
+   */
+  try {
+    while (true) {
+      Block *block = new Block();
+
+      if (!log_reader->next_compressed(block->zblock, &block->header)) {
+        delete block;
+        break;
+      }
+      block->sequence = sequence++;
+
+      ScopedLock lock(m_mutex);
+      while (m_buffered > m_buffer_limit && m_error == Error::OK)
+        m_reader_cond.wait(lock);
+      if (m_error != Error::OK) {
+        delete block;
+        break;
+      }
+      m_buffered += block->zblock.fill();
+      m_zbytes += block->zblock.fill();
+      m_decompress_queue.push_back(block);
+      m_decompress_cond.notify_one();
+    }
+  }
+  catch (Exception &e) {
+    set_error(e.code(), e.what());
+  }
+
+  {
+    ScopedLock lock(m_mutex);
+    m_input_done = true;
+    m_decompress_cond.notify_all();
+  }
+
+  threads.join_all();
+
+  // only non-empty if the replay was cut short by an error
+  foreach(Block *block, m_decompress_queue)
+    delete block;
+  m_decompress_queue.clear();
+  for (map<uint64_t, Block *>::iterator iter = m_decoded.begin();
+       iter != m_decoded.end(); ++iter)
+    delete (*iter).second;
+  m_decoded.clear();
+
+  if (m_error != Error::OK)
+    HT_THROWF(m_error, "Problem replaying commit log '%s' - %s",
+              log_reader->get_log_dir().c_str(), m_error_msg.c_str());
+
+  double elapsed = stopwatch.elapsed();
+  HT_INFOF("Replayed %llu blocks (%llu cells, %llu bytes, %llu compressed) "
+           "from '%s' in %.3f seconds (%.2f MB/s)", (Llu)sequence,
+           (Llu)m_cells, (Llu)m_bytes, (Llu)m_zbytes,
+           log_reader->get_log_dir().c_str(), elapsed,
+           elapsed > 0 ? ((double)m_bytes / elapsed) / 1048576.0 : 0.0);
+}
+
+
+void CommitLogReplayer::decompress_loop() {
+  CompressorMap compressors;
+  DynamicBuffer buf(0);
+  Block *block;
+  uint32_t cells;
+
+  while (true) {
+
+    {
+      ScopedLock lock(m_mutex);
+      while (m_decompress_queue.empty() && !m_input_done
+             && m_error == Error::OK)
+        m_decompress_cond.wait(lock);
+
+      if (m_error != Error::OK || m_decompress_queue.empty()) {
+        if (--m_decompressors_running == 0) {
+          foreach(ApplyShard *shard, m_apply_shards)
+            shard->cond.notify_all();
+        }
+        return;
+      }
+
+      block = m_decompress_queue.front();
+      m_decompress_queue.pop_front();
+    }
+
+    cells = 0;
+    buf.clear();
+
+    /**
+     * Blocks that fail to inflate are skipped, as in CommitLogReader::next,
+     * but still pass through the reorder stage so that the blocks that
+     * follow them get dispatched.
+     */
+    try {
+      uint16_t ztype = block->header.get_compression_type();
+      BlockCompressionCodecPtr &codec = compressors[ztype];
+
+      if (ztype >= BlockCompressionCodec::COMPRESSION_TYPE_LIMIT)
+        HT_THROWF(Error::BLOCK_COMPRESSOR_UNSUPPORTED_TYPE,
+                  "Invalid compression type '%d'", (int)ztype);
+      if (!codec)
+        codec = CompressorFactory::create_block_codec(
+            (BlockCompressionCodec::Type)ztype);
+
+      codec->inflate(block->zblock, buf, block->header);
+    }
+    catch (Exception &e) {
+      HT_ERRORF("Inflate error in commit log block with revision %lld - %s",
+                (Lld)block->header.get_revision(), Error::get_text(e.code()));
+      buf.clear();
+    }
+
+    try {
+      if (buf.fill())
+        cells = split_block(block, buf);
+    }
+    catch (Exception &e) {
+      set_error(e.code(), e.what());
+    }
+
+    {
+      ScopedLock lock(m_mutex);
+      m_buffered -= block->zblock.fill();
+      block->zblock.free();
+      foreach(Fragment *fragment, block->fragments)
+        m_buffered += fragment->cells.fill();
+      m_bytes += buf.fill();
+      m_cells += cells;
+      m_decoded[block->sequence] = block;
+      dispatch_ready_blocks();
+      m_reader_cond.notify_one();
+    }
+  }
+}
+
+
+/**
+ * Splits the cells of an inflated block into one fragment per range,
+ * preserving their order.  Cells that do not belong to any of the ranges
+ * being replayed are dropped.
+ */
+uint32_t CommitLogReplayer::split_block(Block *block, DynamicBuffer &buf) {
+  const uint8_t *ptr = buf.base;
+  const uint8_t *end = buf.ptr;
+  size_t remaining = buf.fill();
+  TableIdentifier table_id;
+  TableInfoPtr table_info;
+  RangePtr range;
+  String start_row, end_row;
+  Fragment *fragment = 0;
+  SerializedKey key;
+  ByteString value;
+  const char *row;
+  uint32_t cells = 0;
+
+  table_id.decode(&ptr, &remaining);
+
+  if (!m_replay_map->get(table_id.id, table_info))
+    return 0;
+
+  while (ptr < end) {
+
+    key.ptr = ptr;
+    ptr += key.length();
+    if (ptr > end)
+      HT_THROW(Error::REQUEST_TRUNCATED, "Problem decoding key");
+
+    value.ptr = ptr;
+    ptr += value.length();
+    if (ptr > end)
+      HT_THROW(Error::REQUEST_TRUNCATED, "Problem decoding value");
+
+    row = key.row();
+
+    if (!fragment || strcmp(row, start_row.c_str()) <= 0
+        || (end_row != "" && strcmp(row, end_row.c_str()) > 0)) {
+
+      if (!table_info->find_containing_range(row, range, start_row, end_row)) {
+        fragment = 0;
+        continue;
+      }
+
+      fragment = 0;
+      foreach(Fragment *f, block->fragments) {
+        if (f->range == range) {
+          fragment = f;
+          break;
+        }
+      }
+      if (fragment == 0) {
+        fragment = new Fragment();
+        fragment->range = range;
+        block->fragments.push_back(fragment);
+      }
+    }
+
+    fragment->cells.add(key.ptr, ptr - key.ptr);
+    cells++;
+  }
+
+  return cells;
+}
+
+
+/**
+ * Hands the decoded blocks that are next in log order to the apply threads.
+ * Called with m_mutex held.
+ */
+void CommitLogReplayer::dispatch_ready_blocks() {
+  map<uint64_t, Block *>::iterator iter;
+
+  while ((iter = m_decoded.begin()) != m_decoded.end()
+         && (*iter).first == m_next_dispatch) {
+    Block *block = (*iter).second;
+
+    foreach(Fragment *fragment, block->fragments) {
+      ApplyShard *shard = m_apply_shards[shard_of(fragment->range.get())];
+      shard->queue.push_back(fragment);
+      shard->cond.notify_one();
+    }
+    block->fragments.clear();
+    delete block;
+
+    m_decoded.erase(iter);
+    m_next_dispatch++;
+  }
+}
+
+
+void CommitLogReplayer::apply_loop(size_t shard_index) {
+  ApplyShard *shard = m_apply_shards[shard_index];
+  Fragment *fragment;
+  SerializedKey serkey;
+  ByteString value;
+  Key key;
+
+  while (true) {
+
+    {
+      ScopedLock lock(m_mutex);
+      while (shard->queue.empty() && m_decompressors_running > 0
+             && m_error == Error::OK)
+        shard->cond.wait(lock);
+
+      if (m_error != Error::OK || shard->queue.empty())
+        return;
+
+      fragment = shard->queue.front();
+      shard->queue.pop_front();
+    }
+
+    try {
+      const uint8_t *ptr = fragment->cells.base;
+      const uint8_t *end = fragment->cells.ptr;
+      Locker<Range> lock(*fragment->range);
+
+      while (ptr < end) {
+        serkey.ptr = ptr;
+        ptr += serkey.length();
+        value.ptr = ptr;
+        ptr += value.length();
+        key.load(serkey);
+        fragment->range->add(key, value);
+      }
+    }
+    catch (Exception &e) {
+      set_error(e.code(), e.what());
+    }
+
+    {
+      ScopedLock lock(m_mutex);
+      m_buffered -= fragment->cells.fill();
+      m_reader_cond.notify_one();
+    }
+    delete fragment;
+  }
+}
+
+
+void CommitLogReplayer::set_error(int error, const String &msg) {
+  ScopedLock lock(m_mutex);
+
+  if (m_error == Error::OK) {
+    m_error = error;
+    m_error_msg = msg;
+  }
+  m_reader_cond.notify_all();
+  m_decompress_cond.notify_all();
+  foreach(ApplyShard *shard, m_apply_shards)
+    shard->cond.notify_all();
+}
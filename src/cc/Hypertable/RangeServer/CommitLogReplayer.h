@@ -0,0 +1,145 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_COMMITLOGREPLAYER_H
+#define HYPERTABLE_COMMITLOGREPLAYER_H
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <boost/thread/condition.hpp>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/HashMap.h"
+#include "Common/Mutex.h"
+#include "Common/String.h"
+#include "Common/Thread.h"
+
+#include "Hypertable/Lib/BlockCompressionCodec.h"
+#include "Hypertable/Lib/BlockCompressionHeaderCommitLog.h"
+#include "Hypertable/Lib/CommitLogReader.h"
+
+#include "Range.h"
+#include "TableInfoMap.h"
+
+namespace Hypertable {
+
+  /**
+   * Replays a commit log into the ranges of a TableInfoMap as a three stage
+   * pipeline.  The calling thread reads compressed blocks from the log,
+   * running ahead of the other stages by up to a configurable number of
+   * bytes.  A pool of decompression threads inflates the blocks and splits
+   * their cells by range.  A pool of apply threads adds the cells to the
+   * ranges, each range being owned by exactly one apply thread.  Blocks are
+   * handed to the apply threads in log order, so the updates of any one
+   * range are applied in the order in which they were logged.
+   */
+  class CommitLogReplayer {
+  public:
+    CommitLogReplayer(TableInfoMapPtr &replay_map, int decompress_threads,
+                      int apply_threads, size_t buffer_limit);
+    ~CommitLogReplayer();
+
+    /**
+     * Replays the given log and waits for all of its updates to be applied.
+     * Throws the first error encountered by any of the stages.
+     *
+     * @param log_reader reader positioned at the start of the log
+     */
+    void replay(CommitLogReaderPtr &log_reader);
+
+  private:
+
+    /** Run of cells of one block that belong to the same range */
+    struct Fragment {
+      RangePtr      range;
+      DynamicBuffer cells;
+    };
+
+    struct Block {
+      Block() : sequence(0) { }
+      ~Block();
+      uint64_t sequence;
+      BlockCompressionHeaderCommitLog header;
+      DynamicBuffer zblock;
+      std::vector<Fragment *> fragments;
+    };
+
+    struct ApplyShard {
+      std::deque<Fragment *> queue;
+      boost::condition       cond;
+    };
+
+    class DecompressWorker {
+    public:
+      DecompressWorker(CommitLogReplayer *replayer) : m_replayer(replayer) { }
+      void operator()() { m_replayer->decompress_loop(); }
+    private:
+      CommitLogReplayer *m_replayer;
+    };
+
+    class ApplyWorker {
+    public:
+      ApplyWorker(CommitLogReplayer *replayer, size_t shard)
+        : m_replayer(replayer), m_shard(shard) { }
+      void operator()() { m_replayer->apply_loop(m_shard); }
+    private:
+      CommitLogReplayer *m_replayer;
+      size_t m_shard;
+    };
+
+    typedef hash_map<uint16_t, BlockCompressionCodecPtr> CompressorMap;
+
+    void decompress_loop();
+    void apply_loop(size_t shard);
+    uint32_t split_block(Block *block, DynamicBuffer &buf);
+    void dispatch_ready_blocks();
+    void set_error(int error, const String &msg);
+    size_t shard_of(Range *range) {
+      return ((size_t)range / sizeof(Range)) % m_apply_shards.size();
+    }
+
+    TableInfoMapPtr   m_replay_map;
+    int               m_decompress_threads;
+    size_t            m_buffer_limit;
+
+    Mutex             m_mutex;
+    boost::condition  m_decompress_cond;
+    boost::condition  m_reader_cond;
+    std::deque<Block *> m_decompress_queue;
+    std::map<uint64_t, Block *> m_decoded;
+    std::vector<ApplyShard *> m_apply_shards;
+    uint64_t          m_next_dispatch;
+    size_t            m_buffered;
+    bool              m_input_done;
+    int               m_decompressors_running;
+    int               m_error;
+    String            m_error_msg;
+
+    uint64_t          m_zbytes;
+    uint64_t          m_bytes;
+    uint64_t          m_cells;
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_COMMITLOGREPLAYER_H
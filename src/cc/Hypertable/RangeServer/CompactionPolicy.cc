@@ -0,0 +1,144 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include <algorithm>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+
+#include "CompactionPolicy.h"
+#include "CompactionPolicyMerging.h"
+#include "CompactionPolicySizeTiered.h"
+#include "CompactionPolicyTimeWindow.h"
+#include "Config.h"
+#include "Global.h"
+
+using namespace Hypertable;
+
+namespace {
+  struct LtDiskUsage {
+    bool operator()(const CompactionPolicy::StoreInfo &x,
+                    const CompactionPolicy::StoreInfo &y) const {
+      return x.disk_usage < y.disk_usage;
+    }
+  };
+}
+
+
+CompactionPolicy *CompactionPolicy::create(const String &name) {
+  if (name == "merging")
+    return new CompactionPolicyMerging();
+  else if (name == "size-tiered")
+    return new CompactionPolicySizeTiered();
+  else if (name == "time-window")
+    return new CompactionPolicyTimeWindow();
+  HT_THROWF(Error::CONFIG_BAD_VALUE, "Unknown compaction policy '%s'",
+            name.c_str());
+}
+
+
+void
+CompactionPolicy::get_store_info(const std::vector<CellStorePtr> &stores,
+                                 std::vector<StoreInfo> &info) {
+  info.resize(stores.size());
+
+  for (size_t i=0; i<stores.size(); i++) {
+    CellStoreTrailer *trailer = stores[i]->get_trailer();
+    boost::any deletes = trailer->get("delete_count");
+    boost::any timestamp_min = trailer->get("timestamp_min");
+    boost::any timestamp_max = trailer->get("timestamp_max");
+
+    info[i].index = i;
+    info[i].disk_usage = stores[i]->disk_usage();
+    info[i].entries = stores[i]->get_total_entries();
+    info[i].deletes = deletes.empty() ? 0 : boost::any_cast<int64_t>(deletes);
+    info[i].timestamp_min = timestamp_min.empty() ? TIMESTAMP_MIN
+        : boost::any_cast<int64_t>(timestamp_min);
+    info[i].timestamp_max = timestamp_max.empty() ? TIMESTAMP_MAX
+        : boost::any_cast<int64_t>(timestamp_max);
+    info[i].has_row_bounds = stores[i]->get_row_bounds(info[i].first_row,
+                                                       info[i].last_row);
+  }
+}
+
+
+int64_t
+CompactionPolicy::estimate_garbage(const std::vector<StoreInfo> &info,
+                                   int64_t ttl, int64_t now) {
+  int64_t cutoff = ttl ? now - ttl : TIMESTAMP_MIN;
+  int64_t garbage = 0;
+
+  foreach(const StoreInfo &si, info) {
+    double ratio = 2.0 * si.tombstone_density();
+
+    if (ttl && si.timestamp_min != TIMESTAMP_MIN
+        && si.timestamp_max != TIMESTAMP_MAX) {
+      if (cutoff >= si.timestamp_max)
+        ratio += 1.0;
+      else if (cutoff > si.timestamp_min)
+        ratio += (double)(cutoff - si.timestamp_min)
+            / (double)(si.timestamp_max - si.timestamp_min);
+    }
+
+    if (ratio > 1.0)
+      ratio = 1.0;
+    garbage += (int64_t)(ratio * (double)si.disk_usage);
+  }
+  return garbage;
+}
+
+
+bool
+CompactionPolicy::select_for_tombstones(const std::vector<StoreInfo> &info,
+                                        std::vector<size_t> &merge) {
+  int64_t entries = 0, deletes = 0;
+
+  if (info.size() < 2)
+    return false;
+
+  foreach(const StoreInfo &si, info) {
+    entries += si.entries;
+    deletes += si.deletes;
+  }
+
+  if (entries == 0 || (double)deletes / (double)entries <= Config::get_f64(
+      "Hypertable.RangeServer.AccessGroup.CompactionPolicy.TombstoneRatio"))
+    return false;
+
+  merge.clear();
+  foreach(const StoreInfo &si, info)
+    merge.push_back(si.index);
+  return true;
+}
+
+
+void CompactionPolicy::select_smallest(std::vector<StoreInfo> info,
+                                       std::vector<size_t> &merge) {
+  if (info.size() <= (size_t)Global::access_group_max_files)
+    return;
+
+  std::sort(info.begin(), info.end(), LtDiskUsage());
+  for (size_t i=0; i<info.size() &&
+       i<(size_t)Global::access_group_merge_files; i++)
+    merge.push_back(info[i].index);
+}
@@ -0,0 +1,139 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_COMPACTIONPOLICY_H
+#define HYPERTABLE_COMPACTIONPOLICY_H
+
+#include <vector>
+
+#include "Common/ReferenceCount.h"
+#include "Common/String.h"
+
+#include "CellStore.h"
+
+namespace Hypertable {
+
+  /**
+   * Decides which CellStores of an access group are merged into the
+   * CellStore written by its next compaction.  Stores that are not chosen
+   * are left untouched, so a policy trades off how often data is rewritten
+   * against how many stores a scan has to merge.
+   */
+  class CompactionPolicy : public ReferenceCount {
+  public:
+
+    /** What a policy gets to know about each CellStore */
+    struct StoreInfo {
+      size_t  index;
+      int64_t disk_usage;
+      int64_t entries;
+      int64_t deletes;
+      int64_t timestamp_min;
+      int64_t timestamp_max;
+      bool    has_row_bounds;
+      String  first_row;
+      String  last_row;
+      double tombstone_density() const {
+        return entries ? (double)deletes / (double)entries : 0.0;
+      }
+      /** Stores with unknown row bounds are taken to overlap everything */
+      bool overlaps(const StoreInfo &other) const {
+        if (!has_row_bounds || !other.has_row_bounds)
+          return true;
+        return first_row <= other.last_row && other.first_row <= last_row;
+      }
+    };
+
+    virtual ~CompactionPolicy() { }
+
+    virtual const char *name() = 0;
+
+    /**
+     * Chooses the stores to merge.  Choosing every store turns the
+     * compaction into a major one, which is the only kind that drops delete
+     * records.
+     *
+     * @param stores CellStores of the access group
+     * @param merge receives the indexes (into stores) of the stores to
+     *        merge, left empty for a minor compaction
+     */
+    void select(const std::vector<CellStorePtr> &stores,
+                std::vector<size_t> &merge) {
+      std::vector<StoreInfo> info;
+      get_store_info(stores, info);
+      select(info, merge);
+    }
+
+    /**
+     * Chooses the stores to merge from their statistics (see
+     * get_store_info())
+     *
+     * @param info statistics of the CellStores of the access group
+     * @param merge receives the StoreInfo::index values of the stores to
+     *        merge, left empty for a minor compaction
+     */
+    virtual void select(const std::vector<StoreInfo> &info,
+                        std::vector<size_t> &merge) = 0;
+
+    /**
+     * Creates a policy by name, one of "merging", "size-tiered" or
+     * "time-window"
+     */
+    static CompactionPolicy *create(const String &name);
+
+    /** Gathers the trailer statistics of the given stores */
+    static void get_store_info(const std::vector<CellStorePtr> &stores,
+                               std::vector<StoreInfo> &info);
+
+    /**
+     * Estimates how many bytes of the given stores a major compaction would
+     * drop.  Every delete record is assumed to shadow one cell, and
+     * timestamps are assumed to be spread evenly between the oldest and
+     * newest one of a store.  Cells beyond max_versions are not counted.
+     *
+     * @param info statistics of the CellStores of the access group
+     * @param ttl time to live of the access group's cells in nanoseconds,
+     *        0 if they never expire
+     * @param now current time in nanoseconds
+     */
+    static int64_t estimate_garbage(const std::vector<StoreInfo> &info,
+                                    int64_t ttl, int64_t now);
+
+  protected:
+
+    /**
+     * Selects every store if delete records make up more than
+     * Hypertable.RangeServer.AccessGroup.CompactionPolicy.TombstoneRatio of
+     * all entries, since only a merge of all stores can drop them.
+     */
+    static bool select_for_tombstones(const std::vector<StoreInfo> &info,
+                                      std::vector<size_t> &merge);
+
+    /** Merges the smallest stores once there are too many of them */
+    static void select_smallest(std::vector<StoreInfo> info,
+                                std::vector<size_t> &merge);
+  };
+  typedef intrusive_ptr<CompactionPolicy> CompactionPolicyPtr;
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICY_H
@@ -0,0 +1,49 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_COMPACTIONPOLICYMERGING_H
+#define HYPERTABLE_COMPACTIONPOLICYMERGING_H
+
+#include "CompactionPolicy.h"
+
+namespace Hypertable {
+
+  /**
+   * Original policy: once an access group has more than
+   * Hypertable.RangeServer.AccessGroup.MaxFiles stores, the
+   * Hypertable.RangeServer.AccessGroup.MergeFiles smallest ones are merged.
+   */
+  class CompactionPolicyMerging : public CompactionPolicy {
+  public:
+    virtual const char *name() { return "merging"; }
+
+    using CompactionPolicy::select;
+
+    virtual void select(const std::vector<StoreInfo> &info,
+                        std::vector<size_t> &merge) {
+      select_smallest(info, merge);
+    }
+  };
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICYMERGING_H
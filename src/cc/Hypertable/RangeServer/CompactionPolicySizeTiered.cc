@@ -0,0 +1,116 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include <algorithm>
+
+#include "CompactionPolicySizeTiered.h"
+#include "Config.h"
+#include "Global.h"
+
+using namespace Hypertable;
+
+namespace {
+  struct LtDiskUsage {
+    bool operator()(const CompactionPolicy::StoreInfo &x,
+                    const CompactionPolicy::StoreInfo &y) const {
+      return x.disk_usage < y.disk_usage;
+    }
+  };
+}
+
+
+CompactionPolicySizeTiered::CompactionPolicySizeTiered() {
+  m_bucket_ratio = Config::get_f64("Hypertable.RangeServer.AccessGroup"
+                                   ".CompactionPolicy.SizeTiered.BucketRatio");
+  m_min_size = Config::get_i64("Hypertable.RangeServer.AccessGroup"
+                               ".CompactionPolicy.SizeTiered.MinSize");
+}
+
+
+void
+CompactionPolicySizeTiered::select(const std::vector<StoreInfo> &info,
+                                   std::vector<size_t> &merge) {
+  size_t begin = 0;
+  int64_t total = 0;
+
+  if (select_for_tombstones(info, merge))
+    return;
+
+  std::vector<StoreInfo> sorted(info);
+  std::sort(sorted.begin(), sorted.end(), LtDiskUsage());
+
+  /**
+   * A store joins the current tier if it is no bigger than the tier's
+   * average size times the bucket ratio.  Stores below the minimum size
+   * all end up in the first tier.
+   */
+  for (size_t i=0; i<sorted.size(); i++) {
+    if (i > begin && sorted[i].disk_usage > m_min_size &&
+        (double)sorted[i].disk_usage >
+        m_bucket_ratio * ((double)total / (double)(i - begin))) {
+      if (select_tier(sorted, begin, i, merge))
+        return;
+      begin = i;
+      total = 0;
+    }
+    total += sorted[i].disk_usage;
+  }
+
+  if (select_tier(sorted, begin, sorted.size(), merge))
+    return;
+
+  select_smallest(info, merge);
+}
+
+
+bool
+CompactionPolicySizeTiered::select_tier(const std::vector<StoreInfo> &sorted,
+    size_t begin, size_t end, std::vector<size_t> &merge) {
+
+  std::vector<size_t> overlapping;
+
+  if (end - begin < (size_t)Global::access_group_merge_files)
+    return false;
+
+  /**
+   * A store whose rows overlap no other store of the tier costs scans
+   * nothing extra, so merging it would only add write amplification
+   */
+  for (size_t i=begin; i<end; i++) {
+    for (size_t j=begin; j<end; j++) {
+      if (j != i && sorted[i].overlaps(sorted[j])) {
+        overlapping.push_back(sorted[i].index);
+        break;
+      }
+    }
+  }
+
+  if (overlapping.size() < (size_t)Global::access_group_merge_files)
+    return false;
+
+  if (overlapping.size() > (size_t)Global::access_group_max_files)
+    overlapping.resize(Global::access_group_max_files);
+
+  merge.insert(merge.end(), overlapping.begin(), overlapping.end());
+  return true;
+}
@@ -0,0 +1,60 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_COMPACTIONPOLICYSIZETIERED_H
+#define HYPERTABLE_COMPACTIONPOLICYSIZETIERED_H
+
+#include "CompactionPolicy.h"
+
+namespace Hypertable {
+
+  /**
+   * Groups the stores of an access group into tiers of similar size and
+   * merges the smallest tier that has accumulated
+   * Hypertable.RangeServer.AccessGroup.MergeFiles stores.  Every cell is
+   * rewritten about once per tier, so write amplification grows with the
+   * logarithm of the access group size instead of with its size.  Stores
+   * whose rows overlap no other store of their tier, as happens with
+   * ever increasing row keys, are left out of the merge.
+   */
+  class CompactionPolicySizeTiered : public CompactionPolicy {
+  public:
+    CompactionPolicySizeTiered();
+
+    virtual const char *name() { return "size-tiered"; }
+
+    using CompactionPolicy::select;
+
+    virtual void select(const std::vector<StoreInfo> &info,
+                        std::vector<size_t> &merge);
+
+  private:
+    bool select_tier(const std::vector<StoreInfo> &sorted, size_t begin,
+                     size_t end, std::vector<size_t> &merge);
+
+    double  m_bucket_ratio;
+    int64_t m_min_size;
+  };
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICYSIZETIERED_H
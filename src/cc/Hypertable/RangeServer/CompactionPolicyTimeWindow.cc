@@ -0,0 +1,73 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+
+#include "Hypertable/Lib/KeySpec.h"
+
+#include "CompactionPolicyTimeWindow.h"
+#include "Config.h"
+#include "Global.h"
+
+using namespace Hypertable;
+
+
+CompactionPolicyTimeWindow::CompactionPolicyTimeWindow() {
+  m_window = (int64_t)Config::get_i32("Hypertable.RangeServer.AccessGroup"
+      ".CompactionPolicy.TimeWindow.Size") * 1000000000LL;
+  if (m_window <= 0)
+    m_window = 86400LL * 1000000000LL;
+}
+
+
+void
+CompactionPolicyTimeWindow::select(const std::vector<StoreInfo> &info,
+                                   std::vector<size_t> &merge) {
+  std::vector<size_t> newest;
+  int64_t newest_window = TIMESTAMP_MIN;
+
+  if (select_for_tombstones(info, merge))
+    return;
+
+  // Stores without timestamps (e.g. only deletes) count as current
+  foreach(const StoreInfo &si, info) {
+    if (si.timestamp_max == TIMESTAMP_MIN || si.timestamp_max == TIMESTAMP_MAX)
+      continue;
+    if (si.timestamp_max / m_window > newest_window)
+      newest_window = si.timestamp_max / m_window;
+  }
+
+  foreach(const StoreInfo &si, info) {
+    if (si.timestamp_max == TIMESTAMP_MIN || si.timestamp_max == TIMESTAMP_MAX
+        || si.timestamp_max / m_window == newest_window)
+      newest.push_back(si.index);
+  }
+
+  if (newest.size() >= (size_t)Global::access_group_merge_files) {
+    if (newest.size() > (size_t)Global::access_group_max_files)
+      newest.resize(Global::access_group_max_files);
+    merge.swap(newest);
+    return;
+  }
+
+  select_smallest(info, merge);
+}
@@ -0,0 +1,56 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_COMPACTIONPOLICYTIMEWINDOW_H
+#define HYPERTABLE_COMPACTIONPOLICYTIMEWINDOW_H
+
+#include "CompactionPolicy.h"
+
+namespace Hypertable {
+
+  /**
+   * For time series data.  Stores are assigned to fixed size time windows
+   * by their newest timestamp, and only the stores of the newest window
+   * are merged, once there are
+   * Hypertable.RangeServer.AccessGroup.MergeFiles of them.  A compaction
+   * always writes out the cell cache as well, so its output lands in the
+   * newest window and the stores of older windows are left alone, apart
+   * from the tombstone and store count limits that apply to all policies.
+   */
+  class CompactionPolicyTimeWindow : public CompactionPolicy {
+  public:
+    CompactionPolicyTimeWindow();
+
+    virtual const char *name() { return "time-window"; }
+
+    using CompactionPolicy::select;
+
+    virtual void select(const std::vector<StoreInfo> &info,
+                        std::vector<size_t> &merge);
+
+  private:
+    int64_t m_window;
+  };
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICYTIMEWINDOW_H
@@ -45,6 +45,7 @@ extern "C" {
 #include "RequestHandlerUpdate.h"
 #include "RequestHandlerCreateScanner.h"
 #include "RequestHandlerFetchScanblock.h"
+#include "RequestHandlerGetRows.h"
 #include "RequestHandlerDropTable.h"
 #include "RequestHandlerStatus.h"
 #include "RequestHandlerReplayBegin.h"
@@ -52,6 +53,7 @@ extern "C" {
 #include "RequestHandlerReplayUpdate.h"
 #include "RequestHandlerReplayCommit.h"
 #include "RequestHandlerDropRange.h"
+#include "RequestHandlerLoadCellStores.h"
 #include "RequestHandlerClose.h"
 #include "RequestHandlerCommitLogSync.h"
 
@@ -124,6 +126,10 @@ void ConnectionHandler::handle(EventPtr &event) {
         handler = new RequestHandlerCreateScanner(m_comm,
             m_range_server_ptr.get(), event);
         break;
+      case RangeServerProtocol::COMMAND_GET_ROWS:
+        handler = new RequestHandlerGetRows(m_comm,
+            m_range_server_ptr.get(), event);
+        break;
       case RangeServerProtocol::COMMAND_DESTROY_SCANNER:
         handler = new RequestHandlerDestroyScanner(m_comm,
             m_range_server_ptr.get(), event);
@@ -156,6 +162,10 @@ void ConnectionHandler::handle(EventPtr &event) {
         handler = new RequestHandlerDropRange(m_comm, m_range_server_ptr.get(),
                                               event);
         break;
+      case RangeServerProtocol::COMMAND_LOAD_CELL_STORES:
+        handler = new RequestHandlerLoadCellStores(m_comm,
+            m_range_server_ptr.get(), event);
+        break;
       case RangeServerProtocol::COMMAND_STATUS:
         handler = new RequestHandlerStatus(m_comm, m_range_server_ptr.get(),
                                            event);
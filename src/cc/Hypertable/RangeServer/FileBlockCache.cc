@@ -28,90 +28,183 @@
 using namespace Hypertable;
 using std::pair;
 
+namespace {
+  // smallest amount of memory worth giving its own shard
+  const uint64_t MIN_SHARD_MEMORY = 4 * 1024 * 1024;
+  // minimum number of keys remembered in a shard's ghost queue
+  const size_t MIN_GHOST_ENTRIES = 16;
+}
+
 atomic_t FileBlockCache::ms_next_file_id = ATOMIC_INIT(0);
 
+
+FileBlockCache::FileBlockCache(uint64_t max_memory, uint32_t shards)
+  : m_max_memory(max_memory) {
+  uint64_t max_shards = max_memory / MIN_SHARD_MEMORY;
+
+  if (shards > max_shards)
+    shards = (uint32_t)max_shards;
+  if (shards == 0)
+    shards = 1;
+
+  m_shards.reserve(shards);
+  for (uint32_t i=0; i<shards; i++)
+    m_shards.push_back(new Shard(max_memory / shards));
+}
+
+
 FileBlockCache::~FileBlockCache() {
-  for (BlockCache::const_iterator iter = m_cache.begin();
-       iter != m_cache.end(); ++iter)
-    delete [] (*iter).block;
+  for (size_t i=0; i<m_shards.size(); i++)
+    delete m_shards[i];
 }
 
+
 bool
-FileBlockCache::checkout(int file_id, uint32_t file_offset, uint8_t **blockp,
+FileBlockCache::checkout(int file_id, int64_t file_offset, uint8_t **blockp,
                          uint32_t *lengthp) {
-  ScopedLock lock(m_mutex);
-  HashIndex &hash_index = m_cache.get<1>();
-  HashIndex::iterator iter;
-  uint64_t key = ((uint64_t)file_id << 32) | file_offset;
+  BlockKey key(file_id, file_offset);
+  return get_shard(key)->checkout(key, blockp, lengthp);
+}
 
-  if ((iter = hash_index.find(key)) == hash_index.end())
-    return false;
 
-  BlockCacheEntry entry = *iter;
-  entry.ref_count++;
+void FileBlockCache::checkin(int file_id, int64_t file_offset) {
+  BlockKey key(file_id, file_offset);
+  get_shard(key)->checkin(key);
+}
 
-  hash_index.erase(iter);
 
-  pair<Sequence::iterator, bool> insert_result = m_cache.push_back(entry);
-  assert(insert_result.second);
+bool
+FileBlockCache::insert_and_checkout(int file_id, int64_t file_offset,
+                                    uint8_t *block, uint32_t length) {
+  BlockKey key(file_id, file_offset);
+  return get_shard(key)->insert_and_checkout(key, block, length);
+}
 
-  *blockp = (*insert_result.first).block;
-  *lengthp = (*insert_result.first).length;
 
+bool FileBlockCache::contains(int file_id, int64_t file_offset) {
+  BlockKey key(file_id, file_offset);
+  return get_shard(key)->contains(key);
+}
+
+
+void FileBlockCache::get_stats(std::vector<BlockCacheStat> &stats) {
+  for (size_t i=0; i<m_shards.size(); i++) {
+    BlockCacheStat stat;
+    m_shards[i]->get_stats(stat);
+    stats.push_back(stat);
+  }
+}
+
+
+FileBlockCache::Shard::Shard(uint64_t max_memory)
+  : m_max_memory(max_memory), m_avail_memory(max_memory),
+    m_probation_memory(0), m_protected_memory(0), m_hits(0), m_misses(0),
+    m_evictions(0) {
+}
+
+
+FileBlockCache::Shard::~Shard() {
+  for (BlockCache::const_iterator iter = m_probation.begin();
+       iter != m_probation.end(); ++iter)
+    delete [] (*iter).block;
+  for (BlockCache::const_iterator iter = m_protected.begin();
+       iter != m_protected.end(); ++iter)
+    delete [] (*iter).block;
+}
+
+
+bool
+FileBlockCache::Shard::checkout(const BlockKey &key, uint8_t **blockp,
+                                uint32_t *lengthp) {
+  ScopedLock lock(m_mutex);
+  HashIndex &protected_index = m_protected.get<1>();
+  HashIndex &probation_index = m_probation.get<1>();
+  HashIndex::iterator iter;
+
+  if ((iter = protected_index.find(key)) != protected_index.end()) {
+    BlockCacheEntry entry = *iter;
+    entry.ref_count++;
+    protected_index.erase(iter);
+    pair<Sequence::iterator, bool> insert_result = m_protected.push_back(entry);
+    assert(insert_result.second);
+    *blockp = entry.block;
+    *lengthp = entry.length;
+  }
+  else if ((iter = probation_index.find(key)) != probation_index.end()) {
+    // second reference, promote to the protected queue
+    BlockCacheEntry entry = *iter;
+    entry.ref_count++;
+    probation_index.erase(iter);
+    m_probation_memory -= entry.length;
+    push_protected(entry);
+    *blockp = entry.block;
+    *lengthp = entry.length;
+  }
+  else {
+    m_misses++;
+    return false;
+  }
+
+  m_hits++;
   return true;
 }
 
 
-void FileBlockCache::checkin(int file_id, uint32_t file_offset) {
+void FileBlockCache::Shard::checkin(const BlockKey &key) {
   ScopedLock lock(m_mutex);
-  HashIndex &hash_index = m_cache.get<1>();
+  HashIndex &protected_index = m_protected.get<1>();
+  HashIndex &probation_index = m_probation.get<1>();
   HashIndex::iterator iter;
-  uint64_t key = ((uint64_t)file_id << 32) | file_offset;
 
-  iter = hash_index.find(key);
+  if ((iter = protected_index.find(key)) != protected_index.end()) {
+    assert((*iter).ref_count > 0);
+    protected_index.modify(iter, DecrementRefCount());
+    return;
+  }
+
+  iter = probation_index.find(key);
 
-  assert(iter != hash_index.end() && (*iter).ref_count > 0);
+  assert(iter != probation_index.end() && (*iter).ref_count > 0);
 
-  hash_index.modify(iter, DecrementRefCount());
+  probation_index.modify(iter, DecrementRefCount());
 }
 
 
 bool
-FileBlockCache::insert_and_checkout(int file_id, uint32_t file_offset,
-                                    uint8_t *block, uint32_t length) {
+FileBlockCache::Shard::insert_and_checkout(const BlockKey &key,
+                                           uint8_t *block, uint32_t length) {
   ScopedLock lock(m_mutex);
-  HashIndex &hash_index = m_cache.get<1>();
-  uint64_t key = ((uint64_t)file_id << 32) | file_offset;
+  HashIndex &protected_index = m_protected.get<1>();
+  HashIndex &probation_index = m_probation.get<1>();
+  GhostHashIndex &ghost_index = m_ghost.get<1>();
 
-  if (length > m_max_memory || hash_index.find(key) != hash_index.end())
+  if (length > m_max_memory ||
+      protected_index.find(key) != protected_index.end() ||
+      probation_index.find(key) != probation_index.end())
     return false;
 
-  // make room
-  if (m_avail_memory < length) {
-    BlockCache::iterator iter = m_cache.begin();
-    while (iter != m_cache.end()) {
-      if ((*iter).ref_count == 0) {
-        m_avail_memory += (*iter).length;
-        delete [] (*iter).block;
-        iter = m_cache.erase(iter);
-        if (m_avail_memory >= length)
-          break;
-      }
-      else
-        ++iter;
-    }
-  }
+  make_room(length);
 
   if (m_avail_memory < length)
     return false;
 
-  BlockCacheEntry entry(file_id, file_offset);
+  BlockCacheEntry entry(key.file_id, key.file_offset);
   entry.block = block;
   entry.length = length;
   entry.ref_count = 1;
 
-  pair<Sequence::iterator, bool> insert_result = m_cache.push_back(entry);
-  assert(insert_result.second);
+  GhostHashIndex::iterator ghost_iter = ghost_index.find(key);
+
+  if (ghost_iter != ghost_index.end()) {
+    // block was evicted before it got a second reference, treat as hot
+    ghost_index.erase(ghost_iter);
+    push_protected(entry);
+  }
+  else {
+    pair<Sequence::iterator, bool> insert_result = m_probation.push_back(entry);
+    assert(insert_result.second);
+    m_probation_memory += length;
+  }
 
   m_avail_memory -= length;
 
@@ -119,10 +212,100 @@ FileBlockCache::insert_and_checkout(int file_id, uint32_t file_offset,
 }
 
 
-bool FileBlockCache::contains(int file_id, uint32_t file_offset) {
+bool FileBlockCache::Shard::contains(const BlockKey &key) {
   ScopedLock lock(m_mutex);
-  HashIndex &hash_index = m_cache.get<1>();
-  uint64_t key = ((uint64_t)file_id << 32) | file_offset;
+  HashIndex &protected_index = m_protected.get<1>();
+  HashIndex &probation_index = m_probation.get<1>();
+
+  return protected_index.find(key) != protected_index.end() ||
+      probation_index.find(key) != probation_index.end();
+}
+
+
+void FileBlockCache::Shard::get_stats(BlockCacheStat &stat) {
+  ScopedLock lock(m_mutex);
+  stat.hits = m_hits;
+  stat.misses = m_misses;
+  stat.evictions = m_evictions;
+  stat.memory_used = m_max_memory - m_avail_memory;
+}
+
+
+/**
+ * Appends an entry to the protected queue.  If the protected queue grows
+ * beyond three quarters of the shard, its least recently used entries are
+ * demoted to the tail of the probationary queue.
+ */
+void FileBlockCache::Shard::push_protected(const BlockCacheEntry &entry) {
+  pair<Sequence::iterator, bool> insert_result = m_protected.push_back(entry);
+  assert(insert_result.second);
+  m_protected_memory += entry.length;
 
-  return (hash_index.find(key) != hash_index.end());
+  while (m_protected_memory > (m_max_memory / 4) * 3 &&
+         m_protected.size() > 1) {
+    BlockCacheEntry demoted = m_protected.front();
+    m_protected.pop_front();
+    m_protected_memory -= demoted.length;
+    insert_result = m_probation.push_back(demoted);
+    assert(insert_result.second);
+    m_probation_memory += demoted.length;
+  }
+}
+
+
+/**
+ * Evicts the least recently used entry of the given queue that is not
+ * checked out.  If remember is true, the key of the evicted entry is added
+ * to the ghost queue.
+ */
+bool FileBlockCache::Shard::evict(BlockCache &queue, bool remember) {
+  BlockCache::iterator iter = queue.begin();
+
+  while (iter != queue.end() && (*iter).ref_count > 0)
+    ++iter;
+
+  if (iter == queue.end())
+    return false;
+
+  if (remember) {
+    size_t max_ghosts = m_probation.size() + m_protected.size();
+    if (max_ghosts < MIN_GHOST_ENTRIES)
+      max_ghosts = MIN_GHOST_ENTRIES;
+    m_ghost.push_back((*iter).key);
+    while (m_ghost.size() > max_ghosts)
+      m_ghost.pop_front();
+  }
+
+  if (&queue == &m_probation)
+    m_probation_memory -= (*iter).length;
+  else
+    m_protected_memory -= (*iter).length;
+  m_avail_memory += (*iter).length;
+  m_evictions++;
+
+  delete [] (*iter).block;
+  queue.erase(iter);
+  return true;
+}
+
+
+/**
+ * Evicts entries until there is room for a block of the given length.  The
+ * probationary queue is drained first as long as it (together with the new
+ * block) would occupy more than a quarter of the shard, otherwise the
+ * protected queue is used.  Either queue is used as a fallback when the
+ * other one only holds blocks that are checked out.
+ */
+void FileBlockCache::Shard::make_room(uint32_t length) {
+  while (m_avail_memory < length) {
+    bool from_probation = m_probation_memory + length > m_max_memory / 4
+        || m_protected.empty();
+
+    if (from_probation) {
+      if (!evict(m_probation, true) && !evict(m_protected, false))
+        break;
+    }
+    else if (!evict(m_protected, false) && !evict(m_probation, true))
+      break;
+  }
 }
@@ -22,32 +22,67 @@
 #ifndef HYPERTABLE_FILEBLOCKCACHE_H
 #define HYPERTABLE_FILEBLOCKCACHE_H
 
+#include <vector>
+
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/member.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 
 #include "Common/Mutex.h"
 #include "Common/atomic.h"
 
+#include "Hypertable/Lib/Stat.h"
+
 namespace Hypertable {
   using namespace boost::multi_index;
 
+  /**
+   * Cache of uncompressed cell store blocks.  The cache is split into a
+   * number of independently locked shards, selected by a hash of the
+   * (file id, file offset) pair, so that scanners running on different
+   * cores don't serialize on a single lock.  Each shard implements a 2Q
+   * style replacement policy: newly inserted blocks go into a probationary
+   * queue and are only promoted to the protected queue when they are
+   * checked out again.  The probationary queue is evicted first, so a large
+   * sequential scan that touches each block once will not flush the
+   * frequently accessed blocks out of the cache.  Keys of blocks recently
+   * evicted from the probationary queue are remembered in a ghost queue;
+   * re-inserting one of them places the block directly in the protected
+   * queue.
+   */
   class FileBlockCache {
 
     static atomic_t ms_next_file_id;
 
   public:
-    FileBlockCache(uint64_t max_memory)
-        : m_max_memory(max_memory), m_avail_memory(max_memory) {  }
+    enum { DEFAULT_SHARDS = 16 };
+
+    /**
+     * Constructor.  The number of shards is reduced for small caches so
+     * that each shard is able to hold a reasonable number of blocks.
+     *
+     * @param max_memory maximum number of bytes to cache
+     * @param shards number of shards to split the cache into
+     */
+    FileBlockCache(uint64_t max_memory, uint32_t shards = DEFAULT_SHARDS);
     ~FileBlockCache();
 
-    bool checkout(int file_id, uint32_t file_offset, uint8_t **blockp,
+    bool checkout(int file_id, int64_t file_offset, uint8_t **blockp,
                   uint32_t *lengthp);
-    void checkin(int file_id, uint32_t file_offset);
-    bool insert_and_checkout(int file_id, uint32_t file_offset,
+    void checkin(int file_id, int64_t file_offset);
+    bool insert_and_checkout(int file_id, int64_t file_offset,
                              uint8_t *block, uint32_t length);
-    bool contains(int file_id, uint32_t file_offset);
+    bool contains(int file_id, int64_t file_offset);
+
+    /**
+     * Appends the hit, miss and eviction counters of each shard to the
+     * given vector.
+     *
+     * @param stats vector to receive the per-shard statistics
+     */
+    void get_stats(std::vector<BlockCacheStat> &stats);
 
     static int get_next_file_id() {
       return atomic_inc_return(&ms_next_file_id);
@@ -55,19 +90,40 @@ namespace Hypertable {
 
   private:
 
+    struct BlockKey {
+      BlockKey() : file_id(-1), file_offset(0) { }
+      BlockKey(int id, int64_t offset) : file_id(id), file_offset(offset) { }
+      bool operator==(const BlockKey &other) const {
+        return file_id == other.file_id && file_offset == other.file_offset;
+      }
+      int      file_id;
+      int64_t  file_offset;
+    };
+
+    struct HashBlockKey {
+      std::size_t operator()(const BlockKey &key) const {
+        uint64_t x = (uint64_t)key.file_offset
+            ^ ((uint64_t)(uint32_t)key.file_id << 40)
+            ^ ((uint64_t)(uint32_t)key.file_id >> 24);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return (std::size_t)x;
+      }
+    };
+
     class BlockCacheEntry {
     public:
-      BlockCacheEntry() : file_id(-1), file_offset(0), block(0), length(0),
-          ref_count(0) { return; }
-      BlockCacheEntry(int id, uint32_t offset) : file_id(id),
-          file_offset(offset), block(0), length(0), ref_count(0) { return; }
+      BlockCacheEntry() : block(0), length(0), ref_count(0) { return; }
+      BlockCacheEntry(int id, int64_t offset) : key(id, offset),
+          block(0), length(0), ref_count(0) { return; }
 
-      int      file_id;
-      uint32_t file_offset;
+      BlockKey  key;
       uint8_t  *block;
-      uint32_t length;
-      uint32_t ref_count;
-      uint64_t key() const { return ((uint64_t)file_id << 32) | file_offset; }
+      uint32_t  length;
+      uint32_t  ref_count;
     };
 
     struct DecrementRefCount {
@@ -76,28 +132,64 @@ namespace Hypertable {
       }
     };
 
-    struct HashI64 {
-      std::size_t operator()(uint64_t x) const {
-        return (std::size_t)(x >> 32) ^ (std::size_t)x;
-      }
-    };
-
     typedef boost::multi_index_container<
       BlockCacheEntry,
       indexed_by<
         sequenced<>,
-        hashed_unique<const_mem_fun<BlockCacheEntry, uint64_t,
-                      &BlockCacheEntry::key>, HashI64>
+        hashed_unique<member<BlockCacheEntry, BlockKey,
+                      &BlockCacheEntry::key>, HashBlockKey>
       >
     > BlockCache;
 
     typedef BlockCache::nth_index<0>::type Sequence;
     typedef BlockCache::nth_index<1>::type HashIndex;
 
-    Mutex         m_mutex;
-    BlockCache    m_cache;
-    uint64_t      m_max_memory;
-    uint64_t      m_avail_memory;
+    typedef boost::multi_index_container<
+      BlockKey,
+      indexed_by<
+        sequenced<>,
+        hashed_unique<identity<BlockKey>, HashBlockKey>
+      >
+    > GhostCache;
+
+    typedef GhostCache::nth_index<1>::type GhostHashIndex;
+
+    class Shard {
+    public:
+      Shard(uint64_t max_memory);
+      ~Shard();
+
+      bool checkout(const BlockKey &key, uint8_t **blockp, uint32_t *lengthp);
+      void checkin(const BlockKey &key);
+      bool insert_and_checkout(const BlockKey &key, uint8_t *block,
+                               uint32_t length);
+      bool contains(const BlockKey &key);
+      void get_stats(BlockCacheStat &stat);
+
+    private:
+      void push_protected(const BlockCacheEntry &entry);
+      bool evict(BlockCache &queue, bool remember);
+      void make_room(uint32_t length);
+
+      Mutex         m_mutex;
+      BlockCache    m_probation;
+      BlockCache    m_protected;
+      GhostCache    m_ghost;
+      uint64_t      m_max_memory;
+      uint64_t      m_avail_memory;
+      uint64_t      m_probation_memory;
+      uint64_t      m_protected_memory;
+      uint64_t      m_hits;
+      uint64_t      m_misses;
+      uint64_t      m_evictions;
+    };
+
+    Shard *get_shard(const BlockKey &key) {
+      return m_shards[HashBlockKey()(key) % m_shards.size()];
+    }
+
+    std::vector<Shard *> m_shards;
+    uint64_t             m_max_memory;
   };
 
 }
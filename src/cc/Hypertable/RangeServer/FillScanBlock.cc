@@ -20,6 +20,8 @@
  */
 
 #include "Common/Compat.h"
+#include <algorithm>
+
 #include "FillScanBlock.h"
 #include "Hypertable/Lib/Defaults.h"
 
@@ -27,31 +29,38 @@ namespace Hypertable {
 
   bool
   FillScanBlock(CellListScannerPtr &scanner, DynamicBuffer &dbuf,
-                size_t *countp) {
+                size_t *countp, size_t block_size) {
     Key key;
     ByteString value;
     size_t value_len;
     bool more = true;
-    size_t limit = DATA_TRANSFER_BLOCKSIZE;
-    size_t remaining = DATA_TRANSFER_BLOCKSIZE;
+    size_t limit = block_size;
+    size_t remaining = block_size;
     uint8_t *ptr;
 
     assert(dbuf.base == 0);
 
     *countp = 0;
 
+    /**
+     * block_size only caps how much is filled; the buffer starts at the
+     * default transfer size and grows as cells are added, so small or
+     * empty results don't allocate a whole (possibly grown) block.
+     */
+    dbuf.reserve(std::min(limit, (size_t)DATA_TRANSFER_BLOCKSIZE) + 4);
+    // skip encoded length
+    dbuf.ptr = dbuf.base + 4;
+
     while ((more = scanner->get(key, value))) {
       value_len = value.length();
-      if (dbuf.base == 0) {
-        if (key.length + value_len > limit) {
-          limit = key.length + value_len;
-          remaining = limit;
-        }
-        dbuf.reserve(limit+4);
-        // skip encoded length
-        dbuf.ptr = dbuf.base + 4;
+      if (*countp == 0 && key.length + value_len > limit) {
+        limit = key.length + value_len;
+        remaining = limit;
       }
       if (key.length + value_len <= remaining) {
+        if (key.length + value_len > dbuf.remaining())
+          dbuf.grow(std::min((dbuf.fill() + key.length + value_len) * 3 / 2,
+                             limit + 4));
         dbuf.add_unchecked(key.serial.ptr, key.length);
         dbuf.add_unchecked(value.ptr, value_len);
         remaining -= (key.length + value_len);
@@ -62,11 +71,6 @@ namespace Hypertable {
         break;
     }
 
-    if (dbuf.base == 0) {
-      dbuf.reserve(limit + 4);
-      dbuf.ptr = dbuf.base + 4;
-    }
-
     ptr = dbuf.base;
     Serialization::encode_i32(&ptr, dbuf.fill() - 4);
 
@@ -24,12 +24,26 @@
 
 #include "Common/DynamicBuffer.h"
 
+#include "Hypertable/Lib/Defaults.h"
+
 #include "CellListScanner.h"
 
 namespace Hypertable {
 
+  /**
+   * Fills a buffer with key/value pairs from the scanner, up to the given
+   * block size.  A single pair larger than the block size is still returned
+   * on its own.
+   *
+   * @param scanner scanner to pull key/value pairs from
+   * @param dbuf buffer to fill (must be empty)
+   * @param countp address of variable to hold number of pairs added
+   * @param block_size maximum number of bytes of key/value data to add
+   * @return true if there are more pairs to be fetched
+   */
   bool FillScanBlock(CellListScannerPtr &scanner, DynamicBuffer &dbuf,
-                     size_t *countp);
+                     size_t *countp,
+                     size_t block_size = DATA_TRANSFER_BLOCKSIZE);
 
 }
 
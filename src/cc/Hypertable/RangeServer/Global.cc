@@ -35,6 +35,7 @@ namespace Hypertable {
   Filesystem            *Global::dfs = 0;
   Filesystem            *Global::log_dfs = 0;
   MaintenanceQueuePtr    Global::maintenance_queue;
+  ApplicationQueue      *Global::compression_queue = 0;
   RangeServerProtocol   *Global::protocol = 0;
   bool                   Global::verbose = false;
   CommitLog             *Global::user_log = 0;
@@ -50,6 +51,7 @@ namespace Hypertable {
   int32_t                Global::access_group_max_mem = 0;
   ScannerMap             Global::scanner_map;
   FileBlockCache        *Global::block_cache = 0;
+  FileBlockCache        *Global::compressed_block_cache = 0;
   TablePtr               Global::metadata_table = 0;
   int64_t                Global::range_metadata_split_size = 0;
   MemoryTracker          Global::memory_tracker;
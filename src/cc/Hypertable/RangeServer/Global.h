@@ -56,6 +56,7 @@ namespace Hypertable {
     static Hypertable::Filesystem *dfs;
     static Hypertable::Filesystem *log_dfs;
     static Hypertable::MaintenanceQueuePtr maintenance_queue;
+    static Hypertable::ApplicationQueue *compression_queue;
     static Hypertable::RangeServerProtocol *protocol;
     static bool           verbose;
     static CommitLog     *user_log;
@@ -71,6 +72,7 @@ namespace Hypertable {
     static int32_t        access_group_max_mem;
     static ScannerMap     scanner_map;
     static Hypertable::FileBlockCache *block_cache;
+    static Hypertable::FileBlockCache *compressed_block_cache;
     static TablePtr       metadata_table;
     static int64_t        range_metadata_split_size;
     static Hypertable::MemoryTracker memory_tracker;
@@ -0,0 +1,216 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Time.h"
+
+#include "GroupCommit.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  uint64_t elapsed_micros(const boost::xtime &start) {
+    boost::xtime now;
+    boost::xtime_get(&now, boost::TIME_UTC);
+    int64_t micros = ((int64_t)now.sec - (int64_t)start.sec) * 1000000LL
+        + ((int64_t)now.nsec - (int64_t)start.nsec) / 1000LL;
+    return micros > 0 ? (uint64_t)micros : 0;
+  }
+
+}
+
+
+GroupCommit::GroupCommit(CommitLog *log, uint32_t max_wait,
+                         uint32_t max_batch_bytes)
+  : m_log(log), m_max_wait(max_wait), m_max_batch_bytes(max_batch_bytes),
+    m_pending_bytes(0), m_next_ticket(0), m_committed_ticket(0),
+    m_flushing(false), m_batches(0), m_requests(0), m_bytes(0),
+    m_max_batch(0), m_latency(0), m_max_latency(0) {
+  if (m_max_batch_bytes == 0)
+    m_max_batch_bytes = 1;
+}
+
+
+uint64_t
+GroupCommit::enqueue(DynamicBuffer &buffer, size_t header_len,
+                     int64_t revision, bool sync) {
+  ScopedLock lock(m_mutex);
+  PendingCommit commit;
+
+  commit.buffer = &buffer;
+  commit.header_len = header_len;
+  commit.revision = revision;
+  commit.sync = sync;
+  commit.ticket = ++m_next_ticket;
+  boost::xtime_get(&commit.enqueue_time, boost::TIME_UTC);
+
+  m_pending.push_back(commit);
+  m_pending_bytes += buffer.fill();
+
+  // wake up a batch leader that is waiting for the batch to fill
+  if (m_flushing && m_pending_bytes >= m_max_batch_bytes)
+    m_cond.notify_all();
+
+  return commit.ticket;
+}
+
+
+int GroupCommit::wait_for_commit(uint64_t ticket) {
+  ScopedLock lock(m_mutex);
+  int error = Error::OK;
+
+  while (ticket > m_committed_ticket) {
+
+    if (m_flushing || m_pending.empty()) {
+      m_cond.wait(lock);
+      continue;
+    }
+
+    /**
+     * Become the batch leader
+     */
+    m_flushing = true;
+
+    if (m_max_wait && m_pending_bytes < m_max_batch_bytes) {
+      boost::xtime deadline;
+      boost::xtime_get(&deadline, boost::TIME_UTC);
+      xtime_add_millis(deadline, m_max_wait);
+      while (m_pending_bytes < m_max_batch_bytes) {
+        if (!m_cond.timed_wait(lock, deadline))
+          break;
+      }
+    }
+
+    PendingQueue batch;
+    size_t batch_bytes = 0;
+
+    while (!m_pending.empty()) {
+      size_t len = m_pending.front().buffer->fill();
+      if (!batch.empty() && batch_bytes + len > m_max_batch_bytes)
+        break;
+      batch_bytes += len;
+      batch.push_back(m_pending.front());
+      m_pending.pop_front();
+    }
+    m_pending_bytes -= batch_bytes;
+
+    lock.unlock();
+    int batch_error = write_batch(batch);
+    lock.lock();
+
+    m_batches++;
+    m_bytes += batch_bytes;
+    m_requests += batch.size();
+    if (batch.size() > m_max_batch)
+      m_max_batch = batch.size();
+
+    foreach(const PendingCommit &commit, batch) {
+      uint64_t latency = elapsed_micros(commit.enqueue_time);
+      m_latency += latency;
+      if (latency > m_max_latency)
+        m_max_latency = latency;
+      if (batch_error != Error::OK)
+        m_errors[commit.ticket] = batch_error;
+    }
+
+    m_committed_ticket = batch.back().ticket;
+    m_flushing = false;
+    m_cond.notify_all();
+  }
+
+  std::map<uint64_t, int>::iterator iter = m_errors.find(ticket);
+  if (iter != m_errors.end()) {
+    error = iter->second;
+    m_errors.erase(iter);
+  }
+
+  return error;
+}
+
+
+/**
+ * Writes a batch of pending commits to the log.  Runs of consecutive buffers
+ * for the same table are merged into a single block and only the last block
+ * of the batch is synced.
+ */
+int GroupCommit::write_batch(PendingQueue &batch) {
+  int error;
+  bool sync = false;
+  size_t i = 0, j;
+
+  foreach(const PendingCommit &commit, batch)
+    sync = sync || commit.sync;
+
+  while (i < batch.size()) {
+    PendingCommit &first = batch[i];
+    size_t total = first.buffer->fill();
+    int64_t revision = first.revision;
+
+    for (j = i+1; j < batch.size(); j++) {
+      if (batch[j].header_len != first.header_len ||
+          memcmp(batch[j].buffer->base, first.buffer->base, first.header_len))
+        break;
+      total += batch[j].buffer->fill() - first.header_len;
+      if (batch[j].revision > revision)
+        revision = batch[j].revision;
+    }
+
+    bool sync_block = sync && j == batch.size();
+
+    if (j == i+1)
+      error = m_log->write(*first.buffer, revision, sync_block);
+    else {
+      DynamicBuffer block(total);
+      block.add_unchecked(first.buffer->base, first.buffer->fill());
+      for (size_t k = i+1; k < j; k++)
+        block.add_unchecked(batch[k].buffer->base + first.header_len,
+                            batch[k].buffer->fill() - first.header_len);
+      error = m_log->write(block, revision, sync_block);
+    }
+
+    if (error != Error::OK) {
+      HT_ERRORF("Problem writing group commit batch of %d updates to "
+                "commit log (%s) - %s", (int)batch.size(),
+                m_log->get_log_dir().c_str(), Error::get_text(error));
+      return error;
+    }
+
+    i = j;
+  }
+
+  return Error::OK;
+}
+
+
+void GroupCommit::get_stats(RangeServerStat &stat) {
+  ScopedLock lock(m_mutex);
+  stat.group_commit_batches = m_batches;
+  stat.group_commit_requests = m_requests;
+  stat.group_commit_bytes = m_bytes;
+  stat.group_commit_max_batch = m_max_batch;
+  stat.group_commit_latency = m_latency;
+  stat.group_commit_max_latency = m_max_latency;
+}
@@ -0,0 +1,133 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_GROUPCOMMIT_H
+#define HYPERTABLE_GROUPCOMMIT_H
+
+#include <deque>
+#include <map>
+
+#include <boost/thread/condition.hpp>
+#include <boost/thread/xtime.hpp>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Mutex.h"
+#include "Common/ReferenceCount.h"
+
+#include "Hypertable/Lib/CommitLog.h"
+#include "Hypertable/Lib/Stat.h"
+
+namespace Hypertable {
+
+  /**
+   * Group commit stage in front of a CommitLog.  Update buffers are
+   * enqueued (in revision order) by concurrently arriving update requests
+   * and are then written by whichever waiting thread becomes the batch
+   * leader.  Consecutive buffers for the same table are coalesced into a
+   * single commit log block and the whole batch is followed by a single
+   * sync, after which all of the waiters are woken up.  The batch leader
+   * will wait up to max_wait milliseconds for more buffers to arrive, unless
+   * max_batch_bytes worth of updates is already pending.
+   */
+  class GroupCommit : public ReferenceCount {
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param log commit log to write batches into
+     * @param max_wait milliseconds a batch leader waits for more updates
+     * @param max_batch_bytes maximum amount of update data in one batch
+     */
+    GroupCommit(CommitLog *log, uint32_t max_wait, uint32_t max_batch_bytes);
+
+    /**
+     * Enqueues a block of updates for commit.  The buffer must remain
+     * valid until #wait_for_commit returns for the returned ticket.
+     * Callers are responsible for serializing calls to this method in
+     * revision order.
+     *
+     * @param buffer block of updates, starting with an encoded table id
+     * @param header_len length of the encoded table id at front of buffer
+     * @param revision most recent revision in buffer
+     * @param sync true if the update must be synced to the log
+     * @return ticket to pass to wait_for_commit
+     */
+    uint64_t enqueue(DynamicBuffer &buffer, size_t header_len,
+                     int64_t revision, bool sync);
+
+    /**
+     * Blocks until the updates associated with the given ticket have been
+     * written (and synced, if requested) to the commit log.  The calling
+     * thread may end up writing the batch itself.
+     *
+     * @param ticket ticket returned by enqueue
+     * @return Error::OK on success or error code on failure
+     */
+    int wait_for_commit(uint64_t ticket);
+
+    /**
+     * Fills in the group commit counters of a RangeServerStat object.
+     *
+     * @param stat reference to statistics object to fill in
+     */
+    void get_stats(RangeServerStat &stat);
+
+  private:
+
+    struct PendingCommit {
+      DynamicBuffer *buffer;
+      size_t         header_len;
+      int64_t        revision;
+      bool           sync;
+      uint64_t       ticket;
+      boost::xtime   enqueue_time;
+    };
+
+    typedef std::deque<PendingCommit> PendingQueue;
+
+    int write_batch(PendingQueue &batch);
+
+    Mutex             m_mutex;
+    boost::condition  m_cond;
+    CommitLog        *m_log;
+    uint32_t          m_max_wait;
+    uint32_t          m_max_batch_bytes;
+    PendingQueue      m_pending;
+    size_t            m_pending_bytes;
+    uint64_t          m_next_ticket;
+    uint64_t          m_committed_ticket;
+    bool              m_flushing;
+    std::map<uint64_t, int> m_errors;
+
+    uint64_t          m_batches;
+    uint64_t          m_requests;
+    uint64_t          m_bytes;
+    uint64_t          m_max_batch;
+    uint64_t          m_latency;
+    uint64_t          m_max_latency;
+  };
+
+  typedef intrusive_ptr<GroupCommit> GroupCommitPtr;
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_GROUPCOMMIT_H
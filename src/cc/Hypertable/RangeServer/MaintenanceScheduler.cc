@@ -41,6 +41,16 @@ namespace {
       return x->priority > y->priority;
     }
   };
+
+  typedef std::pair<AccessGroup::MaintenanceData *, Range::MaintenanceData *>
+      GarbageCandidate;
+
+  struct GarbageDescending {
+    bool operator()(const GarbageCandidate &x,
+                    const GarbageCandidate &y) const {
+      return x.first->garbage_bytes > y.first->garbage_bytes;
+    }
+  };
 }
 
 
@@ -51,6 +61,10 @@ MaintenanceScheduler::MaintenanceScheduler(MaintenanceQueuePtr &queue,
     m_prioritizer_low_memory(m_stats) {
   m_prioritizer = &m_prioritizer_log_cleanup;
   m_maintenance_interval = get_i32("Hypertable.RangeServer.Maintenance.Interval");
+  m_garbage_threshold = get_f64("Hypertable.RangeServer.Maintenance"
+                                ".GarbageCompaction.Threshold");
+  m_garbage_budget = get_i64("Hypertable.RangeServer.Maintenance"
+                             ".GarbageCompaction.Budget");
 }
 
 
@@ -129,6 +143,9 @@ void MaintenanceScheduler::schedule() {
 
   m_prioritizer->prioritize(range_data, memory_needed, trace_str);
 
+  if (!low_memory_mode())
+    schedule_garbage_compactions(range_data, trace_str);
+
   boost::xtime schedule_time;
   boost::xtime_get(&schedule_time, boost::TIME_UTC);
 
@@ -179,3 +196,46 @@ void MaintenanceScheduler::schedule() {
   m_stats.start();
 }
 
+
+/**
+ * Picks the access groups with the most estimated garbage (delete records
+ * and expired cells) in their CellStores and marks them for a garbage
+ * collecting compaction.  Candidates are taken in order of garbage bytes
+ * for as long as the bytes they would rewrite fit in the budget of this
+ * scheduling round.  Ranges that already have maintenance scheduled are
+ * left alone.
+ */
+void
+MaintenanceScheduler::schedule_garbage_compactions(RangeStatsVector &range_data,
+                                                   String &trace_str) {
+  std::vector<GarbageCandidate> candidates;
+  AccessGroup::MaintenanceData *ag_data;
+  int64_t budget = m_garbage_budget;
+
+  for (size_t i=0; i<range_data.size(); i++) {
+    if (range_data[i]->busy || range_data[i]->priority > 0 ||
+        range_data[i]->state != RangeState::STEADY)
+      continue;
+    for (ag_data = range_data[i]->agdata; ag_data; ag_data = ag_data->next) {
+      if (ag_data->in_memory || ag_data->disk_used <= 0)
+        continue;
+      if ((double)ag_data->garbage_bytes >=
+          m_garbage_threshold * (double)ag_data->disk_used)
+        candidates.push_back(GarbageCandidate(ag_data, range_data[i]));
+    }
+  }
+
+  sort(candidates.begin(), candidates.end(), GarbageDescending());
+
+  foreach(GarbageCandidate &candidate, candidates) {
+    if (candidate.first->disk_used > budget)
+      continue;
+    budget -= candidate.first->disk_used;
+    candidate.first->ag->set_gc_compaction_bit();
+    candidate.second->needs_compaction = true;
+    candidate.second->priority = 1;
+    trace_str += String("STAT ") + candidate.first->ag->get_full_name()
+        + " garbage " + candidate.first->garbage_bytes + " of "
+        + candidate.first->disk_used + "\n";
+  }
+}
@@ -61,6 +61,9 @@ namespace Hypertable {
       return m_prioritizer == &m_prioritizer_low_memory;
     }
 
+    void schedule_garbage_compactions(RangeStatsVector &range_data,
+                                      String &trace_str);
+
     Mutex m_mutex;
     bool m_initialized;
     bool m_scheduling_needed;
@@ -72,6 +75,8 @@ namespace Hypertable {
     MaintenancePrioritizerLogCleanup m_prioritizer_log_cleanup;
     MaintenancePrioritizerLowMemory  m_prioritizer_low_memory;
     int32_t m_maintenance_interval;
+    double  m_garbage_threshold;
+    int64_t m_garbage_budget;
   };
 
   typedef intrusive_ptr<MaintenanceScheduler> MaintenanceSchedulerPtr;
@@ -33,7 +33,7 @@ using namespace Hypertable;
 
 MergeScanner::MergeScanner(ScanContextPtr &scan_ctx, bool return_deletes)
   : CellListScanner(scan_ctx), m_done(false), m_initialized(false),
-    m_scanners(), m_queue(), m_delete_present(false), m_deleted_row(0),
+    m_scanners(), m_delete_present(false), m_deleted_row(0),
     m_deleted_column_family(0), m_deleted_cell(0),
     m_return_deletes(return_deletes), m_row_count(0), m_row_limit(0),
     m_cell_count(0), m_cell_limit(0), m_cell_cutoff(0), m_prev_key(0) {
@@ -44,6 +44,7 @@ MergeScanner::MergeScanner(ScanContextPtr &scan_ctx, bool return_deletes)
   m_start_timestamp = scan_ctx->time_interval.first;
   m_end_timestamp = scan_ctx->time_interval.second;
   m_revision = scan_ctx->revision;
+  m_filter = scan_ctx->filter.get();
 }
 
 
@@ -56,8 +57,8 @@ MergeScanner::~MergeScanner() {
   try {
     for (size_t i=0; i<m_scanners.size(); i++)
       delete m_scanners[i];
-    if (m_release_callback)
-      m_release_callback();
+    for (size_t i=0; i<m_release_callbacks.size(); i++)
+      m_release_callbacks[i]();
   }
   catch (Hypertable::Exception &e) {
     HT_ERROR_OUT << "Problem destroying MergeScanner : " << e << HT_END;
@@ -65,90 +66,115 @@ MergeScanner::~MergeScanner() {
 }
 
 
+/**
+ * Plays the matches of the subtree rooted at node, recording the loser of
+ * each match in the node and returning the winner.  Nodes 1..k-1 are the
+ * internal nodes and node k+i is the leaf for slot i.
+ */
+int MergeScanner::build_tree(size_t node) {
+  if (node >= m_states.size())
+    return (int)(node - m_states.size());
+  int left = build_tree(2*node);
+  int right = build_tree(2*node + 1);
+  if (beats(left, right)) {
+    m_tree[node] = right;
+    return left;
+  }
+  m_tree[node] = left;
+  return right;
+}
+
+
+/**
+ * Replays the matches on the path from the leaf of the given slot to the
+ * root after the cell in that slot has changed.
+ */
+void MergeScanner::replay(int slot) {
+  int winner = slot;
+  for (size_t node = (slot + m_states.size()) / 2; node > 0; node /= 2) {
+    if (beats(m_tree[node], winner))
+      std::swap(m_tree[node], winner);
+  }
+  m_tree[0] = winner;
+}
+
+
 void MergeScanner::forward() {
-  ScannerState sstate;
-  Key key;
+  ScannerState *sstate;
   size_t len;
 
-  if (m_queue.empty())
+  if (top() == 0)
     return;
 
-  sstate = m_queue.top();
-
   /**
-   * Pop the top element, forward it, re-insert it back into the queue;
+   * Forward the scanner of the top element and replay its matches
    */
   while (true) {
     while (true) {
-      m_queue.pop();
-      sstate.scanner->forward();
-
-      if (sstate.scanner->get(sstate.key, sstate.value))
-        m_queue.push(sstate);
+      advance();
 
-      if (m_queue.empty())
+      if ((sstate = top()) == 0)
         return;
 
-      sstate = m_queue.top();
       m_cell_cutoff = m_scan_context_ptr->family_info[
-          sstate.key.column_family_code].cutoff_time;
+          sstate->key.column_family_code].cutoff_time;
 
-      if(sstate.key.timestamp < m_cell_cutoff )
+      if(sstate->key.timestamp < m_cell_cutoff )
         continue;
 
-      if (sstate.key.timestamp < m_start_timestamp && !m_return_deletes) {
+      if (sstate->key.timestamp < m_start_timestamp && !m_return_deletes) {
         continue;
       }
-      else if (sstate.key.revision > m_revision
-          || (sstate.key.timestamp >= m_end_timestamp && !m_return_deletes)) {
+      else if (sstate->key.revision > m_revision
+          || (sstate->key.timestamp >= m_end_timestamp && !m_return_deletes)) {
         continue;
       }
-      else if (sstate.key.flag == FLAG_DELETE_ROW) {
-        len = sstate.key.len_row();
-        if (matches_deleted_row(sstate.key)) {
-          if (m_deleted_row_timestamp < sstate.key.timestamp)
-            m_deleted_row_timestamp = sstate.key.timestamp;
+      else if (sstate->key.flag == FLAG_DELETE_ROW) {
+        len = sstate->key.len_row();
+        if (matches_deleted_row(sstate->key)) {
+          if (m_deleted_row_timestamp < sstate->key.timestamp)
+            m_deleted_row_timestamp = sstate->key.timestamp;
         }
         else {
           m_deleted_row.clear();
           m_deleted_row.ensure(len);
-          memcpy(m_deleted_row.base, sstate.key.row, len);
+          memcpy(m_deleted_row.base, sstate->key.row, len);
           m_deleted_row.ptr = m_deleted_row.base + len;
-          m_deleted_row_timestamp = sstate.key.timestamp;
+          m_deleted_row_timestamp = sstate->key.timestamp;
           m_delete_present = true;
         }
         if (m_return_deletes)
           break;
       }
-      else if (sstate.key.flag == FLAG_DELETE_COLUMN_FAMILY) {
-        len = sstate.key.len_column_family();
-        if (matches_deleted_column_family(sstate.key)) {
-          if (m_deleted_column_family_timestamp < sstate.key.timestamp)
-            m_deleted_column_family_timestamp = sstate.key.timestamp;
+      else if (sstate->key.flag == FLAG_DELETE_COLUMN_FAMILY) {
+        len = sstate->key.len_column_family();
+        if (matches_deleted_column_family(sstate->key)) {
+          if (m_deleted_column_family_timestamp < sstate->key.timestamp)
+            m_deleted_column_family_timestamp = sstate->key.timestamp;
         }
         else {
           m_deleted_column_family.clear();
           m_deleted_column_family.ensure(len);
-          memcpy(m_deleted_column_family.base, sstate.key.row, len);
+          memcpy(m_deleted_column_family.base, sstate->key.row, len);
           m_deleted_column_family.ptr = m_deleted_column_family.base + len;
-          m_deleted_column_family_timestamp = sstate.key.timestamp;
+          m_deleted_column_family_timestamp = sstate->key.timestamp;
           m_delete_present = true;
         }
         if (m_return_deletes)
           break;
       }
-      else if (sstate.key.flag == FLAG_DELETE_CELL) {
-        len = sstate.key.len_cell();
-        if (matches_deleted_cell(sstate.key)) {
-          if (m_deleted_cell_timestamp < sstate.key.timestamp)
-            m_deleted_cell_timestamp = sstate.key.timestamp;
+      else if (sstate->key.flag == FLAG_DELETE_CELL) {
+        len = sstate->key.len_cell();
+        if (matches_deleted_cell(sstate->key)) {
+          if (m_deleted_cell_timestamp < sstate->key.timestamp)
+            m_deleted_cell_timestamp = sstate->key.timestamp;
         }
         else {
           m_deleted_cell.clear();
           m_deleted_cell.ensure(len);
-          memcpy(m_deleted_cell.base, sstate.key.row, len);
+          memcpy(m_deleted_cell.base, sstate->key.row, len);
           m_deleted_cell.ptr = m_deleted_cell.base + len;
-          m_deleted_cell_timestamp = sstate.key.timestamp;
+          m_deleted_cell_timestamp = sstate->key.timestamp;
           m_delete_present = true;
         }
         if (m_return_deletes)
@@ -159,26 +185,26 @@ void MergeScanner::forward() {
         // revision intervals.
         if (m_delete_present) {
           if (m_deleted_cell.fill() > 0) {
-            if(!matches_deleted_cell(sstate.key))
+            if(!matches_deleted_cell(sstate->key))
               // we wont see the previously seen deleted cell again
               m_deleted_cell.clear();
-            else if (sstate.key.timestamp < m_deleted_cell_timestamp)
+            else if (sstate->key.timestamp < m_deleted_cell_timestamp)
               // apply previously seen delete cell to this cell
               continue;
           }
           if (m_deleted_column_family.fill() > 0) {
-            if(!matches_deleted_column_family(sstate.key))
+            if(!matches_deleted_column_family(sstate->key))
               // we wont see the previously seen deleted column family again
               m_deleted_column_family.clear();
-            else if (sstate.key.timestamp < m_deleted_column_family_timestamp)
+            else if (sstate->key.timestamp < m_deleted_column_family_timestamp)
               // apply previously seen delete column family to this cell
               continue;
           }
           if (m_deleted_row.fill() > 0) {
-            if(!matches_deleted_row(sstate.key))
+            if(!matches_deleted_row(sstate->key))
               // we wont see the previously seen deleted row family again
               m_deleted_row.clear();
-            else if (sstate.key.timestamp < m_deleted_row_timestamp)
+            else if (sstate->key.timestamp < m_deleted_row_timestamp)
               // apply previously seen delete row family to this cell
               continue;
           }
@@ -186,17 +212,20 @@ void MergeScanner::forward() {
               && m_deleted_row.fill() == 0)
             m_delete_present = false;
         }
+        // drop cells that fail the filter before they count as a version
+        if (m_filter && !m_filter->matches(sstate->key, sstate->value))
+          continue;
         break;
       }
     }
 
-    const uint8_t *prev_key = (const uint8_t *)sstate.key.row;
-    size_t prev_key_len = sstate.key.flag_ptr
-                          - (const uint8_t *)sstate.key.row + 1;
+    const uint8_t *prev_key = (const uint8_t *)sstate->key.row;
+    size_t prev_key_len = sstate->key.flag_ptr
+                          - (const uint8_t *)sstate->key.row + 1;
 
     if (m_prev_key.fill() != 0) {
       if (m_row_limit) {
-        if (strcmp(sstate.key.row, (const char *)m_prev_key.base)) {
+        if (strcmp(sstate->key.row, (const char *)m_prev_key.base)) {
           m_row_count++;
           if (!m_return_deletes && m_row_count >= m_row_limit) {
             m_done = true;
@@ -204,7 +233,7 @@ void MergeScanner::forward() {
           }
           m_prev_key.set(prev_key, prev_key_len);
           m_cell_limit = m_scan_context_ptr->family_info[
-              sstate.key.column_family_code].max_versions;
+              sstate->key.column_family_code].max_versions;
           m_cell_count = 0;
           return;
         }
@@ -222,7 +251,7 @@ void MergeScanner::forward() {
       else {
         m_prev_key.set(prev_key, prev_key_len);
         m_cell_limit = m_scan_context_ptr->family_info[
-            sstate.key.column_family_code].max_versions;
+            sstate->key.column_family_code].max_versions;
         m_cell_count = 0;
       }
 
@@ -230,7 +259,7 @@ void MergeScanner::forward() {
     else {
       m_prev_key.set(prev_key, prev_key_len);
       m_cell_limit = m_scan_context_ptr->family_info[
-          sstate.key.column_family_code].max_versions;
+          sstate->key.column_family_code].max_versions;
       m_cell_count = 0;
     }
     break;
@@ -238,99 +267,96 @@ void MergeScanner::forward() {
 }
 
 bool MergeScanner::get(Key &key, ByteString &value) {
+  ScannerState *sstate;
+
   if (!m_initialized)
     initialize();
 
-  if (!m_queue.empty() && !m_done) {
-    const ScannerState &sstate = m_queue.top();
+  if ((sstate = top()) != 0 && !m_done) {
     // check for row or cell limit
-    key = sstate.key;
-    value = sstate.value;
+    key = sstate->key;
+    value = sstate->value;
     return true;
   }
   return false;
 }
 
 void MergeScanner::initialize() {
-  ScannerState sstate;
-
-  while (!m_queue.empty())
-    m_queue.pop();
+  ScannerState *sstate;
 
+  m_states.resize(m_scanners.size());
   for (size_t i=0; i<m_scanners.size(); i++) {
-    if (m_scanners[i]->get(sstate.key, sstate.value)) {
-      sstate.scanner = m_scanners[i];
-      m_queue.push(sstate);
-    }
+    m_states[i].scanner = m_scanners[i];
+    m_states[i].valid = m_scanners[i]->get(m_states[i].key,
+                                           m_states[i].value);
   }
-  while (!m_queue.empty()) {
-    sstate = m_queue.top();
+
+  if (!m_states.empty()) {
+    m_tree.resize(m_states.size());
+    m_tree[0] = build_tree(1);
+  }
+
+  while ((sstate = top()) != 0) {
 
     m_cell_cutoff = m_scan_context_ptr->family_info[
-        sstate.key.column_family_code].cutoff_time;
-
-    if (sstate.key.timestamp < m_cell_cutoff
-        || (sstate.key.timestamp < m_start_timestamp && !m_return_deletes)) {
-      m_queue.pop();
-      sstate.scanner->forward();
-      if (sstate.scanner->get(sstate.key, sstate.value))
-        m_queue.push(sstate);
+        sstate->key.column_family_code].cutoff_time;
+
+    if (sstate->key.timestamp < m_cell_cutoff
+        || (sstate->key.timestamp < m_start_timestamp && !m_return_deletes)) {
+      advance();
       continue;
     }
 
-    if (sstate.key.flag == FLAG_DELETE_ROW) {
-      size_t len = sstate.key.len_row();
+    if (sstate->key.flag == FLAG_DELETE_ROW) {
+      size_t len = sstate->key.len_row();
       m_deleted_row.clear();
       m_deleted_row.ensure(len);
-      memcpy(m_deleted_row.base, sstate.key.row, len);
+      memcpy(m_deleted_row.base, sstate->key.row, len);
       m_deleted_row.ptr = m_deleted_row.base + len;
-      m_deleted_row_timestamp = sstate.key.timestamp;
+      m_deleted_row_timestamp = sstate->key.timestamp;
       m_delete_present = true;
       if (!m_return_deletes)
         forward();
     }
-    else if (sstate.key.flag == FLAG_DELETE_COLUMN_FAMILY) {
-      size_t len = sstate.key.len_column_family();
+    else if (sstate->key.flag == FLAG_DELETE_COLUMN_FAMILY) {
+      size_t len = sstate->key.len_column_family();
       m_deleted_column_family.clear();
       m_deleted_column_family.ensure(len);
-      memcpy(m_deleted_column_family.base, sstate.key.row, len);
+      memcpy(m_deleted_column_family.base, sstate->key.row, len);
       m_deleted_column_family.ptr = m_deleted_column_family.base + len;
-      m_deleted_column_family_timestamp = sstate.key.timestamp;
+      m_deleted_column_family_timestamp = sstate->key.timestamp;
       m_delete_present = true;
       if (!m_return_deletes)
         forward();
     }
-    else if (sstate.key.flag == FLAG_DELETE_CELL) {
-      size_t len = sstate.key.len_cell();
+    else if (sstate->key.flag == FLAG_DELETE_CELL) {
+      size_t len = sstate->key.len_cell();
       m_deleted_cell.clear();
       m_deleted_cell.ensure(len);
-      memcpy(m_deleted_cell.base, sstate.key.row, len);
+      memcpy(m_deleted_cell.base, sstate->key.row, len);
       m_deleted_cell.ptr = m_deleted_cell.base + len;
-      m_deleted_cell_timestamp = sstate.key.timestamp;
+      m_deleted_cell_timestamp = sstate->key.timestamp;
       m_delete_present = true;
       if (!m_return_deletes)
         forward();
     }
     else {
-      if (sstate.key.revision > m_revision
-          || (sstate.key.timestamp >= m_end_timestamp && !m_return_deletes)) {
-        m_queue.pop();
-        sstate.scanner->forward();
-        if (sstate.scanner->get(sstate.key, sstate.value))
-          m_queue.push(sstate);
+      if (sstate->key.revision > m_revision
+          || (sstate->key.timestamp >= m_end_timestamp && !m_return_deletes)
+          || (m_filter && !m_filter->matches(sstate->key, sstate->value))) {
+        advance();
         continue;
       }
       m_delete_present = false;
-      m_prev_key.set(sstate.key.row, sstate.key.flag_ptr
-                     - (const uint8_t *)sstate.key.row + 1);
+      m_prev_key.set(sstate->key.row, sstate->key.flag_ptr
+                     - (const uint8_t *)sstate->key.row + 1);
       m_cell_limit = m_scan_context_ptr->family_info[
-          sstate.key.column_family_code].max_versions;
+          sstate->key.column_family_code].max_versions;
       m_cell_cutoff = m_scan_context_ptr->family_info[
-          sstate.key.column_family_code].cutoff_time;
+          sstate->key.column_family_code].cutoff_time;
       m_cell_count = 0;
     }
     break;
   }
   m_initialized = true;
 }
-
@@ -22,7 +22,6 @@
 #ifndef HYPERTABLE_MERGESCANNER_H
 #define HYPERTABLE_MERGESCANNER_H
 
-#include <queue>
 #include <string>
 #include <vector>
 
@@ -35,18 +34,21 @@
 
 namespace Hypertable {
 
+  /**
+   * Merges the cells of several scanners into a single ordered stream,
+   * applying deletes, the time and revision bounds of the scan, the cell
+   * filter and the per-family TTL and version limits.  The scanners are merged with a
+   * loser tree: each scanner's current key lives in its own slot and the
+   * tree only holds slot indexes, so advancing the stream replays a single
+   * leaf-to-root path of comparisons without copying any keys.
+   */
   class MergeScanner : public CellListScanner {
   public:
     struct ScannerState {
       CellListScanner *scanner;
       Key key;
       ByteString value;
-    };
-
-    struct LtScannerState {
-      bool operator()(const ScannerState &ss1, const ScannerState &ss2) const {
-        return !(ss1.key.serial < ss2.key.serial);
-      }
+      bool valid;
     };
 
     MergeScanner(ScanContextPtr &scan_ctx, bool return_everything=true);
@@ -55,12 +57,50 @@ namespace Hypertable {
     virtual bool get(Key &key, ByteString &value);
     void add_scanner(CellListScanner *scanner);
 
+    /**
+     * Installs a callback to be run when the scanner is destroyed.  A scanner
+     * that merges the stores of several access groups holds one callback
+     * per access group.
+     */
     void install_release_callback(CellStoreReleaseCallback &cb) {
-      m_release_callback = cb;
+      m_release_callbacks.push_back(cb);
     }
 
   private:
     void initialize();
+
+    /** Returns true if the cell in slot i sorts before the cell in slot j */
+    inline bool beats(int i, int j) const {
+      const ScannerState &si = m_states[i];
+      const ScannerState &sj = m_states[j];
+      if (!si.valid)
+        return false;
+      if (!sj.valid)
+        return true;
+      if (si.key.serial < sj.key.serial)
+        return true;
+      if (sj.key.serial < si.key.serial)
+        return false;
+      return i < j;
+    }
+    int build_tree(size_t node);
+    void replay(int slot);
+
+    /** Returns the current minimum cell, or 0 once all scanners are done */
+    inline ScannerState *top() {
+      if (m_states.empty() || !m_states[m_tree[0]].valid)
+        return 0;
+      return &m_states[m_tree[0]];
+    }
+
+    /** Moves the scanner of the current minimum cell to its next cell */
+    inline void advance() {
+      ScannerState &sstate = m_states[m_tree[0]];
+      sstate.scanner->forward();
+      sstate.valid = sstate.scanner->get(sstate.key, sstate.value);
+      replay(m_tree[0]);
+    }
+
     inline bool matches_deleted_row(const Key& key) const {
       size_t len = key.len_row();
 
@@ -99,8 +139,8 @@ namespace Hypertable {
     bool          m_done;
     bool          m_initialized;
     std::vector<CellListScanner *>  m_scanners;
-    std::priority_queue<ScannerState, std::vector<ScannerState>,
-        LtScannerState> m_queue;
+    std::vector<ScannerState> m_states;
+    std::vector<int> m_tree;  // m_tree[0] is the winner, the rest losers
     bool          m_delete_present;
     DynamicBuffer m_deleted_row;
     int64_t       m_deleted_row_timestamp;
@@ -120,7 +160,8 @@ namespace Hypertable {
     int64_t       m_end_timestamp;
     int64_t       m_revision;
     DynamicBuffer m_prev_key;
-    CellStoreReleaseCallback m_release_callback;
+    ScanFilter   *m_filter;
+    std::vector<CellStoreReleaseCallback> m_release_callbacks;
   };
 
 } // namespace Hypertable
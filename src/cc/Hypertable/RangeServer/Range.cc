@@ -45,6 +45,7 @@ extern "C" {
 #include "MetadataNormal.h"
 #include "MetadataRoot.h"
 #include "Range.h"
+#include "SelectSplitRow.h"
 
 using namespace Hypertable;
 using namespace std;
@@ -53,10 +54,11 @@ using namespace std;
 Range::Range(MasterClientPtr &master_client,
              const TableIdentifier *identifier, SchemaPtr &schema,
              const RangeSpec *range, RangeSet *range_set,
-             const RangeState *state)
+             const RangeState *state, Metadata *metadata)
     : m_bytes_read(0), m_bytes_written(0), m_master_client(master_client),
       m_identifier(*identifier), m_schema(schema), m_revision(TIMESTAMP_MIN),
-      m_latest_revision(TIMESTAMP_MIN), m_split_off_high(false),
+      m_latest_revision(TIMESTAMP_MIN), m_split_low_bytes(0),
+      m_split_high_bytes(0), m_split_off_high(false),
       m_added_inserts(0), m_range_set(range_set), m_state(*state),
       m_error(Error::OK), m_dropped(false), m_capacity_exceeded_throttle(false),
       m_maintenance_generation(0) {
@@ -106,13 +108,15 @@ Range::Range(MasterClientPtr &master_client,
       m_column_family_vector[scf->id] = ag;
   }
 
-  if (m_is_root) {
-    MetadataRoot metadata(m_schema);
-    load_cell_stores(&metadata);
+  if (metadata)
+    load_cell_stores(metadata);
+  else if (m_is_root) {
+    MetadataRoot root_metadata(m_schema);
+    load_cell_stores(&root_metadata);
   }
   else {
-    MetadataNormal metadata(&m_identifier, m_end_row);
-    load_cell_stores(&metadata);
+    MetadataNormal normal_metadata(&m_identifier, m_end_row);
+    load_cell_stores(&normal_metadata);
   }
 
   HT_DEBUG_OUT << "Range object for " << m_name << " constructed\n"
@@ -307,7 +311,7 @@ CellListScanner *Range::create_scanner(ScanContextPtr &scan_ctx) {
   try {
     for (size_t i=0; i<ag_vector.size(); ++i) {
       if (ag_vector[i]->include_in_scan(scan_ctx))
-        mscanner->add_scanner(ag_vector[i]->create_scanner(scan_ctx));
+        ag_vector[i]->add_scanners(mscanner, scan_ctx);
     }
   }
   catch (Exception &e) {
@@ -319,6 +323,46 @@ CellListScanner *Range::create_scanner(ScanContextPtr &scan_ctx) {
 }
 
 
+void
+Range::create_scanners(std::vector<ScanContextPtr> &scan_ctxs,
+                       std::vector<CellListScannerPtr> &scanners) {
+  std::vector<MergeScanner *> mscanners;
+  AccessGroupVector  ag_vector(0);
+
+  if (scan_ctxs.empty())
+    return;
+
+  {
+    ScopedLock lock(m_schema_mutex);
+    ag_vector = m_access_group_vector;
+  }
+
+  mscanners.reserve(scan_ctxs.size());
+  for (size_t r=0; r<scan_ctxs.size(); ++r) {
+    bool return_deletes = scan_ctxs[r]->spec ?
+        scan_ctxs[r]->spec->return_deletes : false;
+    mscanners.push_back(new MergeScanner(scan_ctxs[r], return_deletes));
+  }
+
+  try {
+    for (size_t i=0; i<ag_vector.size(); ++i) {
+      // all contexts of a batch select the same column families
+      if (ag_vector[i]->include_in_scan(scan_ctxs[0]))
+        ag_vector[i]->add_scanners(mscanners, scan_ctxs);
+    }
+  }
+  catch (Exception &e) {
+    for (size_t r=0; r<mscanners.size(); ++r)
+      delete mscanners[r];
+    HT_THROW2(e.code(), e, "");
+  }
+
+  scanners.reserve(scanners.size() + mscanners.size());
+  for (size_t r=0; r<mscanners.size(); ++r)
+    scanners.push_back(mscanners[r]);
+}
+
+
 uint64_t Range::disk_usage() {
   ScopedLock lock(m_schema_mutex);
   uint64_t usage = 0;
@@ -379,6 +423,8 @@ Range::MaintenanceData *Range::get_maintenance_data(ByteArena &arena) {
     starting_maintenance_generation = m_maintenance_generation;
     mdata->bytes_read = m_bytes_read;
     mdata->bytes_written = m_bytes_written;
+    mdata->split_low_bytes = m_split_low_bytes;
+    mdata->split_high_bytes = m_split_high_bytes;
     mdata->state = m_state.state;
   }
 
@@ -448,6 +494,45 @@ void Range::split() {
 
 
 
+/**
+ * Picks the sample row whose cumulative byte count is closest to half of
+ * the range (see SelectSplitRow()) and records the resulting balance.
+ */
+bool Range::select_weighted_split_row(AccessGroupVector &ag_vector) {
+  std::vector<SplitSample> samples;
+  String start_row, end_row, split_row;
+  int64_t low_bytes, high_bytes, total;
+
+  for (size_t i=0; i<ag_vector.size(); i++)
+    ag_vector[i]->get_split_samples(samples);
+
+  {
+    ScopedLock lock(m_mutex);
+    start_row = m_start_row;
+    end_row = m_end_row;
+  }
+
+  if (!SelectSplitRow(samples, start_row, end_row, split_row, &low_bytes,
+                      &high_bytes))
+    return false;
+
+  {
+    ScopedLock lock(m_mutex);
+    m_split_row = split_row;
+    m_split_low_bytes = low_bytes;
+    m_split_high_bytes = high_bytes;
+  }
+
+  total = low_bytes + high_bytes;
+  HT_INFOF("Split row '%s' for range %s divides %lld bytes (%d samples) "
+           "into %lld/%lld (%.1f%% low)", split_row.c_str(), m_name.c_str(),
+           (Lld)total, (int)samples.size(), (Lld)low_bytes, (Lld)high_bytes,
+           100.0 * (double)low_bytes / total);
+
+  return true;
+}
+
+
 /**
  */
 void Range::split_install_log() {
@@ -463,63 +548,72 @@ void Range::split_install_log() {
   if (cancel_maintenance())
     HT_THROW(Error::CANCELLED, "");
 
-  for (size_t i=0; i<ag_vector.size(); i++)
-    ag_vector[i]->get_split_rows(split_rows, false);
-
   /**
-   * If we didn't get at least one row from each Access Group, then try again
-   * the hard way (scans CellCache for middle row)
+   * Split where the bytes of the range divide evenly, using the block
+   * indexes of the cell stores and the cell caches.  Fall back to the
+   * median of the sampled split rows if no sample row lies inside the range.
    */
-  if (split_rows.size() < ag_vector.size()) {
-    for (size_t i=0; i<ag_vector.size(); i++)
-      ag_vector[i]->get_split_rows(split_rows, true);
-  }
-  sort(split_rows.begin(), split_rows.end());
+  if (!select_weighted_split_row(ag_vector)) {
 
-  /**
-  cout << flush;
-  cout << "thelma Dumping split rows for " << m_name << "\n";
-  for (size_t i=0; i<split_rows.size(); i++)
-    cout << "thelma Range::get_split_row [" << i << "] = " << split_rows[i]
-         << "\n";
-  cout << flush;
-  */
+    for (size_t i=0; i<ag_vector.size(); i++)
+      ag_vector[i]->get_split_rows(split_rows, false);
 
-  /**
-   * If we still didn't get a good split row, try again the *really* hard way
-   * by collecting all of the cached rows, sorting them and then taking the
-   * middle.
-   */
-  if (split_rows.size() > 0) {
-    ScopedLock lock(m_mutex);
-    m_split_row = split_rows[split_rows.size()/2];
-    if (m_split_row < m_start_row || m_split_row >= m_end_row) {
-      split_rows.clear();
+    /**
+     * If we didn't get at least one row from each Access Group, then try again
+     * the hard way (scans CellCache for middle row)
+     */
+    if (split_rows.size() < ag_vector.size()) {
       for (size_t i=0; i<ag_vector.size(); i++)
-        ag_vector[i]->get_cached_rows(split_rows);
-      if (split_rows.size() > 0) {
-        sort(split_rows.begin(), split_rows.end());
-        m_split_row = split_rows[split_rows.size()/2];
-        if (m_split_row < m_start_row || m_split_row >= m_end_row) {
+        ag_vector[i]->get_split_rows(split_rows, true);
+    }
+    sort(split_rows.begin(), split_rows.end());
+
+    /**
+    cout << flush;
+    cout << "thelma Dumping split rows for " << m_name << "\n";
+    for (size_t i=0; i<split_rows.size(); i++)
+      cout << "thelma Range::get_split_row [" << i << "] = " << split_rows[i]
+           << "\n";
+    cout << flush;
+    */
+
+    /**
+     * If we still didn't get a good split row, try again the *really* hard way
+     * by collecting all of the cached rows, sorting them and then taking the
+     * middle.
+     */
+    if (split_rows.size() > 0) {
+      ScopedLock lock(m_mutex);
+      m_split_row = split_rows[split_rows.size()/2];
+      if (m_split_row < m_start_row || m_split_row >= m_end_row) {
+        split_rows.clear();
+        for (size_t i=0; i<ag_vector.size(); i++)
+          ag_vector[i]->get_cached_rows(split_rows);
+        if (split_rows.size() > 0) {
+          sort(split_rows.begin(), split_rows.end());
+          m_split_row = split_rows[split_rows.size()/2];
+          if (m_split_row < m_start_row || m_split_row >= m_end_row) {
+            m_error = Error::RANGESERVER_ROW_OVERFLOW;
+            HT_THROWF(Error::RANGESERVER_ROW_OVERFLOW,
+                      "(a) Unable to determine split row for range %s[%s..%s]",
+                      m_identifier.name, m_start_row.c_str(),
+                      m_end_row.c_str());
+          }
+        }
+        else {
           m_error = Error::RANGESERVER_ROW_OVERFLOW;
           HT_THROWF(Error::RANGESERVER_ROW_OVERFLOW,
-                    "(a) Unable to determine split row for range %s[%s..%s]",
-                    m_identifier.name, m_start_row.c_str(), m_end_row.c_str());
+                    "(b) Unable to determine split row for range %s[%s..%s]",
+                     m_identifier.name, m_start_row.c_str(), m_end_row.c_str());
         }
       }
-      else {
-        m_error = Error::RANGESERVER_ROW_OVERFLOW;
-        HT_THROWF(Error::RANGESERVER_ROW_OVERFLOW,
-                  "(b) Unable to determine split row for range %s[%s..%s]",
-                   m_identifier.name, m_start_row.c_str(), m_end_row.c_str());
-      }
     }
-  }
-  else {
-    m_error = Error::RANGESERVER_ROW_OVERFLOW;
-    HT_THROWF(Error::RANGESERVER_ROW_OVERFLOW,
-              "(c) Unable to determine split row for range %s[%s..%s]",
-              m_identifier.name, m_start_row.c_str(), m_end_row.c_str());
+    else {
+      m_error = Error::RANGESERVER_ROW_OVERFLOW;
+      HT_THROWF(Error::RANGESERVER_ROW_OVERFLOW,
+                "(c) Unable to determine split row for range %s[%s..%s]",
+                m_identifier.name, m_start_row.c_str(), m_end_row.c_str());
+    }
   }
 
   m_state.set_split_point(m_split_row);
@@ -868,7 +962,8 @@ void Range::run_compaction(bool major) {
     Barrier::ScopedActivator block_updates(m_update_barrier);
     ScopedLock lock(m_mutex);
     for (size_t i=0; i<ag_vector.size(); i++) {
-      if (major || ag_vector[i]->needs_compaction())
+      if (major || ag_vector[i]->needs_compaction() ||
+          ag_vector[i]->needs_gc_compaction())
         ag_vector[i]->initiate_compaction();
     }
   }
@@ -879,6 +974,83 @@ void Range::run_compaction(bool major) {
 }
 
 
+void Range::load_cell_stores(const std::vector<String> &access_groups,
+                             const std::vector<String> &files,
+                             int64_t max_revision) {
+  RangeMaintenanceGuard::Activator activator(m_maintenance_guard);
+  std::vector<AccessGroup *> ags;
+  std::vector<CellStorePtr> stores;
+  std::vector<int64_t> revisions;
+  AccessGroupVector ag_vector(0);
+  AccessGroupMap::iterator ag_iter;
+
+  HT_ASSERT(access_groups.size() == files.size());
+
+  {
+    ScopedLock lock(m_schema_mutex);
+    ag_vector = m_access_group_vector;
+    for (size_t i=0; i<access_groups.size(); i++) {
+      if ((ag_iter = m_access_group_map.find(access_groups[i]))
+          == m_access_group_map.end())
+        HT_THROWF(Error::RANGESERVER_INVALID_COLUMNFAMILY,
+                  "Unknown access group '%s' in range %s",
+                  access_groups[i].c_str(), m_name.c_str());
+      if (ag_iter->second->in_memory())
+        HT_THROWF(Error::NOT_IMPLEMENTED, "Can't load CellStores into "
+                  "in-memory access group %s", ag_iter->second->get_full_name());
+      ags.push_back(ag_iter->second);
+    }
+  }
+
+  for (size_t i=0; i<files.size(); i++) {
+    HT_INFOF("Loading CellStore %s into %s", files[i].c_str(), m_name.c_str());
+    stores.push_back(CellStoreFactory::open(files[i], m_start_row.c_str(),
+                                            m_end_row.c_str()));
+    revisions.push_back(boost::any_cast<int64_t>
+                        (stores.back()->get_trailer()->get("revision")));
+    if (revisions.back() > max_revision)
+      HT_THROWF(Error::RANGESERVER_CLOCK_SKEW, "Revision %lld of CellStore "
+                "%s is ahead of the maximum (%lld) range=%s",
+                (Lld)revisions.back(), files[i].c_str(), (Lld)max_revision,
+                m_name.c_str());
+  }
+
+  /**
+   * Updates are held off until the stores are installed and the latest
+   * revision of the range is raised past theirs.  The cached updates of the
+   * target access groups are written out first, and updates that arrive
+   * afterwards are assigned revisions above those of the loaded stores, so
+   * none of them are skipped when the commit log is replayed.
+   */
+  {
+    Barrier::ScopedActivator block_updates(m_update_barrier);
+
+    {
+      ScopedLock lock(m_mutex);
+      foreach(AccessGroup *ag, ags)
+        if (!ag->compaction_initiated())
+          ag->initiate_compaction();
+    }
+
+    foreach(AccessGroupPtr &ag, ag_vector)
+      if (ag->compaction_initiated())
+        ag->run_compaction(false);
+
+    for (size_t i=0; i<stores.size(); i++) {
+      ags[i]->load_cell_store(stores[i]);
+      ScopedLock lock(m_mutex);
+      if (revisions[i] > m_latest_revision)
+        m_latest_revision = revisions[i];
+    }
+  }
+
+  {
+    ScopedLock lock(m_mutex);
+    m_maintenance_generation++;
+  }
+}
+
+
 void Range::purge_index_data(int64_t scanner_generation) {
   RangeMaintenanceGuard::Activator activator(m_maintenance_guard);
   AccessGroupVector  ag_vector(0);
@@ -67,6 +67,8 @@ namespace Hypertable {
       uint64_t bytes_written;
       int64_t  purgeable_index_memory;
       int64_t  compact_memory;
+      int64_t  split_low_bytes;   // bytes on each side of the last split
+      int64_t  split_high_bytes;
       uint32_t table_id;
       int32_t  priority;
       int16_t  state;
@@ -78,8 +80,16 @@ namespace Hypertable {
     typedef std::map<String, AccessGroup *> AccessGroupMap;
     typedef std::vector<AccessGroupPtr>  AccessGroupVector;
 
+    /**
+     * Constructs a range and loads its cell stores.  The cell store files
+     * are read from the METADATA entry of the range (or from Hyperspace for
+     * the root range), unless another source is given.
+     *
+     * @param metadata source of the cell store files, 0 for the default
+     */
     Range(MasterClientPtr &, const TableIdentifier *, SchemaPtr &,
-          const RangeSpec *, RangeSet *, const RangeState *);
+          const RangeSpec *, RangeSet *, const RangeState *,
+          Metadata *metadata = 0);
     virtual ~Range() {}
     virtual void add(const Key &key, const ByteString value);
     virtual const char *get_split_row() { return 0; }
@@ -99,6 +109,17 @@ namespace Hypertable {
 
     CellListScanner *create_scanner(ScanContextPtr &scan_ctx);
 
+    /**
+     * Creates one scanner per single row scan context, building the access
+     * group scanners of the whole batch together (see
+     * AccessGroup::add_scanners).
+     *
+     * @param scan_ctxs single row scan contexts sharing the same columns
+     * @param scanners receives the scanner of each row
+     */
+    void create_scanners(std::vector<ScanContextPtr> &scan_ctxs,
+                         std::vector<CellListScannerPtr> &scanners);
+
     String start_row() {
       ScopedLock lock(m_mutex);
       return m_start_row;
@@ -134,6 +155,23 @@ namespace Hypertable {
 
     void purge_index_data(int64_t scanner_generation);
 
+    /**
+     * Adds CellStore files written outside of the RangeServer (by a bulk
+     * load) to the range and records them in the 'Files' column of
+     * METADATA.  All of the files are opened, and their revisions checked,
+     * before any are installed.  Updates to the range are held off until
+     * the files are installed.
+     *
+     * @param access_groups access group of each file
+     * @param files CellStore files to add
+     * @param max_revision newest revision a file may carry; files written
+     *        by a client whose clock runs ahead of the server's are rejected
+     *        with Error::RANGESERVER_CLOCK_SKEW
+     */
+    void load_cell_stores(const std::vector<String> &access_groups,
+                          const std::vector<String> &files,
+                          int64_t max_revision);
+
     void recovery_initialize() {
       ScopedLock lock(m_mutex);
       for (size_t i=0; i<m_access_group_vector.size(); i++)
@@ -230,6 +268,7 @@ namespace Hypertable {
     bool cancel_maintenance();
 
     void split_install_log();
+    bool select_weighted_split_row(AccessGroupVector &ag_vector);
     void split_compact_and_shrink();
     void split_notify_master();
 
@@ -252,6 +291,8 @@ namespace Hypertable {
     int64_t          m_revision;
     int64_t          m_latest_revision;
     String           m_split_row;
+    int64_t          m_split_low_bytes;
+    int64_t          m_split_high_bytes;
     CommitLogPtr     m_split_log;
     bool             m_split_off_high;
     Barrier          m_update_barrier;
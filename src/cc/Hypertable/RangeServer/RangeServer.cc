@@ -49,6 +49,7 @@ extern "C" {
 
 #include "DfsBroker/Lib/Client.h"
 
+#include "CommitLogReplayer.h"
 #include "FillScanBlock.h"
 #include "Global.h"
 #include "HandlerFactory.h"
@@ -68,8 +69,9 @@ using namespace Hypertable::Property;
 RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
     ApplicationQueuePtr &app_queue, Hyperspace::SessionPtr &hyperspace)
   : m_root_replay_finished(false), m_metadata_replay_finished(false),
-    m_replay_finished(false), m_props(props), m_verbose(false),
-    m_conn_manager(conn_mgr), m_app_queue(app_queue), m_hyperspace(hyperspace) {
+    m_replay_finished(false), m_update_sequence(0), m_update_applied(0),
+    m_props(props), m_verbose(false), m_conn_manager(conn_mgr),
+    m_app_queue(app_queue), m_hyperspace(hyperspace) {
 
   uint16_t port;
   uint32_t maintenance_threads = std::min(2, System::cpu_info().total_cores);
@@ -86,6 +88,7 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   maintenance_threads = cfg.get_i32("MaintenanceThreads", maintenance_threads);
   port = cfg.get_i16("Port");
   m_scanner_ttl = (time_t)cfg.get_i32("Scanner.Ttl");
+  m_scan_block_size_max = cfg.get_i32("Scanner.BlockSize.Max");
 
   if (Global::access_group_merge_files > Global::access_group_max_files)
     Global::access_group_merge_files = Global::access_group_max_files;
@@ -96,6 +99,9 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
     m_scanner_ttl = (time_t)10000;
   }
 
+  if (m_scan_block_size_max < DATA_TRANSFER_BLOCKSIZE)
+    m_scan_block_size_max = DATA_TRANSFER_BLOCKSIZE;
+
   if (cfg.has("MemoryLimit"))
     Global::memory_limit = cfg.get_i64("MemoryLimit");
   else {
@@ -108,10 +114,20 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   m_update_delay = cfg.get_i32("UpdateDelay", 0);
 
   uint64_t block_cacheMemory = cfg.get_i64("BlockCache.MaxMemory");
-  Global::block_cache = new FileBlockCache(block_cacheMemory);
+  Global::block_cache = new FileBlockCache(block_cacheMemory,
+                                           cfg.get_i32("BlockCache.Shards"));
 
   Global::memory_tracker.add(block_cacheMemory);
 
+  uint64_t compressed_cache_memory =
+      cfg.get_i64("BlockCache.Compressed.MaxMemory");
+  if (compressed_cache_memory) {
+    Global::compressed_block_cache =
+        new FileBlockCache(compressed_cache_memory,
+                           cfg.get_i32("BlockCache.Shards"));
+    Global::memory_tracker.add(compressed_cache_memory);
+  }
+
   Global::protocol = new Hypertable::RangeServerProtocol();
 
   DfsBroker::Client *dfsclient = new DfsBroker::Client(conn_mgr, props);
@@ -129,6 +145,14 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
 
   m_log_roll_limit = cfg.get_i64("CommitLog.RollLimit");
 
+  m_group_commit_max_wait = cfg.get_i32("CommitLog.GroupCommit.MaxWait");
+  m_group_commit_max_batch_bytes =
+      cfg.get_i32("CommitLog.GroupCommit.MaxBatchBytes");
+  m_replay_decompress_threads =
+      cfg.get_i32("CommitLog.Replay.DecompressThreads");
+  m_replay_apply_threads = cfg.get_i32("CommitLog.Replay.ApplyThreads");
+  m_replay_buffer_limit = cfg.get_i64("CommitLog.Replay.BufferSize");
+
   m_dropped_table_id_cache = new TableIdCache(50);
 
   /**
@@ -159,6 +183,11 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   // Create the maintenance queue
   Global::maintenance_queue = new MaintenanceQueue(maintenance_threads);
 
+  // Create the queue that compresses CellStore blocks for compactions
+  int32_t compression_threads = cfg.get_i32("CellStore.CompressionThreads");
+  if (compression_threads > 0)
+    Global::compression_queue = new ApplicationQueue(compression_threads);
+
   // Create table info maps
   m_live_map = new TableInfoMap();
   m_replay_map = new TableInfoMap();
@@ -219,6 +248,7 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
 
 RangeServer::~RangeServer() {
   delete Global::block_cache;
+  delete Global::compressed_block_cache;
   delete Global::protocol;
   m_hyperspace = 0;
   delete Global::dfs;
@@ -430,6 +460,8 @@ void RangeServer::local_recover() {
         ScopedLock lock(m_mutex);
         Global::user_log = new CommitLog(Global::log_dfs, Global::log_dir
             + "/user", m_props, user_log_reader.get());
+        m_group_commit = new GroupCommit(Global::user_log,
+            m_group_commit_max_wait, m_group_commit_max_batch_bytes);
         Global::range_log = new RangeServerMetaLog(Global::log_dfs,
                                                    meta_log_dir);
         m_replay_finished = true;
@@ -454,6 +486,8 @@ void RangeServer::local_recover() {
 
       Global::user_log = new CommitLog(Global::log_dfs, Global::log_dir
           + "/user", m_props, user_log_reader.get());
+      m_group_commit = new GroupCommit(Global::user_log,
+          m_group_commit_max_wait, m_group_commit_max_batch_bytes);
 
       Global::range_log = new RangeServerMetaLog(Global::log_dfs,
                                                  meta_log_dir);
@@ -476,76 +510,9 @@ void RangeServer::local_recover() {
 
 
 void RangeServer::replay_log(CommitLogReaderPtr &log_reader) {
-  BlockCompressionHeaderCommitLog header;
-  uint8_t *base;
-  size_t len;
-  TableIdentifier table_id;
-  DynamicBuffer dbuf;
-  const uint8_t *ptr, *end;
-  int64_t revision;
-  TableInfoPtr table_info;
-  RangePtr range;
-  SerializedKey key;
-  ByteString value;
-  uint32_t block_count = 0;
-  String start_row, end_row;
-
-  while (log_reader->next((const uint8_t **)&base, &len, &header)) {
-
-    revision = header.get_revision();
-
-    ptr = base;
-    end = base + len;
-
-    table_id.decode(&ptr, &len);
-
-    // Fetch table info
-    if (!m_replay_map->get(table_id.id, table_info))
-      continue;
-
-    dbuf.ensure(table_id.encoded_length() + 12 + len);
-    dbuf.clear();
-
-    dbuf.ptr += 4;  // skip size
-    encode_i64(&dbuf.ptr, revision);
-    table_id.encode(&dbuf.ptr);
-    base = dbuf.ptr;
-
-    while (ptr < end) {
-
-      // extract the key
-      key.ptr = ptr;
-      ptr += key.length();
-      if (ptr > end)
-        HT_THROW(Error::REQUEST_TRUNCATED, "Problem decoding key");
-
-      // extract the value
-      value.ptr = ptr;
-      ptr += value.length();
-      if (ptr > end)
-        HT_THROW(Error::REQUEST_TRUNCATED, "Problem decoding value");
-
-      // Look for containing range, add to stop mods if not found
-      if (!table_info->find_containing_range(key.row(), range,
-                                             start_row, end_row))
-        continue;
-
-      // add key/value pair to buffer
-      memcpy(dbuf.ptr, key.ptr, ptr-key.ptr);
-      dbuf.ptr += ptr-key.ptr;
-
-    }
-
-    uint32_t block_size = dbuf.ptr - base;
-    base = dbuf.base;
-    encode_i32(&base, block_size);
-
-    replay_update(0, dbuf.base, dbuf.fill());
-    block_count++;
-  }
-
-  HT_INFOF("Replayed %u blocks of updates from '%s'", block_count,
-           log_reader->get_log_dir().c_str());
+  CommitLogReplayer replayer(m_replay_map, m_replay_decompress_threads,
+                             m_replay_apply_threads, m_replay_buffer_limit);
+  replayer.replay(log_reader);
 }
 
 
@@ -672,12 +639,22 @@ RangeServer::create_scanner(ResponseCallbackCreateScanner *cb,
     decrement_needed = false;
 
     size_t count;
-    more = FillScanBlock(scanner, rbuf, &count);
+    uint32_t block_size = scan_spec->block_size;
+    if (block_size == 0)
+      block_size = DATA_TRANSFER_BLOCKSIZE;
+    else if (block_size > m_scan_block_size_max)
+      block_size = m_scan_block_size_max;
+
+    more = FillScanBlock(scanner, rbuf, &count, block_size);
 
-    id = (more) ? Global::scanner_map.put(scanner, range, table) : 0;
+    Global::scanner_map.record_block(block_size, rbuf.fill());
+
+    id = (more) ? Global::scanner_map.put(scanner, range, table,
+                      next_scan_block_size(block_size)) : 0;
 
     HT_DEBUGF("Successfully created scanner (id=%u) on table '%s', returning "
-              "%d k/v pairs", id, table->name, (int)count);
+              "%d k/v pairs (block_size=%u)", id, table->name, (int)count,
+              block_size);
 
     /**
      *  Send back data
@@ -704,6 +681,154 @@ RangeServer::create_scanner(ResponseCallbackCreateScanner *cb,
 }
 
 
+/**
+ * Looks up a sorted batch of rows of one range.  The request is a scan
+ * specification holding one single row interval per row; the cells found
+ * are returned in a single block laid out like a "create scanner"
+ * response, with no scanner left behind on the server.  The block is
+ * capped like a scanner block, but only ever ends between rows: if the cap
+ * is reached before the last row, the end-of-scan flag is left clear and
+ * the scanner id field holds the number of leading rows returned, so the
+ * client can ask again for the rest.
+ */
+void
+RangeServer::get_rows(ResponseCallbackCreateScanner *cb,
+    const TableIdentifier *table, const RangeSpec *range_spec,
+    const ScanSpec *scan_spec) {
+  int error = Error::OK;
+  TableInfoPtr table_info;
+  RangePtr range;
+  SchemaPtr schema;
+  size_t count = 0;
+  size_t rows_done = 0;
+  bool decrement_needed = false;
+
+  HT_DEBUG_OUT <<"Getting rows:\n"<< *table << *range_spec
+               << *scan_spec << HT_END;
+
+  if (!m_replay_finished)
+    wait_for_recovery_finish(table, range_spec);
+
+  try {
+    DynamicBuffer rbuf;
+    size_t nrows = scan_spec->row_intervals.size();
+    std::vector<ScanSpec> row_specs(nrows);
+    std::vector<ScanContextPtr> scan_ctxs;
+    std::vector<CellListScannerPtr> scanners;
+    Key key;
+    ByteString value;
+    size_t value_len;
+
+    if (scan_spec->cell_intervals.size() > 0)
+      HT_THROW(Error::RANGESERVER_BAD_SCAN_SPEC,
+               "cell intervals not allowed in get rows request");
+
+    for (size_t i=0; i<nrows; ++i) {
+      const RowInterval &ri = scan_spec->row_intervals[i];
+      if (!ri.start_inclusive || !ri.end_inclusive ||
+          strcmp(ri.start, ri.end))
+        HT_THROWF(Error::RANGESERVER_BAD_SCAN_SPEC,
+                  "row interval %d does not name a single row", (int)i);
+      if (i > 0 && strcmp(scan_spec->row_intervals[i-1].start, ri.start) >= 0)
+        HT_THROW(Error::RANGESERVER_BAD_SCAN_SPEC,
+                 "rows not sorted in get rows request");
+      if (strcmp(ri.start, range_spec->start_row) <= 0 ||
+          strcmp(ri.start, range_spec->end_row) > 0)
+        HT_THROWF(Error::RANGESERVER_OUT_OF_RANGE, "row '%s' not in %s[%s..%s]",
+                  ri.start, table->name, range_spec->start_row,
+                  range_spec->end_row);
+    }
+
+    m_live_map->get(table, table_info);
+
+    if (!table_info->get_range(range_spec, range))
+      HT_THROWF(Error::RANGESERVER_RANGE_NOT_FOUND, "(a) %s[%s..%s]",
+                table->name, range_spec->start_row, range_spec->end_row);
+
+    schema = table_info->get_schema();
+
+    // verify schema
+    if (schema->get_generation() != table->generation) {
+      HT_THROW(Error::RANGESERVER_GENERATION_MISMATCH,
+               (String)"RangeServer Schema generation for table '"
+               + table_info->get_name() + "' is " +
+               schema->get_generation() + " but supplied is "
+               + table->generation);
+    }
+
+    range->increment_scan_counter();
+    decrement_needed = true;
+
+    // Check to see if range just shrunk
+    if (strcmp(range->start_row().c_str(), range_spec->start_row) ||
+        strcmp(range->end_row().c_str(), range_spec->end_row))
+      HT_THROWF(Error::RANGESERVER_RANGE_NOT_FOUND, "(b) %s[%s..%s]",
+                table->name, range_spec->start_row, range_spec->end_row);
+
+    int64_t revision = range->get_scan_revision();
+    scan_ctxs.reserve(nrows);
+    for (size_t i=0; i<nrows; ++i) {
+      scan_spec->base_copy(row_specs[i]);
+      row_specs[i].row_intervals.push_back(scan_spec->row_intervals[i]);
+      scan_ctxs.push_back(new ScanContext(revision, &row_specs[i],
+                                          range_spec, schema));
+    }
+
+    range->create_scanners(scan_ctxs, scanners);
+
+    range->decrement_scan_counter();
+    decrement_needed = false;
+
+    uint32_t block_size = scan_spec->block_size;
+    if (block_size == 0)
+      block_size = DATA_TRANSFER_BLOCKSIZE;
+    else if (block_size > m_scan_block_size_max)
+      block_size = m_scan_block_size_max;
+
+    // skip encoded length
+    rbuf.reserve(block_size + 4);
+    rbuf.ptr = rbuf.base + 4;
+
+    while (rows_done < scanners.size() && rbuf.fill() - 4 < block_size) {
+      CellListScannerPtr &scanner = scanners[rows_done++];
+      while (scanner->get(key, value)) {
+        value_len = value.length();
+        rbuf.ensure(key.length + value_len);
+        rbuf.add_unchecked(key.serial.ptr, key.length);
+        rbuf.add_unchecked(value.ptr, value_len);
+        scanner->forward();
+        count++;
+      }
+    }
+
+    uint8_t *ptr = rbuf.base;
+    Serialization::encode_i32(&ptr, rbuf.fill() - 4);
+
+    HT_DEBUGF("Looked up %d of %d rows on table '%s', returning %d k/v pairs",
+              (int)rows_done, (int)nrows, table->name, (int)count);
+
+    {
+      short moreflag = (rows_done < nrows) ? 0 : 1;
+      StaticBuffer ext(rbuf);
+      if ((error = cb->response(moreflag, rows_done, ext)) != Error::OK) {
+        HT_ERRORF("Problem sending OK response - %s", Error::get_text(error));
+      }
+    }
+  }
+  catch (Hypertable::Exception &e) {
+    int error;
+    if (decrement_needed)
+      range->decrement_scan_counter();
+    if (e.code() == Error::RANGESERVER_RANGE_NOT_FOUND)
+      HT_INFO_OUT << e << HT_END;
+    else
+      HT_ERROR_OUT << e << HT_END;
+    if ((error = cb->error(e.code(), e.what())) != Error::OK)
+      HT_ERRORF("Problem sending error response - %s", Error::get_text(error));
+  }
+}
+
+
 void RangeServer::destroy_scanner(ResponseCallback *cb, uint32_t scanner_id) {
   HT_DEBUGF("destroying scanner id=%u", scanner_id);
   Global::scanner_map.remove(scanner_id);
@@ -723,12 +848,14 @@ RangeServer::fetch_scanblock(ResponseCallbackFetchScanblock *cb,
   TableInfoPtr table_info;
   TableIdentifierManaged scanner_table;
   SchemaPtr schema;
+  uint32_t block_size;
 
   HT_DEBUG_OUT <<"Scanner ID = " << scanner_id << HT_END;
 
   try {
 
-    if (!Global::scanner_map.get(scanner_id, scanner, range, scanner_table))
+    if (!Global::scanner_map.get(scanner_id, scanner, range, scanner_table,
+                                 &block_size))
       HT_THROW(Error::RANGESERVER_INVALID_SCANNER_ID,
                format("scanner ID %d", scanner_id));
 
@@ -748,10 +875,15 @@ RangeServer::fetch_scanblock(ResponseCallbackFetchScanblock *cb,
     range->add_bytes_read( rbuf.fill() );
 
     size_t count;
-    more = FillScanBlock(scanner, rbuf, &count);
+    more = FillScanBlock(scanner, rbuf, &count, block_size);
+
+    Global::scanner_map.record_block(block_size, rbuf.fill());
 
     if (!more)
       Global::scanner_map.remove(scanner_id);
+    else
+      Global::scanner_map.set_block_size(scanner_id,
+                                         next_scan_block_size(block_size));
 
     /**
      *  Send back data
@@ -763,8 +895,9 @@ RangeServer::fetch_scanblock(ResponseCallbackFetchScanblock *cb,
       if ((error = cb->response(moreflag, scanner_id, ext)) != Error::OK)
         HT_ERRORF("Problem sending OK response - %s", Error::get_text(error));
 
-      HT_DEBUGF("Successfully fetched %u bytes (%d k/v pairs) of scan data",
-                ext.size-4, (int)count);
+      HT_DEBUGF("Successfully fetched %u bytes (%d k/v pairs) of scan data "
+                "(scanner=%u, block_size=%u)", ext.size-4, (int)count,
+                scanner_id, block_size);
     }
 
   }
@@ -914,7 +1047,14 @@ RangeServer::load_range(ResponseCallback *cb, const TableIdentifier *table,
        * NOTE: The range does not need to be locked in the following replay since
        * it has not been added yet and therefore no one else can find it and
        * concurrently access it.
+       *
+       * The transfer log is replayed in recovery mode, so updates that are
+       * already in the range's CellStores (e.g. when the Master reassigns the
+       * ranges of a failed server) are skipped rather than added twice.
+       * Finalizing recovery also restores an in-progress split of a range
+       * taken over from a failed server.
        */
+      range->recovery_initialize();
       if (transfer_log_dir && *transfer_log_dir) {
         CommitLogReaderPtr commit_log_reader =
           new CommitLogReader(Global::dfs, transfer_log_dir, true);
@@ -937,6 +1077,7 @@ RangeServer::load_range(ResponseCallback *cb, const TableIdentifier *table,
           log->stitch_in(commit_log_reader.get());
         }
       }
+      range->recovery_finalize();
 
       table_info->add_range(range);
 
@@ -1161,6 +1302,9 @@ RangeServer::update(ResponseCallbackUpdate *cb, const TableIdentifier *table,
   ByteString value;
   bool a_locked = false;
   bool b_locked = false;
+  bool sequenced = false;
+  uint64_t update_seq = 0;
+  uint64_t commit_ticket = 0;
   vector<SendBackRec> send_back_vector;
   SendBackRec send_back;
   uint32_t total_added = 0;
@@ -1440,6 +1584,10 @@ RangeServer::update(ResponseCallbackUpdate *cb, const TableIdentifier *table,
     m_update_mutex_a.unlock();
     a_locked = false;
 
+    // Updates are applied to the ranges in the order they pass through here
+    update_seq = m_update_sequence++;
+    sequenced = true;
+
     /**
      * Commit ROOT mutations
      */
@@ -1451,22 +1599,36 @@ RangeServer::update(ResponseCallbackUpdate *cb, const TableIdentifier *table,
     }
 
     /**
-     * Commit valid (go) mutations
+     * Commit valid (go) mutations.  User table mutations are handed off to
+     * the group commit stage so that concurrent updates share a single
+     * commit log block and sync.
      */
     if (go_buf.fill() > encoded_table_len) {
-      CommitLog *log;
       if (table->id == 0) {
         HT_ASSERT(sync == true);
-        log = Global::metadata_log;
+        if ((error = Global::metadata_log->write(go_buf, last_revision, sync))
+            != Error::OK)
+          HT_THROWF(error, "Problem writing %d bytes to commit log (%s)",
+                    (int)go_buf.fill(),
+                    Global::metadata_log->get_log_dir().c_str());
       }
       else
-        log = Global::user_log;
-
-      if ((error = log->write(go_buf, last_revision, sync)) != Error::OK)
-        HT_THROWF(error, "Problem writing %d bytes to commit log (%s)",
-                  (int)go_buf.fill(), log->get_log_dir().c_str());
+        commit_ticket = m_group_commit->enqueue(go_buf, encoded_table_len,
+                                                last_revision, sync);
     }
 
+    m_update_mutex_b.unlock();
+    b_locked = false;
+
+    if (commit_ticket &&
+        (error = m_group_commit->wait_for_commit(commit_ticket)) != Error::OK)
+      HT_THROWF(error, "Problem writing %d bytes to commit log (%s)",
+                (int)go_buf.fill(), Global::user_log->get_log_dir().c_str());
+
+    ScopedLock apply_lock(m_update_apply_mutex);
+    while (m_update_applied != update_seq)
+      m_update_apply_cond.wait(apply_lock);
+
     for (size_t rangei=0; rangei<range_vector.size(); rangei++) {
 
       /**
@@ -1500,6 +1662,10 @@ RangeServer::update(ResponseCallbackUpdate *cb, const TableIdentifier *table,
     if (Global::verbose && misses)
       HT_INFOF("Sent back %d updates because out-of-range", misses);
 
+    m_update_applied++;
+    m_update_apply_cond.notify_all();
+    sequenced = false;
+
     error = Error::OK;
   }
   catch (Exception &e) {
@@ -1508,13 +1674,25 @@ RangeServer::update(ResponseCallbackUpdate *cb, const TableIdentifier *table,
     errmsg = e.what();
   }
 
+  if (b_locked) {
+    m_update_mutex_b.unlock();
+    b_locked = false;
+  }
+
+  // Let subsequent updates proceed if this one failed after sequencing
+  if (sequenced) {
+    ScopedLock lock(m_update_apply_mutex);
+    while (m_update_applied != update_seq)
+      m_update_apply_cond.wait(lock);
+    m_update_applied++;
+    m_update_apply_cond.notify_all();
+  }
+
   // decrement usage counters for all referenced ranges
   foreach(Range *range, reference_set)
     range->decrement_update_counter();
 
-  if (b_locked)
-    m_update_mutex_b.unlock();
-  else if (a_locked)
+  if (a_locked)
     m_update_mutex_a.unlock();
 
   /**
@@ -1638,6 +1816,10 @@ void RangeServer::dump(ResponseCallback *cb, const char *outfile,
     stats_gatherer.fetch(range_data);
 
     for (size_t i=0; i<range_data.size(); i++) {
+      if (range_data[i]->split_low_bytes || range_data[i]->split_high_bytes)
+	out << range_data[i]->range->get_name() << "\tsplit low/high bytes\t"
+	    << range_data[i]->split_low_bytes << "/"
+	    << range_data[i]->split_high_bytes << "\n";
       for (ag_data = range_data[i]->agdata; ag_data; ag_data = ag_data->next) {
 	ag_name = range_data[i]->range->get_name() + "(" + ag_data->ag->get_name() + ")";
 	out << ag_name << "\tecr\t" << ag_data->earliest_cached_revision << "\n";
@@ -1647,6 +1829,10 @@ void RangeServer::dump(ResponseCallback *cb, const char *outfile,
 	out << ag_name << "\timmutable items\t" << ag_data->immutable_items << "\n";
 	out << ag_name << "\tdisk\t" << ag_data->disk_used << "\n";
 	out << ag_name << "\tscanners\t" << ag_data->outstanding_scanners << "\n";
+	out << ag_name << "\tcompaction read\t" << ag_data->compaction_bytes_read << "\n";
+	out << ag_name << "\tcompaction written\t" << ag_data->compaction_bytes_written << "\n";
+	out << ag_name << "\tcellstores scanned\t" << ag_data->cellstores_scanned << "\n";
+	out << ag_name << "\tcellstores pruned\t" << ag_data->cellstores_pruned << "\n";
       }
     }
 
@@ -1703,6 +1889,19 @@ void RangeServer::get_statistics(ResponseCallbackGetStatistics *cb) {
     }
   }
 
+  if (m_group_commit)
+    m_group_commit->get_stats(stat);
+
+  Global::block_cache->get_stats(stat.block_cache_stats);
+
+  Global::scanner_map.get_stats(stat);
+
+  stat.request_backlog = m_app_queue->backlog();
+
+  if (Global::compressed_block_cache)
+    Global::compressed_block_cache->get_stats(
+        stat.compressed_block_cache_stats);
+
   StaticBuffer ext(stat.encoded_length());
   uint8_t *bufp = ext.base;
   stat.encode(&bufp);
@@ -2019,6 +2218,51 @@ RangeServer::drop_range(ResponseCallback *cb, const TableIdentifier *table,
 }
 
 
+void
+RangeServer::load_cell_stores(ResponseCallback *cb,
+    const TableIdentifier *table, const RangeSpec *range_spec,
+    const std::vector<String> &access_groups,
+    const std::vector<String> &files) {
+  TableInfoPtr table_info;
+  RangePtr range;
+
+  HT_INFO_OUT << "load_cell_stores (" << files.size() << " files)\n"
+              << *table << *range_spec << HT_END;
+
+  try {
+
+    if (!m_replay_finished)
+      wait_for_recovery_finish(table, range_spec);
+
+    if (!m_live_map->get(table->id, table_info))
+      HT_THROWF(Error::RANGESERVER_TABLE_NOT_FOUND, "%s", table->name);
+
+    if (!table_info->get_range(range_spec, range)
+        || range->start_row() != range_spec->start_row)
+      HT_THROWF(Error::RANGESERVER_RANGE_NOT_FOUND, "%s[%s..%s]",
+                table->name, range_spec->start_row, range_spec->end_row);
+
+    /**
+     * The bulk loader stamps revisions from its own clock, so reject stores
+     * that are ahead of ours; updates made after the load would otherwise
+     * be assigned revisions below those of the loaded cells and be skipped
+     * on commit log replay
+     */
+    int64_t max_revision = Global::user_log->get_timestamp();
+
+    range->load_cell_stores(access_groups, files, max_revision);
+
+    cb->response_ok();
+  }
+  catch (Hypertable::Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    int error = 0;
+    if (cb && (error = cb->error(e.code(), e.what())) != Error::OK)
+      HT_ERRORF("Problem sending error response - %s", Error::get_text(error));
+  }
+}
+
+
 void RangeServer::close(ResponseCallback *cb) {
   std::vector<TableInfoPtr> table_vec;
   std::vector<RangePtr> range_vec;
@@ -2033,6 +2277,13 @@ void RangeServer::close(ResponseCallback *cb) {
   m_update_mutex_a.lock();
   m_update_mutex_b.lock();
 
+  // wait for updates already past the commit stage to be applied
+  {
+    ScopedLock lock(m_update_apply_mutex);
+    while (m_update_applied != m_update_sequence)
+      m_update_apply_cond.wait(lock);
+  }
+
   // get the tables
   m_live_map->get_all(table_vec);
 
@@ -40,6 +40,7 @@
 #include "Hypertable/Lib/Types.h"
 
 #include "Global.h"
+#include "GroupCommit.h"
 #include "MaintenanceScheduler.h"
 #include "ResponseCallbackCreateScanner.h"
 #include "ResponseCallbackFetchScanblock.h"
@@ -67,6 +68,8 @@ namespace Hypertable {
     void create_scanner(ResponseCallbackCreateScanner *,
                         const TableIdentifier *,
                         const  RangeSpec *, const ScanSpec *);
+    void get_rows(ResponseCallbackCreateScanner *, const TableIdentifier *,
+                  const RangeSpec *, const ScanSpec *);
     void destroy_scanner(ResponseCallback *cb, uint32_t scanner_id);
     void fetch_scanblock(ResponseCallbackFetchScanblock *, uint32_t scanner_id);
     void load_range(ResponseCallback *, const TableIdentifier *,
@@ -90,6 +93,11 @@ namespace Hypertable {
     void drop_range(ResponseCallback *, const TableIdentifier *,
                     const RangeSpec *);
 
+    void load_cell_stores(ResponseCallback *, const TableIdentifier *,
+                          const RangeSpec *,
+                          const std::vector<String> &access_groups,
+                          const std::vector<String> &files);
+
     void close(ResponseCallback *cb);
 
     // Other methods
@@ -119,6 +127,18 @@ namespace Hypertable {
     void transform_key(ByteString &bskey, DynamicBuffer *dest_bufp,
                        int64_t revision, int64_t *revisionp);
 
+    /**
+     * Returns the block size to use for the next fetch of a scanner that
+     * has just returned a full block of the given size.  Scanners that keep
+     * fetching are assumed to be long sequential scans, so the block size
+     * is doubled on each fetch up to Scanner.BlockSize.Max.
+     */
+    uint32_t next_scan_block_size(uint32_t block_size) {
+      if (block_size >= m_scan_block_size_max / 2)
+        return m_scan_block_size_max;
+      return block_size * 2;
+    }
+
     Mutex                  m_mutex;
     Mutex                  m_drop_table_mutex;
     boost::condition       m_root_replay_finished_cond;
@@ -129,6 +149,16 @@ namespace Hypertable {
     bool                   m_replay_finished;
     Mutex                  m_update_mutex_a;
     Mutex                  m_update_mutex_b;
+    Mutex                  m_update_apply_mutex;
+    boost::condition       m_update_apply_cond;
+    uint64_t               m_update_sequence;
+    uint64_t               m_update_applied;
+    GroupCommitPtr         m_group_commit;
+    uint32_t               m_group_commit_max_wait;
+    uint32_t               m_group_commit_max_batch_bytes;
+    int32_t                m_replay_decompress_threads;
+    int32_t                m_replay_apply_threads;
+    uint64_t               m_replay_buffer_limit;
     PropertiesPtr          m_props;
     bool                   m_verbose;
     Comm                  *m_comm;
@@ -143,6 +173,7 @@ namespace Hypertable {
     MasterClientPtr        m_master_client;
     Hyperspace::SessionPtr m_hyperspace;
     uint32_t               m_scanner_ttl;
+    uint32_t               m_scan_block_size_max;
     int32_t                m_max_clock_skew;
     uint64_t               m_bytes_loaded;
     uint64_t               m_log_roll_limit;
@@ -60,6 +60,9 @@ ScanContext::initialize(int64_t rev, const ScanSpec *ss,
   spec = ss;
   range = range_spec;
 
+  if (spec && !spec->filter.empty())
+    filter = new ScanFilter(spec->filter);
+
   if (spec == 0)
     memset(family_mask, true, 256*sizeof(bool));
   else {
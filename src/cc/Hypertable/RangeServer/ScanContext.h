@@ -34,6 +34,8 @@
 #include "Hypertable/Lib/ScanSpec.h"
 #include "Hypertable/Lib/Types.h"
 
+#include "ScanFilter.h"
+
 namespace Hypertable {
 
   struct CellFilterInfo {
@@ -63,6 +65,7 @@ namespace Hypertable {
     std::pair<int64_t, int64_t> time_interval;
     bool family_mask[256];
     CellFilterInfo family_info[256];
+    ScanFilterPtr filter;  // compiled spec->filter, 0 if there is none
 
     /**
      * Constructor.
@@ -0,0 +1,165 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+
+#include "ScanFilter.h"
+
+using namespace Hypertable;
+
+
+ScanFilter::ScanFilter(const std::vector<CellPredicate> &predicates) {
+  size_t depth = 0, max_depth = 0;
+
+  m_terms.reserve(predicates.size());
+
+  try {
+    foreach(const CellPredicate &cp, predicates) {
+      Term term;
+      term.op = cp.op;
+      term.regex = 0;
+
+      if (cp.is_match()) {
+        term.pattern = cp.pattern ? cp.pattern : "";
+        if (cp.op == CellPredicate::QUALIFIER_REGEX ||
+            cp.op == CellPredicate::VALUE_REGEX) {
+          char errbuf[256];
+          int error;
+          term.regex = new regex_t;
+          if ((error = regcomp(term.regex, term.pattern.c_str(),
+                               REG_EXTENDED | REG_NOSUB)) != 0) {
+            regerror(error, term.regex, errbuf, sizeof(errbuf));
+            delete term.regex;
+            HT_THROWF(Error::RANGESERVER_BAD_SCAN_SPEC,
+                      "Bad filter regular expression '%s' - %s",
+                      term.pattern.c_str(), errbuf);
+          }
+        }
+        if (++depth > max_depth)
+          max_depth = depth;
+      }
+      else if (cp.op == CellPredicate::AND || cp.op == CellPredicate::OR) {
+        if (depth < 2)
+          HT_THROW(Error::RANGESERVER_BAD_SCAN_SPEC,
+                   "Filter AND/OR is missing an operand");
+        depth--;
+      }
+      else if (cp.op == CellPredicate::NOT) {
+        if (depth < 1)
+          HT_THROW(Error::RANGESERVER_BAD_SCAN_SPEC,
+                   "Filter NOT is missing an operand");
+      }
+      else
+        HT_THROWF(Error::RANGESERVER_BAD_SCAN_SPEC,
+                  "Bad filter operator %d", (int)cp.op);
+
+      m_terms.push_back(term);
+    }
+
+    if (depth != 1)
+      HT_THROW(Error::RANGESERVER_BAD_SCAN_SPEC,
+               "Filter terms do not form a single expression");
+  }
+  catch (...) {
+    foreach(Term &term, m_terms) {
+      if (term.regex) {
+        regfree(term.regex);
+        delete term.regex;
+      }
+    }
+    throw;
+  }
+
+  m_stack.resize(max_depth);
+}
+
+
+ScanFilter::~ScanFilter() {
+  foreach(Term &term, m_terms) {
+    if (term.regex) {
+      regfree(term.regex);
+      delete term.regex;
+    }
+  }
+}
+
+
+bool ScanFilter::matches(const Key &key, const ByteString &value) {
+  const uint8_t *vptr = (const uint8_t *)"";
+  size_t vlen = 0;
+  bool value_decoded = false;
+  size_t top = 0;
+  bool result;
+
+  foreach(const Term &term, m_terms) {
+    switch (term.op) {
+    case CellPredicate::AND:
+      top--;
+      m_stack[top-1] = m_stack[top-1] && m_stack[top];
+      continue;
+    case CellPredicate::OR:
+      top--;
+      m_stack[top-1] = m_stack[top-1] || m_stack[top];
+      continue;
+    case CellPredicate::NOT:
+      m_stack[top-1] = !m_stack[top-1];
+      continue;
+    case CellPredicate::QUALIFIER_EXACT:
+      result = key.column_qualifier_len == term.pattern.length() &&
+          !memcmp(key.column_qualifier, term.pattern.data(),
+                  term.pattern.length());
+      break;
+    case CellPredicate::QUALIFIER_PREFIX:
+      result = key.column_qualifier_len >= term.pattern.length() &&
+          !memcmp(key.column_qualifier, term.pattern.data(),
+                  term.pattern.length());
+      break;
+    case CellPredicate::QUALIFIER_REGEX:
+      result = regexec(term.regex, key.column_qualifier, 0, 0, 0) == 0;
+      break;
+    default:
+      if (!value_decoded) {
+        if (value.ptr)
+          vlen = value.decode_length(&vptr);
+        value_decoded = true;
+      }
+      if (term.op == CellPredicate::VALUE_EXACT)
+        result = vlen == term.pattern.length() &&
+            !memcmp(vptr, term.pattern.data(), vlen);
+      else if (term.op == CellPredicate::VALUE_PREFIX)
+        result = vlen >= term.pattern.length() &&
+            !memcmp(vptr, term.pattern.data(), term.pattern.length());
+      else {
+        // regexec() needs a terminated string
+        m_value.assign((const char *)vptr, vlen);
+        result = regexec(term.regex, m_value.c_str(), 0, 0, 0) == 0;
+      }
+      break;
+    }
+    m_stack[top++] = result;
+  }
+
+  return m_stack[0] != 0;
+}
@@ -0,0 +1,84 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_SCANFILTER_H
+#define HYPERTABLE_SCANFILTER_H
+
+#include <regex.h>
+
+#include <vector>
+
+#include "Common/ByteString.h"
+#include "Common/ReferenceCount.h"
+#include "Common/String.h"
+
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/ScanSpec.h"
+
+namespace Hypertable {
+
+  /**
+   * Cell filter expression of a ScanSpec compiled for evaluation on the
+   * range server.  The patterns are copied and the regular expressions are
+   * compiled once, when the scan is created, and the shape of the postfix
+   * expression is checked so that evaluation never underflows its stack.
+   * A filter is not thread safe, it belongs to the scan context of a single
+   * scanner.
+   */
+  class ScanFilter : public ReferenceCount {
+  public:
+    /**
+     * Compiles the filter.  Throws RANGESERVER_BAD_SCAN_SPEC if a term has
+     * an unknown operator or a bad regular expression, or if the terms do
+     * not form a single expression.
+     *
+     * @param predicates filter terms in postfix order
+     */
+    ScanFilter(const std::vector<CellPredicate> &predicates);
+    ~ScanFilter();
+
+    /**
+     * Evaluates the filter against a cell.  Value terms see an empty value
+     * if the scan is keys only.
+     *
+     * @param key key of the cell
+     * @param value value of the cell
+     * @return true if the cell satisfies the filter
+     */
+    bool matches(const Key &key, const ByteString &value);
+
+  private:
+    struct Term {
+      uint8_t op;
+      String pattern;
+      regex_t *regex;
+    };
+
+    std::vector<Term> m_terms;
+    std::vector<uint8_t> m_stack;
+    String m_value;
+  };
+
+  typedef intrusive_ptr<ScanFilter> ScanFilterPtr;
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_SCANFILTER_H
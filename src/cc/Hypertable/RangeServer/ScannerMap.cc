@@ -30,13 +30,14 @@ atomic_t ScannerMap::ms_next_id = ATOMIC_INIT(0);
  */
 uint32_t ScannerMap::put(CellListScannerPtr &scanner_ptr,
                          RangePtr &range_ptr,
-                         const TableIdentifier *table) {
+                         const TableIdentifier *table, uint32_t block_size) {
   ScopedLock lock(m_mutex);
   ScanInfo scaninfo;
   scaninfo.scanner_ptr = scanner_ptr;
   scaninfo.range_ptr = range_ptr;
   scaninfo.last_access_millis = get_timestamp_millis();
   scaninfo.table= *table;
+  scaninfo.block_size = block_size;
   uint32_t id = atomic_inc_return(&ms_next_id);
   m_scanner_map[id] = scaninfo;
   return id;
@@ -48,7 +49,8 @@ uint32_t ScannerMap::put(CellListScannerPtr &scanner_ptr,
  */
 bool
 ScannerMap::get(uint32_t id, CellListScannerPtr &scanner_ptr,
-                RangePtr &range_ptr, TableIdentifierManaged &table) {
+                RangePtr &range_ptr, TableIdentifierManaged &table,
+                uint32_t *block_sizep) {
   ScopedLock lock(m_mutex);
   CellListScannerMap::iterator iter = m_scanner_map.find(id);
   if (iter == m_scanner_map.end())
@@ -57,10 +59,36 @@ ScannerMap::get(uint32_t id, CellListScannerPtr &scanner_ptr,
   scanner_ptr = (*iter).second.scanner_ptr;
   range_ptr = (*iter).second.range_ptr;
   table = (*iter).second.table;
+  *block_sizep = (*iter).second.block_size;
   return true;
 }
 
 
+void ScannerMap::set_block_size(uint32_t id, uint32_t block_size) {
+  ScopedLock lock(m_mutex);
+  CellListScannerMap::iterator iter = m_scanner_map.find(id);
+  if (iter != m_scanner_map.end())
+    (*iter).second.block_size = block_size;
+}
+
+
+void ScannerMap::record_block(uint32_t block_size, size_t length) {
+  ScopedLock lock(m_mutex);
+  m_blocks++;
+  m_block_bytes += length;
+  if (block_size > m_max_block_size)
+    m_max_block_size = block_size;
+}
+
+
+void ScannerMap::get_stats(RangeServerStat &stat) {
+  ScopedLock lock(m_mutex);
+  stat.scan_blocks = m_blocks;
+  stat.scan_block_bytes = m_block_bytes;
+  stat.scan_max_block_size = m_max_block_size;
+}
+
+
 
 /**
  */
@@ -31,6 +31,8 @@ extern "C" {
 #include "Common/atomic.h"
 #include "Common/HashMap.h"
 
+#include "Hypertable/Lib/Stat.h"
+
 #include "CellListScanner.h"
 #include "Range.h"
 
@@ -39,7 +41,8 @@ namespace Hypertable {
   class ScannerMap {
 
   public:
-    ScannerMap() : m_mutex() { return; }
+    ScannerMap() : m_mutex(), m_blocks(0), m_block_bytes(0),
+                   m_max_block_size(0) { return; }
 
     /**
      * This method computes a unique scanner ID and puts the given scanner
@@ -48,10 +51,11 @@ namespace Hypertable {
      * @param scanner_ptr smart pointer to scanner object
      * @param range_ptr smart pointer to range object
      * @param table table identifier for this scanner
+     * @param block_size size of the next block to return to the client
      * @return unique scanner ID
      */
     uint32_t put(CellListScannerPtr &scanner_ptr, RangePtr &range_ptr,
-                 const TableIdentifier *table);
+                 const TableIdentifier *table, uint32_t block_size);
 
     /**
      * This method retrieves the scanner and range mapped to the given scanner
@@ -62,9 +66,35 @@ namespace Hypertable {
      * @param scanner_ptr smart pointer to returned scanner object
      * @param range_ptr smart pointer to returned range object
      * @param table reference to (managed) table identifier
+     * @param block_sizep address of variable to hold the scan block size
      * @return true if found, false if not
      */
-    bool get(uint32_t id, CellListScannerPtr &scanner_ptr, RangePtr &range_ptr, TableIdentifierManaged &table);
+    bool get(uint32_t id, CellListScannerPtr &scanner_ptr, RangePtr &range_ptr,
+             TableIdentifierManaged &table, uint32_t *block_sizep);
+
+    /**
+     * This method sets the size of the next block to be returned by the
+     * scanner with the given id.
+     *
+     * @param id scanner id
+     * @param block_size block size in bytes
+     */
+    void set_block_size(uint32_t id, uint32_t block_size);
+
+    /**
+     * Records a scan block that was sent back to a client.
+     *
+     * @param block_size block size that was used to fill the block
+     * @param length number of bytes actually returned
+     */
+    void record_block(uint32_t block_size, size_t length);
+
+    /**
+     * Fills in the scan block statistics of the given RangeServerStat.
+     *
+     * @param stat reference to stat object to fill in
+     */
+    void get_stats(RangeServerStat &stat);
 
     /**
      * This method removes the entry in the scanner map corresponding to the
@@ -99,11 +129,16 @@ namespace Hypertable {
       RangePtr range_ptr;
       uint64_t last_access_millis;
       TableIdentifierManaged table;
+      uint32_t block_size;
     };
     typedef hash_map<uint32_t, ScanInfo> CellListScannerMap;
 
     CellListScannerMap m_scanner_map;
 
+    uint64_t       m_blocks;
+    uint64_t       m_block_bytes;
+    uint32_t       m_max_block_size;
+
   };
 
 }
@@ -0,0 +1,69 @@
+/** -*- c++ -*-
+ * Copyright (C) 2008 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <algorithm>
+
+#include "SelectSplitRow.h"
+
+namespace Hypertable {
+
+  bool
+  SelectSplitRow(std::vector<SplitSample> &samples, const String &start_row,
+                 const String &end_row, String &split_row,
+                 int64_t *low_bytesp, int64_t *high_bytesp) {
+    const String *best_row = 0;
+    int64_t total = 0, below = 0, best_below = 0, best_diff = -1, diff;
+
+    foreach(const SplitSample &sample, samples)
+      total += sample.bytes;
+
+    if (total <= 0)
+      return false;
+
+    std::sort(samples.begin(), samples.end());
+
+    for (size_t i=0; i<samples.size(); ) {
+      const String &row = samples[i].row;
+      for (; i<samples.size() && samples[i].row == row; i++)
+        below += samples[i].bytes;
+      if (row <= start_row || row >= end_row)
+        continue;
+      diff = 2*below - total;
+      if (diff < 0)
+        diff = -diff;
+      if (best_diff < 0 || diff < best_diff) {
+        best_diff = diff;
+        best_below = below;
+        best_row = &row;
+      }
+    }
+
+    if (best_row == 0)
+      return false;
+
+    split_row = *best_row;
+    *low_bytesp = best_below;
+    *high_bytesp = total - best_below;
+    return true;
+  }
+
+}
@@ -0,0 +1,56 @@
+/** -*- c++ -*-
+ * Copyright (C) 2008 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_SELECTSPLITROW_H
+#define HYPERTABLE_SELECTSPLITROW_H
+
+#include <vector>
+
+#include "Common/String.h"
+
+#include "CellList.h"
+
+namespace Hypertable {
+
+  /**
+   * Picks the sample row whose cumulative byte count is closest to half of
+   * the total.  Only rows strictly between start_row and end_row qualify,
+   * since a range can only be split inside of it.
+   *
+   * @param samples split samples of all of the cell lists of a range,
+   *        sorted by row on return
+   * @param start_row start row of the range
+   * @param end_row end row of the range
+   * @param split_row receives the chosen row
+   * @param low_bytesp address of variable to hold the bytes at or below
+   *        the chosen row
+   * @param high_bytesp address of variable to hold the bytes above it
+   * @return false if the samples hold no bytes or no sample row lies
+   *         inside of the range
+   */
+  bool SelectSplitRow(std::vector<SplitSample> &samples,
+                      const String &start_row, const String &end_row,
+                      String &split_row, int64_t *low_bytesp,
+                      int64_t *high_bytesp);
+
+}
+
+#endif // HYPERTABLE_SELECTSPLITROW_H
@@ -0,0 +1,606 @@
+/** -*- c++ -*-
+ * Copyright (C) 2008 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Init.h"
+#include "Common/Serialization.h"
+#include "Common/Time.h"
+#include "Common/md5.h"
+
+#include "AsyncComm/ApplicationQueue.h"
+#include "AsyncComm/Comm.h"
+
+#include "DfsBroker/Lib/Client.h"
+
+#include "Hypertable/Lib/Client.h"
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/LoadDataEscape.h"
+#include "Hypertable/Lib/LoadDataSourceFactory.h"
+#include "Hypertable/Lib/LocationCache.h"
+#include "Hypertable/Lib/RangeServerClient.h"
+#include "Hypertable/Lib/ScanSpec.h"
+#include "Hypertable/Lib/SerializedKey.h"
+
+#include "Config.h"
+#include "CellStoreV1.h"
+#include "Global.h"
+
+
+using namespace Hypertable;
+using namespace Serialization;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+struct MyPolicy : Config::Policy {
+  static void init_options() {
+    cmdline_desc("Usage: %s [options] <table> <input-file>\n\n"
+      "  This program loads a tab delimited input file (same format as\n"
+      "  LOAD DATA INFILE) into an existing table without going through\n"
+      "  the update path of the RangeServers.  The input is sorted\n"
+      "  externally, written out as one CellStore per range and access\n"
+      "  group, and the CellStores are then handed to the RangeServers\n"
+      "  that own the ranges, which add them to the ranges and record\n"
+      "  them in the METADATA table.\n\nOptions");
+    cmdline_desc().add_options()
+      ("header-file", str()->default_value(""),
+          "Read the column header from this file")
+      ("row-key-column", strs(), "Column(s) to use as the row key")
+      ("timestamp-column", str()->default_value(""),
+          "Column to use as the cell timestamp")
+      ("no-escape", boo()->zero_tokens()->default_value(false),
+          "Do not unescape values")
+      ("sort-memory", i64()->default_value(256*M),
+          "Amount of memory to use for sorting before spilling to disk")
+      ("temp-dir", str()->default_value("/tmp"),
+          "Directory for the sorted runs spilled to disk")
+      ;
+    cmdline_hidden_desc().add_options()
+      ("table", str(), "name of the table to load")
+      ("input-file", str(), "file to load")
+      ("clock-offset", i64()->default_value(0),
+          "Microseconds to add to the local clock when assigning revisions "
+          "(for testing the RangeServer clock skew check)")
+      ;
+    cmdline_positional_desc().add("table", 1).add("input-file", 1);
+  }
+};
+
+typedef Cons<MyPolicy, DefaultClientPolicy> AppPolicy;
+
+struct RangeInfo {
+  String start_row;
+  String end_row;
+  String location;
+  std::vector<int64_t> entries;
+  std::vector<String> access_groups;
+  std::vector<String> files;
+};
+
+/** Ranges of the table, keyed by end row */
+typedef std::map<String, RangeInfo> RangeMap;
+
+void fetch_ranges(ClientPtr &client, uint32_t table_id, RangeMap &ranges);
+
+
+/**
+ * Source of key/value pairs in key order, either the in-memory remainder
+ * of the input or a sorted run that was spilled to disk.
+ */
+class SortedRun {
+public:
+  virtual ~SortedRun() { }
+  virtual bool next() = 0;
+  SerializedKey key;
+  ByteString value;
+};
+
+
+/** Sorts a buffer of serialized key/value pairs in place */
+class SortBuffer {
+public:
+  SortBuffer() : m_buf(0) { }
+
+  void add(DynamicBuffer &entry) {
+    m_offsets.push_back(m_buf.fill());
+    m_buf.add(entry.base, entry.fill());
+  }
+
+  size_t memory_used() {
+    return m_buf.fill() + m_offsets.size() * sizeof(size_t);
+  }
+
+  bool empty() { return m_offsets.empty(); }
+
+  void sort() {
+    std::sort(m_offsets.begin(), m_offsets.end(), LtEntry(m_buf.base));
+  }
+
+  /** Writes the sorted entries to a run file, each preceded by its length */
+  void spill(FILE *fp) {
+    uint8_t lenbuf[4], *ptr;
+
+    foreach(size_t offset, m_offsets) {
+      SerializedKey key(m_buf.base + offset);
+      ByteString value(key.ptr + key.length());
+      uint32_t len = (value.ptr + value.length()) - key.ptr;
+      ptr = lenbuf;
+      encode_i32(&ptr, len);
+      if (fwrite(lenbuf, 4, 1, fp) != 1 || fwrite(key.ptr, len, 1, fp) != 1)
+        HT_THROWF(Error::LOCAL_IO_ERROR, "Problem writing sorted run - %s",
+                  strerror(errno));
+    }
+    m_offsets.clear();
+    m_buf.clear();
+  }
+
+  class Run : public SortedRun {
+  public:
+    Run(SortBuffer &buf) : m_buf(buf), m_next(0) { }
+    virtual bool next() {
+      if (m_next == m_buf.m_offsets.size())
+        return false;
+      key.ptr = m_buf.m_buf.base + m_buf.m_offsets[m_next++];
+      value.ptr = key.ptr + key.length();
+      return true;
+    }
+  private:
+    SortBuffer &m_buf;
+    size_t m_next;
+  };
+
+private:
+  struct LtEntry {
+    LtEntry(const uint8_t *base) : base(base) { }
+    bool operator()(size_t a, size_t b) const {
+      return SerializedKey(base + a) < SerializedKey(base + b);
+    }
+    const uint8_t *base;
+  };
+
+  DynamicBuffer m_buf;
+  std::vector<size_t> m_offsets;
+};
+
+
+class FileRun : public SortedRun {
+public:
+  FileRun(const String &fname) : m_fname(fname), m_buf(0) {
+    if ((m_fp = fopen(fname.c_str(), "w+")) == 0)
+      HT_THROWF(Error::LOCAL_IO_ERROR, "Unable to create '%s' - %s",
+                fname.c_str(), strerror(errno));
+    unlink(fname.c_str());
+  }
+
+  virtual ~FileRun() { fclose(m_fp); }
+
+  FILE *fp() { return m_fp; }
+
+  void rewind() { ::rewind(m_fp); }
+
+  virtual bool next() {
+    uint8_t lenbuf[4];
+    const uint8_t *ptr = lenbuf;
+    size_t remain = 4;
+
+    if (fread(lenbuf, 4, 1, m_fp) != 1)
+      return false;
+    uint32_t len = decode_i32(&ptr, &remain);
+    m_buf.clear();
+    m_buf.ensure(len);
+    if (fread(m_buf.base, len, 1, m_fp) != 1)
+      HT_THROWF(Error::LOCAL_IO_ERROR, "Short read on sorted run '%s'",
+                m_fname.c_str());
+    key.ptr = m_buf.base;
+    value.ptr = key.ptr + key.length();
+    return true;
+  }
+
+private:
+  String m_fname;
+  FILE *m_fp;
+  DynamicBuffer m_buf;
+};
+
+
+struct GtRun {
+  bool operator()(SortedRun *a, SortedRun *b) const {
+    return b->key < a->key;
+  }
+};
+
+
+/**
+ * Writes the merged stream into one CellStore per range and access group
+ * that receives cells.
+ */
+class StoreWriter {
+public:
+  StoreWriter(TablePtr &table, RangeMap &ranges)
+    : m_table(table), m_ranges(ranges), m_range(ranges.end()) {
+    SchemaPtr schema = table->schema();
+    table->get_identifier(&m_identifier);
+    m_table_name = m_identifier.name;
+    memset(m_cf_to_ag, 0, sizeof(m_cf_to_ag));
+
+    foreach(Schema::AccessGroup *ag, schema->get_access_groups()) {
+      PropertiesPtr props = new Properties();
+      props->set("compressor", ag->compressor.size() ?
+                 ag->compressor : schema->get_compressor());
+      props->set("blocksize", ag->blocksize);
+      Schema::parse_bloom_filter(ag->bloom_filter.size() ? ag->bloom_filter
+          : get_str("Hypertable.RangeServer.CellStore.DefaultBloomFilter"),
+          props);
+      foreach(Schema::ColumnFamily *cf, ag->columns)
+        m_cf_to_ag[cf->id] = m_ag_names.size();
+      m_ag_names.push_back(ag->name);
+      m_ag_props.push_back(props);
+    }
+    m_stores.resize(m_ag_names.size());
+  }
+
+  size_t ag_index(uint8_t cf_code) { return m_cf_to_ag[cf_code]; }
+  size_t ag_count() { return m_ag_names.size(); }
+
+  void add(const Key &key, const ByteString value) {
+    if (m_range == m_ranges.end() || strcmp(key.row, m_range->first.c_str()) > 0) {
+      finish_range();
+      m_range = m_ranges.lower_bound(key.row);
+      HT_ASSERT(m_range != m_ranges.end());
+    }
+    size_t ag = m_cf_to_ag[key.column_family_code];
+    if (!m_stores[ag])
+      m_stores[ag] = create_store(m_range->second, ag);
+    m_stores[ag]->add(key, value);
+  }
+
+  void finish_range() {
+    if (m_range == m_ranges.end())
+      return;
+    for (size_t i=0; i<m_stores.size(); i++) {
+      if (m_stores[i]) {
+        m_stores[i]->finalize(&m_identifier);
+        m_range->second.access_groups.push_back(m_ag_names[i]);
+        m_range->second.files.push_back(m_stores[i]->get_filename());
+        m_stores[i] = 0;
+      }
+    }
+  }
+
+private:
+  CellStorePtr create_store(RangeInfo &range, size_t ag) {
+    char hash_str[33];
+    String range_dir, fname;
+
+    if (range.end_row == Key::END_ROW_MARKER)
+      memset(hash_str, '0', 24);
+    else
+      md5_string(range.end_row.c_str(), hash_str);
+    hash_str[24] = 0;
+
+    range_dir = format("/hypertable/tables/%s/%s/%s", m_table_name.c_str(),
+                       m_ag_names[ag].c_str(), hash_str);
+    Global::dfs->mkdirs(range_dir);
+
+    // The RangeServer assigns the CellStore ID when it loads the store, so
+    // the file is named outside of the "cs<id>" names of its compactions
+    for (int64_t stamp = get_ts64(); ; stamp++) {
+      fname = format("%s/bulk%lld", range_dir.c_str(), (Lld)stamp);
+      if (!Global::dfs->exists(fname))
+        break;
+    }
+
+    CellStorePtr cellstore = new CellStoreV1(Global::dfs);
+    cellstore->create(fname.c_str(), range.entries[ag], m_ag_props[ag]);
+    return cellstore;
+  }
+
+  TablePtr m_table;
+  RangeMap &m_ranges;
+  RangeMap::iterator m_range;
+  String m_table_name;
+  TableIdentifierManaged m_identifier;
+  size_t m_cf_to_ag[256];
+  std::vector<String> m_ag_names;
+  std::vector<PropertiesPtr> m_ag_props;
+  std::vector<CellStorePtr> m_stores;
+};
+
+
+/**
+ * Hands the CellStores of one range to the server that holds the range.
+ * If the range has moved or split since the METADATA table was read, the
+ * ranges are re-read and the CellStores are handed to every range that
+ * now overlaps the original one.
+ */
+void install_cell_stores(ClientPtr &client, TablePtr &table,
+                         RangeServerClient &rsc, RangeInfo &range) {
+  TableIdentifierManaged identifier;
+  struct sockaddr_in addr;
+  RangeMap current;
+
+  table->get_identifier(&identifier);
+
+  std::vector<RangeInfo> targets(1, range);
+
+  for (int attempt = 0; !targets.empty(); attempt++) {
+    std::vector<RangeInfo> retry;
+
+    foreach(RangeInfo &target, targets) {
+      RangeSpec spec(target.start_row.c_str(), target.end_row.c_str());
+      try {
+        if (!LocationCache::location_to_addr(target.location.c_str(), addr))
+          HT_THROWF(Error::RANGESERVER_RANGE_NOT_FOUND, "Bad location '%s'",
+                    target.location.c_str());
+        rsc.load_cell_stores(addr, identifier, spec, range.access_groups,
+                             range.files);
+        continue;
+      }
+      catch (Exception &e) {
+        if ((e.code() != Error::RANGESERVER_RANGE_BUSY &&
+             e.code() != Error::RANGESERVER_RANGE_NOT_FOUND &&
+             e.code() != Error::COMM_CONNECT_ERROR) || attempt == 20)
+          HT_THROW2F(e.code(), e, "Loading %u CellStores into %s[%s..%s]",
+                     (unsigned)range.files.size(), identifier.name,
+                     target.start_row.c_str(), target.end_row.c_str());
+        HT_INFOF("Range %s[%s..%s] unavailable (%s), retrying",
+                 identifier.name, target.start_row.c_str(),
+                 target.end_row.c_str(), Error::get_text(e.code()));
+      }
+      retry.push_back(target);
+    }
+
+    if (retry.empty())
+      break;
+
+    poll(0, 0, 3000);
+
+    // Locate the ranges that now cover the rows of the ones that failed
+    current.clear();
+    fetch_ranges(client, identifier.id, current);
+    targets.clear();
+    foreach(RangeInfo &target, retry) {
+      RangeMap::iterator it = current.upper_bound(target.start_row);
+      for (; it != current.end(); ++it) {
+        targets.push_back(it->second);
+        if (it->first >= target.end_row)
+          break;
+      }
+    }
+  }
+}
+
+} // local namespace
+
+
+int main(int argc, char **argv) {
+  try {
+    init_with_policy<AppPolicy>(argc, argv);
+
+    String table_name = get("table", String());
+    String input_file = get("input-file", String());
+
+    if (table_name.empty() || input_file.empty()) {
+      HT_ERROR_OUT <<"table name and input file are required"<< HT_END;
+      cout << cmdline_desc() << endl;
+      return 1;
+    }
+
+    bool escape = !get_bool("no-escape");
+    size_t sort_memory = get_i64("sort-memory");
+    String temp_dir = get_str("temp-dir");
+    std::vector<String> key_columns = get("row-key-column", Strings());
+    String timestamp_column = get_str("timestamp-column");
+    String header_file = get_str("header-file");
+    int64_t clock_offset = get_i64("clock-offset");
+    int timeout = get_i32("DfsBroker.Timeout");
+
+    ClientPtr client = new Hypertable::Client(argv[0]);
+    ConnectionManagerPtr conn_mgr = new ConnectionManager();
+    DfsBroker::Client *dfs = new DfsBroker::Client(conn_mgr, properties);
+
+    Global::dfs = dfs;
+
+    int32_t compression_threads =
+        get_i32("Hypertable.RangeServer.CellStore.CompressionThreads");
+    if (compression_threads > 0)
+      Global::compression_queue = new ApplicationQueue(compression_threads);
+
+    if (!dfs->wait_for_connection(timeout)) {
+      cerr << "error: timed out waiting for DFS broker" << endl;
+      exit(1);
+    }
+
+    TablePtr table = client->open_table(table_name);
+    SchemaPtr schema = table->schema();
+    RangeMap ranges;
+
+    fetch_ranges(client, client->get_table_id(table_name), ranges);
+
+    StoreWriter writer(table, ranges);
+
+    foreach(RangeMap::value_type &v, ranges)
+      v.second.entries.resize(writer.ag_count());
+
+    /**
+     * Parse the input into sorted runs
+     */
+    LoadDataSourcePtr lds = LoadDataSourceFactory::create(input_file,
+        LOCAL_FILE, header_file, LOCAL_FILE, key_columns, timestamp_column);
+    LoadDataEscape escaper;
+    KeySpec key;
+    uint8_t *value;
+    uint32_t value_len;
+    const char *escaped_buf;
+    size_t escaped_len;
+    int64_t revision = get_ts64() + clock_offset * 1000LL;
+    uint64_t total_cells = 0;
+    DynamicBuffer entry(0);
+    SortBuffer sort_buf;
+    std::vector<SortedRun *> runs;
+
+    while (lds->next(0, &key, &value, &value_len, 0)) {
+      if (value_len == 0)
+        continue;
+
+      Schema::ColumnFamily *cf = schema->get_column_family(key.column_family);
+      if (!cf)
+        HT_THROWF(Error::BAD_KEY, "Bad column family '%s' on line %lld",
+                  key.column_family, (Lld)lds->get_current_lineno());
+
+      if (escape)
+        escaper.unescape((const char *)value, (size_t)value_len, &escaped_buf,
+                         &escaped_len);
+      else {
+        escaped_buf = (const char *)value;
+        escaped_len = (size_t)value_len;
+      }
+
+      ++revision;
+      entry.clear();
+      create_key_and_append(entry, FLAG_INSERT, (const char *)key.row,
+          (uint8_t)cf->id, (const char *)key.column_qualifier,
+          key.timestamp == AUTO_ASSIGN ? revision : key.timestamp, revision);
+      entry.ensure(encoded_length_vstr(escaped_len));
+      encode_vstr(&entry.ptr, escaped_buf, escaped_len);
+      sort_buf.add(entry);
+
+      ranges.lower_bound((const char *)key.row)->second
+          .entries[writer.ag_index(cf->id)]++;
+      total_cells++;
+
+      if (sort_buf.memory_used() >= sort_memory) {
+        FileRun *run = new FileRun(format("%s/bulk_load.%d.%u",
+            temp_dir.c_str(), (int)getpid(), (unsigned)runs.size()));
+        sort_buf.sort();
+        sort_buf.spill(run->fp());
+        run->rewind();
+        runs.push_back(run);
+      }
+    }
+
+    sort_buf.sort();
+    runs.push_back(new SortBuffer::Run(sort_buf));
+
+    HT_INFOF("Sorted %llu cells into %u runs", (Llu)total_cells,
+             (unsigned)runs.size());
+
+    /**
+     * Merge the runs into CellStores
+     */
+    std::priority_queue<SortedRun *, std::vector<SortedRun *>, GtRun> heap;
+    Key cur_key;
+
+    foreach(SortedRun *run, runs) {
+      if (run->next())
+        heap.push(run);
+    }
+
+    while (!heap.empty()) {
+      SortedRun *run = heap.top();
+      heap.pop();
+      cur_key.load(run->key);
+      writer.add(cur_key, run->value);
+      if (run->next())
+        heap.push(run);
+    }
+    writer.finish_range();
+
+    foreach(SortedRun *run, runs)
+      delete run;
+
+    /**
+     * Hand the CellStores to the RangeServers
+     */
+    RangeServerClient rsc(Comm::instance(), get_i32("Hypertable.Request.Timeout"));
+    size_t files = 0;
+
+    foreach(RangeMap::value_type &v, ranges) {
+      if (v.second.files.empty())
+        continue;
+      install_cell_stores(client, table, rsc, v.second);
+      files += v.second.files.size();
+    }
+
+    cout << "Loaded " << total_cells << " cells into " << files
+         << " CellStores" << endl;
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+  return 0;
+}
+
+
+namespace {
+
+void fetch_ranges(ClientPtr &client, uint32_t table_id, RangeMap &ranges) {
+  TablePtr metadata = client->open_table("METADATA");
+  TableScannerPtr scanner;
+  ScanSpec scan_spec;
+  RowInterval ri;
+  Cell cell;
+  char start_row[16];
+  char end_row[16];
+
+  scan_spec.max_versions = 1;
+  sprintf(start_row, "%u:", (unsigned)table_id);
+  ri.start = start_row;
+  sprintf(end_row, "%u:%s", (unsigned)table_id, Key::END_ROW_MARKER);
+  ri.end = end_row;
+  scan_spec.row_intervals.push_back(ri);
+  scan_spec.columns.push_back("StartRow");
+  scan_spec.columns.push_back("Location");
+
+  scanner = metadata->create_scanner(scan_spec);
+
+  while (scanner->next(cell)) {
+    const char *row = strchr(cell.row_key, ':');
+    if (row == 0)
+      HT_THROWF(Error::BAD_KEY, "Mal-formed METADATA row key '%s'",
+                cell.row_key);
+    RangeInfo &range = ranges[++row];
+    range.end_row = row;
+    if (!strcmp(cell.column_family, "StartRow"))
+      range.start_row = String((const char *)cell.value, cell.value_len);
+    else
+      range.location = String((const char *)cell.value, cell.value_len);
+  }
+
+  if (ranges.empty() || ranges.rbegin()->first != Key::END_ROW_MARKER)
+    HT_THROWF(Error::RANGESERVER_RANGE_NOT_FOUND, "Incomplete METADATA for "
+              "table %u", (unsigned)table_id);
+}
+
+} // local namespace
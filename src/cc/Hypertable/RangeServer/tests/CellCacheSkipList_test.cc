@@ -0,0 +1,189 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/Serialization.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include "Hypertable/Lib/Key.h"
+
+#include "../CellCacheMap.h"
+#include "../CellCacheSkipList.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  const int ROWS = 2000;
+  const int COLUMNS = 5;
+
+  void make_key(DynamicBuffer &buf, Key &key, int row, int column,
+                uint8_t flag = FLAG_INSERT) {
+    char rowbuf[32], qualifier[32];
+    sprintf(rowbuf, "row%06d", row);
+    sprintf(qualifier, "q%d", column);
+    buf.clear();
+    create_key_and_append(buf, flag, rowbuf, 1, qualifier,
+                          (int64_t)column + 1, (int64_t)column + 1);
+    key.load(SerializedKey(buf.base));
+  }
+
+  void add_cell(CellCache *cache, int row, int column) {
+    DynamicBuffer buf(64);
+    uint8_t valuebuf[32], *ptr = valuebuf;
+    Key key;
+    make_key(buf, key, row, column);
+    Serialization::encode_vi32(&ptr, 5);
+    memcpy(ptr, "value", 5);
+    cache->lock();
+    cache->add(key, ByteString(valuebuf));
+    cache->unlock();
+  }
+
+  /**
+   * Scans the whole cache, checks that keys come back in order and returns
+   * them serialized in out.
+   */
+  size_t scan(CellCache *cache, vector<String> *out = 0) {
+    ScanContextPtr scan_ctx = new ScanContext();
+    CellListScannerPtr scanner = cache->create_scanner(scan_ctx);
+    Key key;
+    ByteString value;
+    String last, cur;
+    size_t count = 0;
+
+    while (scanner->get(key, value)) {
+      cur = String((const char *)key.serial.ptr, key.length);
+      HT_ASSERT(count == 0 || SerializedKey((const uint8_t *)last.c_str())
+                < SerializedKey((const uint8_t *)cur.c_str()));
+      HT_ASSERT(value.length() == 6 && !memcmp(value.str(), "value", 5));
+      if (out)
+        out->push_back(cur);
+      last.swap(cur);
+      count++;
+      scanner->forward();
+    }
+    return count;
+  }
+
+  struct Writer {
+    Writer(CellCache *cache, int begin, int end)
+      : cache(cache), begin(begin), end(end) { }
+    void operator()() {
+      for (int i=begin; i<end; i++) {
+        int cell = (i * 7919) % (ROWS * COLUMNS);
+        add_cell(cache, cell / COLUMNS, cell % COLUMNS);
+      }
+    }
+    CellCache *cache;
+    int begin, end;
+  };
+
+  struct Reader {
+    Reader(CellCache *cache, volatile bool *done)
+      : cache(cache), done(done) { }
+    void operator()() {
+      size_t last = 0, count;
+      while (!*done) {
+        count = scan(cache);
+        HT_ASSERT(count >= last);
+        last = count;
+      }
+    }
+    CellCache *cache;
+    volatile bool *done;
+  };
+
+}
+
+
+int main(int argc, char **argv) {
+  Config::init(argc, argv);
+
+  CellCachePtr map_cache = new CellCacheMap();
+  CellCachePtr skip_list = new CellCacheSkipList();
+  vector<String> map_keys, skip_list_keys;
+  vector<int> order;
+
+  for (int i=0; i<ROWS*COLUMNS; i++)
+    order.push_back(i);
+  srand(1);
+  random_shuffle(order.begin(), order.end());
+
+  // both caches return the same keys in the same order
+  for (size_t i=0; i<order.size(); i++) {
+    add_cell(map_cache.get(), order[i] / COLUMNS, order[i] % COLUMNS);
+    add_cell(skip_list.get(), order[i] / COLUMNS, order[i] % COLUMNS);
+  }
+  HT_ASSERT(scan(map_cache.get(), &map_keys) == (size_t)ROWS*COLUMNS);
+  HT_ASSERT(scan(skip_list.get(), &skip_list_keys) == (size_t)ROWS*COLUMNS);
+  HT_ASSERT(map_keys == skip_list_keys);
+  HT_ASSERT(skip_list->size() == (size_t)ROWS*COLUMNS);
+
+  // duplicate keys are counted as collisions and not inserted
+  add_cell(skip_list.get(), 0, 0);
+  HT_ASSERT(skip_list->get_collision_count() == 1);
+  HT_ASSERT(skip_list->size() == (size_t)ROWS*COLUMNS);
+
+  // split samples cover every key and value byte exactly once
+  {
+    vector<SplitSample> samples;
+    int64_t total = 0, expected = 0;
+    for (size_t i=0; i<skip_list_keys.size(); i++)
+      expected += skip_list_keys[i].length() + 6;
+    skip_list->get_split_samples(samples);
+    HT_ASSERT(samples.size() > 1);
+    for (size_t i=0; i<samples.size(); i++) {
+      HT_ASSERT(i == 0 || samples[i-1].row < samples[i].row);
+      total += samples[i].bytes;
+    }
+    HT_ASSERT(total == expected);
+    HT_ASSERT(samples.back().row == "row001999");
+  }
+
+  // scanners running concurrently with a writer see a sorted, growing list
+  {
+    CellCachePtr cache = new CellCacheSkipList();
+    volatile bool done = false;
+    boost::thread_group readers;
+    for (int i=0; i<3; i++)
+      readers.create_thread(Reader(cache.get(), &done));
+    boost::thread writer(Writer(cache.get(), 0, ROWS*COLUMNS));
+    writer.join();
+    done = true;
+    readers.join_all();
+    HT_ASSERT(scan(cache.get()) == (size_t)ROWS*COLUMNS);
+  }
+
+  cout << "CellCacheSkipList test passed" << endl;
+
+  return 0;
+}
@@ -115,6 +115,7 @@ int main(int argc, char **argv) {
 
     Config::properties->set("Hypertable.RangeServer.CellStore.DefaultCompressor", String("none"));
     Config::properties->set("Hypertable.RangeServer.CellStore.DefaultBlockSize", 4*1024*1024);
+    Config::properties->set("Hypertable.RangeServer.CellStore.PrefixCompressKeys", false);
 
     cs = new CellStoreV1(Global::dfs);
     HT_TRY("creating cellstore", cs->create(csname.c_str(), 4096, Config::properties));
@@ -0,0 +1,140 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "Hypertable/RangeServer/CellStoreBlock.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  /**
+   * Builds a sorted run of keys with long common row prefixes and several
+   * cells per row, and the matching values.
+   */
+  void build_cells(DynamicBuffer &keys, DynamicBuffer &values,
+                   vector<size_t> &key_offsets, vector<size_t> &value_offsets,
+                   int rows) {
+    char row[64], qualifier[32], value[32];
+    for (int r = 0; r < rows; r++) {
+      sprintf(row, "com.example.www/some/long/path/prefix/%08d", r * 2);
+      for (int q = 0; q < 5; q++) {
+        sprintf(qualifier, "q%d", q);
+        key_offsets.push_back(keys.fill());
+        create_key_and_append(keys, FLAG_INSERT, row, 1, qualifier,
+                              1000 - q, 1000 - q);
+        sprintf(value, "value-%d-%d", r, q);
+        value_offsets.push_back(values.fill());
+        append_as_byte_string(values, value, strlen(value));
+      }
+    }
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  DynamicBuffer keys(0), values(0), plain(0), compressed(0);
+  vector<size_t> key_offsets, value_offsets;
+  CellStoreBlockBuilder builder;
+  CellStoreBlockDecoder decoder;
+  size_t n;
+
+  build_cells(keys, values, key_offsets, value_offsets, 100);
+  n = key_offsets.size();
+
+  for (size_t i = 0; i < n; i++) {
+    SerializedKey key(keys.base + key_offsets[i]);
+    ByteString value(values.base + value_offsets[i]);
+    plain.add(key.ptr, key.length());
+    plain.add(value.ptr, value.length());
+    builder.add(compressed, key, value);
+    HT_ASSERT(builder.last_key() == key);
+  }
+  builder.finish(compressed);
+
+  cout << "plain block " << plain.fill() << " bytes, prefix compressed block "
+       << compressed.fill() << " bytes" << endl;
+  HT_ASSERT(compressed.fill() < plain.fill() / 2);
+
+  /**
+   * Both layouts must decode to the same sequence of key/value pairs
+   */
+  for (int layout = 0; layout < 2; layout++) {
+    DynamicBuffer &block = layout ? compressed : plain;
+    size_t i = 0;
+
+    HT_ASSERT(decoder.load(block.base, block.fill(), layout == 1));
+    do {
+      SerializedKey key(keys.base + key_offsets[i]);
+      ByteString value(values.base + value_offsets[i]);
+      HT_ASSERT(decoder.key() == key);
+      HT_ASSERT(decoder.key().length() == key.length());
+      HT_ASSERT(!memcmp(decoder.key().ptr, key.ptr, key.length()));
+      HT_ASSERT(!memcmp(decoder.value().ptr, value.ptr, value.length()));
+      i++;
+    } while (decoder.next());
+    HT_ASSERT(i == n);
+  }
+
+  /**
+   * Seek to every key, and to keys that fall between two stored keys
+   */
+  for (size_t i = 0; i < n; i++) {
+    SerializedKey key(keys.base + key_offsets[i]);
+
+    HT_ASSERT(decoder.load(compressed.base, compressed.fill(), true));
+    HT_ASSERT(decoder.seek(key));
+    HT_ASSERT(!memcmp(decoder.key().ptr, key.ptr, key.length()));
+
+    if (i % 5 == 0) {
+      DynamicBuffer between(0);
+      char row[64];
+      sprintf(row, "com.example.www/some/long/path/prefix/%08d",
+              (int)(i / 5) * 2 - 1);
+      create_key_and_append(between, row);
+      HT_ASSERT(decoder.load(compressed.base, compressed.fill(), true));
+      HT_ASSERT(decoder.seek(SerializedKey(between.base)));
+      HT_ASSERT(!memcmp(decoder.key().ptr, key.ptr, key.length()));
+    }
+  }
+
+  // seeking past the last key exhausts the block
+  {
+    DynamicBuffer past(0);
+    create_key_and_append(past, "com.example.www/some/long/path/prefix/99999999");
+    HT_ASSERT(decoder.load(compressed.base, compressed.fill(), true));
+    HT_ASSERT(!decoder.seek(SerializedKey(past.base)));
+  }
+
+  return 0;
+}
@@ -0,0 +1,204 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/InetAddr.h"
+#include "Common/Serialization.h"
+#include "Common/System.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "AsyncComm/ApplicationQueue.h"
+#include "AsyncComm/ConnectionManager.h"
+
+#include "DfsBroker/Lib/Client.h"
+
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/Schema.h"
+
+#include "../CellStoreFactory.h"
+#include "../CellStoreV1.h"
+#include "../FileBlockCache.h"
+#include "../Global.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  const uint16_t DEFAULT_DFSBROKER_PORT = 38030;
+  const int ROWS = 5000;
+
+  const char *schema_str =
+  "<Schema>\n"
+  "  <AccessGroup name=\"default\">\n"
+  "    <ColumnFamily id=\"1\">\n"
+  "      <Name>tag</Name>\n"
+  "    </ColumnFamily>\n"
+  "  </AccessGroup>\n"
+  "</Schema>";
+
+  /**
+   * Writes ROWS cells, each with a value derived from its row, into a
+   * CellStore with small blocks so that many of them are in flight in
+   * the compression queue at once
+   */
+  void write_store(const String &name) {
+    PropertiesPtr cs_props = new Properties();
+    CellStorePtr cs = new CellStoreV1(Global::dfs);
+    DynamicBuffer buf(64);
+    char row[32], value[32];
+    uint8_t valuebuf[64], *uptr;
+    Key key;
+
+    cs_props->set("blocksize", uint32_t(512));
+    HT_TRY("creating cellstore", cs->create(name.c_str(), ROWS, cs_props));
+
+    for (int i=0; i<ROWS; i++) {
+      sprintf(row, "row%06d", i);
+      sprintf(value, "value%06d", i);
+      buf.clear();
+      create_key_and_append(buf, FLAG_INSERT, row, 1, "q", (int64_t)i + 1,
+                            (int64_t)i + 1);
+      key.load(SerializedKey(buf.base));
+      uptr = valuebuf;
+      Serialization::encode_vi32(&uptr, strlen(value));
+      memcpy(uptr, value, strlen(value));
+      cs->add(key, ByteString(valuebuf));
+    }
+
+    TableIdentifier table_id;
+    cs->finalize(&table_id);
+  }
+
+  /**
+   * Scans the given cells of a store, checks that keys come back in order
+   * and that every value matches its row, and returns the rows seen
+   */
+  vector<String> scan(CellStorePtr &cs, ScanContextPtr &scan_ctx) {
+    CellListScannerPtr scanner = cs->create_scanner(scan_ctx);
+    vector<String> rows;
+    Key key;
+    ByteString value;
+    char expected[32];
+
+    while (scanner->get(key, value)) {
+      HT_ASSERT(rows.empty() || rows.back() < key.row);
+      sprintf(expected, "value%s", key.row + 3);
+      HT_ASSERT(value.length() == strlen(expected) + 1);
+      HT_ASSERT(!memcmp(value.str(), expected, strlen(expected)));
+      rows.push_back(key.row);
+      scanner->forward();
+    }
+    return rows;
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  try {
+    struct sockaddr_in addr;
+    ConnectionManagerPtr conn_mgr;
+    DfsBroker::ClientPtr client;
+
+    Config::init(argc, argv);
+
+    System::initialize(System::locate_install_dir(argv[0]));
+    ReactorFactory::initialize(2);
+
+    InetAddr::initialize(&addr, "localhost", DEFAULT_DFSBROKER_PORT);
+
+    conn_mgr = new ConnectionManager();
+    Global::dfs = new DfsBroker::Client(conn_mgr, addr, 15000);
+
+    // force broker client to be destroyed before connection manager
+    client = (DfsBroker::Client *)Global::dfs;
+
+    if (!client->wait_for_connection(15000)) {
+      HT_ERROR("Unable to connect to DFS");
+      return 1;
+    }
+
+    Global::block_cache = new FileBlockCache(20000000LL);
+
+    String testdir = "/CellStoreCompression_test";
+    client->mkdirs(testdir);
+
+    // one store compressed inline, one through the compression queue
+    write_store(testdir + "/inline");
+    Global::compression_queue = new ApplicationQueue(4);
+    write_store(testdir + "/queued");
+
+    SchemaPtr schema = Schema::new_instance(schema_str, strlen(schema_str),
+                                            true);
+    HT_ASSERT(schema->is_valid());
+
+    RangeSpec range;
+    range.start_row = "";
+    range.end_row = Key::END_ROW_MARKER;
+
+    CellStorePtr inline_cs = CellStoreFactory::open(testdir + "/inline", "",
+                                                    Key::END_ROW_MARKER);
+    CellStorePtr queued_cs = CellStoreFactory::open(testdir + "/queued", "",
+                                                    Key::END_ROW_MARKER);
+    ScanSpecBuilder ssbuilder;
+    ScanContextPtr scan_ctx = new ScanContext(TIMESTAMP_MAX,
+        &(ssbuilder.get()), &range, schema);
+
+    // blocks are written in the order they were filled
+    vector<String> rows = scan(queued_cs, scan_ctx);
+    HT_ASSERT(rows.size() == (size_t)ROWS);
+    HT_ASSERT(rows == scan(inline_cs, scan_ctx));
+
+    // and the block index points every row at the block that holds it
+    char row[32];
+    for (int i=0; i<ROWS; i+=37) {
+      sprintf(row, "row%06d", i);
+      ssbuilder.clear();
+      ssbuilder.add_row(row);
+      scan_ctx = new ScanContext(TIMESTAMP_MAX, &(ssbuilder.get()), &range,
+                                 schema);
+      rows = scan(queued_cs, scan_ctx);
+      HT_ASSERT(rows.size() == 1 && rows[0] == row);
+    }
+
+    Global::compression_queue->shutdown();
+    Global::compression_queue->join();
+
+    client->rmdir(testdir);
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+  catch (...) {
+    HT_ERROR_OUT << "unexpected exception caught" << HT_END;
+    return 1;
+  }
+  cout << "CellStore compression test passed" << endl;
+  return 0;
+}
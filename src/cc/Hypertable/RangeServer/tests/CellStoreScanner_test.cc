@@ -1457,6 +1457,43 @@ int main(int argc, char **argv) {
     scanner = cs->create_scanner(scan_ctx);
     display_scan(scanner, out);
 
+    // row and time bounds pruning (adds nothing to the output)
+    cs = CellStoreFactory::open(csname, "", Key::END_ROW_MARKER);
+    ssbuilder.clear();
+    ssbuilder.add_row_interval("row000450", true, "row000460", true);
+    scan_ctx = new ScanContext(TIMESTAMP_MAX, &(ssbuilder.get()), &range, schema);
+    HT_ASSERT(cs->may_intersect(scan_ctx));
+    ssbuilder.clear();
+    ssbuilder.add_row_interval("row000499", false, "row000600", true);
+    scan_ctx = new ScanContext(TIMESTAMP_MAX, &(ssbuilder.get()), &range, schema);
+    HT_ASSERT(!cs->may_intersect(scan_ctx));
+    // exclusive cell intervals that start or end on a boundary row of the
+    // store may still match other columns of that row
+    ssbuilder.clear();
+    ssbuilder.add_cell_interval("row000499", "tag:a", false,
+                                "row000600", "tag:a", true);
+    scan_ctx = new ScanContext(TIMESTAMP_MAX, &(ssbuilder.get()), &range, schema);
+    HT_ASSERT(cs->may_intersect(scan_ctx));
+    ssbuilder.clear();
+    ssbuilder.add_cell_interval("a", "tag:a", true,
+                                "row000000", "tag:z", false);
+    scan_ctx = new ScanContext(TIMESTAMP_MAX, &(ssbuilder.get()), &range, schema);
+    HT_ASSERT(cs->may_intersect(scan_ctx));
+    ssbuilder.clear();
+    ssbuilder.add_row("a");
+    scan_ctx = new ScanContext(TIMESTAMP_MAX, &(ssbuilder.get()), &range, schema);
+    HT_ASSERT(!cs->may_intersect(scan_ctx));
+
+    cs = CellStoreFactory::open(testdir + "/cs0", "", Key::END_ROW_MARKER);
+    ssbuilder.clear();
+    ssbuilder.set_time_interval(1, 2);
+    scan_ctx = new ScanContext(TIMESTAMP_MAX, &(ssbuilder.get()), &range, schema);
+    HT_ASSERT(cs->may_intersect(scan_ctx));
+    ssbuilder.clear();
+    ssbuilder.set_time_interval(timestamp, TIMESTAMP_MAX);
+    scan_ctx = new ScanContext(TIMESTAMP_MAX, &(ssbuilder.get()), &range, schema);
+    HT_ASSERT(!cs->may_intersect(scan_ctx));
+
     out << flush;
 
     String cmd_str = "diff CellStoreScanner_test.output "
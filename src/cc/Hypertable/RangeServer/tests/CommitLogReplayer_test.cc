@@ -0,0 +1,324 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/Serialization.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "AsyncComm/Comm.h"
+
+#include "DfsBroker/Lib/Client.h"
+
+#include "Hypertable/Lib/CommitLog.h"
+#include "Hypertable/Lib/CommitLogReader.h"
+#include "Hypertable/Lib/Config.h"
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/Schema.h"
+
+#include "../CommitLogReplayer.h"
+#include "../Range.h"
+#include "../TableInfo.h"
+#include "../TableInfoMap.h"
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+  typedef Meta::list<DfsClientPolicy, DefaultCommPolicy> Policies;
+
+  const char *schema_str =
+  "<Schema>\n"
+  "  <AccessGroup name=\"default\">\n"
+  "    <ColumnFamily id=\"1\">\n"
+  "      <Name>a</Name>\n"
+  "    </ColumnFamily>\n"
+  "  </AccessGroup>\n"
+  "  <AccessGroup name=\"second\">\n"
+  "    <ColumnFamily id=\"2\">\n"
+  "      <Name>b</Name>\n"
+  "    </ColumnFamily>\n"
+  "  </AccessGroup>\n"
+  "</Schema>";
+
+  const char *log_dir = "/hypertable/test_log/CommitLogReplayer_test";
+  const uint32_t TABLE_ID = 2;
+  const uint32_t DROPPED_TABLE_ID = 3;
+  const int ROWS = 100;
+  const int BLOCKS = 300;
+
+  /** End rows of the replayed ranges, the last one ends the table */
+  const char *end_rows[] = { "row015", "row030", "row050", "row075", 0 };
+
+  /** Source of cell store files for ranges that have none */
+  class NoFiles : public Metadata {
+  public:
+    virtual void reset_files_scan() { }
+    virtual bool get_next_files(String &ag_name, String &files) {
+      return false;
+    }
+    virtual void write_files(const String &ag_name, const String &files) { }
+  };
+
+  /** A range that records the keys added to it, in the order added */
+  class RecordingRange : public Range {
+  public:
+    RecordingRange(MasterClientPtr &master_client,
+                   const TableIdentifier *identifier, SchemaPtr &schema,
+                   const RangeSpec *range, RangeSet *range_set,
+                   const RangeState *state, Metadata *metadata)
+      : Range(master_client, identifier, schema, range, range_set, state,
+              metadata) { }
+    virtual void add(const Key &key, const ByteString value) {
+      added.push_back(String((const char *)key.serial.ptr, key.length));
+      revisions.push_back(key.revision);
+      Range::add(key, value);
+    }
+    vector<String> added;
+    vector<int64_t> revisions;
+  };
+
+  typedef intrusive_ptr<RecordingRange> RecordingRangePtr;
+
+  /**
+   * Builds a replay map holding one table split into the ranges of
+   * end_rows, all of them empty
+   */
+  TableInfoMapPtr build_map(SchemaPtr &schema,
+                            vector<RecordingRangePtr> &ranges) {
+    static TableIdentifier table("CommitLogReplayer_test");
+    MasterClientPtr master_client;
+    TableInfoMapPtr map = new TableInfoMap();
+    RangeState state;
+    NoFiles no_files;
+    const char *start_row = "";
+
+    table.id = TABLE_ID;
+    table.generation = 1;
+
+    TableInfoPtr table_info = new TableInfo(master_client, &table, schema);
+
+    ranges.clear();
+    for (size_t i=0; i<sizeof(end_rows)/sizeof(end_rows[0]); i++) {
+      const char *end_row = end_rows[i] ? end_rows[i] : Key::END_ROW_MARKER;
+      RangeSpec range_spec(start_row, end_row);
+      RecordingRangePtr range = new RecordingRange(master_client, &table,
+          schema, &range_spec, table_info.get(), &state, &no_files);
+      RangePtr base = range.get();
+      table_info->add_range(base);
+      ranges.push_back(range);
+      start_row = end_row;
+    }
+    map->set(TABLE_ID, table_info);
+    return map;
+  }
+
+  /**
+   * Writes a log of BLOCKS blocks of random cells.  Every cell has its own
+   * revision, increasing through the log, and some rows get several
+   * versions of the same cell.  Every tenth block belongs to a table that
+   * is not being replayed.
+   */
+  void write_log(DfsBroker::Client *dfs) {
+    CommitLog log(dfs, log_dir, properties);
+    DynamicBuffer buf;
+    int64_t revision = 0;
+    char row[32], qualifier[32], value[32];
+    int error;
+
+    for (int i=0; i<BLOCKS; i++) {
+      TableIdentifier table("CommitLogReplayer_test");
+      table.id = (i % 10 == 9) ? DROPPED_TABLE_ID : TABLE_ID;
+      table.generation = 1;
+
+      buf.clear();
+      buf.ensure(table.encoded_length());
+      table.encode(&buf.ptr);
+
+      int ncells = 1 + rand() % 100;
+      for (int j=0; j<ncells; j++) {
+        ++revision;
+        sprintf(row, "row%03d", rand() % ROWS);
+        sprintf(qualifier, "q%d", rand() % 3);
+        sprintf(value, "v%lld", (Lld)revision);
+        create_key_and_append(buf, FLAG_INSERT, row, 1 + rand() % 2,
+                              qualifier, revision, revision);
+        append_as_byte_string(buf, value, strlen(value));
+      }
+
+      if ((error = log.write(buf, revision)) != Error::OK)
+        HT_THROW(error, "Problem writing to log file");
+    }
+    log.close();
+  }
+
+  /** Replays the log cell by cell in the calling thread */
+  void serial_replay(DfsBroker::Client *dfs, TableInfoMapPtr &map) {
+    CommitLogReader reader(dfs, log_dir);
+    BlockCompressionHeaderCommitLog header;
+    const uint8_t *block;
+    size_t block_len;
+
+    while (reader.next(&block, &block_len, &header)) {
+      const uint8_t *ptr = block;
+      const uint8_t *end = block + block_len;
+      size_t remain = block_len;
+      TableIdentifier table(&ptr, &remain);
+      TableInfoPtr table_info;
+      SerializedKey serkey;
+      ByteString value;
+      Key key;
+
+      if (!map->get(table.id, table_info))
+        continue;
+
+      while (ptr < end) {
+        RangePtr range;
+        String start_row, end_row;
+
+        serkey.ptr = ptr;
+        ptr += serkey.length();
+        value.ptr = ptr;
+        ptr += value.length();
+        key.load(serkey);
+        HT_ASSERT(table_info->find_containing_range(key.row, range,
+                                                    start_row, end_row));
+        Locker<Range> lock(*range);
+        range->add(key, value);
+      }
+    }
+  }
+
+  /** Scans the whole range */
+  vector<String> contents(RecordingRangePtr &range, SchemaPtr &schema) {
+    ScanContextPtr scan_ctx = new ScanContext(TIMESTAMP_MAX, schema);
+    CellListScannerPtr scanner = range->create_scanner(scan_ctx);
+    vector<String> cells;
+    Key key;
+    ByteString value;
+
+    while (scanner->get(key, value)) {
+      const uint8_t *v;
+      size_t len = value.decode_length(&v);
+      cells.push_back(String((const char *)key.serial.ptr, key.length)
+                      + String((const char *)v, len));
+      scanner->forward();
+    }
+    return cells;
+  }
+
+  /**
+   * Replays the log with the given number of threads and checks each range
+   * against the serial replay: the same cells, added in the same order,
+   * which is the order of their revisions
+   */
+  void check_replay(DfsBroker::Client *dfs, SchemaPtr &schema,
+                    vector<RecordingRangePtr> &expected,
+                    int decompress_threads, int apply_threads,
+                    size_t buffer_limit) {
+    vector<RecordingRangePtr> ranges;
+    TableInfoMapPtr map = build_map(schema, ranges);
+    CommitLogReplayer replayer(map, decompress_threads, apply_threads,
+                               buffer_limit);
+    CommitLogReaderPtr reader = new CommitLogReader(dfs, log_dir);
+
+    replayer.replay(reader);
+
+    for (size_t i=0; i<ranges.size(); i++) {
+      RecordingRangePtr &range = ranges[i];
+      for (size_t j=1; j<range->revisions.size(); j++)
+        HT_ASSERT(range->revisions[j-1] < range->revisions[j]);
+      if (range->added != expected[i]->added) {
+        cout << "range " << range->get_name() << " got "
+             << range->added.size() << " cells, expected "
+             << expected[i]->added.size() << " (" << decompress_threads
+             << " decompress threads, " << apply_threads
+             << " apply threads)" << endl;
+        HT_ASSERT(!"replay differs from serial replay");
+      }
+      HT_ASSERT(contents(range, schema) == contents(expected[i], schema));
+    }
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  try {
+    init_with_policies<Policies>(argc, argv);
+
+    ConnectionManagerPtr conn_mgr = new ConnectionManager(Comm::instance());
+    int timeout = has("dfs-timeout") ? get_i32("dfs-timeout") : 180000;
+    InetAddr addr(get_str("dfs-host"), get_i16("dfs-port"));
+    DfsBroker::Client *dfs = new DfsBroker::Client(conn_mgr, addr, timeout);
+
+    if (!dfs->wait_for_connection(10000)) {
+      HT_ERROR("Unable to connect to DFS Broker, exiting...");
+      return 1;
+    }
+
+    SchemaPtr schema = Schema::new_instance(schema_str, strlen(schema_str),
+                                            true);
+    if (!schema->is_valid()) {
+      HT_ERRORF("Schema Parse Error: %s", schema->get_error_string());
+      return 1;
+    }
+
+    srand(1);
+    dfs->rmdir(log_dir);
+    dfs->mkdirs(log_dir);
+    write_log(dfs);
+
+    vector<RecordingRangePtr> expected;
+    TableInfoMapPtr map = build_map(schema, expected);
+    serial_replay(dfs, map);
+
+    size_t total = 0;
+    foreach(RecordingRangePtr &range, expected) {
+      HT_ASSERT(!range->added.empty());
+      total += range->added.size();
+    }
+    HT_ASSERT(total > (size_t)BLOCKS * 10);
+
+    check_replay(dfs, schema, expected, 1, 1, 1024 * 1024);
+    check_replay(dfs, schema, expected, 3, 4, 1024 * 1024);
+    // a buffer limit below the size of one block keeps the reader waiting
+    check_replay(dfs, schema, expected, 4, 3, 1);
+
+    dfs->rmdir(log_dir);
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+
+  cout << "CommitLogReplayer test passed" << endl;
+
+  return 0;
+}
@@ -0,0 +1,253 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "Hypertable/Lib/KeySpec.h"
+
+#include "../CompactionPolicy.h"
+#include "../Global.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  typedef CompactionPolicy::StoreInfo StoreInfo;
+
+  const int64_t SECOND = 1000000000LL;
+
+  void add_store(vector<StoreInfo> &info, int64_t disk_usage,
+                 int64_t timestamp_max = TIMESTAMP_MAX,
+                 const char *first_row = 0, const char *last_row = 0) {
+    StoreInfo si;
+    si.index = info.size();
+    si.disk_usage = disk_usage;
+    si.entries = 1000;
+    si.deletes = 0;
+    si.timestamp_min = TIMESTAMP_MIN;
+    si.timestamp_max = timestamp_max;
+    si.has_row_bounds = first_row != 0;
+    if (first_row) {
+      si.first_row = first_row;
+      si.last_row = last_row;
+    }
+    info.push_back(si);
+  }
+
+  /** Returns the sorted indexes of the stores the policy chooses */
+  vector<size_t> select(CompactionPolicyPtr &policy,
+                        const vector<StoreInfo> &info) {
+    vector<size_t> merge;
+    policy->select(info, merge);
+    sort(merge.begin(), merge.end());
+    return merge;
+  }
+
+  vector<size_t> indexes(size_t a, size_t b, size_t c) {
+    vector<size_t> v;
+    v.push_back(a);
+    v.push_back(b);
+    v.push_back(c);
+    return v;
+  }
+
+  void test_merging() {
+    CompactionPolicyPtr policy = CompactionPolicy::create("merging");
+    vector<StoreInfo> info;
+
+    // up to MaxFiles stores are left alone
+    add_store(info, 50);
+    add_store(info, 10);
+    add_store(info, 40);
+    add_store(info, 20);
+    HT_ASSERT(select(policy, info).empty());
+
+    // past MaxFiles, the MergeFiles smallest are merged
+    add_store(info, 30);
+    HT_ASSERT(select(policy, info) == indexes(1, 3, 4));
+
+    // deletes do not matter to this policy
+    info[0].deletes = info[0].entries;
+    HT_ASSERT(select(policy, info) == indexes(1, 3, 4));
+  }
+
+  void test_size_tiered() {
+    CompactionPolicyPtr policy = CompactionPolicy::create("size-tiered");
+    vector<StoreInfo> info;
+
+    // a tier of three similar stores is merged, the bigger tier is not
+    add_store(info, 10000);
+    add_store(info, 1000);
+    add_store(info, 11000);
+    add_store(info, 1100);
+    add_store(info, 1050);
+    HT_ASSERT(select(policy, info) == indexes(1, 3, 4));
+
+    // two stores do not make a tier worth merging
+    info.pop_back();
+    HT_ASSERT(select(policy, info).empty());
+
+    // stores below MinSize all share the first tier
+    info.clear();
+    add_store(info, 10);
+    add_store(info, 5000);
+    add_store(info, 50);
+    add_store(info, 90);
+    HT_ASSERT(select(policy, info) == indexes(0, 2, 3));
+
+    // enough delete records make it merge every store
+    info.clear();
+    add_store(info, 1000);
+    add_store(info, 10000);
+    info[1].deletes = 500;
+    HT_ASSERT(select(policy, info).size() == 2);
+    info[1].deletes = 100;
+    HT_ASSERT(select(policy, info).empty());
+
+    // stores that overlap no other store of the tier are left out
+    info.clear();
+    add_store(info, 1000, TIMESTAMP_MAX, "a", "c");
+    add_store(info, 1010, TIMESTAMP_MAX, "b", "d");
+    add_store(info, 1020, TIMESTAMP_MAX, "x", "z");
+    add_store(info, 1030, TIMESTAMP_MAX, "c", "e");
+    HT_ASSERT(select(policy, info) == indexes(0, 1, 3));
+
+    // so a tier of disjoint stores is not merged at all
+    info[1].first_row = "m";
+    info[1].last_row = "n";
+    HT_ASSERT(select(policy, info).empty());
+
+    // stores without row bounds overlap everything
+    info[2].has_row_bounds = false;
+    HT_ASSERT(select(policy, info).size() == 4);
+  }
+
+  void test_time_window() {
+    CompactionPolicyPtr policy = CompactionPolicy::create("time-window");
+    vector<StoreInfo> info;
+
+    Global::access_group_max_files = 10;
+
+    // only the stores of the newest window are merged
+    add_store(info, 1000, 5 * SECOND + 500);
+    add_store(info, 1000, 2 * SECOND);
+    add_store(info, 9000, 5 * SECOND + 100);
+    add_store(info, 1000, 3 * SECOND);
+    HT_ASSERT(select(policy, info).empty());
+    add_store(info, 1000, 5 * SECOND + 900);
+    HT_ASSERT(select(policy, info) == indexes(0, 2, 4));
+
+    // stores without timestamps count as current
+    info.pop_back();
+    add_store(info, 1000);
+    HT_ASSERT(select(policy, info) == indexes(0, 2, 4));
+
+    // a newer window leaves the older stores alone
+    add_store(info, 1000, 6 * SECOND);
+    HT_ASSERT(select(policy, info).empty());
+
+    // until there are more than MaxFiles stores
+    Global::access_group_max_files = 4;
+    HT_ASSERT(select(policy, info).size() == 3);
+  }
+
+  void test_estimate_garbage() {
+    const double threshold = 0.3;  // GarbageCompaction.Threshold default
+    const int64_t ttl = 10 * SECOND;
+    vector<StoreInfo> info;
+
+    // no delete records and no TTL, nothing to collect
+    add_store(info, 1000);
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, 0, 0) == 0);
+
+    // every delete record is taken to shadow one more cell
+    info[0].deletes = 100;
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, 0, 0) == 200);
+    info[0].deletes = 150;
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, 0, 0)
+              >= threshold * info[0].disk_usage);
+    info[0].deletes = 800;
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, 0, 0) == 1000);
+
+    // a store without timestamps in its trailer never expires
+    info[0].deletes = 0;
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 100 * SECOND)
+              == 0);
+
+    // cells expire in proportion to how much of the store's time span lies
+    // before the cutoff
+    info[0].timestamp_min = 10 * SECOND;
+    info[0].timestamp_max = 20 * SECOND;
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 15 * SECOND)
+              == 0);
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 20 * SECOND)
+              == 0);
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 22 * SECOND)
+              == 200);
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 23 * SECOND)
+              >= threshold * info[0].disk_usage);
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 30 * SECOND)
+              == 1000);
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, 0, 30 * SECOND) == 0);
+
+    // expired cells and delete records add up, to no more than the store
+    info[0].deletes = 100;
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 22 * SECOND)
+              == 400);
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 29 * SECOND)
+              == 1000);
+
+    // the estimates of the stores are summed
+    add_store(info, 3000);
+    info[1].deletes = 50;
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, 0, 0) == 200 + 300);
+    HT_ASSERT(CompactionPolicy::estimate_garbage(info, ttl, 22 * SECOND)
+              == 400 + 300);
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  Config::init(argc, argv);
+
+  Global::access_group_max_files = 4;
+  Global::access_group_merge_files = 3;
+  Config::properties->set("Hypertable.RangeServer.AccessGroup"
+      ".CompactionPolicy.SizeTiered.MinSize", int64_t(100));
+  Config::properties->set("Hypertable.RangeServer.AccessGroup"
+      ".CompactionPolicy.TimeWindow.Size", int32_t(1));
+
+  test_merging();
+  test_size_tiered();
+  test_time_window();
+  test_estimate_garbage();
+
+  cout << "CompactionPolicy test passed" << endl;
+
+  return 0;
+}
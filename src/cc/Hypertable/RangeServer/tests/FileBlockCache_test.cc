@@ -23,7 +23,6 @@
 #include <cstdlib>
 #include <cstdio>
 #include <iostream>
-#include <list>
 #include <vector>
 
 extern "C" {
@@ -48,17 +47,6 @@ namespace {
     uint32_t file_offset;
     uint32_t length;
   };
-  struct LtBufferRecord {
-    bool operator()(const struct BufferRecord &br1,
-                    const struct BufferRecord &br2) const {
-      if (br1.file_id == br2.file_id) {
-        if (br1.file_offset == br2.file_offset)
-          return br1.length < br2.length;
-        return br1.file_offset < br2.file_offset;
-      }
-      return br1.file_id < br2.file_id;
-    }
-  };
 }
 
 #define MAX_MEMORY 50000000
@@ -66,11 +54,12 @@ namespace {
 #define TARGET_BUFSIZE 65536
 #define MAX_FILE_ID 10
 #define MAX_FILE_OFFSET 100
+#define HOT_BLOCKS 100
+#define SCAN_BLOCKS 2000
 
 int main(int argc, char **argv) {
   FileBlockCache *cache;
   vector<BufferRecord> input_data;
-  list<BufferRecord> history;
   BufferRecord rec;
   unsigned long seed = (unsigned long)getpid();
   uint64_t total_alloc = 0;
@@ -80,7 +69,6 @@ int main(int argc, char **argv) {
   uint8_t *block;
   uint32_t length;
   int index;
-  set<BufferRecord, LtBufferRecord> lru;
 
   System::initialize(System::locate_install_dir(argv[0]));
 
@@ -129,51 +117,67 @@ int main(int argc, char **argv) {
       total_alloc += length;
       cache->checkin(file_id, file_offset);
     }
-    history.push_front(input_data[index]);
   }
 
   /**
-   * Now verify that our idea of LRU is actually in the cache
+   * Verify that the cache stayed within its memory limit
    */
-  total_alloc = 0;
-  list<BufferRecord>::iterator history_iter = history.begin();
-  while (total_alloc < MAX_MEMORY) {
-    rec.file_id = (*history_iter).file_id;
-    rec.file_offset = (*history_iter).file_offset;
-    rec.length = (*history_iter).length;
-    if (lru.find(rec) == lru.end()) {
-      if (total_alloc + (*history_iter).length > MAX_MEMORY)
-        break;
-      lru.insert(rec);
-      total_alloc += rec.length;
-      if (!cache->contains(rec.file_id, rec.file_offset)) {
-        HT_ERRORF("computed LRU does not match cache's (id=%d, offset=%u)",
-                  rec.file_id, rec.file_offset);
-        return 1;
-      }
-    }
-    ++history_iter;
+  vector<BlockCacheStat> stats;
+  uint64_t memory_used = 0;
+  cache->get_stats(stats);
+  for (size_t i=0; i<stats.size(); i++)
+    memory_used += stats[i].memory_used;
+  if (memory_used > MAX_MEMORY) {
+    HT_ERRORF("Cache exceeded memory limit (%llu > %llu)",
+              (Llu)memory_used, (Llu)MAX_MEMORY);
+    return 1;
   }
 
+  delete cache;
+
   /**
-   * Now verify that all of the remaining items that
-   * should *not* be in our LRU are, indeed, not in the cache
+   * Check that offsets beyond 4GB don't alias
    */
-  if (cache->contains(rec.file_id, rec.file_offset)) {
-    HT_ERROR("computed LRU does not match cache's");
-    return 1;
+  cache = new FileBlockCache(MAX_MEMORY);
+  uint8_t *low_block = new uint8_t [ 16 ];
+  uint8_t *high_block = new uint8_t [ 16 ];
+  int64_t high_offset = (1LL << 32) + 5;
+  HT_EXPECT(cache->insert_and_checkout(0, 5, low_block, 16),
+            Error::FAILED_EXPECTATION);
+  HT_EXPECT(cache->insert_and_checkout(0, high_offset, high_block, 16),
+            Error::FAILED_EXPECTATION);
+  HT_EXPECT(cache->checkout(0, high_offset, &block, &length) &&
+            block == high_block, Error::FAILED_EXPECTATION);
+  cache->checkin(0, high_offset);
+  cache->checkin(0, high_offset);
+  cache->checkin(0, 5);
+  delete cache;
+
+  /**
+   * Check that a large sequential scan doesn't flush out the blocks that
+   * are accessed repeatedly
+   */
+  cache = new FileBlockCache(MAX_MEMORY, 4);
+  for (int i=0; i<HOT_BLOCKS; i++) {
+    block = new uint8_t [ TARGET_BUFSIZE ];
+    HT_EXPECT(cache->insert_and_checkout(MAX_FILE_ID, i, block,
+              TARGET_BUFSIZE), Error::FAILED_EXPECTATION);
+    cache->checkin(MAX_FILE_ID, i);
+    HT_EXPECT(cache->checkout(MAX_FILE_ID, i, &block, &length),
+              Error::FAILED_EXPECTATION);
+    cache->checkin(MAX_FILE_ID, i);
+  }
+  for (int i=0; i<SCAN_BLOCKS; i++) {
+    block = new uint8_t [ TARGET_BUFSIZE ];
+    HT_EXPECT(cache->insert_and_checkout(MAX_FILE_ID+1, i, block,
+              TARGET_BUFSIZE), Error::FAILED_EXPECTATION);
+    cache->checkin(MAX_FILE_ID+1, i);
   }
-  while (history_iter != history.end()) {
-    rec.file_id = (*history_iter).file_id;
-    rec.file_offset = (*history_iter).file_offset;
-    rec.length = (*history_iter).length;
-    if (lru.find(rec) == lru.end()) {
-      if (cache->contains(rec.file_id, rec.file_offset)) {
-        HT_ERROR("computed LRU does not match cache's");
-        return 1;
-      }
+  for (int i=0; i<HOT_BLOCKS; i++) {
+    if (!cache->contains(MAX_FILE_ID, i)) {
+      HT_ERRORF("Sequential scan evicted hot block (offset=%d)", i);
+      return 1;
     }
-    ++history_iter;
   }
 
   delete cache;
@@ -0,0 +1,210 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/Serialization.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <vector>
+
+#include "Hypertable/Lib/Key.h"
+
+#include "../CellCacheMap.h"
+#include "../MergeScanner.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  /** A cell added to one of the merged caches */
+  struct TestCell {
+    String key;       // serialized key
+    size_t scanner;   // index of the cache holding it
+    bool operator<(const TestCell &other) const {
+      SerializedKey x((const uint8_t *)key.data());
+      SerializedKey y((const uint8_t *)other.key.data());
+      if (x < y)
+        return true;
+      if (y < x)
+        return false;
+      return scanner < other.scanner;
+    }
+  };
+
+  String make_key(int row, int column, int64_t timestamp) {
+    DynamicBuffer buf(64);
+    char rowbuf[32], qualifier[32];
+    sprintf(rowbuf, "row%03d", row);
+    sprintf(qualifier, "q%d", column);
+    create_key_and_append(buf, FLAG_INSERT, rowbuf, 1, qualifier, timestamp,
+                          timestamp);
+    return String((const char *)buf.base, buf.fill());
+  }
+
+  /**
+   * Fills count caches with cells drawn from a small key space, so that
+   * the same key often shows up in several caches.  Every cell's value is
+   * the index of its cache.  The first empty caches are left empty.
+   */
+  void fill_caches(vector<CellCachePtr> &caches, vector<TestCell> &cells,
+                   size_t count, size_t empty, size_t max_cells) {
+    for (size_t i=0; i<count; i++) {
+      CellCachePtr cache = new CellCacheMap();
+      set<String> keys;
+      size_t n = (i < empty) ? 0 : (size_t)(rand() % (max_cells + 1));
+
+      for (size_t j=0; j<n; j++)
+        keys.insert(make_key(rand() % 50, rand() % 3, 1 + rand() % 3));
+
+      foreach(const String &k, keys) {
+        uint8_t valuebuf[16], *ptr = valuebuf;
+        Key key;
+        TestCell cell;
+        char value[8];
+
+        sprintf(value, "%d", (int)i);
+        Serialization::encode_vi32(&ptr, strlen(value));
+        memcpy(ptr, value, strlen(value));
+        key.load(SerializedKey((const uint8_t *)k.data()));
+        cache->lock();
+        cache->add(key, ByteString(valuebuf));
+        cache->unlock();
+
+        cell.key = k;
+        cell.scanner = i;
+        cells.push_back(cell);
+      }
+      caches.push_back(cache);
+    }
+  }
+
+  /**
+   * Merges count caches and checks that the merged stream holds every cell
+   * in key order, with equal keys in the order of their caches
+   */
+  void check_merge(size_t count, size_t empty, size_t max_cells) {
+    vector<CellCachePtr> caches;
+    vector<TestCell> expected;
+    ScanContextPtr scan_ctx = new ScanContext();
+    MergeScanner *mscanner = new MergeScanner(scan_ctx);
+    CellListScannerPtr scanner = mscanner;
+    Key key;
+    ByteString value;
+    size_t i = 0;
+
+    fill_caches(caches, expected, count, empty, max_cells);
+    sort(expected.begin(), expected.end());
+
+    foreach(CellCachePtr &cache, caches)
+      mscanner->add_scanner(cache->create_scanner(scan_ctx));
+
+    while (scanner->get(key, value)) {
+      char scanner_index[8];
+      HT_ASSERT(i < expected.size());
+      HT_ASSERT(key.length == expected[i].key.length());
+      HT_ASSERT(!memcmp(key.serial.ptr, expected[i].key.data(), key.length));
+      sprintf(scanner_index, "%d", (int)expected[i].scanner);
+      HT_ASSERT(value.length() == strlen(scanner_index) + 1);
+      HT_ASSERT(!memcmp(value.str(), scanner_index, strlen(scanner_index)));
+      scanner->forward();
+      i++;
+    }
+    HT_ASSERT(i == expected.size());
+
+    // once done, the scanner stays done
+    scanner->forward();
+    HT_ASSERT(!scanner->get(key, value));
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  Config::init(argc, argv);
+
+  srand(1);
+
+  // no scanners at all
+  check_merge(0, 0, 0);
+
+  // a single scanner, two scanners, and counts that do not fill the
+  // bottom level of the loser tree
+  for (int round=0; round<20; round++) {
+    check_merge(1, 0, 200);
+    check_merge(2, 0, 200);
+    check_merge(3, 0, 200);
+    check_merge(5, 0, 100);
+    check_merge(7, 0, 100);
+    check_merge(8, 0, 100);
+  }
+
+  // scanners that are empty from the start or run dry early
+  for (int round=0; round<20; round++) {
+    check_merge(1, 1, 0);
+    check_merge(3, 2, 200);
+    check_merge(6, 3, 100);
+    check_merge(9, 0, 5);
+  }
+
+  // a single key present in every scanner comes out once per scanner
+  {
+    vector<CellCachePtr> caches;
+    ScanContextPtr scan_ctx = new ScanContext();
+    MergeScanner *mscanner = new MergeScanner(scan_ctx);
+    CellListScannerPtr scanner = mscanner;
+    String k = make_key(1, 1, 1);
+    Key key;
+    ByteString value;
+    size_t count = 0;
+
+    for (int i=0; i<5; i++) {
+      uint8_t valuebuf[16], *ptr = valuebuf;
+      CellCachePtr cache = new CellCacheMap();
+      Serialization::encode_vi32(&ptr, 1);
+      *ptr = '0' + i;
+      key.load(SerializedKey((const uint8_t *)k.data()));
+      cache->lock();
+      cache->add(key, ByteString(valuebuf));
+      cache->unlock();
+      caches.push_back(cache);
+      mscanner->add_scanner(cache->create_scanner(scan_ctx));
+    }
+
+    while (scanner->get(key, value)) {
+      HT_ASSERT(*value.str() == '0' + (int)count);
+      scanner->forward();
+      count++;
+    }
+    HT_ASSERT(count == 5);
+  }
+
+  cout << "MergeScanner test passed" << endl;
+
+  return 0;
+}
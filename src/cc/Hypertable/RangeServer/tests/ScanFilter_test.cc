@@ -0,0 +1,98 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+#include <iostream>
+
+#include "Common/Serialization.h"
+#include "Common/System.h"
+
+#include "Hypertable/RangeServer/ScanFilter.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  bool matches(ScanFilter &filter, const char *qualifier, const char *value) {
+    uint8_t buf[64], *ptr = buf;
+    Key key;
+    key.column_qualifier = qualifier;
+    key.column_qualifier_len = strlen(qualifier);
+    Serialization::encode_vi32(&ptr, strlen(value));
+    memcpy(ptr, value, strlen(value));
+    return filter.matches(key, ByteString(buf));
+  }
+
+  bool compiles(const vector<CellPredicate> &predicates) {
+    try {
+      ScanFilter filter(predicates);
+    }
+    catch (Exception &e) {
+      HT_ASSERT(e.code() == Error::RANGESERVER_BAD_SCAN_SPEC);
+      return false;
+    }
+    return true;
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  vector<CellPredicate> predicates;
+
+  System::initialize(System::locate_install_dir(argv[0]));
+
+  // qualifier =^ 'ab' AND (value = 'x' OR NOT value =~ '^y.*z$')
+  predicates.push_back(CellPredicate(CellPredicate::QUALIFIER_PREFIX, "ab"));
+  predicates.push_back(CellPredicate(CellPredicate::VALUE_EXACT, "x"));
+  predicates.push_back(CellPredicate(CellPredicate::VALUE_REGEX, "^y.*z$"));
+  predicates.push_back(CellPredicate(CellPredicate::NOT));
+  predicates.push_back(CellPredicate(CellPredicate::OR));
+  predicates.push_back(CellPredicate(CellPredicate::AND));
+
+  {
+    ScanFilter filter(predicates);
+    HT_ASSERT(matches(filter, "abc", "x"));
+    HT_ASSERT(matches(filter, "ab", "yaa"));
+    HT_ASSERT(!matches(filter, "abc", "yaz"));
+    HT_ASSERT(!matches(filter, "a", "x"));
+    HT_ASSERT(!matches(filter, "", ""));
+  }
+
+  // malformed expressions are rejected when the scan is created
+  predicates.pop_back();
+  HT_ASSERT(!compiles(predicates));
+  predicates.clear();
+  predicates.push_back(CellPredicate(CellPredicate::AND));
+  HT_ASSERT(!compiles(predicates));
+  predicates.clear();
+  predicates.push_back(CellPredicate(CellPredicate::QUALIFIER_REGEX, "("));
+  HT_ASSERT(!compiles(predicates));
+  predicates.clear();
+  predicates.push_back(CellPredicate(42, "x"));
+  HT_ASSERT(!compiles(predicates));
+
+  cout << "ScanFilter test passed" << endl;
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+/** -*- c++ -*-
+ * Copyright (C) 2009 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "Hypertable/Lib/Key.h"
+
+#include "../SelectSplitRow.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  /** Runs SelectSplitRow over the whole key space unless given a range */
+  bool select(vector<SplitSample> samples, String &split_row,
+              int64_t *low, int64_t *high, const String &start_row = "",
+              const String &end_row = Key::END_ROW_MARKER) {
+    return SelectSplitRow(samples, start_row, end_row, split_row, low, high);
+  }
+
+  void check(const vector<SplitSample> &samples, const char *row,
+             int64_t low, int64_t high, const String &start_row = "",
+             const String &end_row = Key::END_ROW_MARKER) {
+    String split_row;
+    int64_t low_bytes = -1, high_bytes = -1;
+    HT_ASSERT(select(samples, split_row, &low_bytes, &high_bytes, start_row,
+                     end_row));
+    if (split_row != row || low_bytes != low || high_bytes != high) {
+      cout << "got '" << split_row << "' " << low_bytes << "/" << high_bytes
+           << ", expected '" << row << "' " << low << "/" << high << endl;
+      HT_ASSERT(!"wrong split row");
+    }
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  vector<SplitSample> samples;
+  String split_row;
+  int64_t low, high;
+  char row[8];
+
+  // evenly sized rows split in the middle
+  for (char c='a'; c<='j'; c++) {
+    sprintf(row, "%c", c);
+    samples.push_back(SplitSample(row, 10));
+  }
+  check(samples, "e", 50, 50);
+
+  // skewed sizes move the split row towards the big rows
+  samples.clear();
+  samples.push_back(SplitSample("a", 1));
+  samples.push_back(SplitSample("b", 1));
+  samples.push_back(SplitSample("c", 1));
+  samples.push_back(SplitSample("d", 97));
+  check(samples, "c", 3, 97);
+
+  samples.clear();
+  samples.push_back(SplitSample("a", 90));
+  for (char c='b'; c<='k'; c++) {
+    sprintf(row, "%c", c);
+    samples.push_back(SplitSample(row, 1));
+  }
+  check(samples, "a", 90, 10);
+
+  // samples of several cell lists arrive unsorted and share rows
+  samples.clear();
+  samples.push_back(SplitSample("c", 10));
+  samples.push_back(SplitSample("a", 10));
+  samples.push_back(SplitSample("b", 10));
+  samples.push_back(SplitSample("a", 10));
+  check(samples, "a", 20, 20);
+
+  // rows at or outside of the range boundaries are never chosen, but their
+  // bytes still count
+  samples.clear();
+  samples.push_back(SplitSample("a", 90));
+  for (char c='b'; c<='k'; c++) {
+    sprintf(row, "%c", c);
+    samples.push_back(SplitSample(row, 1));
+  }
+  check(samples, "b", 91, 9, "a");
+
+  samples.clear();
+  samples.push_back(SplitSample("a", 1));
+  samples.push_back(SplitSample("b", 1));
+  samples.push_back(SplitSample("c", 1));
+  samples.push_back(SplitSample("d", 97));
+  check(samples, "b", 2, 98, "", "c");
+
+  samples.clear();
+  samples.push_back(SplitSample("a", 10));
+  samples.push_back(SplitSample("m", 10));
+  samples.push_back(SplitSample("z", 10));
+  check(samples, "m", 20, 10, "b", "y");
+
+  // no sample row strictly inside of the range
+  split_row = "unchanged";
+  HT_ASSERT(!select(samples, split_row, &low, &high, "b", "m"));
+  HT_ASSERT(!select(samples, split_row, &low, &high, "m", "y"));
+  HT_ASSERT(!select(samples, split_row, &low, &high, "zz"));
+
+  // no samples, or samples without any bytes
+  samples.clear();
+  HT_ASSERT(!select(samples, split_row, &low, &high));
+  samples.push_back(SplitSample("a", 0));
+  samples.push_back(SplitSample("b", 0));
+  HT_ASSERT(!select(samples, split_row, &low, &high));
+  HT_ASSERT(split_row == "unchanged");
+
+  cout << "SelectSplitRow test passed" << endl;
+
+  return 0;
+}
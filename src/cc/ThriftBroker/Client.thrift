@@ -46,6 +46,24 @@ typedef i64 Mutator
  */
 typedef binary Value
 
+/** A block of cells in the serialized cells encoding
+ *
+ * The block starts with a 4 byte version (currently 1) followed by the
+ * cells and a terminating byte with the value 0x80.  All integers are little
+ * endian.  Each cell is encoded as:
+ *
+ * <pre>
+ *   flags:u8 [timestamp:i64] [revision:i64]
+ *   row '\0' column_family '\0' column_qualifier '\0'
+ *   value_length:i32 value cell_flag:u8
+ * </pre>
+ *
+ * The timestamp is present if bit 0x01 of flags is set and the revision if
+ * bit 0x02 is set; otherwise they are assigned by the server.  An empty row
+ * means the cell has the same row as the previous cell.
+ */
+typedef binary CellsSerialized
+
 /** Specifies a range of rows
  *
  * <dl>
@@ -102,6 +120,43 @@ struct CellInterval {
   6: optional bool end_inclusive = 1
 }
 
+/** Operators of a cell filter term
+ *
+ * Note for maintainers: the definition must be sync'ed with the
+ * CellPredicate constants in src/cc/Hypertable/Lib/ScanSpec.h
+ *
+ * The QUALIFIER_* and VALUE_* terms test the column qualifier or the value
+ * of a cell against their pattern, as an exact match, a prefix or a POSIX
+ * extended regular expression.  AND, OR and NOT combine the results of the
+ * preceding terms.
+ */
+enum FilterOp {
+  QUALIFIER_EXACT = 1,
+  QUALIFIER_PREFIX = 2,
+  QUALIFIER_REGEX = 3,
+  VALUE_EXACT = 4,
+  VALUE_PREFIX = 5,
+  VALUE_REGEX = 6,
+  AND = 7,
+  OR = 8,
+  NOT = 9
+}
+
+/** One term of a cell filter expression
+ *
+ * <dl>
+ *   <dt>op</dt>
+ *   <dd>The operator of the term</dd>
+ *
+ *   <dt>pattern</dt>
+ *   <dd>The pattern of a QUALIFIER_* or VALUE_* term</dd>
+ * </dl>
+ */
+struct FilterTerm {
+  1: required FilterOp op
+  2: optional string pattern
+}
+
 /** Specifies options for a scan
  *
  * <dl>
@@ -131,6 +186,11 @@ struct CellInterval {
  *
  *   <dt>columns</dt>
  *   <dd>Specifies the names of the columns to return</dd>
+ *
+ *   <dt>filter</dt>
+ *   <dd>A cell filter expression as a list of terms in postfix order, e.g.
+ *   [QUALIFIER_PREFIX 'a', VALUE_EXACT 'x', NOT, AND].  Cells that do not
+ *   match are dropped by the range servers</dd>
  * </dl>
  */
 struct ScanSpec {
@@ -142,6 +202,7 @@ struct ScanSpec {
   6: optional i64 start_time
   7: optional i64 end_time
   8: optional list<string> columns
+  9: optional list<FilterTerm> filter
 }
 
 /** State flags for a table cell
@@ -288,6 +349,17 @@ service ClientService {
   list<CellAsArray> next_cells_as_arrays(1:Scanner scanner)
       throws (1:ClientException e),
 
+  /**
+   * Alternative interface returning a block of cells in the serialized
+   * cells encoding, which avoids creating an object per cell
+   *
+   * @param scanner - scanner id
+   *
+   * @return a block of cells, containing no cells at the end of the scan
+   */
+  CellsSerialized next_cells_serialized(1:Scanner scanner)
+      throws (1:ClientException e),
+
   /**
    * Iterate over rows of a scanner
    *
@@ -412,6 +484,19 @@ service ClientService {
   void set_cells_as_arrays(1:Mutator mutator, 2:list<CellAsArray> cells)
       throws (1:ClientException e),
 
+  /**
+   * Alternative interface taking a block of cells in the serialized cells
+   * encoding
+   *
+   * @param mutator - mutator id
+   *
+   * @param cells - a block of serialized cells
+   *
+   * @param flush - whether to flush the mutator after adding the cells
+   */
+  void set_cells_serialized(1:Mutator mutator, 2:CellsSerialized cells,
+                            3:bool flush = 0) throws (1:ClientException e),
+
   /**
    * Flush mutator buffers
    */
@@ -50,8 +50,10 @@ void init_thrift_broker_options() {
     ("port", i16()->default_value(38080), "Listening port")
     ("pidfile", str(), "File to contain the process id")
     ("log-api", boo()->default_value(false), "Enable or disable API logging")
+    ("workers", i32()->default_value(50), "Number of worker threads")
     ;
   alias("port", "ThriftBroker.Port");
+  alias("workers", "ThriftBroker.Workers");
   alias("log-api", "ThriftBroker.API.Logging");
 }
 
@@ -23,6 +23,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <concurrency/PosixThreadFactory.h>
+#include <concurrency/ThreadManager.h>
 #include <protocol/TBinaryProtocol.h>
 #include <server/TNonblockingServer.h>
 #include <transport/TServerSocket.h>
@@ -31,6 +33,7 @@
 #include "Common/Time.h"
 #include "Hypertable/Lib/Client.h"
 #include "Hypertable/Lib/HqlInterpreter.h"
+#include "Hypertable/Lib/SerializedCells.h"
 
 #include "Config.h"
 #include "ThriftHelper.h"
@@ -125,6 +128,10 @@ convert_scan_spec(const ThriftGen::ScanSpec &tss, Hypertable::ScanSpec &hss) {
 
   foreach(const std::string &col, tss.columns)
     hss.columns.push_back(col.c_str());
+
+  foreach(const ThriftGen::FilterTerm &ft, tss.filter)
+    hss.filter.push_back(Hypertable::CellPredicate(ft.op,
+        ft.__isset.pattern ? ft.pattern.c_str() : ""));
 }
 
 void convert_cell(const ThriftGen::Cell &tcell, Hypertable::Cell &hcell) {
@@ -261,6 +268,7 @@ public:
   ServerHandler() {
     m_log_api = Config::get_bool("ThriftBroker.API.Logging");
     m_next_limit = Config::get_i32("ThriftBroker.NextLimit");
+    m_next_threshold = Config::get_i32("ThriftBroker.NextThreshold");
     m_client = new Hypertable::Client();
   }
 
@@ -352,6 +360,25 @@ public:
     } RETHROW()
   }
 
+  virtual void
+  next_cells_serialized(CellsSerialized &result, const Scanner scanner_id) {
+    LOG_API("scanner="<< scanner_id);
+
+    try {
+      TableScannerPtr scanner = get_scanner(scanner_id);
+      SerializedCellsWriter writer(m_next_threshold + 1024);
+      Hypertable::Cell cell;
+
+      while (writer.size() < (size_t)m_next_threshold && scanner->next(cell))
+        writer.add(cell);
+      writer.finalize();
+
+      result.assign((const char *)writer.get_buffer(), writer.size());
+      LOG_API("scanner="<< scanner_id <<" cells="<< writer.count()
+              <<" result.size="<< result.size());
+    } RETHROW()
+  }
+
   virtual void next_row(ThriftCells &result, const Scanner scanner_id) {
     LOG_API("scanner="<< scanner_id);
 
@@ -502,6 +529,28 @@ public:
     } RETHROW()
   }
 
+  virtual void
+  set_cells_serialized(const Mutator mutator, const CellsSerialized &cells,
+                       const bool flush) {
+    LOG_API("mutator="<< mutator <<" cells.size="<< cells.size()
+            <<" flush="<< flush);
+
+    try {
+      SerializedCellsReader reader(cells.data(), cells.size());
+      Hypertable::Cells hcells;
+
+      // shallow copy
+      while (reader.next())
+        hcells.push_back(reader.get_cell());
+
+      TableMutatorPtr m = get_mutator(mutator);
+      m->set_cells(hcells);
+      if (flush)
+        m->flush();
+      LOG_API("mutator="<< mutator <<" cells="<< hcells.size() <<" done");
+    } RETHROW()
+  }
+
   virtual void
   set_cell_as_array(const Mutator mutator, const CellAsArray &cell) {
     // gcc 4.0.1 cannot seems to handle << cell here (see ThriftHelper.h)
@@ -706,6 +755,7 @@ private:
   Mutex      m_mutator_mutex;
   MutatorMap m_mutator_map;
   int32_t    m_next_limit;
+  int32_t    m_next_threshold;
   ClientPtr  m_client;
   Mutex      m_interp_mutex;
   HqlInterpreterPtr m_hql_interp;
@@ -760,9 +810,19 @@ int main(int argc, char **argv) {
     shared_ptr<TProtocolFactory> protocolFactory(new TBinaryProtocolFactory());
     shared_ptr<ServerHandler> handler(new ServerHandler());
     shared_ptr<TProcessor> processor(new HqlServiceProcessor(handler));
-    TNonblockingServer server(processor, protocolFactory, port);
 
-    HT_INFO("Starting the server...");
+    // handlers block on scanners and mutator flushes, so run them on a pool
+    // of workers rather than on the thread serving the connections
+    shared_ptr<ThreadManager> thread_manager =
+        ThreadManager::newSimpleThreadManager(get_i32("workers"));
+    thread_manager->threadFactory(
+        shared_ptr<PosixThreadFactory>(new PosixThreadFactory()));
+    thread_manager->start();
+
+    TNonblockingServer server(processor, protocolFactory, port,
+                              thread_manager);
+
+    HT_INFOF("Starting the server with %d workers...", get_i32("workers"));
     server.serve();
     HT_INFO("Exiting.\n");
   }
@@ -629,14 +629,14 @@ uint32_t ClientService_next_cells_result::read(apache::thrift::protocol::TProtoc
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size18;
-            apache::thrift::protocol::TType _etype21;
-            iprot->readListBegin(_etype21, _size18);
-            this->success.resize(_size18);
-            uint32_t _i22;
-            for (_i22 = 0; _i22 < _size18; ++_i22)
+            uint32_t _size25;
+            apache::thrift::protocol::TType _etype28;
+            iprot->readListBegin(_etype28, _size25);
+            this->success.resize(_size25);
+            uint32_t _i29;
+            for (_i29 = 0; _i29 < _size25; ++_i29)
             {
-              xfer += this->success[_i22].read(iprot);
+              xfer += this->success[_i29].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -675,10 +675,10 @@ uint32_t ClientService_next_cells_result::write(apache::thrift::protocol::TProto
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->success.size());
-      std::vector<Cell> ::const_iterator _iter23;
-      for (_iter23 = this->success.begin(); _iter23 != this->success.end(); ++_iter23)
+      std::vector<Cell> ::const_iterator _iter30;
+      for (_iter30 = this->success.begin(); _iter30 != this->success.end(); ++_iter30)
       {
-        xfer += (*_iter23).write(oprot);
+        xfer += (*_iter30).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -717,14 +717,14 @@ uint32_t ClientService_next_cells_presult::read(apache::thrift::protocol::TProto
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size24;
-            apache::thrift::protocol::TType _etype27;
-            iprot->readListBegin(_etype27, _size24);
-            (*(this->success)).resize(_size24);
-            uint32_t _i28;
-            for (_i28 = 0; _i28 < _size24; ++_i28)
+            uint32_t _size31;
+            apache::thrift::protocol::TType _etype34;
+            iprot->readListBegin(_etype34, _size31);
+            (*(this->success)).resize(_size31);
+            uint32_t _i35;
+            for (_i35 = 0; _i35 < _size31; ++_i35)
             {
-              xfer += (*(this->success))[_i28].read(iprot);
+              xfer += (*(this->success))[_i35].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -839,23 +839,23 @@ uint32_t ClientService_next_cells_as_arrays_result::read(apache::thrift::protoco
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size29;
-            apache::thrift::protocol::TType _etype32;
-            iprot->readListBegin(_etype32, _size29);
-            this->success.resize(_size29);
-            uint32_t _i33;
-            for (_i33 = 0; _i33 < _size29; ++_i33)
+            uint32_t _size36;
+            apache::thrift::protocol::TType _etype39;
+            iprot->readListBegin(_etype39, _size36);
+            this->success.resize(_size36);
+            uint32_t _i40;
+            for (_i40 = 0; _i40 < _size36; ++_i40)
             {
               {
-                this->success[_i33].clear();
-                uint32_t _size34;
-                apache::thrift::protocol::TType _etype37;
-                iprot->readListBegin(_etype37, _size34);
-                this->success[_i33].resize(_size34);
-                uint32_t _i38;
-                for (_i38 = 0; _i38 < _size34; ++_i38)
+                this->success[_i40].clear();
+                uint32_t _size41;
+                apache::thrift::protocol::TType _etype44;
+                iprot->readListBegin(_etype44, _size41);
+                this->success[_i40].resize(_size41);
+                uint32_t _i45;
+                for (_i45 = 0; _i45 < _size41; ++_i45)
                 {
-                  xfer += iprot->readString(this->success[_i33][_i38]);
+                  xfer += iprot->readString(this->success[_i40][_i45]);
                 }
                 iprot->readListEnd();
               }
@@ -897,15 +897,15 @@ uint32_t ClientService_next_cells_as_arrays_result::write(apache::thrift::protoc
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_LIST, this->success.size());
-      std::vector<CellAsArray> ::const_iterator _iter39;
-      for (_iter39 = this->success.begin(); _iter39 != this->success.end(); ++_iter39)
+      std::vector<CellAsArray> ::const_iterator _iter46;
+      for (_iter46 = this->success.begin(); _iter46 != this->success.end(); ++_iter46)
       {
         {
-          xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter39).size());
-          std::vector<std::string> ::const_iterator _iter40;
-          for (_iter40 = (*_iter39).begin(); _iter40 != (*_iter39).end(); ++_iter40)
+          xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter46).size());
+          std::vector<std::string> ::const_iterator _iter47;
+          for (_iter47 = (*_iter46).begin(); _iter47 != (*_iter46).end(); ++_iter47)
           {
-            xfer += oprot->writeString((*_iter40));
+            xfer += oprot->writeString((*_iter47));
           }
           xfer += oprot->writeListEnd();
         }
@@ -947,23 +947,23 @@ uint32_t ClientService_next_cells_as_arrays_presult::read(apache::thrift::protoc
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size41;
-            apache::thrift::protocol::TType _etype44;
-            iprot->readListBegin(_etype44, _size41);
-            (*(this->success)).resize(_size41);
-            uint32_t _i45;
-            for (_i45 = 0; _i45 < _size41; ++_i45)
+            uint32_t _size48;
+            apache::thrift::protocol::TType _etype51;
+            iprot->readListBegin(_etype51, _size48);
+            (*(this->success)).resize(_size48);
+            uint32_t _i52;
+            for (_i52 = 0; _i52 < _size48; ++_i52)
             {
               {
-                (*(this->success))[_i45].clear();
-                uint32_t _size46;
-                apache::thrift::protocol::TType _etype49;
-                iprot->readListBegin(_etype49, _size46);
-                (*(this->success))[_i45].resize(_size46);
-                uint32_t _i50;
-                for (_i50 = 0; _i50 < _size46; ++_i50)
+                (*(this->success))[_i52].clear();
+                uint32_t _size53;
+                apache::thrift::protocol::TType _etype56;
+                iprot->readListBegin(_etype56, _size53);
+                (*(this->success))[_i52].resize(_size53);
+                uint32_t _i57;
+                for (_i57 = 0; _i57 < _size53; ++_i57)
                 {
-                  xfer += iprot->readString((*(this->success))[_i45][_i50]);
+                  xfer += iprot->readString((*(this->success))[_i52][_i57]);
                 }
                 iprot->readListEnd();
               }
@@ -995,6 +995,184 @@ uint32_t ClientService_next_cells_as_arrays_presult::read(apache::thrift::protoc
   return xfer;
 }
 
+uint32_t ClientService_next_cells_serialized_args::read(apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->scanner);
+          this->__isset.scanner = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientService_next_cells_serialized_args::write(apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  xfer += oprot->writeStructBegin("ClientService_next_cells_serialized_args");
+  xfer += oprot->writeFieldBegin("scanner", apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->scanner);
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_next_cells_serialized_pargs::write(apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  xfer += oprot->writeStructBegin("ClientService_next_cells_serialized_pargs");
+  xfer += oprot->writeFieldBegin("scanner", apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->scanner)));
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_next_cells_serialized_result::read(apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->success);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == apache::thrift::protocol::T_STRUCT) {
+          xfer += this->e.read(iprot);
+          this->__isset.e = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientService_next_cells_serialized_result::write(apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("ClientService_next_cells_serialized_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_STRING, 0);
+    xfer += oprot->writeBinary(this->success);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.e) {
+    xfer += oprot->writeFieldBegin("e", apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->e.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_next_cells_serialized_presult::read(apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary((*(this->success)));
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == apache::thrift::protocol::T_STRUCT) {
+          xfer += this->e.read(iprot);
+          this->__isset.e = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
 uint32_t ClientService_next_row_args::read(apache::thrift::protocol::TProtocol* iprot) {
 
   uint32_t xfer = 0;
@@ -1081,14 +1259,14 @@ uint32_t ClientService_next_row_result::read(apache::thrift::protocol::TProtocol
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size51;
-            apache::thrift::protocol::TType _etype54;
-            iprot->readListBegin(_etype54, _size51);
-            this->success.resize(_size51);
-            uint32_t _i55;
-            for (_i55 = 0; _i55 < _size51; ++_i55)
+            uint32_t _size58;
+            apache::thrift::protocol::TType _etype61;
+            iprot->readListBegin(_etype61, _size58);
+            this->success.resize(_size58);
+            uint32_t _i62;
+            for (_i62 = 0; _i62 < _size58; ++_i62)
             {
-              xfer += this->success[_i55].read(iprot);
+              xfer += this->success[_i62].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -1127,10 +1305,10 @@ uint32_t ClientService_next_row_result::write(apache::thrift::protocol::TProtoco
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->success.size());
-      std::vector<Cell> ::const_iterator _iter56;
-      for (_iter56 = this->success.begin(); _iter56 != this->success.end(); ++_iter56)
+      std::vector<Cell> ::const_iterator _iter63;
+      for (_iter63 = this->success.begin(); _iter63 != this->success.end(); ++_iter63)
       {
-        xfer += (*_iter56).write(oprot);
+        xfer += (*_iter63).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -1169,14 +1347,14 @@ uint32_t ClientService_next_row_presult::read(apache::thrift::protocol::TProtoco
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size57;
-            apache::thrift::protocol::TType _etype60;
-            iprot->readListBegin(_etype60, _size57);
-            (*(this->success)).resize(_size57);
-            uint32_t _i61;
-            for (_i61 = 0; _i61 < _size57; ++_i61)
+            uint32_t _size64;
+            apache::thrift::protocol::TType _etype67;
+            iprot->readListBegin(_etype67, _size64);
+            (*(this->success)).resize(_size64);
+            uint32_t _i68;
+            for (_i68 = 0; _i68 < _size64; ++_i68)
             {
-              xfer += (*(this->success))[_i61].read(iprot);
+              xfer += (*(this->success))[_i68].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -1291,23 +1469,23 @@ uint32_t ClientService_next_row_as_arrays_result::read(apache::thrift::protocol:
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size62;
-            apache::thrift::protocol::TType _etype65;
-            iprot->readListBegin(_etype65, _size62);
-            this->success.resize(_size62);
-            uint32_t _i66;
-            for (_i66 = 0; _i66 < _size62; ++_i66)
+            uint32_t _size69;
+            apache::thrift::protocol::TType _etype72;
+            iprot->readListBegin(_etype72, _size69);
+            this->success.resize(_size69);
+            uint32_t _i73;
+            for (_i73 = 0; _i73 < _size69; ++_i73)
             {
               {
-                this->success[_i66].clear();
-                uint32_t _size67;
-                apache::thrift::protocol::TType _etype70;
-                iprot->readListBegin(_etype70, _size67);
-                this->success[_i66].resize(_size67);
-                uint32_t _i71;
-                for (_i71 = 0; _i71 < _size67; ++_i71)
+                this->success[_i73].clear();
+                uint32_t _size74;
+                apache::thrift::protocol::TType _etype77;
+                iprot->readListBegin(_etype77, _size74);
+                this->success[_i73].resize(_size74);
+                uint32_t _i78;
+                for (_i78 = 0; _i78 < _size74; ++_i78)
                 {
-                  xfer += iprot->readString(this->success[_i66][_i71]);
+                  xfer += iprot->readString(this->success[_i73][_i78]);
                 }
                 iprot->readListEnd();
               }
@@ -1349,15 +1527,15 @@ uint32_t ClientService_next_row_as_arrays_result::write(apache::thrift::protocol
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_LIST, this->success.size());
-      std::vector<CellAsArray> ::const_iterator _iter72;
-      for (_iter72 = this->success.begin(); _iter72 != this->success.end(); ++_iter72)
+      std::vector<CellAsArray> ::const_iterator _iter79;
+      for (_iter79 = this->success.begin(); _iter79 != this->success.end(); ++_iter79)
       {
         {
-          xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter72).size());
-          std::vector<std::string> ::const_iterator _iter73;
-          for (_iter73 = (*_iter72).begin(); _iter73 != (*_iter72).end(); ++_iter73)
+          xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter79).size());
+          std::vector<std::string> ::const_iterator _iter80;
+          for (_iter80 = (*_iter79).begin(); _iter80 != (*_iter79).end(); ++_iter80)
           {
-            xfer += oprot->writeString((*_iter73));
+            xfer += oprot->writeString((*_iter80));
           }
           xfer += oprot->writeListEnd();
         }
@@ -1399,23 +1577,23 @@ uint32_t ClientService_next_row_as_arrays_presult::read(apache::thrift::protocol
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size74;
-            apache::thrift::protocol::TType _etype77;
-            iprot->readListBegin(_etype77, _size74);
-            (*(this->success)).resize(_size74);
-            uint32_t _i78;
-            for (_i78 = 0; _i78 < _size74; ++_i78)
+            uint32_t _size81;
+            apache::thrift::protocol::TType _etype84;
+            iprot->readListBegin(_etype84, _size81);
+            (*(this->success)).resize(_size81);
+            uint32_t _i85;
+            for (_i85 = 0; _i85 < _size81; ++_i85)
             {
               {
-                (*(this->success))[_i78].clear();
-                uint32_t _size79;
-                apache::thrift::protocol::TType _etype82;
-                iprot->readListBegin(_etype82, _size79);
-                (*(this->success))[_i78].resize(_size79);
-                uint32_t _i83;
-                for (_i83 = 0; _i83 < _size79; ++_i83)
+                (*(this->success))[_i85].clear();
+                uint32_t _size86;
+                apache::thrift::protocol::TType _etype89;
+                iprot->readListBegin(_etype89, _size86);
+                (*(this->success))[_i85].resize(_size86);
+                uint32_t _i90;
+                for (_i90 = 0; _i90 < _size86; ++_i90)
                 {
-                  xfer += iprot->readString((*(this->success))[_i78][_i83]);
+                  xfer += iprot->readString((*(this->success))[_i85][_i90]);
                 }
                 iprot->readListEnd();
               }
@@ -1547,14 +1725,14 @@ uint32_t ClientService_get_row_result::read(apache::thrift::protocol::TProtocol*
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size84;
-            apache::thrift::protocol::TType _etype87;
-            iprot->readListBegin(_etype87, _size84);
-            this->success.resize(_size84);
-            uint32_t _i88;
-            for (_i88 = 0; _i88 < _size84; ++_i88)
+            uint32_t _size91;
+            apache::thrift::protocol::TType _etype94;
+            iprot->readListBegin(_etype94, _size91);
+            this->success.resize(_size91);
+            uint32_t _i95;
+            for (_i95 = 0; _i95 < _size91; ++_i95)
             {
-              xfer += this->success[_i88].read(iprot);
+              xfer += this->success[_i95].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -1593,10 +1771,10 @@ uint32_t ClientService_get_row_result::write(apache::thrift::protocol::TProtocol
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->success.size());
-      std::vector<Cell> ::const_iterator _iter89;
-      for (_iter89 = this->success.begin(); _iter89 != this->success.end(); ++_iter89)
+      std::vector<Cell> ::const_iterator _iter96;
+      for (_iter96 = this->success.begin(); _iter96 != this->success.end(); ++_iter96)
       {
-        xfer += (*_iter89).write(oprot);
+        xfer += (*_iter96).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -1635,14 +1813,14 @@ uint32_t ClientService_get_row_presult::read(apache::thrift::protocol::TProtocol
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size90;
-            apache::thrift::protocol::TType _etype93;
-            iprot->readListBegin(_etype93, _size90);
-            (*(this->success)).resize(_size90);
-            uint32_t _i94;
-            for (_i94 = 0; _i94 < _size90; ++_i94)
+            uint32_t _size97;
+            apache::thrift::protocol::TType _etype100;
+            iprot->readListBegin(_etype100, _size97);
+            (*(this->success)).resize(_size97);
+            uint32_t _i101;
+            for (_i101 = 0; _i101 < _size97; ++_i101)
             {
-              xfer += (*(this->success))[_i94].read(iprot);
+              xfer += (*(this->success))[_i101].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -1771,23 +1949,23 @@ uint32_t ClientService_get_row_as_arrays_result::read(apache::thrift::protocol::
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size95;
-            apache::thrift::protocol::TType _etype98;
-            iprot->readListBegin(_etype98, _size95);
-            this->success.resize(_size95);
-            uint32_t _i99;
-            for (_i99 = 0; _i99 < _size95; ++_i99)
+            uint32_t _size102;
+            apache::thrift::protocol::TType _etype105;
+            iprot->readListBegin(_etype105, _size102);
+            this->success.resize(_size102);
+            uint32_t _i106;
+            for (_i106 = 0; _i106 < _size102; ++_i106)
             {
               {
-                this->success[_i99].clear();
-                uint32_t _size100;
-                apache::thrift::protocol::TType _etype103;
-                iprot->readListBegin(_etype103, _size100);
-                this->success[_i99].resize(_size100);
-                uint32_t _i104;
-                for (_i104 = 0; _i104 < _size100; ++_i104)
+                this->success[_i106].clear();
+                uint32_t _size107;
+                apache::thrift::protocol::TType _etype110;
+                iprot->readListBegin(_etype110, _size107);
+                this->success[_i106].resize(_size107);
+                uint32_t _i111;
+                for (_i111 = 0; _i111 < _size107; ++_i111)
                 {
-                  xfer += iprot->readString(this->success[_i99][_i104]);
+                  xfer += iprot->readString(this->success[_i106][_i111]);
                 }
                 iprot->readListEnd();
               }
@@ -1829,15 +2007,15 @@ uint32_t ClientService_get_row_as_arrays_result::write(apache::thrift::protocol:
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_LIST, this->success.size());
-      std::vector<CellAsArray> ::const_iterator _iter105;
-      for (_iter105 = this->success.begin(); _iter105 != this->success.end(); ++_iter105)
+      std::vector<CellAsArray> ::const_iterator _iter112;
+      for (_iter112 = this->success.begin(); _iter112 != this->success.end(); ++_iter112)
       {
         {
-          xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter105).size());
-          std::vector<std::string> ::const_iterator _iter106;
-          for (_iter106 = (*_iter105).begin(); _iter106 != (*_iter105).end(); ++_iter106)
+          xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter112).size());
+          std::vector<std::string> ::const_iterator _iter113;
+          for (_iter113 = (*_iter112).begin(); _iter113 != (*_iter112).end(); ++_iter113)
           {
-            xfer += oprot->writeString((*_iter106));
+            xfer += oprot->writeString((*_iter113));
           }
           xfer += oprot->writeListEnd();
         }
@@ -1879,23 +2057,23 @@ uint32_t ClientService_get_row_as_arrays_presult::read(apache::thrift::protocol:
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size107;
-            apache::thrift::protocol::TType _etype110;
-            iprot->readListBegin(_etype110, _size107);
-            (*(this->success)).resize(_size107);
-            uint32_t _i111;
-            for (_i111 = 0; _i111 < _size107; ++_i111)
+            uint32_t _size114;
+            apache::thrift::protocol::TType _etype117;
+            iprot->readListBegin(_etype117, _size114);
+            (*(this->success)).resize(_size114);
+            uint32_t _i118;
+            for (_i118 = 0; _i118 < _size114; ++_i118)
             {
               {
-                (*(this->success))[_i111].clear();
-                uint32_t _size112;
-                apache::thrift::protocol::TType _etype115;
-                iprot->readListBegin(_etype115, _size112);
-                (*(this->success))[_i111].resize(_size112);
-                uint32_t _i116;
-                for (_i116 = 0; _i116 < _size112; ++_i116)
+                (*(this->success))[_i118].clear();
+                uint32_t _size119;
+                apache::thrift::protocol::TType _etype122;
+                iprot->readListBegin(_etype122, _size119);
+                (*(this->success))[_i118].resize(_size119);
+                uint32_t _i123;
+                for (_i123 = 0; _i123 < _size119; ++_i123)
                 {
-                  xfer += iprot->readString((*(this->success))[_i111][_i116]);
+                  xfer += iprot->readString((*(this->success))[_i118][_i123]);
                 }
                 iprot->readListEnd();
               }
@@ -2233,14 +2411,14 @@ uint32_t ClientService_get_cells_result::read(apache::thrift::protocol::TProtoco
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size117;
-            apache::thrift::protocol::TType _etype120;
-            iprot->readListBegin(_etype120, _size117);
-            this->success.resize(_size117);
-            uint32_t _i121;
-            for (_i121 = 0; _i121 < _size117; ++_i121)
+            uint32_t _size124;
+            apache::thrift::protocol::TType _etype127;
+            iprot->readListBegin(_etype127, _size124);
+            this->success.resize(_size124);
+            uint32_t _i128;
+            for (_i128 = 0; _i128 < _size124; ++_i128)
             {
-              xfer += this->success[_i121].read(iprot);
+              xfer += this->success[_i128].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -2279,10 +2457,10 @@ uint32_t ClientService_get_cells_result::write(apache::thrift::protocol::TProtoc
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->success.size());
-      std::vector<Cell> ::const_iterator _iter122;
-      for (_iter122 = this->success.begin(); _iter122 != this->success.end(); ++_iter122)
+      std::vector<Cell> ::const_iterator _iter129;
+      for (_iter129 = this->success.begin(); _iter129 != this->success.end(); ++_iter129)
       {
-        xfer += (*_iter122).write(oprot);
+        xfer += (*_iter129).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -2321,14 +2499,14 @@ uint32_t ClientService_get_cells_presult::read(apache::thrift::protocol::TProtoc
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size123;
-            apache::thrift::protocol::TType _etype126;
-            iprot->readListBegin(_etype126, _size123);
-            (*(this->success)).resize(_size123);
-            uint32_t _i127;
-            for (_i127 = 0; _i127 < _size123; ++_i127)
+            uint32_t _size130;
+            apache::thrift::protocol::TType _etype133;
+            iprot->readListBegin(_etype133, _size130);
+            (*(this->success)).resize(_size130);
+            uint32_t _i134;
+            for (_i134 = 0; _i134 < _size130; ++_i134)
             {
-              xfer += (*(this->success))[_i127].read(iprot);
+              xfer += (*(this->success))[_i134].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -2457,23 +2635,23 @@ uint32_t ClientService_get_cells_as_arrays_result::read(apache::thrift::protocol
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size128;
-            apache::thrift::protocol::TType _etype131;
-            iprot->readListBegin(_etype131, _size128);
-            this->success.resize(_size128);
-            uint32_t _i132;
-            for (_i132 = 0; _i132 < _size128; ++_i132)
+            uint32_t _size135;
+            apache::thrift::protocol::TType _etype138;
+            iprot->readListBegin(_etype138, _size135);
+            this->success.resize(_size135);
+            uint32_t _i139;
+            for (_i139 = 0; _i139 < _size135; ++_i139)
             {
               {
-                this->success[_i132].clear();
-                uint32_t _size133;
-                apache::thrift::protocol::TType _etype136;
-                iprot->readListBegin(_etype136, _size133);
-                this->success[_i132].resize(_size133);
-                uint32_t _i137;
-                for (_i137 = 0; _i137 < _size133; ++_i137)
+                this->success[_i139].clear();
+                uint32_t _size140;
+                apache::thrift::protocol::TType _etype143;
+                iprot->readListBegin(_etype143, _size140);
+                this->success[_i139].resize(_size140);
+                uint32_t _i144;
+                for (_i144 = 0; _i144 < _size140; ++_i144)
                 {
-                  xfer += iprot->readString(this->success[_i132][_i137]);
+                  xfer += iprot->readString(this->success[_i139][_i144]);
                 }
                 iprot->readListEnd();
               }
@@ -2515,15 +2693,15 @@ uint32_t ClientService_get_cells_as_arrays_result::write(apache::thrift::protoco
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_LIST, this->success.size());
-      std::vector<CellAsArray> ::const_iterator _iter138;
-      for (_iter138 = this->success.begin(); _iter138 != this->success.end(); ++_iter138)
+      std::vector<CellAsArray> ::const_iterator _iter145;
+      for (_iter145 = this->success.begin(); _iter145 != this->success.end(); ++_iter145)
       {
         {
-          xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter138).size());
-          std::vector<std::string> ::const_iterator _iter139;
-          for (_iter139 = (*_iter138).begin(); _iter139 != (*_iter138).end(); ++_iter139)
+          xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter145).size());
+          std::vector<std::string> ::const_iterator _iter146;
+          for (_iter146 = (*_iter145).begin(); _iter146 != (*_iter145).end(); ++_iter146)
           {
-            xfer += oprot->writeString((*_iter139));
+            xfer += oprot->writeString((*_iter146));
           }
           xfer += oprot->writeListEnd();
         }
@@ -2565,23 +2743,23 @@ uint32_t ClientService_get_cells_as_arrays_presult::read(apache::thrift::protoco
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size140;
-            apache::thrift::protocol::TType _etype143;
-            iprot->readListBegin(_etype143, _size140);
-            (*(this->success)).resize(_size140);
-            uint32_t _i144;
-            for (_i144 = 0; _i144 < _size140; ++_i144)
+            uint32_t _size147;
+            apache::thrift::protocol::TType _etype150;
+            iprot->readListBegin(_etype150, _size147);
+            (*(this->success)).resize(_size147);
+            uint32_t _i151;
+            for (_i151 = 0; _i151 < _size147; ++_i151)
             {
               {
-                (*(this->success))[_i144].clear();
-                uint32_t _size145;
-                apache::thrift::protocol::TType _etype148;
-                iprot->readListBegin(_etype148, _size145);
-                (*(this->success))[_i144].resize(_size145);
-                uint32_t _i149;
-                for (_i149 = 0; _i149 < _size145; ++_i149)
+                (*(this->success))[_i151].clear();
+                uint32_t _size152;
+                apache::thrift::protocol::TType _etype155;
+                iprot->readListBegin(_etype155, _size152);
+                (*(this->success))[_i151].resize(_size152);
+                uint32_t _i156;
+                for (_i156 = 0; _i156 < _size152; ++_i156)
                 {
-                  xfer += iprot->readString((*(this->success))[_i144][_i149]);
+                  xfer += iprot->readString((*(this->success))[_i151][_i156]);
                 }
                 iprot->readListEnd();
               }
@@ -3195,14 +3373,14 @@ uint32_t ClientService_set_cell_as_array_args::read(apache::thrift::protocol::TP
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->cell.clear();
-            uint32_t _size150;
-            apache::thrift::protocol::TType _etype153;
-            iprot->readListBegin(_etype153, _size150);
-            this->cell.resize(_size150);
-            uint32_t _i154;
-            for (_i154 = 0; _i154 < _size150; ++_i154)
+            uint32_t _size157;
+            apache::thrift::protocol::TType _etype160;
+            iprot->readListBegin(_etype160, _size157);
+            this->cell.resize(_size157);
+            uint32_t _i161;
+            for (_i161 = 0; _i161 < _size157; ++_i161)
             {
-              xfer += iprot->readString(this->cell[_i154]);
+              xfer += iprot->readString(this->cell[_i161]);
             }
             iprot->readListEnd();
           }
@@ -3232,10 +3410,10 @@ uint32_t ClientService_set_cell_as_array_args::write(apache::thrift::protocol::T
   xfer += oprot->writeFieldBegin("cell", apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, this->cell.size());
-    std::vector<std::string> ::const_iterator _iter155;
-    for (_iter155 = this->cell.begin(); _iter155 != this->cell.end(); ++_iter155)
+    std::vector<std::string> ::const_iterator _iter162;
+    for (_iter162 = this->cell.begin(); _iter162 != this->cell.end(); ++_iter162)
     {
-      xfer += oprot->writeString((*_iter155));
+      xfer += oprot->writeString((*_iter162));
     }
     xfer += oprot->writeListEnd();
   }
@@ -3254,10 +3432,10 @@ uint32_t ClientService_set_cell_as_array_pargs::write(apache::thrift::protocol::
   xfer += oprot->writeFieldBegin("cell", apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*(this->cell)).size());
-    std::vector<std::string> ::const_iterator _iter156;
-    for (_iter156 = (*(this->cell)).begin(); _iter156 != (*(this->cell)).end(); ++_iter156)
+    std::vector<std::string> ::const_iterator _iter163;
+    for (_iter163 = (*(this->cell)).begin(); _iter163 != (*(this->cell)).end(); ++_iter163)
     {
-      xfer += oprot->writeString((*_iter156));
+      xfer += oprot->writeString((*_iter163));
     }
     xfer += oprot->writeListEnd();
   }
@@ -3395,14 +3573,226 @@ uint32_t ClientService_set_cells_args::read(apache::thrift::protocol::TProtocol*
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->cells.clear();
-            uint32_t _size157;
-            apache::thrift::protocol::TType _etype160;
-            iprot->readListBegin(_etype160, _size157);
-            this->cells.resize(_size157);
-            uint32_t _i161;
-            for (_i161 = 0; _i161 < _size157; ++_i161)
+            uint32_t _size164;
+            apache::thrift::protocol::TType _etype167;
+            iprot->readListBegin(_etype167, _size164);
+            this->cells.resize(_size164);
+            uint32_t _i168;
+            for (_i168 = 0; _i168 < _size164; ++_i168)
+            {
+              xfer += this->cells[_i168].read(iprot);
+            }
+            iprot->readListEnd();
+          }
+          this->__isset.cells = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientService_set_cells_args::write(apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  xfer += oprot->writeStructBegin("ClientService_set_cells_args");
+  xfer += oprot->writeFieldBegin("mutator", apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->mutator);
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("cells", apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->cells.size());
+    std::vector<Cell> ::const_iterator _iter169;
+    for (_iter169 = this->cells.begin(); _iter169 != this->cells.end(); ++_iter169)
+    {
+      xfer += (*_iter169).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_set_cells_pargs::write(apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  xfer += oprot->writeStructBegin("ClientService_set_cells_pargs");
+  xfer += oprot->writeFieldBegin("mutator", apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->mutator)));
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("cells", apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, (*(this->cells)).size());
+    std::vector<Cell> ::const_iterator _iter170;
+    for (_iter170 = (*(this->cells)).begin(); _iter170 != (*(this->cells)).end(); ++_iter170)
+    {
+      xfer += (*_iter170).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_set_cells_result::read(apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == apache::thrift::protocol::T_STRUCT) {
+          xfer += this->e.read(iprot);
+          this->__isset.e = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientService_set_cells_result::write(apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("ClientService_set_cells_result");
+
+  if (this->__isset.e) {
+    xfer += oprot->writeFieldBegin("e", apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->e.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_set_cells_presult::read(apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == apache::thrift::protocol::T_STRUCT) {
+          xfer += this->e.read(iprot);
+          this->__isset.e = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientService_set_cells_as_arrays_args::read(apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->mutator);
+          this->__isset.mutator = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == apache::thrift::protocol::T_LIST) {
+          {
+            this->cells.clear();
+            uint32_t _size171;
+            apache::thrift::protocol::TType _etype174;
+            iprot->readListBegin(_etype174, _size171);
+            this->cells.resize(_size171);
+            uint32_t _i175;
+            for (_i175 = 0; _i175 < _size171; ++_i175)
             {
-              xfer += this->cells[_i161].read(iprot);
+              {
+                this->cells[_i175].clear();
+                uint32_t _size176;
+                apache::thrift::protocol::TType _etype179;
+                iprot->readListBegin(_etype179, _size176);
+                this->cells[_i175].resize(_size176);
+                uint32_t _i180;
+                for (_i180 = 0; _i180 < _size176; ++_i180)
+                {
+                  xfer += iprot->readString(this->cells[_i175][_i180]);
+                }
+                iprot->readListEnd();
+              }
             }
             iprot->readListEnd();
           }
@@ -3423,19 +3813,27 @@ uint32_t ClientService_set_cells_args::read(apache::thrift::protocol::TProtocol*
   return xfer;
 }
 
-uint32_t ClientService_set_cells_args::write(apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ClientService_set_cells_as_arrays_args::write(apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
-  xfer += oprot->writeStructBegin("ClientService_set_cells_args");
+  xfer += oprot->writeStructBegin("ClientService_set_cells_as_arrays_args");
   xfer += oprot->writeFieldBegin("mutator", apache::thrift::protocol::T_I64, 1);
   xfer += oprot->writeI64(this->mutator);
   xfer += oprot->writeFieldEnd();
   xfer += oprot->writeFieldBegin("cells", apache::thrift::protocol::T_LIST, 2);
   {
-    xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->cells.size());
-    std::vector<Cell> ::const_iterator _iter162;
-    for (_iter162 = this->cells.begin(); _iter162 != this->cells.end(); ++_iter162)
+    xfer += oprot->writeListBegin(apache::thrift::protocol::T_LIST, this->cells.size());
+    std::vector<CellAsArray> ::const_iterator _iter181;
+    for (_iter181 = this->cells.begin(); _iter181 != this->cells.end(); ++_iter181)
     {
-      xfer += (*_iter162).write(oprot);
+      {
+        xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter181).size());
+        std::vector<std::string> ::const_iterator _iter182;
+        for (_iter182 = (*_iter181).begin(); _iter182 != (*_iter181).end(); ++_iter182)
+        {
+          xfer += oprot->writeString((*_iter182));
+        }
+        xfer += oprot->writeListEnd();
+      }
     }
     xfer += oprot->writeListEnd();
   }
@@ -3445,19 +3843,27 @@ uint32_t ClientService_set_cells_args::write(apache::thrift::protocol::TProtocol
   return xfer;
 }
 
-uint32_t ClientService_set_cells_pargs::write(apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ClientService_set_cells_as_arrays_pargs::write(apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
-  xfer += oprot->writeStructBegin("ClientService_set_cells_pargs");
+  xfer += oprot->writeStructBegin("ClientService_set_cells_as_arrays_pargs");
   xfer += oprot->writeFieldBegin("mutator", apache::thrift::protocol::T_I64, 1);
   xfer += oprot->writeI64((*(this->mutator)));
   xfer += oprot->writeFieldEnd();
   xfer += oprot->writeFieldBegin("cells", apache::thrift::protocol::T_LIST, 2);
   {
-    xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, (*(this->cells)).size());
-    std::vector<Cell> ::const_iterator _iter163;
-    for (_iter163 = (*(this->cells)).begin(); _iter163 != (*(this->cells)).end(); ++_iter163)
+    xfer += oprot->writeListBegin(apache::thrift::protocol::T_LIST, (*(this->cells)).size());
+    std::vector<CellAsArray> ::const_iterator _iter183;
+    for (_iter183 = (*(this->cells)).begin(); _iter183 != (*(this->cells)).end(); ++_iter183)
     {
-      xfer += (*_iter163).write(oprot);
+      {
+        xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter183).size());
+        std::vector<std::string> ::const_iterator _iter184;
+        for (_iter184 = (*_iter183).begin(); _iter184 != (*_iter183).end(); ++_iter184)
+        {
+          xfer += oprot->writeString((*_iter184));
+        }
+        xfer += oprot->writeListEnd();
+      }
     }
     xfer += oprot->writeListEnd();
   }
@@ -3467,7 +3873,7 @@ uint32_t ClientService_set_cells_pargs::write(apache::thrift::protocol::TProtoco
   return xfer;
 }
 
-uint32_t ClientService_set_cells_result::read(apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ClientService_set_cells_as_arrays_result::read(apache::thrift::protocol::TProtocol* iprot) {
 
   uint32_t xfer = 0;
   std::string fname;
@@ -3507,11 +3913,11 @@ uint32_t ClientService_set_cells_result::read(apache::thrift::protocol::TProtoco
   return xfer;
 }
 
-uint32_t ClientService_set_cells_result::write(apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ClientService_set_cells_as_arrays_result::write(apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("ClientService_set_cells_result");
+  xfer += oprot->writeStructBegin("ClientService_set_cells_as_arrays_result");
 
   if (this->__isset.e) {
     xfer += oprot->writeFieldBegin("e", apache::thrift::protocol::T_STRUCT, 1);
@@ -3523,7 +3929,7 @@ uint32_t ClientService_set_cells_result::write(apache::thrift::protocol::TProtoc
   return xfer;
 }
 
-uint32_t ClientService_set_cells_presult::read(apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ClientService_set_cells_as_arrays_presult::read(apache::thrift::protocol::TProtocol* iprot) {
 
   uint32_t xfer = 0;
   std::string fname;
@@ -3563,7 +3969,7 @@ uint32_t ClientService_set_cells_presult::read(apache::thrift::protocol::TProtoc
   return xfer;
 }
 
-uint32_t ClientService_set_cells_as_arrays_args::read(apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ClientService_set_cells_serialized_args::read(apache::thrift::protocol::TProtocol* iprot) {
 
   uint32_t xfer = 0;
   std::string fname;
@@ -3592,37 +3998,21 @@ uint32_t ClientService_set_cells_as_arrays_args::read(apache::thrift::protocol::
         }
         break;
       case 2:
-        if (ftype == apache::thrift::protocol::T_LIST) {
-          {
-            this->cells.clear();
-            uint32_t _size164;
-            apache::thrift::protocol::TType _etype167;
-            iprot->readListBegin(_etype167, _size164);
-            this->cells.resize(_size164);
-            uint32_t _i168;
-            for (_i168 = 0; _i168 < _size164; ++_i168)
-            {
-              {
-                this->cells[_i168].clear();
-                uint32_t _size169;
-                apache::thrift::protocol::TType _etype172;
-                iprot->readListBegin(_etype172, _size169);
-                this->cells[_i168].resize(_size169);
-                uint32_t _i173;
-                for (_i173 = 0; _i173 < _size169; ++_i173)
-                {
-                  xfer += iprot->readString(this->cells[_i168][_i173]);
-                }
-                iprot->readListEnd();
-              }
-            }
-            iprot->readListEnd();
-          }
+        if (ftype == apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->cells);
           this->__isset.cells = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->flush);
+          this->__isset.flush = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3635,67 +4025,41 @@ uint32_t ClientService_set_cells_as_arrays_args::read(apache::thrift::protocol::
   return xfer;
 }
 
-uint32_t ClientService_set_cells_as_arrays_args::write(apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ClientService_set_cells_serialized_args::write(apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
-  xfer += oprot->writeStructBegin("ClientService_set_cells_as_arrays_args");
+  xfer += oprot->writeStructBegin("ClientService_set_cells_serialized_args");
   xfer += oprot->writeFieldBegin("mutator", apache::thrift::protocol::T_I64, 1);
   xfer += oprot->writeI64(this->mutator);
   xfer += oprot->writeFieldEnd();
-  xfer += oprot->writeFieldBegin("cells", apache::thrift::protocol::T_LIST, 2);
-  {
-    xfer += oprot->writeListBegin(apache::thrift::protocol::T_LIST, this->cells.size());
-    std::vector<CellAsArray> ::const_iterator _iter174;
-    for (_iter174 = this->cells.begin(); _iter174 != this->cells.end(); ++_iter174)
-    {
-      {
-        xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter174).size());
-        std::vector<std::string> ::const_iterator _iter175;
-        for (_iter175 = (*_iter174).begin(); _iter175 != (*_iter174).end(); ++_iter175)
-        {
-          xfer += oprot->writeString((*_iter175));
-        }
-        xfer += oprot->writeListEnd();
-      }
-    }
-    xfer += oprot->writeListEnd();
-  }
+  xfer += oprot->writeFieldBegin("cells", apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeBinary(this->cells);
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("flush", apache::thrift::protocol::T_BOOL, 3);
+  xfer += oprot->writeBool(this->flush);
   xfer += oprot->writeFieldEnd();
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-uint32_t ClientService_set_cells_as_arrays_pargs::write(apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ClientService_set_cells_serialized_pargs::write(apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
-  xfer += oprot->writeStructBegin("ClientService_set_cells_as_arrays_pargs");
+  xfer += oprot->writeStructBegin("ClientService_set_cells_serialized_pargs");
   xfer += oprot->writeFieldBegin("mutator", apache::thrift::protocol::T_I64, 1);
   xfer += oprot->writeI64((*(this->mutator)));
   xfer += oprot->writeFieldEnd();
-  xfer += oprot->writeFieldBegin("cells", apache::thrift::protocol::T_LIST, 2);
-  {
-    xfer += oprot->writeListBegin(apache::thrift::protocol::T_LIST, (*(this->cells)).size());
-    std::vector<CellAsArray> ::const_iterator _iter176;
-    for (_iter176 = (*(this->cells)).begin(); _iter176 != (*(this->cells)).end(); ++_iter176)
-    {
-      {
-        xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, (*_iter176).size());
-        std::vector<std::string> ::const_iterator _iter177;
-        for (_iter177 = (*_iter176).begin(); _iter177 != (*_iter176).end(); ++_iter177)
-        {
-          xfer += oprot->writeString((*_iter177));
-        }
-        xfer += oprot->writeListEnd();
-      }
-    }
-    xfer += oprot->writeListEnd();
-  }
+  xfer += oprot->writeFieldBegin("cells", apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeBinary((*(this->cells)));
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("flush", apache::thrift::protocol::T_BOOL, 3);
+  xfer += oprot->writeBool((*(this->flush)));
   xfer += oprot->writeFieldEnd();
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-uint32_t ClientService_set_cells_as_arrays_result::read(apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ClientService_set_cells_serialized_result::read(apache::thrift::protocol::TProtocol* iprot) {
 
   uint32_t xfer = 0;
   std::string fname;
@@ -3735,11 +4099,11 @@ uint32_t ClientService_set_cells_as_arrays_result::read(apache::thrift::protocol
   return xfer;
 }
 
-uint32_t ClientService_set_cells_as_arrays_result::write(apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ClientService_set_cells_serialized_result::write(apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("ClientService_set_cells_as_arrays_result");
+  xfer += oprot->writeStructBegin("ClientService_set_cells_serialized_result");
 
   if (this->__isset.e) {
     xfer += oprot->writeFieldBegin("e", apache::thrift::protocol::T_STRUCT, 1);
@@ -3751,7 +4115,7 @@ uint32_t ClientService_set_cells_as_arrays_result::write(apache::thrift::protoco
   return xfer;
 }
 
-uint32_t ClientService_set_cells_as_arrays_presult::read(apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ClientService_set_cells_serialized_presult::read(apache::thrift::protocol::TProtocol* iprot) {
 
   uint32_t xfer = 0;
   std::string fname;
@@ -4377,14 +4741,14 @@ uint32_t ClientService_get_tables_result::read(apache::thrift::protocol::TProtoc
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size178;
-            apache::thrift::protocol::TType _etype181;
-            iprot->readListBegin(_etype181, _size178);
-            this->success.resize(_size178);
-            uint32_t _i182;
-            for (_i182 = 0; _i182 < _size178; ++_i182)
+            uint32_t _size185;
+            apache::thrift::protocol::TType _etype188;
+            iprot->readListBegin(_etype188, _size185);
+            this->success.resize(_size185);
+            uint32_t _i189;
+            for (_i189 = 0; _i189 < _size185; ++_i189)
             {
-              xfer += iprot->readString(this->success[_i182]);
+              xfer += iprot->readString(this->success[_i189]);
             }
             iprot->readListEnd();
           }
@@ -4423,10 +4787,10 @@ uint32_t ClientService_get_tables_result::write(apache::thrift::protocol::TProto
     xfer += oprot->writeFieldBegin("success", apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, this->success.size());
-      std::vector<std::string> ::const_iterator _iter183;
-      for (_iter183 = this->success.begin(); _iter183 != this->success.end(); ++_iter183)
+      std::vector<std::string> ::const_iterator _iter190;
+      for (_iter190 = this->success.begin(); _iter190 != this->success.end(); ++_iter190)
       {
-        xfer += oprot->writeString((*_iter183));
+        xfer += oprot->writeString((*_iter190));
       }
       xfer += oprot->writeListEnd();
     }
@@ -4465,14 +4829,14 @@ uint32_t ClientService_get_tables_presult::read(apache::thrift::protocol::TProto
         if (ftype == apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size184;
-            apache::thrift::protocol::TType _etype187;
-            iprot->readListBegin(_etype187, _size184);
-            (*(this->success)).resize(_size184);
-            uint32_t _i188;
-            for (_i188 = 0; _i188 < _size184; ++_i188)
+            uint32_t _size191;
+            apache::thrift::protocol::TType _etype194;
+            iprot->readListBegin(_etype194, _size191);
+            (*(this->success)).resize(_size191);
+            uint32_t _i195;
+            for (_i195 = 0; _i195 < _size191; ++_i195)
             {
-              xfer += iprot->readString((*(this->success))[_i188]);
+              xfer += iprot->readString((*(this->success))[_i195]);
             }
             iprot->readListEnd();
           }
@@ -4981,6 +5345,69 @@ void ClientServiceClient::recv_next_cells_as_arrays(std::vector<CellAsArray> & _
   throw apache::thrift::TApplicationException(apache::thrift::TApplicationException::MISSING_RESULT, "next_cells_as_arrays failed: unknown result");
 }
 
+void ClientServiceClient::next_cells_serialized(CellsSerialized& _return, const Scanner scanner)
+{
+  send_next_cells_serialized(scanner);
+  recv_next_cells_serialized(_return);
+}
+
+void ClientServiceClient::send_next_cells_serialized(const Scanner scanner)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("next_cells_serialized", apache::thrift::protocol::T_CALL, cseqid);
+
+  ClientService_next_cells_serialized_pargs args;
+  args.scanner = &scanner;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->flush();
+  oprot_->getTransport()->writeEnd();
+}
+
+void ClientServiceClient::recv_next_cells_serialized(CellsSerialized& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == apache::thrift::protocol::T_EXCEPTION) {
+    apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw apache::thrift::TApplicationException(apache::thrift::TApplicationException::INVALID_MESSAGE_TYPE);
+  }
+  if (fname.compare("next_cells_serialized") != 0) {
+    iprot_->skip(apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw apache::thrift::TApplicationException(apache::thrift::TApplicationException::WRONG_METHOD_NAME);
+  }
+  ClientService_next_cells_serialized_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.e) {
+    throw result.e;
+  }
+  throw apache::thrift::TApplicationException(apache::thrift::TApplicationException::MISSING_RESULT, "next_cells_serialized failed: unknown result");
+}
+
 void ClientServiceClient::next_row(std::vector<Cell> & _return, const Scanner scanner)
 {
   send_next_row(scanner);
@@ -5788,6 +6215,66 @@ void ClientServiceClient::recv_set_cells_as_arrays()
   return;
 }
 
+void ClientServiceClient::set_cells_serialized(const Mutator mutator, const CellsSerialized& cells, const bool flush)
+{
+  send_set_cells_serialized(mutator, cells, flush);
+  recv_set_cells_serialized();
+}
+
+void ClientServiceClient::send_set_cells_serialized(const Mutator mutator, const CellsSerialized& cells, const bool flush)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("set_cells_serialized", apache::thrift::protocol::T_CALL, cseqid);
+
+  ClientService_set_cells_serialized_pargs args;
+  args.mutator = &mutator;
+  args.cells = &cells;
+  args.flush = &flush;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->flush();
+  oprot_->getTransport()->writeEnd();
+}
+
+void ClientServiceClient::recv_set_cells_serialized()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == apache::thrift::protocol::T_EXCEPTION) {
+    apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw apache::thrift::TApplicationException(apache::thrift::TApplicationException::INVALID_MESSAGE_TYPE);
+  }
+  if (fname.compare("set_cells_serialized") != 0) {
+    iprot_->skip(apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw apache::thrift::TApplicationException(apache::thrift::TApplicationException::WRONG_METHOD_NAME);
+  }
+  ClientService_set_cells_serialized_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.e) {
+    throw result.e;
+  }
+  return;
+}
+
 void ClientServiceClient::flush_mutator(const Mutator mutator)
 {
   send_flush_mutator(mutator);
@@ -6291,6 +6778,37 @@ void ClientServiceProcessor::process_next_cells_as_arrays(int32_t seqid, apache:
   oprot->getTransport()->writeEnd();
 }
 
+void ClientServiceProcessor::process_next_cells_serialized(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot)
+{
+  ClientService_next_cells_serialized_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  iprot->getTransport()->readEnd();
+
+  ClientService_next_cells_serialized_result result;
+  try {
+    iface_->next_cells_serialized(result.success, args.scanner);
+    result.__isset.success = true;
+  } catch (ClientException &e) {
+    result.e = e;
+    result.__isset.e = true;
+  } catch (const std::exception& e) {
+    apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("next_cells_serialized", apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->flush();
+    oprot->getTransport()->writeEnd();
+    return;
+  }
+
+  oprot->writeMessageBegin("next_cells_serialized", apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  oprot->getTransport()->flush();
+  oprot->getTransport()->writeEnd();
+}
+
 void ClientServiceProcessor::process_next_row(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot)
 {
   ClientService_next_row_args args;
@@ -6689,6 +7207,36 @@ void ClientServiceProcessor::process_set_cells_as_arrays(int32_t seqid, apache::
   oprot->getTransport()->writeEnd();
 }
 
+void ClientServiceProcessor::process_set_cells_serialized(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot)
+{
+  ClientService_set_cells_serialized_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  iprot->getTransport()->readEnd();
+
+  ClientService_set_cells_serialized_result result;
+  try {
+    iface_->set_cells_serialized(args.mutator, args.cells, args.flush);
+  } catch (ClientException &e) {
+    result.e = e;
+    result.__isset.e = true;
+  } catch (const std::exception& e) {
+    apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("set_cells_serialized", apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->flush();
+    oprot->getTransport()->writeEnd();
+    return;
+  }
+
+  oprot->writeMessageBegin("set_cells_serialized", apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  oprot->getTransport()->flush();
+  oprot->getTransport()->writeEnd();
+}
+
 void ClientServiceProcessor::process_flush_mutator(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot)
 {
   ClientService_flush_mutator_args args;
@@ -19,6 +19,7 @@ class ClientServiceIf {
   virtual void close_scanner(const Scanner scanner) = 0;
   virtual void next_cells(std::vector<Cell> & _return, const Scanner scanner) = 0;
   virtual void next_cells_as_arrays(std::vector<CellAsArray> & _return, const Scanner scanner) = 0;
+  virtual void next_cells_serialized(CellsSerialized& _return, const Scanner scanner) = 0;
   virtual void next_row(std::vector<Cell> & _return, const Scanner scanner) = 0;
   virtual void next_row_as_arrays(std::vector<CellAsArray> & _return, const Scanner scanner) = 0;
   virtual void get_row(std::vector<Cell> & _return, const std::string& name, const std::string& row) = 0;
@@ -32,6 +33,7 @@ class ClientServiceIf {
   virtual void set_cell_as_array(const Mutator mutator, const CellAsArray& cell) = 0;
   virtual void set_cells(const Mutator mutator, const std::vector<Cell> & cells) = 0;
   virtual void set_cells_as_arrays(const Mutator mutator, const std::vector<CellAsArray> & cells) = 0;
+  virtual void set_cells_serialized(const Mutator mutator, const CellsSerialized& cells, const bool flush) = 0;
   virtual void flush_mutator(const Mutator mutator) = 0;
   virtual int32_t get_table_id(const std::string& name) = 0;
   virtual void get_schema(std::string& _return, const std::string& name) = 0;
@@ -58,6 +60,9 @@ class ClientServiceNull : virtual public ClientServiceIf {
   void next_cells_as_arrays(std::vector<CellAsArray> & /* _return */, const Scanner /* scanner */) {
     return;
   }
+  void next_cells_serialized(CellsSerialized& /* _return */, const Scanner /* scanner */) {
+    return;
+  }
   void next_row(std::vector<Cell> & /* _return */, const Scanner /* scanner */) {
     return;
   }
@@ -98,6 +103,9 @@ class ClientServiceNull : virtual public ClientServiceIf {
   void set_cells_as_arrays(const Mutator /* mutator */, const std::vector<CellAsArray> & /* cells */) {
     return;
   }
+  void set_cells_serialized(const Mutator /* mutator */, const CellsSerialized& /* cells */, const bool /* flush */) {
+    return;
+  }
   void flush_mutator(const Mutator /* mutator */) {
     return;
   }
@@ -614,6 +622,105 @@ class ClientService_next_cells_as_arrays_presult {
 
 };
 
+class ClientService_next_cells_serialized_args {
+ public:
+
+  ClientService_next_cells_serialized_args() : scanner(0) {
+  }
+
+  virtual ~ClientService_next_cells_serialized_args() throw() {}
+
+  Scanner scanner;
+
+  struct __isset {
+    __isset() : scanner(false) {}
+    bool scanner;
+  } __isset;
+
+  bool operator == (const ClientService_next_cells_serialized_args & rhs) const
+  {
+    if (!(scanner == rhs.scanner))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientService_next_cells_serialized_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientService_next_cells_serialized_args & ) const;
+
+  uint32_t read(apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+class ClientService_next_cells_serialized_pargs {
+ public:
+
+
+  virtual ~ClientService_next_cells_serialized_pargs() throw() {}
+
+  const Scanner* scanner;
+
+  uint32_t write(apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+class ClientService_next_cells_serialized_result {
+ public:
+
+  ClientService_next_cells_serialized_result() : success("") {
+  }
+
+  virtual ~ClientService_next_cells_serialized_result() throw() {}
+
+  CellsSerialized success;
+  ClientException e;
+
+  struct __isset {
+    __isset() : success(false), e(false) {}
+    bool success;
+    bool e;
+  } __isset;
+
+  bool operator == (const ClientService_next_cells_serialized_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(e == rhs.e))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientService_next_cells_serialized_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientService_next_cells_serialized_result & ) const;
+
+  uint32_t read(apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+class ClientService_next_cells_serialized_presult {
+ public:
+
+
+  virtual ~ClientService_next_cells_serialized_presult() throw() {}
+
+  CellsSerialized* success;
+  ClientException e;
+
+  struct __isset {
+    __isset() : success(false), e(false) {}
+    bool success;
+    bool e;
+  } __isset;
+
+  uint32_t read(apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class ClientService_next_row_args {
  public:
 
@@ -1936,6 +2043,109 @@ class ClientService_set_cells_as_arrays_presult {
 
 };
 
+class ClientService_set_cells_serialized_args {
+ public:
+
+  ClientService_set_cells_serialized_args() : mutator(0), cells(""), flush(false) {
+  }
+
+  virtual ~ClientService_set_cells_serialized_args() throw() {}
+
+  Mutator mutator;
+  CellsSerialized cells;
+  bool flush;
+
+  struct __isset {
+    __isset() : mutator(false), cells(false), flush(false) {}
+    bool mutator;
+    bool cells;
+    bool flush;
+  } __isset;
+
+  bool operator == (const ClientService_set_cells_serialized_args & rhs) const
+  {
+    if (!(mutator == rhs.mutator))
+      return false;
+    if (!(cells == rhs.cells))
+      return false;
+    if (!(flush == rhs.flush))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientService_set_cells_serialized_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientService_set_cells_serialized_args & ) const;
+
+  uint32_t read(apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+class ClientService_set_cells_serialized_pargs {
+ public:
+
+
+  virtual ~ClientService_set_cells_serialized_pargs() throw() {}
+
+  const Mutator* mutator;
+  const CellsSerialized* cells;
+  const bool* flush;
+
+  uint32_t write(apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+class ClientService_set_cells_serialized_result {
+ public:
+
+  ClientService_set_cells_serialized_result() {
+  }
+
+  virtual ~ClientService_set_cells_serialized_result() throw() {}
+
+  ClientException e;
+
+  struct __isset {
+    __isset() : e(false) {}
+    bool e;
+  } __isset;
+
+  bool operator == (const ClientService_set_cells_serialized_result & rhs) const
+  {
+    if (!(e == rhs.e))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientService_set_cells_serialized_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientService_set_cells_serialized_result & ) const;
+
+  uint32_t read(apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+class ClientService_set_cells_serialized_presult {
+ public:
+
+
+  virtual ~ClientService_set_cells_serialized_presult() throw() {}
+
+  ClientException e;
+
+  struct __isset {
+    __isset() : e(false) {}
+    bool e;
+  } __isset;
+
+  uint32_t read(apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class ClientService_flush_mutator_args {
  public:
 
@@ -2450,6 +2660,9 @@ class ClientServiceClient : virtual public ClientServiceIf {
   void next_cells_as_arrays(std::vector<CellAsArray> & _return, const Scanner scanner);
   void send_next_cells_as_arrays(const Scanner scanner);
   void recv_next_cells_as_arrays(std::vector<CellAsArray> & _return);
+  void next_cells_serialized(CellsSerialized& _return, const Scanner scanner);
+  void send_next_cells_serialized(const Scanner scanner);
+  void recv_next_cells_serialized(CellsSerialized& _return);
   void next_row(std::vector<Cell> & _return, const Scanner scanner);
   void send_next_row(const Scanner scanner);
   void recv_next_row(std::vector<Cell> & _return);
@@ -2489,6 +2702,9 @@ class ClientServiceClient : virtual public ClientServiceIf {
   void set_cells_as_arrays(const Mutator mutator, const std::vector<CellAsArray> & cells);
   void send_set_cells_as_arrays(const Mutator mutator, const std::vector<CellAsArray> & cells);
   void recv_set_cells_as_arrays();
+  void set_cells_serialized(const Mutator mutator, const CellsSerialized& cells, const bool flush);
+  void send_set_cells_serialized(const Mutator mutator, const CellsSerialized& cells, const bool flush);
+  void recv_set_cells_serialized();
   void flush_mutator(const Mutator mutator);
   void send_flush_mutator(const Mutator mutator);
   void recv_flush_mutator();
@@ -2522,6 +2738,7 @@ class ClientServiceProcessor : virtual public apache::thrift::TProcessor {
   void process_close_scanner(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_next_cells(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_next_cells_as_arrays(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
+  void process_next_cells_serialized(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_next_row(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_next_row_as_arrays(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_get_row(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
@@ -2535,6 +2752,7 @@ class ClientServiceProcessor : virtual public apache::thrift::TProcessor {
   void process_set_cell_as_array(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_set_cells(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_set_cells_as_arrays(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
+  void process_set_cells_serialized(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_flush_mutator(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_get_table_id(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
   void process_get_schema(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot);
@@ -2548,6 +2766,7 @@ class ClientServiceProcessor : virtual public apache::thrift::TProcessor {
     processMap_["close_scanner"] = &ClientServiceProcessor::process_close_scanner;
     processMap_["next_cells"] = &ClientServiceProcessor::process_next_cells;
     processMap_["next_cells_as_arrays"] = &ClientServiceProcessor::process_next_cells_as_arrays;
+    processMap_["next_cells_serialized"] = &ClientServiceProcessor::process_next_cells_serialized;
     processMap_["next_row"] = &ClientServiceProcessor::process_next_row;
     processMap_["next_row_as_arrays"] = &ClientServiceProcessor::process_next_row_as_arrays;
     processMap_["get_row"] = &ClientServiceProcessor::process_get_row;
@@ -2561,6 +2780,7 @@ class ClientServiceProcessor : virtual public apache::thrift::TProcessor {
     processMap_["set_cell_as_array"] = &ClientServiceProcessor::process_set_cell_as_array;
     processMap_["set_cells"] = &ClientServiceProcessor::process_set_cells;
     processMap_["set_cells_as_arrays"] = &ClientServiceProcessor::process_set_cells_as_arrays;
+    processMap_["set_cells_serialized"] = &ClientServiceProcessor::process_set_cells_serialized;
     processMap_["flush_mutator"] = &ClientServiceProcessor::process_flush_mutator;
     processMap_["get_table_id"] = &ClientServiceProcessor::process_get_table_id;
     processMap_["get_schema"] = &ClientServiceProcessor::process_get_schema;
@@ -2633,6 +2853,18 @@ class ClientServiceMultiface : virtual public ClientServiceIf {
     }
   }
 
+  void next_cells_serialized(CellsSerialized& _return, const Scanner scanner) {
+    uint32_t sz = ifaces_.size();
+    for (uint32_t i = 0; i < sz; ++i) {
+      if (i == sz - 1) {
+        ifaces_[i]->next_cells_serialized(_return, scanner);
+        return;
+      } else {
+        ifaces_[i]->next_cells_serialized(_return, scanner);
+      }
+    }
+  }
+
   void next_row(std::vector<Cell> & _return, const Scanner scanner) {
     uint32_t sz = ifaces_.size();
     for (uint32_t i = 0; i < sz; ++i) {
@@ -2763,6 +2995,13 @@ class ClientServiceMultiface : virtual public ClientServiceIf {
     }
   }
 
+  void set_cells_serialized(const Mutator mutator, const CellsSerialized& cells, const bool flush) {
+    uint32_t sz = ifaces_.size();
+    for (uint32_t i = 0; i < sz; ++i) {
+      ifaces_[i]->set_cells_serialized(mutator, cells, flush);
+    }
+  }
+
   void flush_mutator(const Mutator mutator) {
     uint32_t sz = ifaces_.size();
     for (uint32_t i = 0; i < sz; ++i) {
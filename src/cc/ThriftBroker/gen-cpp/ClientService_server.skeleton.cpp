@@ -47,6 +47,11 @@ class ClientServiceHandler : virtual public ClientServiceIf {
     printf("next_cells_as_arrays\n");
   }
 
+  void next_cells_serialized(CellsSerialized& _return, const Scanner scanner) {
+    // Your implementation goes here
+    printf("next_cells_serialized\n");
+  }
+
   void next_row(std::vector<Cell> & _return, const Scanner scanner) {
     // Your implementation goes here
     printf("next_row\n");
@@ -112,6 +117,11 @@ class ClientServiceHandler : virtual public ClientServiceIf {
     printf("set_cells_as_arrays\n");
   }
 
+  void set_cells_serialized(const Mutator mutator, const CellsSerialized& cells, const bool flush) {
+    // Your implementation goes here
+    printf("set_cells_serialized\n");
+  }
+
   void flush_mutator(const Mutator mutator) {
     // Your implementation goes here
     printf("flush_mutator\n");
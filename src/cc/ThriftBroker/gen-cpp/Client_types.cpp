@@ -223,8 +223,80 @@ uint32_t CellInterval::write(apache::thrift::protocol::TProtocol* oprot) const {
   return xfer;
 }
 
-const char* ScanSpec::ascii_fingerprint = "AAC6EAC7CCF976D9159BC1D44D2DABF3";
-const uint8_t ScanSpec::binary_fingerprint[16] = {0xAA,0xC6,0xEA,0xC7,0xCC,0xF9,0x76,0xD9,0x15,0x9B,0xC1,0xD4,0x4D,0x2D,0xAB,0xF3};
+const char* FilterTerm::ascii_fingerprint = "24652790C81ECE22B629CB60A19F1E93";
+const uint8_t FilterTerm::binary_fingerprint[16] = {0x24,0x65,0x27,0x90,0xC8,0x1E,0xCE,0x22,0xB6,0x29,0xCB,0x60,0xA1,0x9F,0x1E,0x93};
+
+uint32_t FilterTerm::read(apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using apache::thrift::protocol::TProtocolException;
+
+  bool isset_op = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == apache::thrift::protocol::T_I32) {
+          int32_t ecast15;
+          xfer += iprot->readI32(ecast15);
+          this->op = (FilterOp)ecast15;
+          isset_op = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->pattern);
+          this->__isset.pattern = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_op)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t FilterTerm::write(apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  xfer += oprot->writeStructBegin("FilterTerm");
+  xfer += oprot->writeFieldBegin("op", apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((int32_t)this->op);
+  xfer += oprot->writeFieldEnd();
+  if (this->__isset.pattern) {
+    xfer += oprot->writeFieldBegin("pattern", apache::thrift::protocol::T_STRING, 2);
+    xfer += oprot->writeString(this->pattern);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+const char* ScanSpec::ascii_fingerprint = "05D69D5F01E5098218A300ACD905C0EB";
+const uint8_t ScanSpec::binary_fingerprint[16] = {0x05,0xD6,0x9D,0x5F,0x01,0xE5,0x09,0x82,0x18,0xA3,0x00,0xAC,0xD9,0x05,0xC0,0xEB};
 
 uint32_t ScanSpec::read(apache::thrift::protocol::TProtocol* iprot) {
 
@@ -346,6 +418,26 @@ uint32_t ScanSpec::read(apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 9:
+        if (ftype == apache::thrift::protocol::T_LIST) {
+          {
+            this->filter.clear();
+            uint32_t _size16;
+            apache::thrift::protocol::TType _etype19;
+            iprot->readListBegin(_etype19, _size16);
+            this->filter.resize(_size16);
+            uint32_t _i20;
+            for (_i20 = 0; _i20 < _size16; ++_i20)
+            {
+              xfer += this->filter[_i20].read(iprot);
+            }
+            iprot->readListEnd();
+          }
+          this->__isset.filter = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -365,10 +457,10 @@ uint32_t ScanSpec::write(apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("row_intervals", apache::thrift::protocol::T_LIST, 1);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->row_intervals.size());
-      std::vector<RowInterval> ::const_iterator _iter15;
-      for (_iter15 = this->row_intervals.begin(); _iter15 != this->row_intervals.end(); ++_iter15)
+      std::vector<RowInterval> ::const_iterator _iter21;
+      for (_iter21 = this->row_intervals.begin(); _iter21 != this->row_intervals.end(); ++_iter21)
       {
-        xfer += (*_iter15).write(oprot);
+        xfer += (*_iter21).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -378,10 +470,10 @@ uint32_t ScanSpec::write(apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("cell_intervals", apache::thrift::protocol::T_LIST, 2);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->cell_intervals.size());
-      std::vector<CellInterval> ::const_iterator _iter16;
-      for (_iter16 = this->cell_intervals.begin(); _iter16 != this->cell_intervals.end(); ++_iter16)
+      std::vector<CellInterval> ::const_iterator _iter22;
+      for (_iter22 = this->cell_intervals.begin(); _iter22 != this->cell_intervals.end(); ++_iter22)
       {
-        xfer += (*_iter16).write(oprot);
+        xfer += (*_iter22).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -416,10 +508,23 @@ uint32_t ScanSpec::write(apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeFieldBegin("columns", apache::thrift::protocol::T_LIST, 8);
     {
       xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRING, this->columns.size());
-      std::vector<std::string> ::const_iterator _iter17;
-      for (_iter17 = this->columns.begin(); _iter17 != this->columns.end(); ++_iter17)
+      std::vector<std::string> ::const_iterator _iter23;
+      for (_iter23 = this->columns.begin(); _iter23 != this->columns.end(); ++_iter23)
+      {
+        xfer += oprot->writeString((*_iter23));
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.filter) {
+    xfer += oprot->writeFieldBegin("filter", apache::thrift::protocol::T_LIST, 9);
+    {
+      xfer += oprot->writeListBegin(apache::thrift::protocol::T_STRUCT, this->filter.size());
+      std::vector<FilterTerm> ::const_iterator _iter24;
+      for (_iter24 = this->filter.begin(); _iter24 != this->filter.end(); ++_iter24)
       {
-        xfer += oprot->writeString((*_iter17));
+        xfer += (*_iter24).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
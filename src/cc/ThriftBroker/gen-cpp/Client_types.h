@@ -25,12 +25,26 @@ enum MutatorFlag {
   NO_LOG_SYNC = 1
 };
 
+enum FilterOp {
+  QUALIFIER_EXACT = 1,
+  QUALIFIER_PREFIX = 2,
+  QUALIFIER_REGEX = 3,
+  VALUE_EXACT = 4,
+  VALUE_PREFIX = 5,
+  VALUE_REGEX = 6,
+  AND = 7,
+  OR = 8,
+  NOT = 9
+};
+
 typedef int64_t Scanner;
 
 typedef int64_t Mutator;
 
 typedef std::string Value;
 
+typedef std::string CellsSerialized;
+
 typedef std::vector<std::string>  CellAsArray;
 
 class RowInterval {
@@ -155,11 +169,51 @@ class CellInterval {
 
 };
 
+class FilterTerm {
+ public:
+
+  static const char* ascii_fingerprint; // = "24652790C81ECE22B629CB60A19F1E93";
+  static const uint8_t binary_fingerprint[16]; // = {0x24,0x65,0x27,0x90,0xC8,0x1E,0xCE,0x22,0xB6,0x29,0xCB,0x60,0xA1,0x9F,0x1E,0x93};
+
+  FilterTerm() : pattern("") {
+  }
+
+  virtual ~FilterTerm() throw() {}
+
+  FilterOp op;
+  std::string pattern;
+
+  struct __isset {
+    __isset() : pattern(false) {}
+    bool pattern;
+  } __isset;
+
+  bool operator == (const FilterTerm & rhs) const
+  {
+    if (!(op == rhs.op))
+      return false;
+    if (__isset.pattern != rhs.__isset.pattern)
+      return false;
+    else if (__isset.pattern && !(pattern == rhs.pattern))
+      return false;
+    return true;
+  }
+  bool operator != (const FilterTerm &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const FilterTerm & ) const;
+
+  uint32_t read(apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
 class ScanSpec {
  public:
 
-  static const char* ascii_fingerprint; // = "AAC6EAC7CCF976D9159BC1D44D2DABF3";
-  static const uint8_t binary_fingerprint[16]; // = {0xAA,0xC6,0xEA,0xC7,0xCC,0xF9,0x76,0xD9,0x15,0x9B,0xC1,0xD4,0x4D,0x2D,0xAB,0xF3};
+  static const char* ascii_fingerprint; // = "05D69D5F01E5098218A300ACD905C0EB";
+  static const uint8_t binary_fingerprint[16]; // = {0x05,0xD6,0x9D,0x5F,0x01,0xE5,0x09,0x82,0x18,0xA3,0x00,0xAC,0xD9,0x05,0xC0,0xEB};
 
   ScanSpec() : return_deletes(false), revs(0), row_limit(0), start_time(0), end_time(0) {
   }
@@ -174,9 +228,10 @@ class ScanSpec {
   int64_t start_time;
   int64_t end_time;
   std::vector<std::string>  columns;
+  std::vector<FilterTerm>  filter;
 
   struct __isset {
-    __isset() : row_intervals(false), cell_intervals(false), return_deletes(false), revs(false), row_limit(false), start_time(false), end_time(false), columns(false) {}
+    __isset() : row_intervals(false), cell_intervals(false), return_deletes(false), revs(false), row_limit(false), start_time(false), end_time(false), columns(false), filter(false) {}
     bool row_intervals;
     bool cell_intervals;
     bool return_deletes;
@@ -185,6 +240,7 @@ class ScanSpec {
     bool start_time;
     bool end_time;
     bool columns;
+    bool filter;
   } __isset;
 
   bool operator == (const ScanSpec & rhs) const
@@ -221,6 +277,10 @@ class ScanSpec {
       return false;
     else if (__isset.columns && !(columns == rhs.columns))
       return false;
+    if (__isset.filter != rhs.__isset.filter)
+      return false;
+    else if (__isset.filter && !(filter == rhs.filter))
+      return false;
     return true;
   }
   bool operator != (const ScanSpec &rhs) const {
@@ -74,6 +74,18 @@ public class ClientService {
 
     public List<List<String>> next_cells_as_arrays(long scanner) throws ClientException, TException;
 
+    /**
+     * Alternative interface returning a block of cells in the serialized
+     * cells encoding, which avoids creating an object per cell
+     * 
+     * @param scanner - scanner id
+     * 
+     * @return a block of cells, containing no cells at the end of the scan
+     * 
+     * @param scanner
+     */
+    public byte[] next_cells_serialized(long scanner) throws ClientException, TException;
+
     /**
      * Iterate over rows of a scanner
      * 
@@ -220,6 +232,22 @@ public class ClientService {
      */
     public void set_cells_as_arrays(long mutator, List<List<String>> cells) throws ClientException, TException;
 
+    /**
+     * Alternative interface taking a block of cells in the serialized cells
+     * encoding
+     * 
+     * @param mutator - mutator id
+     * 
+     * @param cells - a block of serialized cells
+     * 
+     * @param flush - whether to flush the mutator after adding the cells
+     * 
+     * @param mutator
+     * @param cells
+     * @param flush
+     */
+    public void set_cells_serialized(long mutator, byte[] cells, boolean flush) throws ClientException, TException;
+
     /**
      * Flush mutator buffers
      * 
@@ -474,6 +502,42 @@ public class ClientService {
       throw new TApplicationException(TApplicationException.MISSING_RESULT, "next_cells_as_arrays failed: unknown result");
     }
 
+    public byte[] next_cells_serialized(long scanner) throws ClientException, TException
+    {
+      send_next_cells_serialized(scanner);
+      return recv_next_cells_serialized();
+    }
+
+    public void send_next_cells_serialized(long scanner) throws TException
+    {
+      oprot_.writeMessageBegin(new TMessage("next_cells_serialized", TMessageType.CALL, seqid_));
+      next_cells_serialized_args args = new next_cells_serialized_args();
+      args.scanner = scanner;
+      args.write(oprot_);
+      oprot_.writeMessageEnd();
+      oprot_.getTransport().flush();
+    }
+
+    public byte[] recv_next_cells_serialized() throws ClientException, TException
+    {
+      TMessage msg = iprot_.readMessageBegin();
+      if (msg.type == TMessageType.EXCEPTION) {
+        TApplicationException x = TApplicationException.read(iprot_);
+        iprot_.readMessageEnd();
+        throw x;
+      }
+      next_cells_serialized_result result = new next_cells_serialized_result();
+      result.read(iprot_);
+      iprot_.readMessageEnd();
+      if (result.isSetSuccess()) {
+        return result.success;
+      }
+      if (result.e != null) {
+        throw result.e;
+      }
+      throw new TApplicationException(TApplicationException.MISSING_RESULT, "next_cells_serialized failed: unknown result");
+    }
+
     public List<Cell> next_row(long scanner) throws ClientException, TException
     {
       send_next_row(scanner);
@@ -940,6 +1004,41 @@ public class ClientService {
       return;
     }
 
+    public void set_cells_serialized(long mutator, byte[] cells, boolean flush) throws ClientException, TException
+    {
+      send_set_cells_serialized(mutator, cells, flush);
+      recv_set_cells_serialized();
+    }
+
+    public void send_set_cells_serialized(long mutator, byte[] cells, boolean flush) throws TException
+    {
+      oprot_.writeMessageBegin(new TMessage("set_cells_serialized", TMessageType.CALL, seqid_));
+      set_cells_serialized_args args = new set_cells_serialized_args();
+      args.mutator = mutator;
+      args.cells = cells;
+      args.flush = flush;
+      args.write(oprot_);
+      oprot_.writeMessageEnd();
+      oprot_.getTransport().flush();
+    }
+
+    public void recv_set_cells_serialized() throws ClientException, TException
+    {
+      TMessage msg = iprot_.readMessageBegin();
+      if (msg.type == TMessageType.EXCEPTION) {
+        TApplicationException x = TApplicationException.read(iprot_);
+        iprot_.readMessageEnd();
+        throw x;
+      }
+      set_cells_serialized_result result = new set_cells_serialized_result();
+      result.read(iprot_);
+      iprot_.readMessageEnd();
+      if (result.e != null) {
+        throw result.e;
+      }
+      return;
+    }
+
     public void flush_mutator(long mutator) throws ClientException, TException
     {
       send_flush_mutator(mutator);
@@ -1125,6 +1224,7 @@ public class ClientService {
       processMap_.put("close_scanner", new close_scanner());
       processMap_.put("next_cells", new next_cells());
       processMap_.put("next_cells_as_arrays", new next_cells_as_arrays());
+      processMap_.put("next_cells_serialized", new next_cells_serialized());
       processMap_.put("next_row", new next_row());
       processMap_.put("next_row_as_arrays", new next_row_as_arrays());
       processMap_.put("get_row", new get_row());
@@ -1138,6 +1238,7 @@ public class ClientService {
       processMap_.put("set_cell_as_array", new set_cell_as_array());
       processMap_.put("set_cells", new set_cells());
       processMap_.put("set_cells_as_arrays", new set_cells_as_arrays());
+      processMap_.put("set_cells_serialized", new set_cells_serialized());
       processMap_.put("flush_mutator", new flush_mutator());
       processMap_.put("get_table_id", new get_table_id());
       processMap_.put("get_schema", new get_schema());
@@ -1311,6 +1412,34 @@ public class ClientService {
 
     }
 
+    private class next_cells_serialized implements ProcessFunction {
+      public void process(int seqid, TProtocol iprot, TProtocol oprot) throws TException
+      {
+        next_cells_serialized_args args = new next_cells_serialized_args();
+        args.read(iprot);
+        iprot.readMessageEnd();
+        next_cells_serialized_result result = new next_cells_serialized_result();
+        try {
+          result.success = iface_.next_cells_serialized(args.scanner);
+        } catch (ClientException e) {
+          result.e = e;
+        } catch (Throwable th) {
+          LOGGER.error("Internal error processing next_cells_serialized", th);
+          TApplicationException x = new TApplicationException(TApplicationException.INTERNAL_ERROR, "Internal error processing next_cells_serialized");
+          oprot.writeMessageBegin(new TMessage("next_cells_serialized", TMessageType.EXCEPTION, seqid));
+          x.write(oprot);
+          oprot.writeMessageEnd();
+          oprot.getTransport().flush();
+          return;
+        }
+        oprot.writeMessageBegin(new TMessage("next_cells_serialized", TMessageType.REPLY, seqid));
+        result.write(oprot);
+        oprot.writeMessageEnd();
+        oprot.getTransport().flush();
+      }
+
+    }
+
     private class next_row implements ProcessFunction {
       public void process(int seqid, TProtocol iprot, TProtocol oprot) throws TException
       {
@@ -1676,6 +1805,34 @@ public class ClientService {
 
     }
 
+    private class set_cells_serialized implements ProcessFunction {
+      public void process(int seqid, TProtocol iprot, TProtocol oprot) throws TException
+      {
+        set_cells_serialized_args args = new set_cells_serialized_args();
+        args.read(iprot);
+        iprot.readMessageEnd();
+        set_cells_serialized_result result = new set_cells_serialized_result();
+        try {
+          iface_.set_cells_serialized(args.mutator, args.cells, args.flush);
+        } catch (ClientException e) {
+          result.e = e;
+        } catch (Throwable th) {
+          LOGGER.error("Internal error processing set_cells_serialized", th);
+          TApplicationException x = new TApplicationException(TApplicationException.INTERNAL_ERROR, "Internal error processing set_cells_serialized");
+          oprot.writeMessageBegin(new TMessage("set_cells_serialized", TMessageType.EXCEPTION, seqid));
+          x.write(oprot);
+          oprot.writeMessageEnd();
+          oprot.getTransport().flush();
+          return;
+        }
+        oprot.writeMessageBegin(new TMessage("set_cells_serialized", TMessageType.REPLY, seqid));
+        result.write(oprot);
+        oprot.writeMessageEnd();
+        oprot.getTransport().flush();
+      }
+
+    }
+
     private class flush_mutator implements ProcessFunction {
       public void process(int seqid, TProtocol iprot, TProtocol oprot) throws TException
       {
@@ -3717,14 +3874,14 @@ public class ClientService {
           case SUCCESS:
             if (field.type == TType.LIST) {
               {
-                TList _list12 = iprot.readListBegin();
-                this.success = new ArrayList<Cell>(_list12.size);
-                for (int _i13 = 0; _i13 < _list12.size; ++_i13)
+                TList _list16 = iprot.readListBegin();
+                this.success = new ArrayList<Cell>(_list16.size);
+                for (int _i17 = 0; _i17 < _list16.size; ++_i17)
                 {
-                  Cell _elem14;
-                  _elem14 = new Cell();
-                  _elem14.read(iprot);
-                  this.success.add(_elem14);
+                  Cell _elem18;
+                  _elem18 = new Cell();
+                  _elem18.read(iprot);
+                  this.success.add(_elem18);
                 }
                 iprot.readListEnd();
               }
@@ -3760,8 +3917,8 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new TList(TType.STRUCT, this.success.size()));
-          for (Cell _iter15 : this.success)          {
-            _iter15.write(oprot);
+          for (Cell _iter19 : this.success)          {
+            _iter19.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -4221,23 +4378,23 @@ public class ClientService {
           case SUCCESS:
             if (field.type == TType.LIST) {
               {
-                TList _list16 = iprot.readListBegin();
-                this.success = new ArrayList<List<String>>(_list16.size);
-                for (int _i17 = 0; _i17 < _list16.size; ++_i17)
+                TList _list20 = iprot.readListBegin();
+                this.success = new ArrayList<List<String>>(_list20.size);
+                for (int _i21 = 0; _i21 < _list20.size; ++_i21)
                 {
-                  List<String> _elem18;
+                  List<String> _elem22;
                   {
-                    TList _list19 = iprot.readListBegin();
-                    _elem18 = new ArrayList<String>(_list19.size);
-                    for (int _i20 = 0; _i20 < _list19.size; ++_i20)
+                    TList _list23 = iprot.readListBegin();
+                    _elem22 = new ArrayList<String>(_list23.size);
+                    for (int _i24 = 0; _i24 < _list23.size; ++_i24)
                     {
-                      String _elem21;
-                      _elem21 = iprot.readString();
-                      _elem18.add(_elem21);
+                      String _elem25;
+                      _elem25 = iprot.readString();
+                      _elem22.add(_elem25);
                     }
                     iprot.readListEnd();
                   }
-                  this.success.add(_elem18);
+                  this.success.add(_elem22);
                 }
                 iprot.readListEnd();
               }
@@ -4273,11 +4430,11 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new TList(TType.LIST, this.success.size()));
-          for (List<String> _iter22 : this.success)          {
+          for (List<String> _iter26 : this.success)          {
             {
-              oprot.writeListBegin(new TList(TType.STRING, _iter22.size()));
-              for (String _iter23 : _iter22)              {
-                oprot.writeString(_iter23);
+              oprot.writeListBegin(new TList(TType.STRING, _iter26.size()));
+              for (String _iter27 : _iter26)              {
+                oprot.writeString(_iter27);
               }
               oprot.writeListEnd();
             }
@@ -4325,8 +4482,8 @@ public class ClientService {
 
   }
 
-  public static class next_row_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("next_row_args");
+  public static class next_cells_serialized_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("next_cells_serialized_args");
     private static final TField SCANNER_FIELD_DESC = new TField("scanner", TType.I64, (short)1);
 
     public long scanner;
@@ -4343,13 +4500,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(next_row_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(next_cells_serialized_args.class, metaDataMap);
     }
 
-    public next_row_args() {
+    public next_cells_serialized_args() {
     }
 
-    public next_row_args(
+    public next_cells_serialized_args(
       long scanner)
     {
       this();
@@ -4360,14 +4517,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_row_args(next_row_args other) {
+    public next_cells_serialized_args(next_cells_serialized_args other) {
       __isset.scanner = other.__isset.scanner;
       this.scanner = other.scanner;
     }
 
     @Override
-    public next_row_args clone() {
-      return new next_row_args(this);
+    public next_cells_serialized_args clone() {
+      return new next_cells_serialized_args(this);
     }
 
     public long getScanner() {
@@ -4431,12 +4588,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_row_args)
-        return this.equals((next_row_args)that);
+      if (that instanceof next_cells_serialized_args)
+        return this.equals((next_cells_serialized_args)that);
       return false;
     }
 
-    public boolean equals(next_row_args that) {
+    public boolean equals(next_cells_serialized_args that) {
       if (that == null)
         return false;
 
@@ -4502,7 +4659,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_row_args(");
+      StringBuilder sb = new StringBuilder("next_cells_serialized_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -4519,12 +4676,12 @@ public class ClientService {
 
   }
 
-  public static class next_row_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("next_row_result");
-    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.LIST, (short)0);
+  public static class next_cells_serialized_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("next_cells_serialized_result");
+    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.STRING, (short)0);
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
-    public List<Cell> success;
+    public byte[] success;
     public static final int SUCCESS = 0;
     public ClientException e;
     public static final int E = 1;
@@ -4535,21 +4692,20 @@ public class ClientService {
 
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
-          new ListMetaData(TType.LIST, 
-              new StructMetaData(TType.STRUCT, Cell.class))));
+          new FieldValueMetaData(TType.STRING)));
       put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRUCT)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(next_row_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(next_cells_serialized_result.class, metaDataMap);
     }
 
-    public next_row_result() {
+    public next_cells_serialized_result() {
     }
 
-    public next_row_result(
-      List<Cell> success,
+    public next_cells_serialized_result(
+      byte[] success,
       ClientException e)
     {
       this();
@@ -4560,13 +4716,9 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_row_result(next_row_result other) {
+    public next_cells_serialized_result(next_cells_serialized_result other) {
       if (other.isSetSuccess()) {
-        List<Cell> __this__success = new ArrayList<Cell>();
-        for (Cell other_element : other.success) {
-          __this__success.add(new Cell(other_element));
-        }
-        this.success = __this__success;
+        this.success = other.success;
       }
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
@@ -4574,30 +4726,15 @@ public class ClientService {
     }
 
     @Override
-    public next_row_result clone() {
-      return new next_row_result(this);
-    }
-
-    public int getSuccessSize() {
-      return (this.success == null) ? 0 : this.success.size();
-    }
-
-    public java.util.Iterator<Cell> getSuccessIterator() {
-      return (this.success == null) ? null : this.success.iterator();
-    }
-
-    public void addToSuccess(Cell elem) {
-      if (this.success == null) {
-        this.success = new ArrayList<Cell>();
-      }
-      this.success.add(elem);
+    public next_cells_serialized_result clone() {
+      return new next_cells_serialized_result(this);
     }
 
-    public List<Cell> getSuccess() {
+    public byte[] getSuccess() {
       return this.success;
     }
 
-    public void setSuccess(List<Cell> success) {
+    public void setSuccess(byte[] success) {
       this.success = success;
     }
 
@@ -4645,7 +4782,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((List<Cell>)value);
+          setSuccess((byte[])value);
         }
         break;
 
@@ -4691,12 +4828,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_row_result)
-        return this.equals((next_row_result)that);
+      if (that instanceof next_cells_serialized_result)
+        return this.equals((next_cells_serialized_result)that);
       return false;
     }
 
-    public boolean equals(next_row_result that) {
+    public boolean equals(next_cells_serialized_result that) {
       if (that == null)
         return false;
 
@@ -4705,7 +4842,7 @@ public class ClientService {
       if (this_present_success || that_present_success) {
         if (!(this_present_success && that_present_success))
           return false;
-        if (!this.success.equals(that.success))
+        if (!java.util.Arrays.equals(this.success, that.success))
           return false;
       }
 
@@ -4738,19 +4875,8 @@ public class ClientService {
         switch (field.id)
         {
           case SUCCESS:
-            if (field.type == TType.LIST) {
-              {
-                TList _list24 = iprot.readListBegin();
-                this.success = new ArrayList<Cell>(_list24.size);
-                for (int _i25 = 0; _i25 < _list24.size; ++_i25)
-                {
-                  Cell _elem26;
-                  _elem26 = new Cell();
-                  _elem26.read(iprot);
-                  this.success.add(_elem26);
-                }
-                iprot.readListEnd();
-              }
+            if (field.type == TType.STRING) {
+              this.success = iprot.readBinary();
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -4781,13 +4907,7 @@ public class ClientService {
 
       if (this.isSetSuccess()) {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        {
-          oprot.writeListBegin(new TList(TType.STRUCT, this.success.size()));
-          for (Cell _iter27 : this.success)          {
-            _iter27.write(oprot);
-          }
-          oprot.writeListEnd();
-        }
+        oprot.writeBinary(this.success);
         oprot.writeFieldEnd();
       } else if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
@@ -4800,7 +4920,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_row_result(");
+      StringBuilder sb = new StringBuilder("next_cells_serialized_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -4829,8 +4949,8 @@ public class ClientService {
 
   }
 
-  public static class next_row_as_arrays_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("next_row_as_arrays_args");
+  public static class next_row_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("next_row_args");
     private static final TField SCANNER_FIELD_DESC = new TField("scanner", TType.I64, (short)1);
 
     public long scanner;
@@ -4847,13 +4967,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(next_row_as_arrays_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(next_row_args.class, metaDataMap);
     }
 
-    public next_row_as_arrays_args() {
+    public next_row_args() {
     }
 
-    public next_row_as_arrays_args(
+    public next_row_args(
       long scanner)
     {
       this();
@@ -4864,14 +4984,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_row_as_arrays_args(next_row_as_arrays_args other) {
+    public next_row_args(next_row_args other) {
       __isset.scanner = other.__isset.scanner;
       this.scanner = other.scanner;
     }
 
     @Override
-    public next_row_as_arrays_args clone() {
-      return new next_row_as_arrays_args(this);
+    public next_row_args clone() {
+      return new next_row_args(this);
     }
 
     public long getScanner() {
@@ -4935,12 +5055,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_row_as_arrays_args)
-        return this.equals((next_row_as_arrays_args)that);
+      if (that instanceof next_row_args)
+        return this.equals((next_row_args)that);
       return false;
     }
 
-    public boolean equals(next_row_as_arrays_args that) {
+    public boolean equals(next_row_args that) {
       if (that == null)
         return false;
 
@@ -5006,7 +5126,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_row_as_arrays_args(");
+      StringBuilder sb = new StringBuilder("next_row_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -5023,12 +5143,12 @@ public class ClientService {
 
   }
 
-  public static class next_row_as_arrays_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("next_row_as_arrays_result");
+  public static class next_row_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("next_row_result");
     private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.LIST, (short)0);
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
-    public List<List<String>> success;
+    public List<Cell> success;
     public static final int SUCCESS = 0;
     public ClientException e;
     public static final int E = 1;
@@ -5040,20 +5160,20 @@ public class ClientService {
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
           new ListMetaData(TType.LIST, 
-              new FieldValueMetaData(TType.LIST))));
+              new StructMetaData(TType.STRUCT, Cell.class))));
       put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRUCT)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(next_row_as_arrays_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(next_row_result.class, metaDataMap);
     }
 
-    public next_row_as_arrays_result() {
+    public next_row_result() {
     }
 
-    public next_row_as_arrays_result(
-      List<List<String>> success,
+    public next_row_result(
+      List<Cell> success,
       ClientException e)
     {
       this();
@@ -5064,11 +5184,11 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_row_as_arrays_result(next_row_as_arrays_result other) {
+    public next_row_result(next_row_result other) {
       if (other.isSetSuccess()) {
-        List<List<String>> __this__success = new ArrayList<List<String>>();
-        for (List<String> other_element : other.success) {
-          __this__success.add(other_element);
+        List<Cell> __this__success = new ArrayList<Cell>();
+        for (Cell other_element : other.success) {
+          __this__success.add(new Cell(other_element));
         }
         this.success = __this__success;
       }
@@ -5078,30 +5198,30 @@ public class ClientService {
     }
 
     @Override
-    public next_row_as_arrays_result clone() {
-      return new next_row_as_arrays_result(this);
+    public next_row_result clone() {
+      return new next_row_result(this);
     }
 
     public int getSuccessSize() {
       return (this.success == null) ? 0 : this.success.size();
     }
 
-    public java.util.Iterator<List<String>> getSuccessIterator() {
+    public java.util.Iterator<Cell> getSuccessIterator() {
       return (this.success == null) ? null : this.success.iterator();
     }
 
-    public void addToSuccess(List<String> elem) {
+    public void addToSuccess(Cell elem) {
       if (this.success == null) {
-        this.success = new ArrayList<List<String>>();
+        this.success = new ArrayList<Cell>();
       }
       this.success.add(elem);
     }
 
-    public List<List<String>> getSuccess() {
+    public List<Cell> getSuccess() {
       return this.success;
     }
 
-    public void setSuccess(List<List<String>> success) {
+    public void setSuccess(List<Cell> success) {
       this.success = success;
     }
 
@@ -5149,7 +5269,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((List<List<String>>)value);
+          setSuccess((List<Cell>)value);
         }
         break;
 
@@ -5195,12 +5315,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_row_as_arrays_result)
-        return this.equals((next_row_as_arrays_result)that);
+      if (that instanceof next_row_result)
+        return this.equals((next_row_result)that);
       return false;
     }
 
-    public boolean equals(next_row_as_arrays_result that) {
+    public boolean equals(next_row_result that) {
       if (that == null)
         return false;
 
@@ -5245,21 +5365,12 @@ public class ClientService {
             if (field.type == TType.LIST) {
               {
                 TList _list28 = iprot.readListBegin();
-                this.success = new ArrayList<List<String>>(_list28.size);
+                this.success = new ArrayList<Cell>(_list28.size);
                 for (int _i29 = 0; _i29 < _list28.size; ++_i29)
                 {
-                  List<String> _elem30;
-                  {
-                    TList _list31 = iprot.readListBegin();
-                    _elem30 = new ArrayList<String>(_list31.size);
-                    for (int _i32 = 0; _i32 < _list31.size; ++_i32)
-                    {
-                      String _elem33;
-                      _elem33 = iprot.readString();
-                      _elem30.add(_elem33);
-                    }
-                    iprot.readListEnd();
-                  }
+                  Cell _elem30;
+                  _elem30 = new Cell();
+                  _elem30.read(iprot);
                   this.success.add(_elem30);
                 }
                 iprot.readListEnd();
@@ -5295,15 +5406,9 @@ public class ClientService {
       if (this.isSetSuccess()) {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
-          oprot.writeListBegin(new TList(TType.LIST, this.success.size()));
-          for (List<String> _iter34 : this.success)          {
-            {
-              oprot.writeListBegin(new TList(TType.STRING, _iter34.size()));
-              for (String _iter35 : _iter34)              {
-                oprot.writeString(_iter35);
-              }
-              oprot.writeListEnd();
-            }
+          oprot.writeListBegin(new TList(TType.STRUCT, this.success.size()));
+          for (Cell _iter31 : this.success)          {
+            _iter31.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -5319,7 +5424,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_row_as_arrays_result(");
+      StringBuilder sb = new StringBuilder("next_row_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -5348,121 +5453,80 @@ public class ClientService {
 
   }
 
-  public static class get_row_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_row_args");
-    private static final TField NAME_FIELD_DESC = new TField("name", TType.STRING, (short)1);
-    private static final TField ROW_FIELD_DESC = new TField("row", TType.STRING, (short)2);
+  public static class next_row_as_arrays_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("next_row_as_arrays_args");
+    private static final TField SCANNER_FIELD_DESC = new TField("scanner", TType.I64, (short)1);
 
-    public String name;
-    public static final int NAME = 1;
-    public String row;
-    public static final int ROW = 2;
+    public long scanner;
+    public static final int SCANNER = 1;
 
     private final Isset __isset = new Isset();
     private static final class Isset implements java.io.Serializable {
+      public boolean scanner = false;
     }
 
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
-      put(NAME, new FieldMetaData("name", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.STRING)));
-      put(ROW, new FieldMetaData("row", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.STRING)));
+      put(SCANNER, new FieldMetaData("scanner", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.I64)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_row_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(next_row_as_arrays_args.class, metaDataMap);
     }
 
-    public get_row_args() {
+    public next_row_as_arrays_args() {
     }
 
-    public get_row_args(
-      String name,
-      String row)
+    public next_row_as_arrays_args(
+      long scanner)
     {
       this();
-      this.name = name;
-      this.row = row;
+      this.scanner = scanner;
+      this.__isset.scanner = true;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_row_args(get_row_args other) {
-      if (other.isSetName()) {
-        this.name = other.name;
-      }
-      if (other.isSetRow()) {
-        this.row = other.row;
-      }
+    public next_row_as_arrays_args(next_row_as_arrays_args other) {
+      __isset.scanner = other.__isset.scanner;
+      this.scanner = other.scanner;
     }
 
     @Override
-    public get_row_args clone() {
-      return new get_row_args(this);
-    }
-
-    public String getName() {
-      return this.name;
-    }
-
-    public void setName(String name) {
-      this.name = name;
-    }
-
-    public void unsetName() {
-      this.name = null;
-    }
-
-    // Returns true if field name is set (has been asigned a value) and false otherwise
-    public boolean isSetName() {
-      return this.name != null;
-    }
-
-    public void setNameIsSet(boolean value) {
-      if (!value) {
-        this.name = null;
-      }
+    public next_row_as_arrays_args clone() {
+      return new next_row_as_arrays_args(this);
     }
 
-    public String getRow() {
-      return this.row;
+    public long getScanner() {
+      return this.scanner;
     }
 
-    public void setRow(String row) {
-      this.row = row;
+    public void setScanner(long scanner) {
+      this.scanner = scanner;
+      this.__isset.scanner = true;
     }
 
-    public void unsetRow() {
-      this.row = null;
+    public void unsetScanner() {
+      this.__isset.scanner = false;
     }
 
-    // Returns true if field row is set (has been asigned a value) and false otherwise
-    public boolean isSetRow() {
-      return this.row != null;
+    // Returns true if field scanner is set (has been asigned a value) and false otherwise
+    public boolean isSetScanner() {
+      return this.__isset.scanner;
     }
 
-    public void setRowIsSet(boolean value) {
-      if (!value) {
-        this.row = null;
-      }
+    public void setScannerIsSet(boolean value) {
+      this.__isset.scanner = value;
     }
 
     public void setFieldValue(int fieldID, Object value) {
       switch (fieldID) {
-      case NAME:
-        if (value == null) {
-          unsetName();
-        } else {
-          setName((String)value);
-        }
-        break;
-
-      case ROW:
+      case SCANNER:
         if (value == null) {
-          unsetRow();
+          unsetScanner();
         } else {
-          setRow((String)value);
+          setScanner((Long)value);
         }
         break;
 
@@ -5473,11 +5537,8 @@ public class ClientService {
 
     public Object getFieldValue(int fieldID) {
       switch (fieldID) {
-      case NAME:
-        return getName();
-
-      case ROW:
-        return getRow();
+      case SCANNER:
+        return new Long(getScanner());
 
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
@@ -5487,10 +5548,8 @@ public class ClientService {
     // Returns true if field corresponding to fieldID is set (has been asigned a value) and false otherwise
     public boolean isSet(int fieldID) {
       switch (fieldID) {
-      case NAME:
-        return isSetName();
-      case ROW:
-        return isSetRow();
+      case SCANNER:
+        return isSetScanner();
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -5500,30 +5559,21 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_row_args)
-        return this.equals((get_row_args)that);
+      if (that instanceof next_row_as_arrays_args)
+        return this.equals((next_row_as_arrays_args)that);
       return false;
     }
 
-    public boolean equals(get_row_args that) {
+    public boolean equals(next_row_as_arrays_args that) {
       if (that == null)
         return false;
 
-      boolean this_present_name = true && this.isSetName();
-      boolean that_present_name = true && that.isSetName();
-      if (this_present_name || that_present_name) {
-        if (!(this_present_name && that_present_name))
-          return false;
-        if (!this.name.equals(that.name))
-          return false;
-      }
-
-      boolean this_present_row = true && this.isSetRow();
-      boolean that_present_row = true && that.isSetRow();
-      if (this_present_row || that_present_row) {
-        if (!(this_present_row && that_present_row))
+      boolean this_present_scanner = true;
+      boolean that_present_scanner = true;
+      if (this_present_scanner || that_present_scanner) {
+        if (!(this_present_scanner && that_present_scanner))
           return false;
-        if (!this.row.equals(that.row))
+        if (this.scanner != that.scanner)
           return false;
       }
 
@@ -5546,16 +5596,10 @@ public class ClientService {
         }
         switch (field.id)
         {
-          case NAME:
-            if (field.type == TType.STRING) {
-              this.name = iprot.readString();
-            } else { 
-              TProtocolUtil.skip(iprot, field.type);
-            }
-            break;
-          case ROW:
-            if (field.type == TType.STRING) {
-              this.row = iprot.readString();
+          case SCANNER:
+            if (field.type == TType.I64) {
+              this.scanner = iprot.readI64();
+              this.__isset.scanner = true;
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -5577,39 +5621,20 @@ public class ClientService {
       validate();
 
       oprot.writeStructBegin(STRUCT_DESC);
-      if (this.name != null) {
-        oprot.writeFieldBegin(NAME_FIELD_DESC);
-        oprot.writeString(this.name);
-        oprot.writeFieldEnd();
-      }
-      if (this.row != null) {
-        oprot.writeFieldBegin(ROW_FIELD_DESC);
-        oprot.writeString(this.row);
-        oprot.writeFieldEnd();
-      }
+      oprot.writeFieldBegin(SCANNER_FIELD_DESC);
+      oprot.writeI64(this.scanner);
+      oprot.writeFieldEnd();
       oprot.writeFieldStop();
       oprot.writeStructEnd();
     }
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_row_args(");
+      StringBuilder sb = new StringBuilder("next_row_as_arrays_args(");
       boolean first = true;
 
-      sb.append("name:");
-      if (this.name == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.name);
-      }
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("row:");
-      if (this.row == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.row);
-      }
+      sb.append("scanner:");
+      sb.append(this.scanner);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -5622,12 +5647,12 @@ public class ClientService {
 
   }
 
-  public static class get_row_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_row_result");
+  public static class next_row_as_arrays_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("next_row_as_arrays_result");
     private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.LIST, (short)0);
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
-    public List<Cell> success;
+    public List<List<String>> success;
     public static final int SUCCESS = 0;
     public ClientException e;
     public static final int E = 1;
@@ -5639,20 +5664,20 @@ public class ClientService {
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
           new ListMetaData(TType.LIST, 
-              new StructMetaData(TType.STRUCT, Cell.class))));
+              new FieldValueMetaData(TType.LIST))));
       put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRUCT)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_row_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(next_row_as_arrays_result.class, metaDataMap);
     }
 
-    public get_row_result() {
+    public next_row_as_arrays_result() {
     }
 
-    public get_row_result(
-      List<Cell> success,
+    public next_row_as_arrays_result(
+      List<List<String>> success,
       ClientException e)
     {
       this();
@@ -5663,11 +5688,11 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_row_result(get_row_result other) {
+    public next_row_as_arrays_result(next_row_as_arrays_result other) {
       if (other.isSetSuccess()) {
-        List<Cell> __this__success = new ArrayList<Cell>();
-        for (Cell other_element : other.success) {
-          __this__success.add(new Cell(other_element));
+        List<List<String>> __this__success = new ArrayList<List<String>>();
+        for (List<String> other_element : other.success) {
+          __this__success.add(other_element);
         }
         this.success = __this__success;
       }
@@ -5677,30 +5702,30 @@ public class ClientService {
     }
 
     @Override
-    public get_row_result clone() {
-      return new get_row_result(this);
+    public next_row_as_arrays_result clone() {
+      return new next_row_as_arrays_result(this);
     }
 
     public int getSuccessSize() {
       return (this.success == null) ? 0 : this.success.size();
     }
 
-    public java.util.Iterator<Cell> getSuccessIterator() {
+    public java.util.Iterator<List<String>> getSuccessIterator() {
       return (this.success == null) ? null : this.success.iterator();
     }
 
-    public void addToSuccess(Cell elem) {
+    public void addToSuccess(List<String> elem) {
       if (this.success == null) {
-        this.success = new ArrayList<Cell>();
+        this.success = new ArrayList<List<String>>();
       }
       this.success.add(elem);
     }
 
-    public List<Cell> getSuccess() {
+    public List<List<String>> getSuccess() {
       return this.success;
     }
 
-    public void setSuccess(List<Cell> success) {
+    public void setSuccess(List<List<String>> success) {
       this.success = success;
     }
 
@@ -5748,7 +5773,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((List<Cell>)value);
+          setSuccess((List<List<String>>)value);
         }
         break;
 
@@ -5794,12 +5819,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_row_result)
-        return this.equals((get_row_result)that);
+      if (that instanceof next_row_as_arrays_result)
+        return this.equals((next_row_as_arrays_result)that);
       return false;
     }
 
-    public boolean equals(get_row_result that) {
+    public boolean equals(next_row_as_arrays_result that) {
       if (that == null)
         return false;
 
@@ -5843,14 +5868,23 @@ public class ClientService {
           case SUCCESS:
             if (field.type == TType.LIST) {
               {
-                TList _list36 = iprot.readListBegin();
-                this.success = new ArrayList<Cell>(_list36.size);
-                for (int _i37 = 0; _i37 < _list36.size; ++_i37)
+                TList _list32 = iprot.readListBegin();
+                this.success = new ArrayList<List<String>>(_list32.size);
+                for (int _i33 = 0; _i33 < _list32.size; ++_i33)
                 {
-                  Cell _elem38;
-                  _elem38 = new Cell();
-                  _elem38.read(iprot);
-                  this.success.add(_elem38);
+                  List<String> _elem34;
+                  {
+                    TList _list35 = iprot.readListBegin();
+                    _elem34 = new ArrayList<String>(_list35.size);
+                    for (int _i36 = 0; _i36 < _list35.size; ++_i36)
+                    {
+                      String _elem37;
+                      _elem37 = iprot.readString();
+                      _elem34.add(_elem37);
+                    }
+                    iprot.readListEnd();
+                  }
+                  this.success.add(_elem34);
                 }
                 iprot.readListEnd();
               }
@@ -5885,9 +5919,15 @@ public class ClientService {
       if (this.isSetSuccess()) {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
-          oprot.writeListBegin(new TList(TType.STRUCT, this.success.size()));
-          for (Cell _iter39 : this.success)          {
-            _iter39.write(oprot);
+          oprot.writeListBegin(new TList(TType.LIST, this.success.size()));
+          for (List<String> _iter38 : this.success)          {
+            {
+              oprot.writeListBegin(new TList(TType.STRING, _iter38.size()));
+              for (String _iter39 : _iter38)              {
+                oprot.writeString(_iter39);
+              }
+              oprot.writeListEnd();
+            }
           }
           oprot.writeListEnd();
         }
@@ -5903,7 +5943,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_row_result(");
+      StringBuilder sb = new StringBuilder("next_row_as_arrays_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -5932,8 +5972,8 @@ public class ClientService {
 
   }
 
-  public static class get_row_as_arrays_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_row_as_arrays_args");
+  public static class get_row_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_row_args");
     private static final TField NAME_FIELD_DESC = new TField("name", TType.STRING, (short)1);
     private static final TField ROW_FIELD_DESC = new TField("row", TType.STRING, (short)2);
 
@@ -5954,13 +5994,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_row_as_arrays_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_row_args.class, metaDataMap);
     }
 
-    public get_row_as_arrays_args() {
+    public get_row_args() {
     }
 
-    public get_row_as_arrays_args(
+    public get_row_args(
       String name,
       String row)
     {
@@ -5972,7 +6012,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_row_as_arrays_args(get_row_as_arrays_args other) {
+    public get_row_args(get_row_args other) {
       if (other.isSetName()) {
         this.name = other.name;
       }
@@ -5982,8 +6022,8 @@ public class ClientService {
     }
 
     @Override
-    public get_row_as_arrays_args clone() {
-      return new get_row_as_arrays_args(this);
+    public get_row_args clone() {
+      return new get_row_args(this);
     }
 
     public String getName() {
@@ -6084,12 +6124,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_row_as_arrays_args)
-        return this.equals((get_row_as_arrays_args)that);
+      if (that instanceof get_row_args)
+        return this.equals((get_row_args)that);
       return false;
     }
 
-    public boolean equals(get_row_as_arrays_args that) {
+    public boolean equals(get_row_args that) {
       if (that == null)
         return false;
 
@@ -6177,7 +6217,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_row_as_arrays_args(");
+      StringBuilder sb = new StringBuilder("get_row_args(");
       boolean first = true;
 
       sb.append("name:");
@@ -6206,12 +6246,12 @@ public class ClientService {
 
   }
 
-  public static class get_row_as_arrays_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_row_as_arrays_result");
+  public static class get_row_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_row_result");
     private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.LIST, (short)0);
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
-    public List<List<String>> success;
+    public List<Cell> success;
     public static final int SUCCESS = 0;
     public ClientException e;
     public static final int E = 1;
@@ -6223,20 +6263,20 @@ public class ClientService {
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
           new ListMetaData(TType.LIST, 
-              new FieldValueMetaData(TType.LIST))));
+              new StructMetaData(TType.STRUCT, Cell.class))));
       put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRUCT)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_row_as_arrays_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_row_result.class, metaDataMap);
     }
 
-    public get_row_as_arrays_result() {
+    public get_row_result() {
     }
 
-    public get_row_as_arrays_result(
-      List<List<String>> success,
+    public get_row_result(
+      List<Cell> success,
       ClientException e)
     {
       this();
@@ -6247,11 +6287,11 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_row_as_arrays_result(get_row_as_arrays_result other) {
+    public get_row_result(get_row_result other) {
       if (other.isSetSuccess()) {
-        List<List<String>> __this__success = new ArrayList<List<String>>();
-        for (List<String> other_element : other.success) {
-          __this__success.add(other_element);
+        List<Cell> __this__success = new ArrayList<Cell>();
+        for (Cell other_element : other.success) {
+          __this__success.add(new Cell(other_element));
         }
         this.success = __this__success;
       }
@@ -6261,30 +6301,30 @@ public class ClientService {
     }
 
     @Override
-    public get_row_as_arrays_result clone() {
-      return new get_row_as_arrays_result(this);
+    public get_row_result clone() {
+      return new get_row_result(this);
     }
 
     public int getSuccessSize() {
       return (this.success == null) ? 0 : this.success.size();
     }
 
-    public java.util.Iterator<List<String>> getSuccessIterator() {
+    public java.util.Iterator<Cell> getSuccessIterator() {
       return (this.success == null) ? null : this.success.iterator();
     }
 
-    public void addToSuccess(List<String> elem) {
+    public void addToSuccess(Cell elem) {
       if (this.success == null) {
-        this.success = new ArrayList<List<String>>();
+        this.success = new ArrayList<Cell>();
       }
       this.success.add(elem);
     }
 
-    public List<List<String>> getSuccess() {
+    public List<Cell> getSuccess() {
       return this.success;
     }
 
-    public void setSuccess(List<List<String>> success) {
+    public void setSuccess(List<Cell> success) {
       this.success = success;
     }
 
@@ -6332,7 +6372,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((List<List<String>>)value);
+          setSuccess((List<Cell>)value);
         }
         break;
 
@@ -6378,12 +6418,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_row_as_arrays_result)
-        return this.equals((get_row_as_arrays_result)that);
+      if (that instanceof get_row_result)
+        return this.equals((get_row_result)that);
       return false;
     }
 
-    public boolean equals(get_row_as_arrays_result that) {
+    public boolean equals(get_row_result that) {
       if (that == null)
         return false;
 
@@ -6428,21 +6468,12 @@ public class ClientService {
             if (field.type == TType.LIST) {
               {
                 TList _list40 = iprot.readListBegin();
-                this.success = new ArrayList<List<String>>(_list40.size);
+                this.success = new ArrayList<Cell>(_list40.size);
                 for (int _i41 = 0; _i41 < _list40.size; ++_i41)
                 {
-                  List<String> _elem42;
-                  {
-                    TList _list43 = iprot.readListBegin();
-                    _elem42 = new ArrayList<String>(_list43.size);
-                    for (int _i44 = 0; _i44 < _list43.size; ++_i44)
-                    {
-                      String _elem45;
-                      _elem45 = iprot.readString();
-                      _elem42.add(_elem45);
-                    }
-                    iprot.readListEnd();
-                  }
+                  Cell _elem42;
+                  _elem42 = new Cell();
+                  _elem42.read(iprot);
                   this.success.add(_elem42);
                 }
                 iprot.readListEnd();
@@ -6478,15 +6509,9 @@ public class ClientService {
       if (this.isSetSuccess()) {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
-          oprot.writeListBegin(new TList(TType.LIST, this.success.size()));
-          for (List<String> _iter46 : this.success)          {
-            {
-              oprot.writeListBegin(new TList(TType.STRING, _iter46.size()));
-              for (String _iter47 : _iter46)              {
-                oprot.writeString(_iter47);
-              }
-              oprot.writeListEnd();
-            }
+          oprot.writeListBegin(new TList(TType.STRUCT, this.success.size()));
+          for (Cell _iter43 : this.success)          {
+            _iter43.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -6502,7 +6527,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_row_as_arrays_result(");
+      StringBuilder sb = new StringBuilder("get_row_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -6531,18 +6556,15 @@ public class ClientService {
 
   }
 
-  public static class get_cell_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_cell_args");
+  public static class get_row_as_arrays_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_row_as_arrays_args");
     private static final TField NAME_FIELD_DESC = new TField("name", TType.STRING, (short)1);
     private static final TField ROW_FIELD_DESC = new TField("row", TType.STRING, (short)2);
-    private static final TField COLUMN_FIELD_DESC = new TField("column", TType.STRING, (short)3);
 
     public String name;
     public static final int NAME = 1;
     public String row;
     public static final int ROW = 2;
-    public String column;
-    public static final int COLUMN = 3;
 
     private final Isset __isset = new Isset();
     private static final class Isset implements java.io.Serializable {
@@ -6553,46 +6575,39 @@ public class ClientService {
           new FieldValueMetaData(TType.STRING)));
       put(ROW, new FieldMetaData("row", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRING)));
-      put(COLUMN, new FieldMetaData("column", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.STRING)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_cell_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_row_as_arrays_args.class, metaDataMap);
     }
 
-    public get_cell_args() {
+    public get_row_as_arrays_args() {
     }
 
-    public get_cell_args(
+    public get_row_as_arrays_args(
       String name,
-      String row,
-      String column)
+      String row)
     {
       this();
       this.name = name;
       this.row = row;
-      this.column = column;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_cell_args(get_cell_args other) {
+    public get_row_as_arrays_args(get_row_as_arrays_args other) {
       if (other.isSetName()) {
         this.name = other.name;
       }
       if (other.isSetRow()) {
         this.row = other.row;
       }
-      if (other.isSetColumn()) {
-        this.column = other.column;
-      }
     }
 
     @Override
-    public get_cell_args clone() {
-      return new get_cell_args(this);
+    public get_row_as_arrays_args clone() {
+      return new get_row_as_arrays_args(this);
     }
 
     public String getName() {
@@ -6641,29 +6656,6 @@ public class ClientService {
       }
     }
 
-    public String getColumn() {
-      return this.column;
-    }
-
-    public void setColumn(String column) {
-      this.column = column;
-    }
-
-    public void unsetColumn() {
-      this.column = null;
-    }
-
-    // Returns true if field column is set (has been asigned a value) and false otherwise
-    public boolean isSetColumn() {
-      return this.column != null;
-    }
-
-    public void setColumnIsSet(boolean value) {
-      if (!value) {
-        this.column = null;
-      }
-    }
-
     public void setFieldValue(int fieldID, Object value) {
       switch (fieldID) {
       case NAME:
@@ -6682,14 +6674,6 @@ public class ClientService {
         }
         break;
 
-      case COLUMN:
-        if (value == null) {
-          unsetColumn();
-        } else {
-          setColumn((String)value);
-        }
-        break;
-
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -6703,9 +6687,6 @@ public class ClientService {
       case ROW:
         return getRow();
 
-      case COLUMN:
-        return getColumn();
-
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -6718,8 +6699,6 @@ public class ClientService {
         return isSetName();
       case ROW:
         return isSetRow();
-      case COLUMN:
-        return isSetColumn();
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -6729,12 +6708,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_cell_args)
-        return this.equals((get_cell_args)that);
+      if (that instanceof get_row_as_arrays_args)
+        return this.equals((get_row_as_arrays_args)that);
       return false;
     }
 
-    public boolean equals(get_cell_args that) {
+    public boolean equals(get_row_as_arrays_args that) {
       if (that == null)
         return false;
 
@@ -6756,15 +6735,6 @@ public class ClientService {
           return false;
       }
 
-      boolean this_present_column = true && this.isSetColumn();
-      boolean that_present_column = true && that.isSetColumn();
-      if (this_present_column || that_present_column) {
-        if (!(this_present_column && that_present_column))
-          return false;
-        if (!this.column.equals(that.column))
-          return false;
-      }
-
       return true;
     }
 
@@ -6798,13 +6768,6 @@ public class ClientService {
               TProtocolUtil.skip(iprot, field.type);
             }
             break;
-          case COLUMN:
-            if (field.type == TType.STRING) {
-              this.column = iprot.readString();
-            } else { 
-              TProtocolUtil.skip(iprot, field.type);
-            }
-            break;
           default:
             TProtocolUtil.skip(iprot, field.type);
             break;
@@ -6832,18 +6795,13 @@ public class ClientService {
         oprot.writeString(this.row);
         oprot.writeFieldEnd();
       }
-      if (this.column != null) {
-        oprot.writeFieldBegin(COLUMN_FIELD_DESC);
-        oprot.writeString(this.column);
-        oprot.writeFieldEnd();
-      }
       oprot.writeFieldStop();
       oprot.writeStructEnd();
     }
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_cell_args(");
+      StringBuilder sb = new StringBuilder("get_row_as_arrays_args(");
       boolean first = true;
 
       sb.append("name:");
@@ -6861,14 +6819,6 @@ public class ClientService {
         sb.append(this.row);
       }
       first = false;
-      if (!first) sb.append(", ");
-      sb.append("column:");
-      if (this.column == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.column);
-      }
-      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -6880,12 +6830,12 @@ public class ClientService {
 
   }
 
-  public static class get_cell_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_cell_result");
-    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.STRING, (short)0);
+  public static class get_row_as_arrays_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_row_as_arrays_result");
+    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.LIST, (short)0);
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
-    public byte[] success;
+    public List<List<String>> success;
     public static final int SUCCESS = 0;
     public ClientException e;
     public static final int E = 1;
@@ -6896,20 +6846,21 @@ public class ClientService {
 
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.STRING)));
+          new ListMetaData(TType.LIST, 
+              new FieldValueMetaData(TType.LIST))));
       put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRUCT)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_cell_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_row_as_arrays_result.class, metaDataMap);
     }
 
-    public get_cell_result() {
+    public get_row_as_arrays_result() {
     }
 
-    public get_cell_result(
-      byte[] success,
+    public get_row_as_arrays_result(
+      List<List<String>> success,
       ClientException e)
     {
       this();
@@ -6920,9 +6871,13 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_cell_result(get_cell_result other) {
+    public get_row_as_arrays_result(get_row_as_arrays_result other) {
       if (other.isSetSuccess()) {
-        this.success = other.success;
+        List<List<String>> __this__success = new ArrayList<List<String>>();
+        for (List<String> other_element : other.success) {
+          __this__success.add(other_element);
+        }
+        this.success = __this__success;
       }
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
@@ -6930,15 +6885,30 @@ public class ClientService {
     }
 
     @Override
-    public get_cell_result clone() {
-      return new get_cell_result(this);
+    public get_row_as_arrays_result clone() {
+      return new get_row_as_arrays_result(this);
     }
 
-    public byte[] getSuccess() {
+    public int getSuccessSize() {
+      return (this.success == null) ? 0 : this.success.size();
+    }
+
+    public java.util.Iterator<List<String>> getSuccessIterator() {
+      return (this.success == null) ? null : this.success.iterator();
+    }
+
+    public void addToSuccess(List<String> elem) {
+      if (this.success == null) {
+        this.success = new ArrayList<List<String>>();
+      }
+      this.success.add(elem);
+    }
+
+    public List<List<String>> getSuccess() {
       return this.success;
     }
 
-    public void setSuccess(byte[] success) {
+    public void setSuccess(List<List<String>> success) {
       this.success = success;
     }
 
@@ -6986,7 +6956,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((byte[])value);
+          setSuccess((List<List<String>>)value);
         }
         break;
 
@@ -7032,12 +7002,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_cell_result)
-        return this.equals((get_cell_result)that);
-      return false;
+      if (that instanceof get_row_as_arrays_result)
+        return this.equals((get_row_as_arrays_result)that);
+      return false;
     }
 
-    public boolean equals(get_cell_result that) {
+    public boolean equals(get_row_as_arrays_result that) {
       if (that == null)
         return false;
 
@@ -7046,7 +7016,7 @@ public class ClientService {
       if (this_present_success || that_present_success) {
         if (!(this_present_success && that_present_success))
           return false;
-        if (!java.util.Arrays.equals(this.success, that.success))
+        if (!this.success.equals(that.success))
           return false;
       }
 
@@ -7079,8 +7049,28 @@ public class ClientService {
         switch (field.id)
         {
           case SUCCESS:
-            if (field.type == TType.STRING) {
-              this.success = iprot.readBinary();
+            if (field.type == TType.LIST) {
+              {
+                TList _list44 = iprot.readListBegin();
+                this.success = new ArrayList<List<String>>(_list44.size);
+                for (int _i45 = 0; _i45 < _list44.size; ++_i45)
+                {
+                  List<String> _elem46;
+                  {
+                    TList _list47 = iprot.readListBegin();
+                    _elem46 = new ArrayList<String>(_list47.size);
+                    for (int _i48 = 0; _i48 < _list47.size; ++_i48)
+                    {
+                      String _elem49;
+                      _elem49 = iprot.readString();
+                      _elem46.add(_elem49);
+                    }
+                    iprot.readListEnd();
+                  }
+                  this.success.add(_elem46);
+                }
+                iprot.readListEnd();
+              }
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -7111,7 +7101,19 @@ public class ClientService {
 
       if (this.isSetSuccess()) {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        oprot.writeBinary(this.success);
+        {
+          oprot.writeListBegin(new TList(TType.LIST, this.success.size()));
+          for (List<String> _iter50 : this.success)          {
+            {
+              oprot.writeListBegin(new TList(TType.STRING, _iter50.size()));
+              for (String _iter51 : _iter50)              {
+                oprot.writeString(_iter51);
+              }
+              oprot.writeListEnd();
+            }
+          }
+          oprot.writeListEnd();
+        }
         oprot.writeFieldEnd();
       } else if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
@@ -7124,7 +7126,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_cell_result(");
+      StringBuilder sb = new StringBuilder("get_row_as_arrays_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -7153,15 +7155,18 @@ public class ClientService {
 
   }
 
-  public static class get_cells_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_cells_args");
+  public static class get_cell_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_cell_args");
     private static final TField NAME_FIELD_DESC = new TField("name", TType.STRING, (short)1);
-    private static final TField SCAN_SPEC_FIELD_DESC = new TField("scan_spec", TType.STRUCT, (short)2);
+    private static final TField ROW_FIELD_DESC = new TField("row", TType.STRING, (short)2);
+    private static final TField COLUMN_FIELD_DESC = new TField("column", TType.STRING, (short)3);
 
     public String name;
     public static final int NAME = 1;
-    public ScanSpec scan_spec;
-    public static final int SCAN_SPEC = 2;
+    public String row;
+    public static final int ROW = 2;
+    public String column;
+    public static final int COLUMN = 3;
 
     private final Isset __isset = new Isset();
     private static final class Isset implements java.io.Serializable {
@@ -7170,41 +7175,48 @@ public class ClientService {
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(NAME, new FieldMetaData("name", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRING)));
-      put(SCAN_SPEC, new FieldMetaData("scan_spec", TFieldRequirementType.DEFAULT, 
-          new StructMetaData(TType.STRUCT, ScanSpec.class)));
+      put(ROW, new FieldMetaData("row", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.STRING)));
+      put(COLUMN, new FieldMetaData("column", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.STRING)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_cells_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_cell_args.class, metaDataMap);
     }
 
-    public get_cells_args() {
+    public get_cell_args() {
     }
 
-    public get_cells_args(
+    public get_cell_args(
       String name,
-      ScanSpec scan_spec)
+      String row,
+      String column)
     {
       this();
       this.name = name;
-      this.scan_spec = scan_spec;
+      this.row = row;
+      this.column = column;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_cells_args(get_cells_args other) {
+    public get_cell_args(get_cell_args other) {
       if (other.isSetName()) {
         this.name = other.name;
       }
-      if (other.isSetScan_spec()) {
-        this.scan_spec = new ScanSpec(other.scan_spec);
+      if (other.isSetRow()) {
+        this.row = other.row;
+      }
+      if (other.isSetColumn()) {
+        this.column = other.column;
       }
     }
 
     @Override
-    public get_cells_args clone() {
-      return new get_cells_args(this);
+    public get_cell_args clone() {
+      return new get_cell_args(this);
     }
 
     public String getName() {
@@ -7230,26 +7242,49 @@ public class ClientService {
       }
     }
 
-    public ScanSpec getScan_spec() {
-      return this.scan_spec;
+    public String getRow() {
+      return this.row;
     }
 
-    public void setScan_spec(ScanSpec scan_spec) {
-      this.scan_spec = scan_spec;
+    public void setRow(String row) {
+      this.row = row;
     }
 
-    public void unsetScan_spec() {
-      this.scan_spec = null;
+    public void unsetRow() {
+      this.row = null;
     }
 
-    // Returns true if field scan_spec is set (has been asigned a value) and false otherwise
-    public boolean isSetScan_spec() {
-      return this.scan_spec != null;
+    // Returns true if field row is set (has been asigned a value) and false otherwise
+    public boolean isSetRow() {
+      return this.row != null;
     }
 
-    public void setScan_specIsSet(boolean value) {
+    public void setRowIsSet(boolean value) {
       if (!value) {
-        this.scan_spec = null;
+        this.row = null;
+      }
+    }
+
+    public String getColumn() {
+      return this.column;
+    }
+
+    public void setColumn(String column) {
+      this.column = column;
+    }
+
+    public void unsetColumn() {
+      this.column = null;
+    }
+
+    // Returns true if field column is set (has been asigned a value) and false otherwise
+    public boolean isSetColumn() {
+      return this.column != null;
+    }
+
+    public void setColumnIsSet(boolean value) {
+      if (!value) {
+        this.column = null;
       }
     }
 
@@ -7263,11 +7298,19 @@ public class ClientService {
         }
         break;
 
-      case SCAN_SPEC:
+      case ROW:
         if (value == null) {
-          unsetScan_spec();
+          unsetRow();
         } else {
-          setScan_spec((ScanSpec)value);
+          setRow((String)value);
+        }
+        break;
+
+      case COLUMN:
+        if (value == null) {
+          unsetColumn();
+        } else {
+          setColumn((String)value);
         }
         break;
 
@@ -7281,8 +7324,11 @@ public class ClientService {
       case NAME:
         return getName();
 
-      case SCAN_SPEC:
-        return getScan_spec();
+      case ROW:
+        return getRow();
+
+      case COLUMN:
+        return getColumn();
 
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
@@ -7294,8 +7340,10 @@ public class ClientService {
       switch (fieldID) {
       case NAME:
         return isSetName();
-      case SCAN_SPEC:
-        return isSetScan_spec();
+      case ROW:
+        return isSetRow();
+      case COLUMN:
+        return isSetColumn();
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -7305,12 +7353,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_cells_args)
-        return this.equals((get_cells_args)that);
+      if (that instanceof get_cell_args)
+        return this.equals((get_cell_args)that);
       return false;
     }
 
-    public boolean equals(get_cells_args that) {
+    public boolean equals(get_cell_args that) {
       if (that == null)
         return false;
 
@@ -7323,12 +7371,21 @@ public class ClientService {
           return false;
       }
 
-      boolean this_present_scan_spec = true && this.isSetScan_spec();
-      boolean that_present_scan_spec = true && that.isSetScan_spec();
-      if (this_present_scan_spec || that_present_scan_spec) {
-        if (!(this_present_scan_spec && that_present_scan_spec))
+      boolean this_present_row = true && this.isSetRow();
+      boolean that_present_row = true && that.isSetRow();
+      if (this_present_row || that_present_row) {
+        if (!(this_present_row && that_present_row))
           return false;
-        if (!this.scan_spec.equals(that.scan_spec))
+        if (!this.row.equals(that.row))
+          return false;
+      }
+
+      boolean this_present_column = true && this.isSetColumn();
+      boolean that_present_column = true && that.isSetColumn();
+      if (this_present_column || that_present_column) {
+        if (!(this_present_column && that_present_column))
+          return false;
+        if (!this.column.equals(that.column))
           return false;
       }
 
@@ -7358,10 +7415,16 @@ public class ClientService {
               TProtocolUtil.skip(iprot, field.type);
             }
             break;
-          case SCAN_SPEC:
-            if (field.type == TType.STRUCT) {
-              this.scan_spec = new ScanSpec();
-              this.scan_spec.read(iprot);
+          case ROW:
+            if (field.type == TType.STRING) {
+              this.row = iprot.readString();
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          case COLUMN:
+            if (field.type == TType.STRING) {
+              this.column = iprot.readString();
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -7388,9 +7451,14 @@ public class ClientService {
         oprot.writeString(this.name);
         oprot.writeFieldEnd();
       }
-      if (this.scan_spec != null) {
-        oprot.writeFieldBegin(SCAN_SPEC_FIELD_DESC);
-        this.scan_spec.write(oprot);
+      if (this.row != null) {
+        oprot.writeFieldBegin(ROW_FIELD_DESC);
+        oprot.writeString(this.row);
+        oprot.writeFieldEnd();
+      }
+      if (this.column != null) {
+        oprot.writeFieldBegin(COLUMN_FIELD_DESC);
+        oprot.writeString(this.column);
         oprot.writeFieldEnd();
       }
       oprot.writeFieldStop();
@@ -7399,7 +7467,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_cells_args(");
+      StringBuilder sb = new StringBuilder("get_cell_args(");
       boolean first = true;
 
       sb.append("name:");
@@ -7410,11 +7478,19 @@ public class ClientService {
       }
       first = false;
       if (!first) sb.append(", ");
-      sb.append("scan_spec:");
-      if (this.scan_spec == null) {
+      sb.append("row:");
+      if (this.row == null) {
         sb.append("null");
       } else {
-        sb.append(this.scan_spec);
+        sb.append(this.row);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("column:");
+      if (this.column == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.column);
       }
       first = false;
       sb.append(")");
@@ -7428,12 +7504,12 @@ public class ClientService {
 
   }
 
-  public static class get_cells_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_cells_result");
-    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.LIST, (short)0);
+  public static class get_cell_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_cell_result");
+    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.STRING, (short)0);
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
-    public List<Cell> success;
+    public byte[] success;
     public static final int SUCCESS = 0;
     public ClientException e;
     public static final int E = 1;
@@ -7444,21 +7520,20 @@ public class ClientService {
 
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
-          new ListMetaData(TType.LIST, 
-              new StructMetaData(TType.STRUCT, Cell.class))));
+          new FieldValueMetaData(TType.STRING)));
       put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRUCT)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_cells_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_cell_result.class, metaDataMap);
     }
 
-    public get_cells_result() {
+    public get_cell_result() {
     }
 
-    public get_cells_result(
-      List<Cell> success,
+    public get_cell_result(
+      byte[] success,
       ClientException e)
     {
       this();
@@ -7469,13 +7544,9 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_cells_result(get_cells_result other) {
+    public get_cell_result(get_cell_result other) {
       if (other.isSetSuccess()) {
-        List<Cell> __this__success = new ArrayList<Cell>();
-        for (Cell other_element : other.success) {
-          __this__success.add(new Cell(other_element));
-        }
-        this.success = __this__success;
+        this.success = other.success;
       }
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
@@ -7483,31 +7554,16 @@ public class ClientService {
     }
 
     @Override
-    public get_cells_result clone() {
-      return new get_cells_result(this);
+    public get_cell_result clone() {
+      return new get_cell_result(this);
     }
 
-    public int getSuccessSize() {
-      return (this.success == null) ? 0 : this.success.size();
+    public byte[] getSuccess() {
+      return this.success;
     }
 
-    public java.util.Iterator<Cell> getSuccessIterator() {
-      return (this.success == null) ? null : this.success.iterator();
-    }
-
-    public void addToSuccess(Cell elem) {
-      if (this.success == null) {
-        this.success = new ArrayList<Cell>();
-      }
-      this.success.add(elem);
-    }
-
-    public List<Cell> getSuccess() {
-      return this.success;
-    }
-
-    public void setSuccess(List<Cell> success) {
-      this.success = success;
+    public void setSuccess(byte[] success) {
+      this.success = success;
     }
 
     public void unsetSuccess() {
@@ -7554,7 +7610,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((List<Cell>)value);
+          setSuccess((byte[])value);
         }
         break;
 
@@ -7600,12 +7656,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_cells_result)
-        return this.equals((get_cells_result)that);
+      if (that instanceof get_cell_result)
+        return this.equals((get_cell_result)that);
       return false;
     }
 
-    public boolean equals(get_cells_result that) {
+    public boolean equals(get_cell_result that) {
       if (that == null)
         return false;
 
@@ -7614,7 +7670,7 @@ public class ClientService {
       if (this_present_success || that_present_success) {
         if (!(this_present_success && that_present_success))
           return false;
-        if (!this.success.equals(that.success))
+        if (!java.util.Arrays.equals(this.success, that.success))
           return false;
       }
 
@@ -7647,19 +7703,8 @@ public class ClientService {
         switch (field.id)
         {
           case SUCCESS:
-            if (field.type == TType.LIST) {
-              {
-                TList _list48 = iprot.readListBegin();
-                this.success = new ArrayList<Cell>(_list48.size);
-                for (int _i49 = 0; _i49 < _list48.size; ++_i49)
-                {
-                  Cell _elem50;
-                  _elem50 = new Cell();
-                  _elem50.read(iprot);
-                  this.success.add(_elem50);
-                }
-                iprot.readListEnd();
-              }
+            if (field.type == TType.STRING) {
+              this.success = iprot.readBinary();
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -7690,13 +7735,7 @@ public class ClientService {
 
       if (this.isSetSuccess()) {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        {
-          oprot.writeListBegin(new TList(TType.STRUCT, this.success.size()));
-          for (Cell _iter51 : this.success)          {
-            _iter51.write(oprot);
-          }
-          oprot.writeListEnd();
-        }
+        oprot.writeBinary(this.success);
         oprot.writeFieldEnd();
       } else if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
@@ -7709,7 +7748,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_cells_result(");
+      StringBuilder sb = new StringBuilder("get_cell_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -7738,8 +7777,8 @@ public class ClientService {
 
   }
 
-  public static class get_cells_as_arrays_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_cells_as_arrays_args");
+  public static class get_cells_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_cells_args");
     private static final TField NAME_FIELD_DESC = new TField("name", TType.STRING, (short)1);
     private static final TField SCAN_SPEC_FIELD_DESC = new TField("scan_spec", TType.STRUCT, (short)2);
 
@@ -7760,13 +7799,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_cells_as_arrays_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_cells_args.class, metaDataMap);
     }
 
-    public get_cells_as_arrays_args() {
+    public get_cells_args() {
     }
 
-    public get_cells_as_arrays_args(
+    public get_cells_args(
       String name,
       ScanSpec scan_spec)
     {
@@ -7778,7 +7817,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_cells_as_arrays_args(get_cells_as_arrays_args other) {
+    public get_cells_args(get_cells_args other) {
       if (other.isSetName()) {
         this.name = other.name;
       }
@@ -7788,8 +7827,8 @@ public class ClientService {
     }
 
     @Override
-    public get_cells_as_arrays_args clone() {
-      return new get_cells_as_arrays_args(this);
+    public get_cells_args clone() {
+      return new get_cells_args(this);
     }
 
     public String getName() {
@@ -7890,12 +7929,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_cells_as_arrays_args)
-        return this.equals((get_cells_as_arrays_args)that);
+      if (that instanceof get_cells_args)
+        return this.equals((get_cells_args)that);
       return false;
     }
 
-    public boolean equals(get_cells_as_arrays_args that) {
+    public boolean equals(get_cells_args that) {
       if (that == null)
         return false;
 
@@ -7984,7 +8023,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_cells_as_arrays_args(");
+      StringBuilder sb = new StringBuilder("get_cells_args(");
       boolean first = true;
 
       sb.append("name:");
@@ -8013,12 +8052,12 @@ public class ClientService {
 
   }
 
-  public static class get_cells_as_arrays_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("get_cells_as_arrays_result");
+  public static class get_cells_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_cells_result");
     private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.LIST, (short)0);
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
-    public List<List<String>> success;
+    public List<Cell> success;
     public static final int SUCCESS = 0;
     public ClientException e;
     public static final int E = 1;
@@ -8030,20 +8069,20 @@ public class ClientService {
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
           new ListMetaData(TType.LIST, 
-              new FieldValueMetaData(TType.LIST))));
+              new StructMetaData(TType.STRUCT, Cell.class))));
       put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRUCT)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(get_cells_as_arrays_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_cells_result.class, metaDataMap);
     }
 
-    public get_cells_as_arrays_result() {
+    public get_cells_result() {
     }
 
-    public get_cells_as_arrays_result(
-      List<List<String>> success,
+    public get_cells_result(
+      List<Cell> success,
       ClientException e)
     {
       this();
@@ -8054,11 +8093,11 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_cells_as_arrays_result(get_cells_as_arrays_result other) {
+    public get_cells_result(get_cells_result other) {
       if (other.isSetSuccess()) {
-        List<List<String>> __this__success = new ArrayList<List<String>>();
-        for (List<String> other_element : other.success) {
-          __this__success.add(other_element);
+        List<Cell> __this__success = new ArrayList<Cell>();
+        for (Cell other_element : other.success) {
+          __this__success.add(new Cell(other_element));
         }
         this.success = __this__success;
       }
@@ -8068,30 +8107,30 @@ public class ClientService {
     }
 
     @Override
-    public get_cells_as_arrays_result clone() {
-      return new get_cells_as_arrays_result(this);
+    public get_cells_result clone() {
+      return new get_cells_result(this);
     }
 
     public int getSuccessSize() {
       return (this.success == null) ? 0 : this.success.size();
     }
 
-    public java.util.Iterator<List<String>> getSuccessIterator() {
+    public java.util.Iterator<Cell> getSuccessIterator() {
       return (this.success == null) ? null : this.success.iterator();
     }
 
-    public void addToSuccess(List<String> elem) {
+    public void addToSuccess(Cell elem) {
       if (this.success == null) {
-        this.success = new ArrayList<List<String>>();
+        this.success = new ArrayList<Cell>();
       }
       this.success.add(elem);
     }
 
-    public List<List<String>> getSuccess() {
+    public List<Cell> getSuccess() {
       return this.success;
     }
 
-    public void setSuccess(List<List<String>> success) {
+    public void setSuccess(List<Cell> success) {
       this.success = success;
     }
 
@@ -8139,7 +8178,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((List<List<String>>)value);
+          setSuccess((List<Cell>)value);
         }
         break;
 
@@ -8185,12 +8224,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_cells_as_arrays_result)
-        return this.equals((get_cells_as_arrays_result)that);
+      if (that instanceof get_cells_result)
+        return this.equals((get_cells_result)that);
       return false;
     }
 
-    public boolean equals(get_cells_as_arrays_result that) {
+    public boolean equals(get_cells_result that) {
       if (that == null)
         return false;
 
@@ -8235,21 +8274,12 @@ public class ClientService {
             if (field.type == TType.LIST) {
               {
                 TList _list52 = iprot.readListBegin();
-                this.success = new ArrayList<List<String>>(_list52.size);
+                this.success = new ArrayList<Cell>(_list52.size);
                 for (int _i53 = 0; _i53 < _list52.size; ++_i53)
                 {
-                  List<String> _elem54;
-                  {
-                    TList _list55 = iprot.readListBegin();
-                    _elem54 = new ArrayList<String>(_list55.size);
-                    for (int _i56 = 0; _i56 < _list55.size; ++_i56)
-                    {
-                      String _elem57;
-                      _elem57 = iprot.readString();
-                      _elem54.add(_elem57);
-                    }
-                    iprot.readListEnd();
-                  }
+                  Cell _elem54;
+                  _elem54 = new Cell();
+                  _elem54.read(iprot);
                   this.success.add(_elem54);
                 }
                 iprot.readListEnd();
@@ -8285,15 +8315,9 @@ public class ClientService {
       if (this.isSetSuccess()) {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
-          oprot.writeListBegin(new TList(TType.LIST, this.success.size()));
-          for (List<String> _iter58 : this.success)          {
-            {
-              oprot.writeListBegin(new TList(TType.STRING, _iter58.size()));
-              for (String _iter59 : _iter58)              {
-                oprot.writeString(_iter59);
-              }
-              oprot.writeListEnd();
-            }
+          oprot.writeListBegin(new TList(TType.STRUCT, this.success.size()));
+          for (Cell _iter55 : this.success)          {
+            _iter55.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -8309,7 +8333,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_cells_as_arrays_result(");
+      StringBuilder sb = new StringBuilder("get_cells_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -8338,74 +8362,58 @@ public class ClientService {
 
   }
 
-  public static class open_mutator_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("open_mutator_args");
+  public static class get_cells_as_arrays_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_cells_as_arrays_args");
     private static final TField NAME_FIELD_DESC = new TField("name", TType.STRING, (short)1);
-    private static final TField FLAGS_FIELD_DESC = new TField("flags", TType.I32, (short)2);
-    private static final TField FLUSH_INTERVAL_FIELD_DESC = new TField("flush_interval", TType.I32, (short)3);
+    private static final TField SCAN_SPEC_FIELD_DESC = new TField("scan_spec", TType.STRUCT, (short)2);
 
     public String name;
     public static final int NAME = 1;
-    public int flags;
-    public static final int FLAGS = 2;
-    public int flush_interval;
-    public static final int FLUSH_INTERVAL = 3;
+    public ScanSpec scan_spec;
+    public static final int SCAN_SPEC = 2;
 
     private final Isset __isset = new Isset();
     private static final class Isset implements java.io.Serializable {
-      public boolean flags = false;
-      public boolean flush_interval = false;
     }
 
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(NAME, new FieldMetaData("name", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRING)));
-      put(FLAGS, new FieldMetaData("flags", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.I32)));
-      put(FLUSH_INTERVAL, new FieldMetaData("flush_interval", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.I32)));
+      put(SCAN_SPEC, new FieldMetaData("scan_spec", TFieldRequirementType.DEFAULT, 
+          new StructMetaData(TType.STRUCT, ScanSpec.class)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(open_mutator_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(get_cells_as_arrays_args.class, metaDataMap);
     }
 
-    public open_mutator_args() {
-      this.flags = 0;
-
-      this.flush_interval = 0;
-
+    public get_cells_as_arrays_args() {
     }
 
-    public open_mutator_args(
+    public get_cells_as_arrays_args(
       String name,
-      int flags,
-      int flush_interval)
+      ScanSpec scan_spec)
     {
       this();
       this.name = name;
-      this.flags = flags;
-      this.__isset.flags = true;
-      this.flush_interval = flush_interval;
-      this.__isset.flush_interval = true;
+      this.scan_spec = scan_spec;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public open_mutator_args(open_mutator_args other) {
+    public get_cells_as_arrays_args(get_cells_as_arrays_args other) {
       if (other.isSetName()) {
         this.name = other.name;
       }
-      __isset.flags = other.__isset.flags;
-      this.flags = other.flags;
-      __isset.flush_interval = other.__isset.flush_interval;
-      this.flush_interval = other.flush_interval;
+      if (other.isSetScan_spec()) {
+        this.scan_spec = new ScanSpec(other.scan_spec);
+      }
     }
 
     @Override
-    public open_mutator_args clone() {
-      return new open_mutator_args(this);
+    public get_cells_as_arrays_args clone() {
+      return new get_cells_as_arrays_args(this);
     }
 
     public String getName() {
@@ -8431,48 +8439,27 @@ public class ClientService {
       }
     }
 
-    public int getFlags() {
-      return this.flags;
-    }
-
-    public void setFlags(int flags) {
-      this.flags = flags;
-      this.__isset.flags = true;
-    }
-
-    public void unsetFlags() {
-      this.__isset.flags = false;
-    }
-
-    // Returns true if field flags is set (has been asigned a value) and false otherwise
-    public boolean isSetFlags() {
-      return this.__isset.flags;
-    }
-
-    public void setFlagsIsSet(boolean value) {
-      this.__isset.flags = value;
-    }
-
-    public int getFlush_interval() {
-      return this.flush_interval;
+    public ScanSpec getScan_spec() {
+      return this.scan_spec;
     }
 
-    public void setFlush_interval(int flush_interval) {
-      this.flush_interval = flush_interval;
-      this.__isset.flush_interval = true;
+    public void setScan_spec(ScanSpec scan_spec) {
+      this.scan_spec = scan_spec;
     }
 
-    public void unsetFlush_interval() {
-      this.__isset.flush_interval = false;
+    public void unsetScan_spec() {
+      this.scan_spec = null;
     }
 
-    // Returns true if field flush_interval is set (has been asigned a value) and false otherwise
-    public boolean isSetFlush_interval() {
-      return this.__isset.flush_interval;
+    // Returns true if field scan_spec is set (has been asigned a value) and false otherwise
+    public boolean isSetScan_spec() {
+      return this.scan_spec != null;
     }
 
-    public void setFlush_intervalIsSet(boolean value) {
-      this.__isset.flush_interval = value;
+    public void setScan_specIsSet(boolean value) {
+      if (!value) {
+        this.scan_spec = null;
+      }
     }
 
     public void setFieldValue(int fieldID, Object value) {
@@ -8485,19 +8472,11 @@ public class ClientService {
         }
         break;
 
-      case FLAGS:
-        if (value == null) {
-          unsetFlags();
-        } else {
-          setFlags((Integer)value);
-        }
-        break;
-
-      case FLUSH_INTERVAL:
+      case SCAN_SPEC:
         if (value == null) {
-          unsetFlush_interval();
+          unsetScan_spec();
         } else {
-          setFlush_interval((Integer)value);
+          setScan_spec((ScanSpec)value);
         }
         break;
 
@@ -8511,11 +8490,8 @@ public class ClientService {
       case NAME:
         return getName();
 
-      case FLAGS:
-        return new Integer(getFlags());
-
-      case FLUSH_INTERVAL:
-        return new Integer(getFlush_interval());
+      case SCAN_SPEC:
+        return getScan_spec();
 
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
@@ -8527,10 +8503,8 @@ public class ClientService {
       switch (fieldID) {
       case NAME:
         return isSetName();
-      case FLAGS:
-        return isSetFlags();
-      case FLUSH_INTERVAL:
-        return isSetFlush_interval();
+      case SCAN_SPEC:
+        return isSetScan_spec();
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -8540,12 +8514,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof open_mutator_args)
-        return this.equals((open_mutator_args)that);
+      if (that instanceof get_cells_as_arrays_args)
+        return this.equals((get_cells_as_arrays_args)that);
       return false;
     }
 
-    public boolean equals(open_mutator_args that) {
+    public boolean equals(get_cells_as_arrays_args that) {
       if (that == null)
         return false;
 
@@ -8558,21 +8532,12 @@ public class ClientService {
           return false;
       }
 
-      boolean this_present_flags = true;
-      boolean that_present_flags = true;
-      if (this_present_flags || that_present_flags) {
-        if (!(this_present_flags && that_present_flags))
-          return false;
-        if (this.flags != that.flags)
-          return false;
-      }
-
-      boolean this_present_flush_interval = true;
-      boolean that_present_flush_interval = true;
-      if (this_present_flush_interval || that_present_flush_interval) {
-        if (!(this_present_flush_interval && that_present_flush_interval))
+      boolean this_present_scan_spec = true && this.isSetScan_spec();
+      boolean that_present_scan_spec = true && that.isSetScan_spec();
+      if (this_present_scan_spec || that_present_scan_spec) {
+        if (!(this_present_scan_spec && that_present_scan_spec))
           return false;
-        if (this.flush_interval != that.flush_interval)
+        if (!this.scan_spec.equals(that.scan_spec))
           return false;
       }
 
@@ -8602,18 +8567,1226 @@ public class ClientService {
               TProtocolUtil.skip(iprot, field.type);
             }
             break;
-          case FLAGS:
-            if (field.type == TType.I32) {
-              this.flags = iprot.readI32();
-              this.__isset.flags = true;
+          case SCAN_SPEC:
+            if (field.type == TType.STRUCT) {
+              this.scan_spec = new ScanSpec();
+              this.scan_spec.read(iprot);
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          default:
+            TProtocolUtil.skip(iprot, field.type);
+            break;
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      validate();
+    }
+
+    public void write(TProtocol oprot) throws TException {
+      validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      if (this.name != null) {
+        oprot.writeFieldBegin(NAME_FIELD_DESC);
+        oprot.writeString(this.name);
+        oprot.writeFieldEnd();
+      }
+      if (this.scan_spec != null) {
+        oprot.writeFieldBegin(SCAN_SPEC_FIELD_DESC);
+        this.scan_spec.write(oprot);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+    @Override
+    public String toString() {
+      StringBuilder sb = new StringBuilder("get_cells_as_arrays_args(");
+      boolean first = true;
+
+      sb.append("name:");
+      if (this.name == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.name);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("scan_spec:");
+      if (this.scan_spec == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.scan_spec);
+      }
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws TException {
+      // check for required fields
+      // check that fields of type enum have valid values
+    }
+
+  }
+
+  public static class get_cells_as_arrays_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("get_cells_as_arrays_result");
+    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.LIST, (short)0);
+    private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
+
+    public List<List<String>> success;
+    public static final int SUCCESS = 0;
+    public ClientException e;
+    public static final int E = 1;
+
+    private final Isset __isset = new Isset();
+    private static final class Isset implements java.io.Serializable {
+    }
+
+    public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
+      put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
+          new ListMetaData(TType.LIST, 
+              new FieldValueMetaData(TType.LIST))));
+      put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.STRUCT)));
+    }});
+
+    static {
+      FieldMetaData.addStructMetaDataMap(get_cells_as_arrays_result.class, metaDataMap);
+    }
+
+    public get_cells_as_arrays_result() {
+    }
+
+    public get_cells_as_arrays_result(
+      List<List<String>> success,
+      ClientException e)
+    {
+      this();
+      this.success = success;
+      this.e = e;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public get_cells_as_arrays_result(get_cells_as_arrays_result other) {
+      if (other.isSetSuccess()) {
+        List<List<String>> __this__success = new ArrayList<List<String>>();
+        for (List<String> other_element : other.success) {
+          __this__success.add(other_element);
+        }
+        this.success = __this__success;
+      }
+      if (other.isSetE()) {
+        this.e = new ClientException(other.e);
+      }
+    }
+
+    @Override
+    public get_cells_as_arrays_result clone() {
+      return new get_cells_as_arrays_result(this);
+    }
+
+    public int getSuccessSize() {
+      return (this.success == null) ? 0 : this.success.size();
+    }
+
+    public java.util.Iterator<List<String>> getSuccessIterator() {
+      return (this.success == null) ? null : this.success.iterator();
+    }
+
+    public void addToSuccess(List<String> elem) {
+      if (this.success == null) {
+        this.success = new ArrayList<List<String>>();
+      }
+      this.success.add(elem);
+    }
+
+    public List<List<String>> getSuccess() {
+      return this.success;
+    }
+
+    public void setSuccess(List<List<String>> success) {
+      this.success = success;
+    }
+
+    public void unsetSuccess() {
+      this.success = null;
+    }
+
+    // Returns true if field success is set (has been asigned a value) and false otherwise
+    public boolean isSetSuccess() {
+      return this.success != null;
+    }
+
+    public void setSuccessIsSet(boolean value) {
+      if (!value) {
+        this.success = null;
+      }
+    }
+
+    public ClientException getE() {
+      return this.e;
+    }
+
+    public void setE(ClientException e) {
+      this.e = e;
+    }
+
+    public void unsetE() {
+      this.e = null;
+    }
+
+    // Returns true if field e is set (has been asigned a value) and false otherwise
+    public boolean isSetE() {
+      return this.e != null;
+    }
+
+    public void setEIsSet(boolean value) {
+      if (!value) {
+        this.e = null;
+      }
+    }
+
+    public void setFieldValue(int fieldID, Object value) {
+      switch (fieldID) {
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((List<List<String>>)value);
+        }
+        break;
+
+      case E:
+        if (value == null) {
+          unsetE();
+        } else {
+          setE((ClientException)value);
+        }
+        break;
+
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    public Object getFieldValue(int fieldID) {
+      switch (fieldID) {
+      case SUCCESS:
+        return getSuccess();
+
+      case E:
+        return getE();
+
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    // Returns true if field corresponding to fieldID is set (has been asigned a value) and false otherwise
+    public boolean isSet(int fieldID) {
+      switch (fieldID) {
+      case SUCCESS:
+        return isSetSuccess();
+      case E:
+        return isSetE();
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    @Override
+    public boolean equals(Object that) {
+      if (that == null)
+        return false;
+      if (that instanceof get_cells_as_arrays_result)
+        return this.equals((get_cells_as_arrays_result)that);
+      return false;
+    }
+
+    public boolean equals(get_cells_as_arrays_result that) {
+      if (that == null)
+        return false;
+
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (!this.success.equals(that.success))
+          return false;
+      }
+
+      boolean this_present_e = true && this.isSetE();
+      boolean that_present_e = true && that.isSetE();
+      if (this_present_e || that_present_e) {
+        if (!(this_present_e && that_present_e))
+          return false;
+        if (!this.e.equals(that.e))
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      return 0;
+    }
+
+    public void read(TProtocol iprot) throws TException {
+      TField field;
+      iprot.readStructBegin();
+      while (true)
+      {
+        field = iprot.readFieldBegin();
+        if (field.type == TType.STOP) { 
+          break;
+        }
+        switch (field.id)
+        {
+          case SUCCESS:
+            if (field.type == TType.LIST) {
+              {
+                TList _list56 = iprot.readListBegin();
+                this.success = new ArrayList<List<String>>(_list56.size);
+                for (int _i57 = 0; _i57 < _list56.size; ++_i57)
+                {
+                  List<String> _elem58;
+                  {
+                    TList _list59 = iprot.readListBegin();
+                    _elem58 = new ArrayList<String>(_list59.size);
+                    for (int _i60 = 0; _i60 < _list59.size; ++_i60)
+                    {
+                      String _elem61;
+                      _elem61 = iprot.readString();
+                      _elem58.add(_elem61);
+                    }
+                    iprot.readListEnd();
+                  }
+                  this.success.add(_elem58);
+                }
+                iprot.readListEnd();
+              }
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          case E:
+            if (field.type == TType.STRUCT) {
+              this.e = new ClientException();
+              this.e.read(iprot);
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          default:
+            TProtocolUtil.skip(iprot, field.type);
+            break;
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      validate();
+    }
+
+    public void write(TProtocol oprot) throws TException {
+      oprot.writeStructBegin(STRUCT_DESC);
+
+      if (this.isSetSuccess()) {
+        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+        {
+          oprot.writeListBegin(new TList(TType.LIST, this.success.size()));
+          for (List<String> _iter62 : this.success)          {
+            {
+              oprot.writeListBegin(new TList(TType.STRING, _iter62.size()));
+              for (String _iter63 : _iter62)              {
+                oprot.writeString(_iter63);
+              }
+              oprot.writeListEnd();
+            }
+          }
+          oprot.writeListEnd();
+        }
+        oprot.writeFieldEnd();
+      } else if (this.isSetE()) {
+        oprot.writeFieldBegin(E_FIELD_DESC);
+        this.e.write(oprot);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+    @Override
+    public String toString() {
+      StringBuilder sb = new StringBuilder("get_cells_as_arrays_result(");
+      boolean first = true;
+
+      sb.append("success:");
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("e:");
+      if (this.e == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.e);
+      }
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws TException {
+      // check for required fields
+      // check that fields of type enum have valid values
+    }
+
+  }
+
+  public static class open_mutator_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("open_mutator_args");
+    private static final TField NAME_FIELD_DESC = new TField("name", TType.STRING, (short)1);
+    private static final TField FLAGS_FIELD_DESC = new TField("flags", TType.I32, (short)2);
+    private static final TField FLUSH_INTERVAL_FIELD_DESC = new TField("flush_interval", TType.I32, (short)3);
+
+    public String name;
+    public static final int NAME = 1;
+    public int flags;
+    public static final int FLAGS = 2;
+    public int flush_interval;
+    public static final int FLUSH_INTERVAL = 3;
+
+    private final Isset __isset = new Isset();
+    private static final class Isset implements java.io.Serializable {
+      public boolean flags = false;
+      public boolean flush_interval = false;
+    }
+
+    public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
+      put(NAME, new FieldMetaData("name", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.STRING)));
+      put(FLAGS, new FieldMetaData("flags", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.I32)));
+      put(FLUSH_INTERVAL, new FieldMetaData("flush_interval", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.I32)));
+    }});
+
+    static {
+      FieldMetaData.addStructMetaDataMap(open_mutator_args.class, metaDataMap);
+    }
+
+    public open_mutator_args() {
+      this.flags = 0;
+
+      this.flush_interval = 0;
+
+    }
+
+    public open_mutator_args(
+      String name,
+      int flags,
+      int flush_interval)
+    {
+      this();
+      this.name = name;
+      this.flags = flags;
+      this.__isset.flags = true;
+      this.flush_interval = flush_interval;
+      this.__isset.flush_interval = true;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public open_mutator_args(open_mutator_args other) {
+      if (other.isSetName()) {
+        this.name = other.name;
+      }
+      __isset.flags = other.__isset.flags;
+      this.flags = other.flags;
+      __isset.flush_interval = other.__isset.flush_interval;
+      this.flush_interval = other.flush_interval;
+    }
+
+    @Override
+    public open_mutator_args clone() {
+      return new open_mutator_args(this);
+    }
+
+    public String getName() {
+      return this.name;
+    }
+
+    public void setName(String name) {
+      this.name = name;
+    }
+
+    public void unsetName() {
+      this.name = null;
+    }
+
+    // Returns true if field name is set (has been asigned a value) and false otherwise
+    public boolean isSetName() {
+      return this.name != null;
+    }
+
+    public void setNameIsSet(boolean value) {
+      if (!value) {
+        this.name = null;
+      }
+    }
+
+    public int getFlags() {
+      return this.flags;
+    }
+
+    public void setFlags(int flags) {
+      this.flags = flags;
+      this.__isset.flags = true;
+    }
+
+    public void unsetFlags() {
+      this.__isset.flags = false;
+    }
+
+    // Returns true if field flags is set (has been asigned a value) and false otherwise
+    public boolean isSetFlags() {
+      return this.__isset.flags;
+    }
+
+    public void setFlagsIsSet(boolean value) {
+      this.__isset.flags = value;
+    }
+
+    public int getFlush_interval() {
+      return this.flush_interval;
+    }
+
+    public void setFlush_interval(int flush_interval) {
+      this.flush_interval = flush_interval;
+      this.__isset.flush_interval = true;
+    }
+
+    public void unsetFlush_interval() {
+      this.__isset.flush_interval = false;
+    }
+
+    // Returns true if field flush_interval is set (has been asigned a value) and false otherwise
+    public boolean isSetFlush_interval() {
+      return this.__isset.flush_interval;
+    }
+
+    public void setFlush_intervalIsSet(boolean value) {
+      this.__isset.flush_interval = value;
+    }
+
+    public void setFieldValue(int fieldID, Object value) {
+      switch (fieldID) {
+      case NAME:
+        if (value == null) {
+          unsetName();
+        } else {
+          setName((String)value);
+        }
+        break;
+
+      case FLAGS:
+        if (value == null) {
+          unsetFlags();
+        } else {
+          setFlags((Integer)value);
+        }
+        break;
+
+      case FLUSH_INTERVAL:
+        if (value == null) {
+          unsetFlush_interval();
+        } else {
+          setFlush_interval((Integer)value);
+        }
+        break;
+
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    public Object getFieldValue(int fieldID) {
+      switch (fieldID) {
+      case NAME:
+        return getName();
+
+      case FLAGS:
+        return new Integer(getFlags());
+
+      case FLUSH_INTERVAL:
+        return new Integer(getFlush_interval());
+
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    // Returns true if field corresponding to fieldID is set (has been asigned a value) and false otherwise
+    public boolean isSet(int fieldID) {
+      switch (fieldID) {
+      case NAME:
+        return isSetName();
+      case FLAGS:
+        return isSetFlags();
+      case FLUSH_INTERVAL:
+        return isSetFlush_interval();
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    @Override
+    public boolean equals(Object that) {
+      if (that == null)
+        return false;
+      if (that instanceof open_mutator_args)
+        return this.equals((open_mutator_args)that);
+      return false;
+    }
+
+    public boolean equals(open_mutator_args that) {
+      if (that == null)
+        return false;
+
+      boolean this_present_name = true && this.isSetName();
+      boolean that_present_name = true && that.isSetName();
+      if (this_present_name || that_present_name) {
+        if (!(this_present_name && that_present_name))
+          return false;
+        if (!this.name.equals(that.name))
+          return false;
+      }
+
+      boolean this_present_flags = true;
+      boolean that_present_flags = true;
+      if (this_present_flags || that_present_flags) {
+        if (!(this_present_flags && that_present_flags))
+          return false;
+        if (this.flags != that.flags)
+          return false;
+      }
+
+      boolean this_present_flush_interval = true;
+      boolean that_present_flush_interval = true;
+      if (this_present_flush_interval || that_present_flush_interval) {
+        if (!(this_present_flush_interval && that_present_flush_interval))
+          return false;
+        if (this.flush_interval != that.flush_interval)
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      return 0;
+    }
+
+    public void read(TProtocol iprot) throws TException {
+      TField field;
+      iprot.readStructBegin();
+      while (true)
+      {
+        field = iprot.readFieldBegin();
+        if (field.type == TType.STOP) { 
+          break;
+        }
+        switch (field.id)
+        {
+          case NAME:
+            if (field.type == TType.STRING) {
+              this.name = iprot.readString();
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          case FLAGS:
+            if (field.type == TType.I32) {
+              this.flags = iprot.readI32();
+              this.__isset.flags = true;
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          case FLUSH_INTERVAL:
+            if (field.type == TType.I32) {
+              this.flush_interval = iprot.readI32();
+              this.__isset.flush_interval = true;
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          default:
+            TProtocolUtil.skip(iprot, field.type);
+            break;
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      validate();
+    }
+
+    public void write(TProtocol oprot) throws TException {
+      validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      if (this.name != null) {
+        oprot.writeFieldBegin(NAME_FIELD_DESC);
+        oprot.writeString(this.name);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldBegin(FLAGS_FIELD_DESC);
+      oprot.writeI32(this.flags);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(FLUSH_INTERVAL_FIELD_DESC);
+      oprot.writeI32(this.flush_interval);
+      oprot.writeFieldEnd();
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+    @Override
+    public String toString() {
+      StringBuilder sb = new StringBuilder("open_mutator_args(");
+      boolean first = true;
+
+      sb.append("name:");
+      if (this.name == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.name);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("flags:");
+      sb.append(this.flags);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("flush_interval:");
+      sb.append(this.flush_interval);
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws TException {
+      // check for required fields
+      // check that fields of type enum have valid values
+    }
+
+  }
+
+  public static class open_mutator_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("open_mutator_result");
+    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.I64, (short)0);
+    private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
+
+    public long success;
+    public static final int SUCCESS = 0;
+    public ClientException e;
+    public static final int E = 1;
+
+    private final Isset __isset = new Isset();
+    private static final class Isset implements java.io.Serializable {
+      public boolean success = false;
+    }
+
+    public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
+      put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.I64)));
+      put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.STRUCT)));
+    }});
+
+    static {
+      FieldMetaData.addStructMetaDataMap(open_mutator_result.class, metaDataMap);
+    }
+
+    public open_mutator_result() {
+    }
+
+    public open_mutator_result(
+      long success,
+      ClientException e)
+    {
+      this();
+      this.success = success;
+      this.__isset.success = true;
+      this.e = e;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public open_mutator_result(open_mutator_result other) {
+      __isset.success = other.__isset.success;
+      this.success = other.success;
+      if (other.isSetE()) {
+        this.e = new ClientException(other.e);
+      }
+    }
+
+    @Override
+    public open_mutator_result clone() {
+      return new open_mutator_result(this);
+    }
+
+    public long getSuccess() {
+      return this.success;
+    }
+
+    public void setSuccess(long success) {
+      this.success = success;
+      this.__isset.success = true;
+    }
+
+    public void unsetSuccess() {
+      this.__isset.success = false;
+    }
+
+    // Returns true if field success is set (has been asigned a value) and false otherwise
+    public boolean isSetSuccess() {
+      return this.__isset.success;
+    }
+
+    public void setSuccessIsSet(boolean value) {
+      this.__isset.success = value;
+    }
+
+    public ClientException getE() {
+      return this.e;
+    }
+
+    public void setE(ClientException e) {
+      this.e = e;
+    }
+
+    public void unsetE() {
+      this.e = null;
+    }
+
+    // Returns true if field e is set (has been asigned a value) and false otherwise
+    public boolean isSetE() {
+      return this.e != null;
+    }
+
+    public void setEIsSet(boolean value) {
+      if (!value) {
+        this.e = null;
+      }
+    }
+
+    public void setFieldValue(int fieldID, Object value) {
+      switch (fieldID) {
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((Long)value);
+        }
+        break;
+
+      case E:
+        if (value == null) {
+          unsetE();
+        } else {
+          setE((ClientException)value);
+        }
+        break;
+
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    public Object getFieldValue(int fieldID) {
+      switch (fieldID) {
+      case SUCCESS:
+        return new Long(getSuccess());
+
+      case E:
+        return getE();
+
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    // Returns true if field corresponding to fieldID is set (has been asigned a value) and false otherwise
+    public boolean isSet(int fieldID) {
+      switch (fieldID) {
+      case SUCCESS:
+        return isSetSuccess();
+      case E:
+        return isSetE();
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    @Override
+    public boolean equals(Object that) {
+      if (that == null)
+        return false;
+      if (that instanceof open_mutator_result)
+        return this.equals((open_mutator_result)that);
+      return false;
+    }
+
+    public boolean equals(open_mutator_result that) {
+      if (that == null)
+        return false;
+
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (this.success != that.success)
+          return false;
+      }
+
+      boolean this_present_e = true && this.isSetE();
+      boolean that_present_e = true && that.isSetE();
+      if (this_present_e || that_present_e) {
+        if (!(this_present_e && that_present_e))
+          return false;
+        if (!this.e.equals(that.e))
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      return 0;
+    }
+
+    public void read(TProtocol iprot) throws TException {
+      TField field;
+      iprot.readStructBegin();
+      while (true)
+      {
+        field = iprot.readFieldBegin();
+        if (field.type == TType.STOP) { 
+          break;
+        }
+        switch (field.id)
+        {
+          case SUCCESS:
+            if (field.type == TType.I64) {
+              this.success = iprot.readI64();
+              this.__isset.success = true;
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          case E:
+            if (field.type == TType.STRUCT) {
+              this.e = new ClientException();
+              this.e.read(iprot);
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          default:
+            TProtocolUtil.skip(iprot, field.type);
+            break;
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      validate();
+    }
+
+    public void write(TProtocol oprot) throws TException {
+      oprot.writeStructBegin(STRUCT_DESC);
+
+      if (this.isSetSuccess()) {
+        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+        oprot.writeI64(this.success);
+        oprot.writeFieldEnd();
+      } else if (this.isSetE()) {
+        oprot.writeFieldBegin(E_FIELD_DESC);
+        this.e.write(oprot);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+    @Override
+    public String toString() {
+      StringBuilder sb = new StringBuilder("open_mutator_result(");
+      boolean first = true;
+
+      sb.append("success:");
+      sb.append(this.success);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("e:");
+      if (this.e == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.e);
+      }
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws TException {
+      // check for required fields
+      // check that fields of type enum have valid values
+    }
+
+  }
+
+  public static class close_mutator_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("close_mutator_args");
+    private static final TField MUTATOR_FIELD_DESC = new TField("mutator", TType.I64, (short)1);
+    private static final TField FLUSH_FIELD_DESC = new TField("flush", TType.BOOL, (short)2);
+
+    public long mutator;
+    public static final int MUTATOR = 1;
+    public boolean flush;
+    public static final int FLUSH = 2;
+
+    private final Isset __isset = new Isset();
+    private static final class Isset implements java.io.Serializable {
+      public boolean mutator = false;
+      public boolean flush = false;
+    }
+
+    public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
+      put(MUTATOR, new FieldMetaData("mutator", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.I64)));
+      put(FLUSH, new FieldMetaData("flush", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.BOOL)));
+    }});
+
+    static {
+      FieldMetaData.addStructMetaDataMap(close_mutator_args.class, metaDataMap);
+    }
+
+    public close_mutator_args() {
+      this.flush = true;
+
+    }
+
+    public close_mutator_args(
+      long mutator,
+      boolean flush)
+    {
+      this();
+      this.mutator = mutator;
+      this.__isset.mutator = true;
+      this.flush = flush;
+      this.__isset.flush = true;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public close_mutator_args(close_mutator_args other) {
+      __isset.mutator = other.__isset.mutator;
+      this.mutator = other.mutator;
+      __isset.flush = other.__isset.flush;
+      this.flush = other.flush;
+    }
+
+    @Override
+    public close_mutator_args clone() {
+      return new close_mutator_args(this);
+    }
+
+    public long getMutator() {
+      return this.mutator;
+    }
+
+    public void setMutator(long mutator) {
+      this.mutator = mutator;
+      this.__isset.mutator = true;
+    }
+
+    public void unsetMutator() {
+      this.__isset.mutator = false;
+    }
+
+    // Returns true if field mutator is set (has been asigned a value) and false otherwise
+    public boolean isSetMutator() {
+      return this.__isset.mutator;
+    }
+
+    public void setMutatorIsSet(boolean value) {
+      this.__isset.mutator = value;
+    }
+
+    public boolean isFlush() {
+      return this.flush;
+    }
+
+    public void setFlush(boolean flush) {
+      this.flush = flush;
+      this.__isset.flush = true;
+    }
+
+    public void unsetFlush() {
+      this.__isset.flush = false;
+    }
+
+    // Returns true if field flush is set (has been asigned a value) and false otherwise
+    public boolean isSetFlush() {
+      return this.__isset.flush;
+    }
+
+    public void setFlushIsSet(boolean value) {
+      this.__isset.flush = value;
+    }
+
+    public void setFieldValue(int fieldID, Object value) {
+      switch (fieldID) {
+      case MUTATOR:
+        if (value == null) {
+          unsetMutator();
+        } else {
+          setMutator((Long)value);
+        }
+        break;
+
+      case FLUSH:
+        if (value == null) {
+          unsetFlush();
+        } else {
+          setFlush((Boolean)value);
+        }
+        break;
+
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    public Object getFieldValue(int fieldID) {
+      switch (fieldID) {
+      case MUTATOR:
+        return new Long(getMutator());
+
+      case FLUSH:
+        return new Boolean(isFlush());
+
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    // Returns true if field corresponding to fieldID is set (has been asigned a value) and false otherwise
+    public boolean isSet(int fieldID) {
+      switch (fieldID) {
+      case MUTATOR:
+        return isSetMutator();
+      case FLUSH:
+        return isSetFlush();
+      default:
+        throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+      }
+    }
+
+    @Override
+    public boolean equals(Object that) {
+      if (that == null)
+        return false;
+      if (that instanceof close_mutator_args)
+        return this.equals((close_mutator_args)that);
+      return false;
+    }
+
+    public boolean equals(close_mutator_args that) {
+      if (that == null)
+        return false;
+
+      boolean this_present_mutator = true;
+      boolean that_present_mutator = true;
+      if (this_present_mutator || that_present_mutator) {
+        if (!(this_present_mutator && that_present_mutator))
+          return false;
+        if (this.mutator != that.mutator)
+          return false;
+      }
+
+      boolean this_present_flush = true;
+      boolean that_present_flush = true;
+      if (this_present_flush || that_present_flush) {
+        if (!(this_present_flush && that_present_flush))
+          return false;
+        if (this.flush != that.flush)
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      return 0;
+    }
+
+    public void read(TProtocol iprot) throws TException {
+      TField field;
+      iprot.readStructBegin();
+      while (true)
+      {
+        field = iprot.readFieldBegin();
+        if (field.type == TType.STOP) { 
+          break;
+        }
+        switch (field.id)
+        {
+          case MUTATOR:
+            if (field.type == TType.I64) {
+              this.mutator = iprot.readI64();
+              this.__isset.mutator = true;
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
             break;
-          case FLUSH_INTERVAL:
-            if (field.type == TType.I32) {
-              this.flush_interval = iprot.readI32();
-              this.__isset.flush_interval = true;
+          case FLUSH:
+            if (field.type == TType.BOOL) {
+              this.flush = iprot.readBool();
+              this.__isset.flush = true;
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -8635,16 +9808,11 @@ public class ClientService {
       validate();
 
       oprot.writeStructBegin(STRUCT_DESC);
-      if (this.name != null) {
-        oprot.writeFieldBegin(NAME_FIELD_DESC);
-        oprot.writeString(this.name);
-        oprot.writeFieldEnd();
-      }
-      oprot.writeFieldBegin(FLAGS_FIELD_DESC);
-      oprot.writeI32(this.flags);
+      oprot.writeFieldBegin(MUTATOR_FIELD_DESC);
+      oprot.writeI64(this.mutator);
       oprot.writeFieldEnd();
-      oprot.writeFieldBegin(FLUSH_INTERVAL_FIELD_DESC);
-      oprot.writeI32(this.flush_interval);
+      oprot.writeFieldBegin(FLUSH_FIELD_DESC);
+      oprot.writeBool(this.flush);
       oprot.writeFieldEnd();
       oprot.writeFieldStop();
       oprot.writeStructEnd();
@@ -8652,23 +9820,15 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("open_mutator_args(");
+      StringBuilder sb = new StringBuilder("close_mutator_args(");
       boolean first = true;
 
-      sb.append("name:");
-      if (this.name == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.name);
-      }
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("flags:");
-      sb.append(this.flags);
+      sb.append("mutator:");
+      sb.append(this.mutator);
       first = false;
       if (!first) sb.append(", ");
-      sb.append("flush_interval:");
-      sb.append(this.flush_interval);
+      sb.append("flush:");
+      sb.append(this.flush);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -8681,81 +9841,48 @@ public class ClientService {
 
   }
 
-  public static class open_mutator_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("open_mutator_result");
-    private static final TField SUCCESS_FIELD_DESC = new TField("success", TType.I64, (short)0);
+  public static class close_mutator_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("close_mutator_result");
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
-    public long success;
-    public static final int SUCCESS = 0;
     public ClientException e;
     public static final int E = 1;
 
     private final Isset __isset = new Isset();
     private static final class Isset implements java.io.Serializable {
-      public boolean success = false;
     }
 
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
-      put(SUCCESS, new FieldMetaData("success", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.I64)));
       put(E, new FieldMetaData("e", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.STRUCT)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(open_mutator_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(close_mutator_result.class, metaDataMap);
     }
 
-    public open_mutator_result() {
+    public close_mutator_result() {
     }
 
-    public open_mutator_result(
-      long success,
+    public close_mutator_result(
       ClientException e)
     {
       this();
-      this.success = success;
-      this.__isset.success = true;
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public open_mutator_result(open_mutator_result other) {
-      __isset.success = other.__isset.success;
-      this.success = other.success;
+    public close_mutator_result(close_mutator_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
     @Override
-    public open_mutator_result clone() {
-      return new open_mutator_result(this);
-    }
-
-    public long getSuccess() {
-      return this.success;
-    }
-
-    public void setSuccess(long success) {
-      this.success = success;
-      this.__isset.success = true;
-    }
-
-    public void unsetSuccess() {
-      this.__isset.success = false;
-    }
-
-    // Returns true if field success is set (has been asigned a value) and false otherwise
-    public boolean isSetSuccess() {
-      return this.__isset.success;
-    }
-
-    public void setSuccessIsSet(boolean value) {
-      this.__isset.success = value;
+    public close_mutator_result clone() {
+      return new close_mutator_result(this);
     }
 
     public ClientException getE() {
@@ -8783,14 +9910,6 @@ public class ClientService {
 
     public void setFieldValue(int fieldID, Object value) {
       switch (fieldID) {
-      case SUCCESS:
-        if (value == null) {
-          unsetSuccess();
-        } else {
-          setSuccess((Long)value);
-        }
-        break;
-
       case E:
         if (value == null) {
           unsetE();
@@ -8806,9 +9925,6 @@ public class ClientService {
 
     public Object getFieldValue(int fieldID) {
       switch (fieldID) {
-      case SUCCESS:
-        return new Long(getSuccess());
-
       case E:
         return getE();
 
@@ -8820,8 +9936,6 @@ public class ClientService {
     // Returns true if field corresponding to fieldID is set (has been asigned a value) and false otherwise
     public boolean isSet(int fieldID) {
       switch (fieldID) {
-      case SUCCESS:
-        return isSetSuccess();
       case E:
         return isSetE();
       default:
@@ -8833,24 +9947,15 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof open_mutator_result)
-        return this.equals((open_mutator_result)that);
+      if (that instanceof close_mutator_result)
+        return this.equals((close_mutator_result)that);
       return false;
     }
 
-    public boolean equals(open_mutator_result that) {
+    public boolean equals(close_mutator_result that) {
       if (that == null)
         return false;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
-          return false;
-        if (this.success != that.success)
-          return false;
-      }
-
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -8879,14 +9984,6 @@ public class ClientService {
         }
         switch (field.id)
         {
-          case SUCCESS:
-            if (field.type == TType.I64) {
-              this.success = iprot.readI64();
-              this.__isset.success = true;
-            } else { 
-              TProtocolUtil.skip(iprot, field.type);
-            }
-            break;
           case E:
             if (field.type == TType.STRUCT) {
               this.e = new ClientException();
@@ -8911,11 +10008,7 @@ public class ClientService {
     public void write(TProtocol oprot) throws TException {
       oprot.writeStructBegin(STRUCT_DESC);
 
-      if (this.isSetSuccess()) {
-        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        oprot.writeI64(this.success);
-        oprot.writeFieldEnd();
-      } else if (this.isSetE()) {
+      if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
         this.e.write(oprot);
         oprot.writeFieldEnd();
@@ -8926,13 +10019,9 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("open_mutator_result(");
+      StringBuilder sb = new StringBuilder("close_mutator_result(");
       boolean first = true;
 
-      sb.append("success:");
-      sb.append(this.success);
-      first = false;
-      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -8951,62 +10040,59 @@ public class ClientService {
 
   }
 
-  public static class close_mutator_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("close_mutator_args");
+  public static class set_cell_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cell_args");
     private static final TField MUTATOR_FIELD_DESC = new TField("mutator", TType.I64, (short)1);
-    private static final TField FLUSH_FIELD_DESC = new TField("flush", TType.BOOL, (short)2);
+    private static final TField CELL_FIELD_DESC = new TField("cell", TType.STRUCT, (short)2);
 
     public long mutator;
     public static final int MUTATOR = 1;
-    public boolean flush;
-    public static final int FLUSH = 2;
+    public Cell cell;
+    public static final int CELL = 2;
 
     private final Isset __isset = new Isset();
     private static final class Isset implements java.io.Serializable {
       public boolean mutator = false;
-      public boolean flush = false;
     }
 
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(MUTATOR, new FieldMetaData("mutator", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.I64)));
-      put(FLUSH, new FieldMetaData("flush", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.BOOL)));
+      put(CELL, new FieldMetaData("cell", TFieldRequirementType.DEFAULT, 
+          new StructMetaData(TType.STRUCT, Cell.class)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(close_mutator_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cell_args.class, metaDataMap);
     }
 
-    public close_mutator_args() {
-      this.flush = true;
-
+    public set_cell_args() {
     }
 
-    public close_mutator_args(
+    public set_cell_args(
       long mutator,
-      boolean flush)
+      Cell cell)
     {
       this();
       this.mutator = mutator;
       this.__isset.mutator = true;
-      this.flush = flush;
-      this.__isset.flush = true;
+      this.cell = cell;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_mutator_args(close_mutator_args other) {
+    public set_cell_args(set_cell_args other) {
       __isset.mutator = other.__isset.mutator;
       this.mutator = other.mutator;
-      __isset.flush = other.__isset.flush;
-      this.flush = other.flush;
+      if (other.isSetCell()) {
+        this.cell = new Cell(other.cell);
+      }
     }
 
     @Override
-    public close_mutator_args clone() {
-      return new close_mutator_args(this);
+    public set_cell_args clone() {
+      return new set_cell_args(this);
     }
 
     public long getMutator() {
@@ -9031,26 +10117,27 @@ public class ClientService {
       this.__isset.mutator = value;
     }
 
-    public boolean isFlush() {
-      return this.flush;
+    public Cell getCell() {
+      return this.cell;
     }
 
-    public void setFlush(boolean flush) {
-      this.flush = flush;
-      this.__isset.flush = true;
+    public void setCell(Cell cell) {
+      this.cell = cell;
     }
 
-    public void unsetFlush() {
-      this.__isset.flush = false;
+    public void unsetCell() {
+      this.cell = null;
     }
 
-    // Returns true if field flush is set (has been asigned a value) and false otherwise
-    public boolean isSetFlush() {
-      return this.__isset.flush;
+    // Returns true if field cell is set (has been asigned a value) and false otherwise
+    public boolean isSetCell() {
+      return this.cell != null;
     }
 
-    public void setFlushIsSet(boolean value) {
-      this.__isset.flush = value;
+    public void setCellIsSet(boolean value) {
+      if (!value) {
+        this.cell = null;
+      }
     }
 
     public void setFieldValue(int fieldID, Object value) {
@@ -9063,11 +10150,11 @@ public class ClientService {
         }
         break;
 
-      case FLUSH:
+      case CELL:
         if (value == null) {
-          unsetFlush();
+          unsetCell();
         } else {
-          setFlush((Boolean)value);
+          setCell((Cell)value);
         }
         break;
 
@@ -9081,8 +10168,8 @@ public class ClientService {
       case MUTATOR:
         return new Long(getMutator());
 
-      case FLUSH:
-        return new Boolean(isFlush());
+      case CELL:
+        return getCell();
 
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
@@ -9094,8 +10181,8 @@ public class ClientService {
       switch (fieldID) {
       case MUTATOR:
         return isSetMutator();
-      case FLUSH:
-        return isSetFlush();
+      case CELL:
+        return isSetCell();
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -9105,12 +10192,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_mutator_args)
-        return this.equals((close_mutator_args)that);
+      if (that instanceof set_cell_args)
+        return this.equals((set_cell_args)that);
       return false;
     }
 
-    public boolean equals(close_mutator_args that) {
+    public boolean equals(set_cell_args that) {
       if (that == null)
         return false;
 
@@ -9123,12 +10210,12 @@ public class ClientService {
           return false;
       }
 
-      boolean this_present_flush = true;
-      boolean that_present_flush = true;
-      if (this_present_flush || that_present_flush) {
-        if (!(this_present_flush && that_present_flush))
+      boolean this_present_cell = true && this.isSetCell();
+      boolean that_present_cell = true && that.isSetCell();
+      if (this_present_cell || that_present_cell) {
+        if (!(this_present_cell && that_present_cell))
           return false;
-        if (this.flush != that.flush)
+        if (!this.cell.equals(that.cell))
           return false;
       }
 
@@ -9159,10 +10246,10 @@ public class ClientService {
               TProtocolUtil.skip(iprot, field.type);
             }
             break;
-          case FLUSH:
-            if (field.type == TType.BOOL) {
-              this.flush = iprot.readBool();
-              this.__isset.flush = true;
+          case CELL:
+            if (field.type == TType.STRUCT) {
+              this.cell = new Cell();
+              this.cell.read(iprot);
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -9187,24 +10274,30 @@ public class ClientService {
       oprot.writeFieldBegin(MUTATOR_FIELD_DESC);
       oprot.writeI64(this.mutator);
       oprot.writeFieldEnd();
-      oprot.writeFieldBegin(FLUSH_FIELD_DESC);
-      oprot.writeBool(this.flush);
-      oprot.writeFieldEnd();
+      if (this.cell != null) {
+        oprot.writeFieldBegin(CELL_FIELD_DESC);
+        this.cell.write(oprot);
+        oprot.writeFieldEnd();
+      }
       oprot.writeFieldStop();
       oprot.writeStructEnd();
     }
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_mutator_args(");
+      StringBuilder sb = new StringBuilder("set_cell_args(");
       boolean first = true;
 
       sb.append("mutator:");
       sb.append(this.mutator);
       first = false;
       if (!first) sb.append(", ");
-      sb.append("flush:");
-      sb.append(this.flush);
+      sb.append("cell:");
+      if (this.cell == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.cell);
+      }
       first = false;
       sb.append(")");
       return sb.toString();
@@ -9217,8 +10310,8 @@ public class ClientService {
 
   }
 
-  public static class close_mutator_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("close_mutator_result");
+  public static class set_cell_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cell_result");
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
     public ClientException e;
@@ -9234,13 +10327,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(close_mutator_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cell_result.class, metaDataMap);
     }
 
-    public close_mutator_result() {
+    public set_cell_result() {
     }
 
-    public close_mutator_result(
+    public set_cell_result(
       ClientException e)
     {
       this();
@@ -9250,15 +10343,15 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_mutator_result(close_mutator_result other) {
+    public set_cell_result(set_cell_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
     @Override
-    public close_mutator_result clone() {
-      return new close_mutator_result(this);
+    public set_cell_result clone() {
+      return new set_cell_result(this);
     }
 
     public ClientException getE() {
@@ -9323,12 +10416,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_mutator_result)
-        return this.equals((close_mutator_result)that);
+      if (that instanceof set_cell_result)
+        return this.equals((set_cell_result)that);
       return false;
     }
 
-    public boolean equals(close_mutator_result that) {
+    public boolean equals(set_cell_result that) {
       if (that == null)
         return false;
 
@@ -9395,7 +10488,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_mutator_result(");
+      StringBuilder sb = new StringBuilder("set_cell_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -9416,14 +10509,14 @@ public class ClientService {
 
   }
 
-  public static class set_cell_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("set_cell_args");
+  public static class set_cell_as_array_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cell_as_array_args");
     private static final TField MUTATOR_FIELD_DESC = new TField("mutator", TType.I64, (short)1);
-    private static final TField CELL_FIELD_DESC = new TField("cell", TType.STRUCT, (short)2);
+    private static final TField CELL_FIELD_DESC = new TField("cell", TType.LIST, (short)2);
 
     public long mutator;
     public static final int MUTATOR = 1;
-    public Cell cell;
+    public List<String> cell;
     public static final int CELL = 2;
 
     private final Isset __isset = new Isset();
@@ -9435,19 +10528,19 @@ public class ClientService {
       put(MUTATOR, new FieldMetaData("mutator", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.I64)));
       put(CELL, new FieldMetaData("cell", TFieldRequirementType.DEFAULT, 
-          new StructMetaData(TType.STRUCT, Cell.class)));
+          new FieldValueMetaData(TType.LIST)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(set_cell_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cell_as_array_args.class, metaDataMap);
     }
 
-    public set_cell_args() {
+    public set_cell_as_array_args() {
     }
 
-    public set_cell_args(
+    public set_cell_as_array_args(
       long mutator,
-      Cell cell)
+      List<String> cell)
     {
       this();
       this.mutator = mutator;
@@ -9458,17 +10551,17 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public set_cell_args(set_cell_args other) {
+    public set_cell_as_array_args(set_cell_as_array_args other) {
       __isset.mutator = other.__isset.mutator;
       this.mutator = other.mutator;
       if (other.isSetCell()) {
-        this.cell = new Cell(other.cell);
+        this.cell = other.cell;
       }
     }
 
     @Override
-    public set_cell_args clone() {
-      return new set_cell_args(this);
+    public set_cell_as_array_args clone() {
+      return new set_cell_as_array_args(this);
     }
 
     public long getMutator() {
@@ -9493,11 +10586,26 @@ public class ClientService {
       this.__isset.mutator = value;
     }
 
-    public Cell getCell() {
+    public int getCellSize() {
+      return (this.cell == null) ? 0 : this.cell.size();
+    }
+
+    public java.util.Iterator<String> getCellIterator() {
+      return (this.cell == null) ? null : this.cell.iterator();
+    }
+
+    public void addToCell(String elem) {
+      if (this.cell == null) {
+        this.cell = new ArrayList<String>();
+      }
+      this.cell.add(elem);
+    }
+
+    public List<String> getCell() {
       return this.cell;
     }
 
-    public void setCell(Cell cell) {
+    public void setCell(List<String> cell) {
       this.cell = cell;
     }
 
@@ -9530,7 +10638,7 @@ public class ClientService {
         if (value == null) {
           unsetCell();
         } else {
-          setCell((Cell)value);
+          setCell((List<String>)value);
         }
         break;
 
@@ -9568,12 +10676,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof set_cell_args)
-        return this.equals((set_cell_args)that);
+      if (that instanceof set_cell_as_array_args)
+        return this.equals((set_cell_as_array_args)that);
       return false;
     }
 
-    public boolean equals(set_cell_args that) {
+    public boolean equals(set_cell_as_array_args that) {
       if (that == null)
         return false;
 
@@ -9623,9 +10731,18 @@ public class ClientService {
             }
             break;
           case CELL:
-            if (field.type == TType.STRUCT) {
-              this.cell = new Cell();
-              this.cell.read(iprot);
+            if (field.type == TType.LIST) {
+              {
+                TList _list64 = iprot.readListBegin();
+                this.cell = new ArrayList<String>(_list64.size);
+                for (int _i65 = 0; _i65 < _list64.size; ++_i65)
+                {
+                  String _elem66;
+                  _elem66 = iprot.readString();
+                  this.cell.add(_elem66);
+                }
+                iprot.readListEnd();
+              }
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -9652,7 +10769,13 @@ public class ClientService {
       oprot.writeFieldEnd();
       if (this.cell != null) {
         oprot.writeFieldBegin(CELL_FIELD_DESC);
-        this.cell.write(oprot);
+        {
+          oprot.writeListBegin(new TList(TType.STRING, this.cell.size()));
+          for (String _iter67 : this.cell)          {
+            oprot.writeString(_iter67);
+          }
+          oprot.writeListEnd();
+        }
         oprot.writeFieldEnd();
       }
       oprot.writeFieldStop();
@@ -9661,7 +10784,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("set_cell_args(");
+      StringBuilder sb = new StringBuilder("set_cell_as_array_args(");
       boolean first = true;
 
       sb.append("mutator:");
@@ -9686,8 +10809,8 @@ public class ClientService {
 
   }
 
-  public static class set_cell_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("set_cell_result");
+  public static class set_cell_as_array_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cell_as_array_result");
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
     public ClientException e;
@@ -9703,13 +10826,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(set_cell_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cell_as_array_result.class, metaDataMap);
     }
 
-    public set_cell_result() {
+    public set_cell_as_array_result() {
     }
 
-    public set_cell_result(
+    public set_cell_as_array_result(
       ClientException e)
     {
       this();
@@ -9719,15 +10842,15 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public set_cell_result(set_cell_result other) {
+    public set_cell_as_array_result(set_cell_as_array_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
     @Override
-    public set_cell_result clone() {
-      return new set_cell_result(this);
+    public set_cell_as_array_result clone() {
+      return new set_cell_as_array_result(this);
     }
 
     public ClientException getE() {
@@ -9792,12 +10915,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof set_cell_result)
-        return this.equals((set_cell_result)that);
+      if (that instanceof set_cell_as_array_result)
+        return this.equals((set_cell_as_array_result)that);
       return false;
     }
 
-    public boolean equals(set_cell_result that) {
+    public boolean equals(set_cell_as_array_result that) {
       if (that == null)
         return false;
 
@@ -9864,7 +10987,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("set_cell_result(");
+      StringBuilder sb = new StringBuilder("set_cell_as_array_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -9885,15 +11008,15 @@ public class ClientService {
 
   }
 
-  public static class set_cell_as_array_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("set_cell_as_array_args");
+  public static class set_cells_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cells_args");
     private static final TField MUTATOR_FIELD_DESC = new TField("mutator", TType.I64, (short)1);
-    private static final TField CELL_FIELD_DESC = new TField("cell", TType.LIST, (short)2);
+    private static final TField CELLS_FIELD_DESC = new TField("cells", TType.LIST, (short)2);
 
     public long mutator;
     public static final int MUTATOR = 1;
-    public List<String> cell;
-    public static final int CELL = 2;
+    public List<Cell> cells;
+    public static final int CELLS = 2;
 
     private final Isset __isset = new Isset();
     private static final class Isset implements java.io.Serializable {
@@ -9903,41 +11026,46 @@ public class ClientService {
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(MUTATOR, new FieldMetaData("mutator", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.I64)));
-      put(CELL, new FieldMetaData("cell", TFieldRequirementType.DEFAULT, 
-          new FieldValueMetaData(TType.LIST)));
+      put(CELLS, new FieldMetaData("cells", TFieldRequirementType.DEFAULT, 
+          new ListMetaData(TType.LIST, 
+              new StructMetaData(TType.STRUCT, Cell.class))));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(set_cell_as_array_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cells_args.class, metaDataMap);
     }
 
-    public set_cell_as_array_args() {
+    public set_cells_args() {
     }
 
-    public set_cell_as_array_args(
+    public set_cells_args(
       long mutator,
-      List<String> cell)
+      List<Cell> cells)
     {
       this();
       this.mutator = mutator;
       this.__isset.mutator = true;
-      this.cell = cell;
+      this.cells = cells;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public set_cell_as_array_args(set_cell_as_array_args other) {
+    public set_cells_args(set_cells_args other) {
       __isset.mutator = other.__isset.mutator;
       this.mutator = other.mutator;
-      if (other.isSetCell()) {
-        this.cell = other.cell;
+      if (other.isSetCells()) {
+        List<Cell> __this__cells = new ArrayList<Cell>();
+        for (Cell other_element : other.cells) {
+          __this__cells.add(new Cell(other_element));
+        }
+        this.cells = __this__cells;
       }
     }
 
     @Override
-    public set_cell_as_array_args clone() {
-      return new set_cell_as_array_args(this);
+    public set_cells_args clone() {
+      return new set_cells_args(this);
     }
 
     public long getMutator() {
@@ -9962,41 +11090,41 @@ public class ClientService {
       this.__isset.mutator = value;
     }
 
-    public int getCellSize() {
-      return (this.cell == null) ? 0 : this.cell.size();
+    public int getCellsSize() {
+      return (this.cells == null) ? 0 : this.cells.size();
     }
 
-    public java.util.Iterator<String> getCellIterator() {
-      return (this.cell == null) ? null : this.cell.iterator();
+    public java.util.Iterator<Cell> getCellsIterator() {
+      return (this.cells == null) ? null : this.cells.iterator();
     }
 
-    public void addToCell(String elem) {
-      if (this.cell == null) {
-        this.cell = new ArrayList<String>();
+    public void addToCells(Cell elem) {
+      if (this.cells == null) {
+        this.cells = new ArrayList<Cell>();
       }
-      this.cell.add(elem);
+      this.cells.add(elem);
     }
 
-    public List<String> getCell() {
-      return this.cell;
+    public List<Cell> getCells() {
+      return this.cells;
     }
 
-    public void setCell(List<String> cell) {
-      this.cell = cell;
+    public void setCells(List<Cell> cells) {
+      this.cells = cells;
     }
 
-    public void unsetCell() {
-      this.cell = null;
+    public void unsetCells() {
+      this.cells = null;
     }
 
-    // Returns true if field cell is set (has been asigned a value) and false otherwise
-    public boolean isSetCell() {
-      return this.cell != null;
+    // Returns true if field cells is set (has been asigned a value) and false otherwise
+    public boolean isSetCells() {
+      return this.cells != null;
     }
 
-    public void setCellIsSet(boolean value) {
+    public void setCellsIsSet(boolean value) {
       if (!value) {
-        this.cell = null;
+        this.cells = null;
       }
     }
 
@@ -10010,11 +11138,11 @@ public class ClientService {
         }
         break;
 
-      case CELL:
+      case CELLS:
         if (value == null) {
-          unsetCell();
+          unsetCells();
         } else {
-          setCell((List<String>)value);
+          setCells((List<Cell>)value);
         }
         break;
 
@@ -10028,8 +11156,8 @@ public class ClientService {
       case MUTATOR:
         return new Long(getMutator());
 
-      case CELL:
-        return getCell();
+      case CELLS:
+        return getCells();
 
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
@@ -10041,8 +11169,8 @@ public class ClientService {
       switch (fieldID) {
       case MUTATOR:
         return isSetMutator();
-      case CELL:
-        return isSetCell();
+      case CELLS:
+        return isSetCells();
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -10052,12 +11180,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof set_cell_as_array_args)
-        return this.equals((set_cell_as_array_args)that);
+      if (that instanceof set_cells_args)
+        return this.equals((set_cells_args)that);
       return false;
     }
 
-    public boolean equals(set_cell_as_array_args that) {
+    public boolean equals(set_cells_args that) {
       if (that == null)
         return false;
 
@@ -10070,12 +11198,12 @@ public class ClientService {
           return false;
       }
 
-      boolean this_present_cell = true && this.isSetCell();
-      boolean that_present_cell = true && that.isSetCell();
-      if (this_present_cell || that_present_cell) {
-        if (!(this_present_cell && that_present_cell))
+      boolean this_present_cells = true && this.isSetCells();
+      boolean that_present_cells = true && that.isSetCells();
+      if (this_present_cells || that_present_cells) {
+        if (!(this_present_cells && that_present_cells))
           return false;
-        if (!this.cell.equals(that.cell))
+        if (!this.cells.equals(that.cells))
           return false;
       }
 
@@ -10106,16 +11234,17 @@ public class ClientService {
               TProtocolUtil.skip(iprot, field.type);
             }
             break;
-          case CELL:
+          case CELLS:
             if (field.type == TType.LIST) {
               {
-                TList _list60 = iprot.readListBegin();
-                this.cell = new ArrayList<String>(_list60.size);
-                for (int _i61 = 0; _i61 < _list60.size; ++_i61)
+                TList _list68 = iprot.readListBegin();
+                this.cells = new ArrayList<Cell>(_list68.size);
+                for (int _i69 = 0; _i69 < _list68.size; ++_i69)
                 {
-                  String _elem62;
-                  _elem62 = iprot.readString();
-                  this.cell.add(_elem62);
+                  Cell _elem70;
+                  _elem70 = new Cell();
+                  _elem70.read(iprot);
+                  this.cells.add(_elem70);
                 }
                 iprot.readListEnd();
               }
@@ -10143,12 +11272,12 @@ public class ClientService {
       oprot.writeFieldBegin(MUTATOR_FIELD_DESC);
       oprot.writeI64(this.mutator);
       oprot.writeFieldEnd();
-      if (this.cell != null) {
-        oprot.writeFieldBegin(CELL_FIELD_DESC);
+      if (this.cells != null) {
+        oprot.writeFieldBegin(CELLS_FIELD_DESC);
         {
-          oprot.writeListBegin(new TList(TType.STRING, this.cell.size()));
-          for (String _iter63 : this.cell)          {
-            oprot.writeString(_iter63);
+          oprot.writeListBegin(new TList(TType.STRUCT, this.cells.size()));
+          for (Cell _iter71 : this.cells)          {
+            _iter71.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -10160,18 +11289,18 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("set_cell_as_array_args(");
+      StringBuilder sb = new StringBuilder("set_cells_args(");
       boolean first = true;
 
       sb.append("mutator:");
       sb.append(this.mutator);
       first = false;
       if (!first) sb.append(", ");
-      sb.append("cell:");
-      if (this.cell == null) {
+      sb.append("cells:");
+      if (this.cells == null) {
         sb.append("null");
       } else {
-        sb.append(this.cell);
+        sb.append(this.cells);
       }
       first = false;
       sb.append(")");
@@ -10185,8 +11314,8 @@ public class ClientService {
 
   }
 
-  public static class set_cell_as_array_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("set_cell_as_array_result");
+  public static class set_cells_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cells_result");
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
     public ClientException e;
@@ -10202,13 +11331,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(set_cell_as_array_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cells_result.class, metaDataMap);
     }
 
-    public set_cell_as_array_result() {
+    public set_cells_result() {
     }
 
-    public set_cell_as_array_result(
+    public set_cells_result(
       ClientException e)
     {
       this();
@@ -10218,15 +11347,15 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public set_cell_as_array_result(set_cell_as_array_result other) {
+    public set_cells_result(set_cells_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
     @Override
-    public set_cell_as_array_result clone() {
-      return new set_cell_as_array_result(this);
+    public set_cells_result clone() {
+      return new set_cells_result(this);
     }
 
     public ClientException getE() {
@@ -10291,12 +11420,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof set_cell_as_array_result)
-        return this.equals((set_cell_as_array_result)that);
+      if (that instanceof set_cells_result)
+        return this.equals((set_cells_result)that);
       return false;
     }
 
-    public boolean equals(set_cell_as_array_result that) {
+    public boolean equals(set_cells_result that) {
       if (that == null)
         return false;
 
@@ -10363,7 +11492,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("set_cell_as_array_result(");
+      StringBuilder sb = new StringBuilder("set_cells_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -10384,14 +11513,14 @@ public class ClientService {
 
   }
 
-  public static class set_cells_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("set_cells_args");
+  public static class set_cells_as_arrays_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cells_as_arrays_args");
     private static final TField MUTATOR_FIELD_DESC = new TField("mutator", TType.I64, (short)1);
     private static final TField CELLS_FIELD_DESC = new TField("cells", TType.LIST, (short)2);
 
     public long mutator;
     public static final int MUTATOR = 1;
-    public List<Cell> cells;
+    public List<List<String>> cells;
     public static final int CELLS = 2;
 
     private final Isset __isset = new Isset();
@@ -10404,19 +11533,19 @@ public class ClientService {
           new FieldValueMetaData(TType.I64)));
       put(CELLS, new FieldMetaData("cells", TFieldRequirementType.DEFAULT, 
           new ListMetaData(TType.LIST, 
-              new StructMetaData(TType.STRUCT, Cell.class))));
+              new FieldValueMetaData(TType.LIST))));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(set_cells_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cells_as_arrays_args.class, metaDataMap);
     }
 
-    public set_cells_args() {
+    public set_cells_as_arrays_args() {
     }
 
-    public set_cells_args(
+    public set_cells_as_arrays_args(
       long mutator,
-      List<Cell> cells)
+      List<List<String>> cells)
     {
       this();
       this.mutator = mutator;
@@ -10427,21 +11556,21 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public set_cells_args(set_cells_args other) {
+    public set_cells_as_arrays_args(set_cells_as_arrays_args other) {
       __isset.mutator = other.__isset.mutator;
       this.mutator = other.mutator;
       if (other.isSetCells()) {
-        List<Cell> __this__cells = new ArrayList<Cell>();
-        for (Cell other_element : other.cells) {
-          __this__cells.add(new Cell(other_element));
+        List<List<String>> __this__cells = new ArrayList<List<String>>();
+        for (List<String> other_element : other.cells) {
+          __this__cells.add(other_element);
         }
         this.cells = __this__cells;
       }
     }
 
     @Override
-    public set_cells_args clone() {
-      return new set_cells_args(this);
+    public set_cells_as_arrays_args clone() {
+      return new set_cells_as_arrays_args(this);
     }
 
     public long getMutator() {
@@ -10470,22 +11599,22 @@ public class ClientService {
       return (this.cells == null) ? 0 : this.cells.size();
     }
 
-    public java.util.Iterator<Cell> getCellsIterator() {
+    public java.util.Iterator<List<String>> getCellsIterator() {
       return (this.cells == null) ? null : this.cells.iterator();
     }
 
-    public void addToCells(Cell elem) {
+    public void addToCells(List<String> elem) {
       if (this.cells == null) {
-        this.cells = new ArrayList<Cell>();
+        this.cells = new ArrayList<List<String>>();
       }
       this.cells.add(elem);
     }
 
-    public List<Cell> getCells() {
+    public List<List<String>> getCells() {
       return this.cells;
     }
 
-    public void setCells(List<Cell> cells) {
+    public void setCells(List<List<String>> cells) {
       this.cells = cells;
     }
 
@@ -10518,7 +11647,7 @@ public class ClientService {
         if (value == null) {
           unsetCells();
         } else {
-          setCells((List<Cell>)value);
+          setCells((List<List<String>>)value);
         }
         break;
 
@@ -10556,12 +11685,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof set_cells_args)
-        return this.equals((set_cells_args)that);
+      if (that instanceof set_cells_as_arrays_args)
+        return this.equals((set_cells_as_arrays_args)that);
       return false;
     }
 
-    public boolean equals(set_cells_args that) {
+    public boolean equals(set_cells_as_arrays_args that) {
       if (that == null)
         return false;
 
@@ -10613,14 +11742,23 @@ public class ClientService {
           case CELLS:
             if (field.type == TType.LIST) {
               {
-                TList _list64 = iprot.readListBegin();
-                this.cells = new ArrayList<Cell>(_list64.size);
-                for (int _i65 = 0; _i65 < _list64.size; ++_i65)
+                TList _list72 = iprot.readListBegin();
+                this.cells = new ArrayList<List<String>>(_list72.size);
+                for (int _i73 = 0; _i73 < _list72.size; ++_i73)
                 {
-                  Cell _elem66;
-                  _elem66 = new Cell();
-                  _elem66.read(iprot);
-                  this.cells.add(_elem66);
+                  List<String> _elem74;
+                  {
+                    TList _list75 = iprot.readListBegin();
+                    _elem74 = new ArrayList<String>(_list75.size);
+                    for (int _i76 = 0; _i76 < _list75.size; ++_i76)
+                    {
+                      String _elem77;
+                      _elem77 = iprot.readString();
+                      _elem74.add(_elem77);
+                    }
+                    iprot.readListEnd();
+                  }
+                  this.cells.add(_elem74);
                 }
                 iprot.readListEnd();
               }
@@ -10651,9 +11789,15 @@ public class ClientService {
       if (this.cells != null) {
         oprot.writeFieldBegin(CELLS_FIELD_DESC);
         {
-          oprot.writeListBegin(new TList(TType.STRUCT, this.cells.size()));
-          for (Cell _iter67 : this.cells)          {
-            _iter67.write(oprot);
+          oprot.writeListBegin(new TList(TType.LIST, this.cells.size()));
+          for (List<String> _iter78 : this.cells)          {
+            {
+              oprot.writeListBegin(new TList(TType.STRING, _iter78.size()));
+              for (String _iter79 : _iter78)              {
+                oprot.writeString(_iter79);
+              }
+              oprot.writeListEnd();
+            }
           }
           oprot.writeListEnd();
         }
@@ -10665,7 +11809,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("set_cells_args(");
+      StringBuilder sb = new StringBuilder("set_cells_as_arrays_args(");
       boolean first = true;
 
       sb.append("mutator:");
@@ -10690,8 +11834,8 @@ public class ClientService {
 
   }
 
-  public static class set_cells_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("set_cells_result");
+  public static class set_cells_as_arrays_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cells_as_arrays_result");
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
     public ClientException e;
@@ -10707,13 +11851,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(set_cells_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cells_as_arrays_result.class, metaDataMap);
     }
 
-    public set_cells_result() {
+    public set_cells_as_arrays_result() {
     }
 
-    public set_cells_result(
+    public set_cells_as_arrays_result(
       ClientException e)
     {
       this();
@@ -10723,15 +11867,15 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public set_cells_result(set_cells_result other) {
+    public set_cells_as_arrays_result(set_cells_as_arrays_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
     @Override
-    public set_cells_result clone() {
-      return new set_cells_result(this);
+    public set_cells_as_arrays_result clone() {
+      return new set_cells_as_arrays_result(this);
     }
 
     public ClientException getE() {
@@ -10796,12 +11940,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof set_cells_result)
-        return this.equals((set_cells_result)that);
+      if (that instanceof set_cells_as_arrays_result)
+        return this.equals((set_cells_as_arrays_result)that);
       return false;
     }
 
-    public boolean equals(set_cells_result that) {
+    public boolean equals(set_cells_as_arrays_result that) {
       if (that == null)
         return false;
 
@@ -10868,7 +12012,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("set_cells_result(");
+      StringBuilder sb = new StringBuilder("set_cells_as_arrays_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -10889,64 +12033,72 @@ public class ClientService {
 
   }
 
-  public static class set_cells_as_arrays_args implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("set_cells_as_arrays_args");
+  public static class set_cells_serialized_args implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cells_serialized_args");
     private static final TField MUTATOR_FIELD_DESC = new TField("mutator", TType.I64, (short)1);
-    private static final TField CELLS_FIELD_DESC = new TField("cells", TType.LIST, (short)2);
+    private static final TField CELLS_FIELD_DESC = new TField("cells", TType.STRING, (short)2);
+    private static final TField FLUSH_FIELD_DESC = new TField("flush", TType.BOOL, (short)3);
 
     public long mutator;
     public static final int MUTATOR = 1;
-    public List<List<String>> cells;
+    public byte[] cells;
     public static final int CELLS = 2;
+    public boolean flush;
+    public static final int FLUSH = 3;
 
     private final Isset __isset = new Isset();
     private static final class Isset implements java.io.Serializable {
       public boolean mutator = false;
+      public boolean flush = false;
     }
 
     public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
       put(MUTATOR, new FieldMetaData("mutator", TFieldRequirementType.DEFAULT, 
           new FieldValueMetaData(TType.I64)));
       put(CELLS, new FieldMetaData("cells", TFieldRequirementType.DEFAULT, 
-          new ListMetaData(TType.LIST, 
-              new FieldValueMetaData(TType.LIST))));
+          new FieldValueMetaData(TType.STRING)));
+      put(FLUSH, new FieldMetaData("flush", TFieldRequirementType.DEFAULT, 
+          new FieldValueMetaData(TType.BOOL)));
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(set_cells_as_arrays_args.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cells_serialized_args.class, metaDataMap);
     }
 
-    public set_cells_as_arrays_args() {
+    public set_cells_serialized_args() {
+      this.flush = false;
+
     }
 
-    public set_cells_as_arrays_args(
+    public set_cells_serialized_args(
       long mutator,
-      List<List<String>> cells)
+      byte[] cells,
+      boolean flush)
     {
       this();
       this.mutator = mutator;
       this.__isset.mutator = true;
       this.cells = cells;
+      this.flush = flush;
+      this.__isset.flush = true;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public set_cells_as_arrays_args(set_cells_as_arrays_args other) {
+    public set_cells_serialized_args(set_cells_serialized_args other) {
       __isset.mutator = other.__isset.mutator;
       this.mutator = other.mutator;
       if (other.isSetCells()) {
-        List<List<String>> __this__cells = new ArrayList<List<String>>();
-        for (List<String> other_element : other.cells) {
-          __this__cells.add(other_element);
-        }
-        this.cells = __this__cells;
+        this.cells = other.cells;
       }
+      __isset.flush = other.__isset.flush;
+      this.flush = other.flush;
     }
 
     @Override
-    public set_cells_as_arrays_args clone() {
-      return new set_cells_as_arrays_args(this);
+    public set_cells_serialized_args clone() {
+      return new set_cells_serialized_args(this);
     }
 
     public long getMutator() {
@@ -10971,26 +12123,11 @@ public class ClientService {
       this.__isset.mutator = value;
     }
 
-    public int getCellsSize() {
-      return (this.cells == null) ? 0 : this.cells.size();
-    }
-
-    public java.util.Iterator<List<String>> getCellsIterator() {
-      return (this.cells == null) ? null : this.cells.iterator();
-    }
-
-    public void addToCells(List<String> elem) {
-      if (this.cells == null) {
-        this.cells = new ArrayList<List<String>>();
-      }
-      this.cells.add(elem);
-    }
-
-    public List<List<String>> getCells() {
+    public byte[] getCells() {
       return this.cells;
     }
 
-    public void setCells(List<List<String>> cells) {
+    public void setCells(byte[] cells) {
       this.cells = cells;
     }
 
@@ -11009,6 +12146,28 @@ public class ClientService {
       }
     }
 
+    public boolean isFlush() {
+      return this.flush;
+    }
+
+    public void setFlush(boolean flush) {
+      this.flush = flush;
+      this.__isset.flush = true;
+    }
+
+    public void unsetFlush() {
+      this.__isset.flush = false;
+    }
+
+    // Returns true if field flush is set (has been asigned a value) and false otherwise
+    public boolean isSetFlush() {
+      return this.__isset.flush;
+    }
+
+    public void setFlushIsSet(boolean value) {
+      this.__isset.flush = value;
+    }
+
     public void setFieldValue(int fieldID, Object value) {
       switch (fieldID) {
       case MUTATOR:
@@ -11023,7 +12182,15 @@ public class ClientService {
         if (value == null) {
           unsetCells();
         } else {
-          setCells((List<List<String>>)value);
+          setCells((byte[])value);
+        }
+        break;
+
+      case FLUSH:
+        if (value == null) {
+          unsetFlush();
+        } else {
+          setFlush((Boolean)value);
         }
         break;
 
@@ -11040,6 +12207,9 @@ public class ClientService {
       case CELLS:
         return getCells();
 
+      case FLUSH:
+        return new Boolean(isFlush());
+
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -11052,6 +12222,8 @@ public class ClientService {
         return isSetMutator();
       case CELLS:
         return isSetCells();
+      case FLUSH:
+        return isSetFlush();
       default:
         throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
       }
@@ -11061,12 +12233,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof set_cells_as_arrays_args)
-        return this.equals((set_cells_as_arrays_args)that);
+      if (that instanceof set_cells_serialized_args)
+        return this.equals((set_cells_serialized_args)that);
       return false;
     }
 
-    public boolean equals(set_cells_as_arrays_args that) {
+    public boolean equals(set_cells_serialized_args that) {
       if (that == null)
         return false;
 
@@ -11084,7 +12256,16 @@ public class ClientService {
       if (this_present_cells || that_present_cells) {
         if (!(this_present_cells && that_present_cells))
           return false;
-        if (!this.cells.equals(that.cells))
+        if (!java.util.Arrays.equals(this.cells, that.cells))
+          return false;
+      }
+
+      boolean this_present_flush = true;
+      boolean that_present_flush = true;
+      if (this_present_flush || that_present_flush) {
+        if (!(this_present_flush && that_present_flush))
+          return false;
+        if (this.flush != that.flush)
           return false;
       }
 
@@ -11116,28 +12297,16 @@ public class ClientService {
             }
             break;
           case CELLS:
-            if (field.type == TType.LIST) {
-              {
-                TList _list68 = iprot.readListBegin();
-                this.cells = new ArrayList<List<String>>(_list68.size);
-                for (int _i69 = 0; _i69 < _list68.size; ++_i69)
-                {
-                  List<String> _elem70;
-                  {
-                    TList _list71 = iprot.readListBegin();
-                    _elem70 = new ArrayList<String>(_list71.size);
-                    for (int _i72 = 0; _i72 < _list71.size; ++_i72)
-                    {
-                      String _elem73;
-                      _elem73 = iprot.readString();
-                      _elem70.add(_elem73);
-                    }
-                    iprot.readListEnd();
-                  }
-                  this.cells.add(_elem70);
-                }
-                iprot.readListEnd();
-              }
+            if (field.type == TType.STRING) {
+              this.cells = iprot.readBinary();
+            } else { 
+              TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          case FLUSH:
+            if (field.type == TType.BOOL) {
+              this.flush = iprot.readBool();
+              this.__isset.flush = true;
             } else { 
               TProtocolUtil.skip(iprot, field.type);
             }
@@ -11164,28 +12333,19 @@ public class ClientService {
       oprot.writeFieldEnd();
       if (this.cells != null) {
         oprot.writeFieldBegin(CELLS_FIELD_DESC);
-        {
-          oprot.writeListBegin(new TList(TType.LIST, this.cells.size()));
-          for (List<String> _iter74 : this.cells)          {
-            {
-              oprot.writeListBegin(new TList(TType.STRING, _iter74.size()));
-              for (String _iter75 : _iter74)              {
-                oprot.writeString(_iter75);
-              }
-              oprot.writeListEnd();
-            }
-          }
-          oprot.writeListEnd();
-        }
+        oprot.writeBinary(this.cells);
         oprot.writeFieldEnd();
       }
+      oprot.writeFieldBegin(FLUSH_FIELD_DESC);
+      oprot.writeBool(this.flush);
+      oprot.writeFieldEnd();
       oprot.writeFieldStop();
       oprot.writeStructEnd();
     }
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("set_cells_as_arrays_args(");
+      StringBuilder sb = new StringBuilder("set_cells_serialized_args(");
       boolean first = true;
 
       sb.append("mutator:");
@@ -11199,6 +12359,10 @@ public class ClientService {
         sb.append(this.cells);
       }
       first = false;
+      if (!first) sb.append(", ");
+      sb.append("flush:");
+      sb.append(this.flush);
+      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -11210,8 +12374,8 @@ public class ClientService {
 
   }
 
-  public static class set_cells_as_arrays_result implements TBase, java.io.Serializable, Cloneable   {
-    private static final TStruct STRUCT_DESC = new TStruct("set_cells_as_arrays_result");
+  public static class set_cells_serialized_result implements TBase, java.io.Serializable, Cloneable   {
+    private static final TStruct STRUCT_DESC = new TStruct("set_cells_serialized_result");
     private static final TField E_FIELD_DESC = new TField("e", TType.STRUCT, (short)1);
 
     public ClientException e;
@@ -11227,13 +12391,13 @@ public class ClientService {
     }});
 
     static {
-      FieldMetaData.addStructMetaDataMap(set_cells_as_arrays_result.class, metaDataMap);
+      FieldMetaData.addStructMetaDataMap(set_cells_serialized_result.class, metaDataMap);
     }
 
-    public set_cells_as_arrays_result() {
+    public set_cells_serialized_result() {
     }
 
-    public set_cells_as_arrays_result(
+    public set_cells_serialized_result(
       ClientException e)
     {
       this();
@@ -11243,15 +12407,15 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public set_cells_as_arrays_result(set_cells_as_arrays_result other) {
+    public set_cells_serialized_result(set_cells_serialized_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
     @Override
-    public set_cells_as_arrays_result clone() {
-      return new set_cells_as_arrays_result(this);
+    public set_cells_serialized_result clone() {
+      return new set_cells_serialized_result(this);
     }
 
     public ClientException getE() {
@@ -11316,12 +12480,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof set_cells_as_arrays_result)
-        return this.equals((set_cells_as_arrays_result)that);
+      if (that instanceof set_cells_serialized_result)
+        return this.equals((set_cells_serialized_result)that);
       return false;
     }
 
-    public boolean equals(set_cells_as_arrays_result that) {
+    public boolean equals(set_cells_serialized_result that) {
       if (that == null)
         return false;
 
@@ -11388,7 +12552,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("set_cells_as_arrays_result(");
+      StringBuilder sb = new StringBuilder("set_cells_serialized_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -13079,13 +14243,13 @@ public class ClientService {
           case SUCCESS:
             if (field.type == TType.LIST) {
               {
-                TList _list76 = iprot.readListBegin();
-                this.success = new ArrayList<String>(_list76.size);
-                for (int _i77 = 0; _i77 < _list76.size; ++_i77)
+                TList _list80 = iprot.readListBegin();
+                this.success = new ArrayList<String>(_list80.size);
+                for (int _i81 = 0; _i81 < _list80.size; ++_i81)
                 {
-                  String _elem78;
-                  _elem78 = iprot.readString();
-                  this.success.add(_elem78);
+                  String _elem82;
+                  _elem82 = iprot.readString();
+                  this.success.add(_elem82);
                 }
                 iprot.readListEnd();
               }
@@ -13121,8 +14285,8 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new TList(TType.STRING, this.success.size()));
-          for (String _iter79 : this.success)          {
-            oprot.writeString(_iter79);
+          for (String _iter83 : this.success)          {
+            oprot.writeString(_iter83);
           }
           oprot.writeListEnd();
         }
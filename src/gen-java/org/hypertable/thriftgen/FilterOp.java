@@ -0,0 +1,49 @@
+/**
+ * Autogenerated by Thrift
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ */
+package org.hypertable.thriftgen;
+
+
+import java.util.Set;
+import java.util.HashSet;
+import java.util.Collections;
+import org.apache.thrift.IntRangeSet;
+import java.util.Map;
+import java.util.HashMap;
+
+public class FilterOp {
+  public static final int QUALIFIER_EXACT = 1;
+  public static final int QUALIFIER_PREFIX = 2;
+  public static final int QUALIFIER_REGEX = 3;
+  public static final int VALUE_EXACT = 4;
+  public static final int VALUE_PREFIX = 5;
+  public static final int VALUE_REGEX = 6;
+  public static final int AND = 7;
+  public static final int OR = 8;
+  public static final int NOT = 9;
+
+  public static final IntRangeSet VALID_VALUES = new IntRangeSet(
+    QUALIFIER_EXACT, 
+    QUALIFIER_PREFIX, 
+    QUALIFIER_REGEX, 
+    VALUE_EXACT, 
+    VALUE_PREFIX, 
+    VALUE_REGEX, 
+    AND, 
+    OR, 
+    NOT );
+
+  public static final Map<Integer, String> VALUES_TO_NAMES = new HashMap<Integer, String>() {{
+    put(QUALIFIER_EXACT, "QUALIFIER_EXACT");
+    put(QUALIFIER_PREFIX, "QUALIFIER_PREFIX");
+    put(QUALIFIER_REGEX, "QUALIFIER_REGEX");
+    put(VALUE_EXACT, "VALUE_EXACT");
+    put(VALUE_PREFIX, "VALUE_PREFIX");
+    put(VALUE_REGEX, "VALUE_REGEX");
+    put(AND, "AND");
+    put(OR, "OR");
+    put(NOT, "NOT");
+  }};
+}
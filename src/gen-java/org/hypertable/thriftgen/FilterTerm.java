@@ -0,0 +1,331 @@
+/**
+ * Autogenerated by Thrift
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ */
+package org.hypertable.thriftgen;
+
+import java.util.List;
+import java.util.ArrayList;
+import java.util.Map;
+import java.util.HashMap;
+import java.util.Set;
+import java.util.HashSet;
+import java.util.Collections;
+import org.apache.log4j.Logger;
+
+import org.apache.thrift.*;
+import org.apache.thrift.meta_data.*;
+import org.apache.thrift.protocol.*;
+
+/**
+ * One term of a cell filter expression
+ * 
+ * <dl>
+ *   <dt>op</dt>
+ *   <dd>The operator of the term</dd>
+ * 
+ *   <dt>pattern</dt>
+ *   <dd>The pattern of a QUALIFIER_* or VALUE_* term</dd>
+ * </dl>
+ */
+public class FilterTerm implements TBase, java.io.Serializable, Cloneable {
+  private static final TStruct STRUCT_DESC = new TStruct("FilterTerm");
+  private static final TField OP_FIELD_DESC = new TField("op", TType.I32, (short)1);
+  private static final TField PATTERN_FIELD_DESC = new TField("pattern", TType.STRING, (short)2);
+
+  /**
+   * 
+   * @see FilterOp
+   */
+  public int op;
+  public static final int OP = 1;
+  public String pattern;
+  public static final int PATTERN = 2;
+
+  private final Isset __isset = new Isset();
+  private static final class Isset implements java.io.Serializable {
+    public boolean op = false;
+  }
+
+  public static final Map<Integer, FieldMetaData> metaDataMap = Collections.unmodifiableMap(new HashMap<Integer, FieldMetaData>() {{
+    put(OP, new FieldMetaData("op", TFieldRequirementType.REQUIRED, 
+        new FieldValueMetaData(TType.I32)));
+    put(PATTERN, new FieldMetaData("pattern", TFieldRequirementType.OPTIONAL, 
+        new FieldValueMetaData(TType.STRING)));
+  }});
+
+  static {
+    FieldMetaData.addStructMetaDataMap(FilterTerm.class, metaDataMap);
+  }
+
+  public FilterTerm() {
+  }
+
+  public FilterTerm(
+    int op,
+    String pattern)
+  {
+    this();
+    this.op = op;
+    this.__isset.op = true;
+    this.pattern = pattern;
+  }
+
+  /**
+   * Performs a deep copy on <i>other</i>.
+   */
+  public FilterTerm(FilterTerm other) {
+    __isset.op = other.__isset.op;
+    this.op = other.op;
+    if (other.isSetPattern()) {
+      this.pattern = other.pattern;
+    }
+  }
+
+  @Override
+  public FilterTerm clone() {
+    return new FilterTerm(this);
+  }
+
+  /**
+   * 
+   * @see FilterOp
+   */
+  public int getOp() {
+    return this.op;
+  }
+
+  /**
+   * 
+   * @see FilterOp
+   */
+  public void setOp(int op) {
+    this.op = op;
+    this.__isset.op = true;
+  }
+
+  public void unsetOp() {
+    this.__isset.op = false;
+  }
+
+  // Returns true if field op is set (has been asigned a value) and false otherwise
+  public boolean isSetOp() {
+    return this.__isset.op;
+  }
+
+  public void setOpIsSet(boolean value) {
+    this.__isset.op = value;
+  }
+
+  public String getPattern() {
+    return this.pattern;
+  }
+
+  public void setPattern(String pattern) {
+    this.pattern = pattern;
+  }
+
+  public void unsetPattern() {
+    this.pattern = null;
+  }
+
+  // Returns true if field pattern is set (has been asigned a value) and false otherwise
+  public boolean isSetPattern() {
+    return this.pattern != null;
+  }
+
+  public void setPatternIsSet(boolean value) {
+    if (!value) {
+      this.pattern = null;
+    }
+  }
+
+  public void setFieldValue(int fieldID, Object value) {
+    switch (fieldID) {
+    case OP:
+      if (value == null) {
+        unsetOp();
+      } else {
+        setOp((Integer)value);
+      }
+      break;
+
+    case PATTERN:
+      if (value == null) {
+        unsetPattern();
+      } else {
+        setPattern((String)value);
+      }
+      break;
+
+    default:
+      throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+    }
+  }
+
+  public Object getFieldValue(int fieldID) {
+    switch (fieldID) {
+    case OP:
+      return getOp();
+
+    case PATTERN:
+      return getPattern();
+
+    default:
+      throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+    }
+  }
+
+  // Returns true if field corresponding to fieldID is set (has been asigned a value) and false otherwise
+  public boolean isSet(int fieldID) {
+    switch (fieldID) {
+    case OP:
+      return isSetOp();
+    case PATTERN:
+      return isSetPattern();
+    default:
+      throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
+    }
+  }
+
+  @Override
+  public boolean equals(Object that) {
+    if (that == null)
+      return false;
+    if (that instanceof FilterTerm)
+      return this.equals((FilterTerm)that);
+    return false;
+  }
+
+  public boolean equals(FilterTerm that) {
+    if (that == null)
+      return false;
+
+    boolean this_present_op = true;
+    boolean that_present_op = true;
+    if (this_present_op || that_present_op) {
+      if (!(this_present_op && that_present_op))
+        return false;
+      if (this.op != that.op)
+        return false;
+    }
+
+    boolean this_present_pattern = true && this.isSetPattern();
+    boolean that_present_pattern = true && that.isSetPattern();
+    if (this_present_pattern || that_present_pattern) {
+      if (!(this_present_pattern && that_present_pattern))
+        return false;
+      if (!this.pattern.equals(that.pattern))
+        return false;
+    }
+
+    return true;
+  }
+
+  @Override
+  public int hashCode() {
+    return 0;
+  }
+
+  public void read(TProtocol iprot) throws TException {
+    TField field;
+    iprot.readStructBegin();
+    while (true)
+    {
+      field = iprot.readFieldBegin();
+      if (field.type == TType.STOP) { 
+        break;
+      }
+      switch (field.id)
+      {
+        case OP:
+          if (field.type == TType.I32) {
+            this.op = iprot.readI32();
+            this.__isset.op = true;
+          } else { 
+            TProtocolUtil.skip(iprot, field.type);
+          }
+          break;
+        case PATTERN:
+          if (field.type == TType.STRING) {
+            this.pattern = iprot.readString();
+          } else { 
+            TProtocolUtil.skip(iprot, field.type);
+          }
+          break;
+        default:
+          TProtocolUtil.skip(iprot, field.type);
+          break;
+      }
+      iprot.readFieldEnd();
+    }
+    iprot.readStructEnd();
+
+
+    // check for required fields of primitive type, which can't be checked in the validate method
+    if (!__isset.op) {
+      throw new TProtocolException("Required field 'op' was not found in serialized data! Struct: " + toString());
+    }
+    validate();
+  }
+
+  public void write(TProtocol oprot) throws TException {
+    validate();
+
+    oprot.writeStructBegin(STRUCT_DESC);
+    oprot.writeFieldBegin(OP_FIELD_DESC);
+    oprot.writeI32(this.op);
+    oprot.writeFieldEnd();
+    if (this.pattern != null) {
+      if (isSetPattern()) {
+        oprot.writeFieldBegin(PATTERN_FIELD_DESC);
+        oprot.writeString(this.pattern);
+        oprot.writeFieldEnd();
+      }
+    }
+    oprot.writeFieldStop();
+    oprot.writeStructEnd();
+  }
+
+  @Override
+  public String toString() {
+    StringBuilder sb = new StringBuilder("FilterTerm(");
+    boolean first = true;
+
+    sb.append("op:");
+    String op_name = FilterOp.VALUES_TO_NAMES.get(this.op);
+    if (op_name != null) {
+      sb.append(op_name);
+      sb.append(" (");
+    }
+    sb.append(this.op);
+    if (op_name != null) {
+      sb.append(")");
+    }
+    first = false;
+    if (isSetPattern()) {
+      if (!first) sb.append(", ");
+      sb.append("pattern:");
+      if (this.pattern == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.pattern);
+      }
+      first = false;
+    }
+    sb.append(")");
+    return sb.toString();
+  }
+
+  public void validate() throws TException {
+    // check for required fields
+    // 'op' is only checked in read() because it's a primitive and you chose the non-beans generator.
+    // check that fields of type enum have valid values
+    if (isSetOp() && !FilterOp.VALID_VALUES.contains(op)){
+      throw new TProtocolException("The field 'op' has been assigned the invalid value " + op);
+    }
+  }
+
+}
+
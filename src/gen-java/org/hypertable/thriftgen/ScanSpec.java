@@ -48,6 +48,11 @@ import org.apache.thrift.protocol.*;
  * 
  *   <dt>columns</dt>
  *   <dd>Specifies the names of the columns to return</dd>
+ * 
+ *   <dt>filter</dt>
+ *   <dd>A cell filter expression as a list of terms in postfix order, e.g.
+ *   [QUALIFIER_PREFIX 'a', VALUE_EXACT 'x', NOT, AND].  Cells that do not
+ *   match are dropped by the range servers</dd>
  * </dl>
  */
 public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
@@ -60,6 +65,7 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
   private static final TField START_TIME_FIELD_DESC = new TField("start_time", TType.I64, (short)6);
   private static final TField END_TIME_FIELD_DESC = new TField("end_time", TType.I64, (short)7);
   private static final TField COLUMNS_FIELD_DESC = new TField("columns", TType.LIST, (short)8);
+  private static final TField FILTER_FIELD_DESC = new TField("filter", TType.LIST, (short)9);
 
   public List<RowInterval> row_intervals;
   public static final int ROW_INTERVALS = 1;
@@ -77,6 +83,8 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
   public static final int END_TIME = 7;
   public List<String> columns;
   public static final int COLUMNS = 8;
+  public List<FilterTerm> filter;
+  public static final int FILTER = 9;
 
   private final Isset __isset = new Isset();
   private static final class Isset implements java.io.Serializable {
@@ -107,6 +115,9 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
     put(COLUMNS, new FieldMetaData("columns", TFieldRequirementType.OPTIONAL, 
         new ListMetaData(TType.LIST, 
             new FieldValueMetaData(TType.STRING))));
+    put(FILTER, new FieldMetaData("filter", TFieldRequirementType.OPTIONAL, 
+        new ListMetaData(TType.LIST, 
+            new StructMetaData(TType.STRUCT, FilterTerm.class))));
   }});
 
   static {
@@ -130,7 +141,8 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
     int row_limit,
     long start_time,
     long end_time,
-    List<String> columns)
+    List<String> columns,
+    List<FilterTerm> filter)
   {
     this();
     this.row_intervals = row_intervals;
@@ -146,6 +158,7 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
     this.end_time = end_time;
     this.__isset.end_time = true;
     this.columns = columns;
+    this.filter = filter;
   }
 
   /**
@@ -183,6 +196,13 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
       }
       this.columns = __this__columns;
     }
+    if (other.isSetFilter()) {
+      List<FilterTerm> __this__filter = new ArrayList<FilterTerm>();
+      for (FilterTerm other_element : other.filter) {
+        __this__filter.add(new FilterTerm(other_element));
+      }
+      this.filter = __this__filter;
+    }
   }
 
   @Override
@@ -414,6 +434,44 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
     }
   }
 
+  public int getFilterSize() {
+    return (this.filter == null) ? 0 : this.filter.size();
+  }
+
+  public java.util.Iterator<FilterTerm> getFilterIterator() {
+    return (this.filter == null) ? null : this.filter.iterator();
+  }
+
+  public void addToFilter(FilterTerm elem) {
+    if (this.filter == null) {
+      this.filter = new ArrayList<FilterTerm>();
+    }
+    this.filter.add(elem);
+  }
+
+  public List<FilterTerm> getFilter() {
+    return this.filter;
+  }
+
+  public void setFilter(List<FilterTerm> filter) {
+    this.filter = filter;
+  }
+
+  public void unsetFilter() {
+    this.filter = null;
+  }
+
+  // Returns true if field filter is set (has been asigned a value) and false otherwise
+  public boolean isSetFilter() {
+    return this.filter != null;
+  }
+
+  public void setFilterIsSet(boolean value) {
+    if (!value) {
+      this.filter = null;
+    }
+  }
+
   public void setFieldValue(int fieldID, Object value) {
     switch (fieldID) {
     case ROW_INTERVALS:
@@ -480,6 +538,14 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
       }
       break;
 
+    case FILTER:
+      if (value == null) {
+        unsetFilter();
+      } else {
+        setFilter((List<FilterTerm>)value);
+      }
+      break;
+
     default:
       throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
     }
@@ -511,6 +577,9 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
     case COLUMNS:
       return getColumns();
 
+    case FILTER:
+      return getFilter();
+
     default:
       throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
     }
@@ -535,6 +604,8 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
       return isSetEnd_time();
     case COLUMNS:
       return isSetColumns();
+    case FILTER:
+      return isSetFilter();
     default:
       throw new IllegalArgumentException("Field " + fieldID + " doesn't exist!");
     }
@@ -625,6 +696,15 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
         return false;
     }
 
+    boolean this_present_filter = true && this.isSetFilter();
+    boolean that_present_filter = true && that.isSetFilter();
+    if (this_present_filter || that_present_filter) {
+      if (!(this_present_filter && that_present_filter))
+        return false;
+      if (!this.filter.equals(that.filter))
+        return false;
+    }
+
     return true;
   }
 
@@ -737,6 +817,24 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
             TProtocolUtil.skip(iprot, field.type);
           }
           break;
+        case FILTER:
+          if (field.type == TType.LIST) {
+            {
+              TList _list9 = iprot.readListBegin();
+              this.filter = new ArrayList<FilterTerm>(_list9.size);
+              for (int _i10 = 0; _i10 < _list9.size; ++_i10)
+              {
+                FilterTerm _elem11;
+                _elem11 = new FilterTerm();
+                _elem11.read(iprot);
+                this.filter.add(_elem11);
+              }
+              iprot.readListEnd();
+            }
+          } else { 
+            TProtocolUtil.skip(iprot, field.type);
+          }
+          break;
         default:
           TProtocolUtil.skip(iprot, field.type);
           break;
@@ -759,8 +857,8 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
         oprot.writeFieldBegin(ROW_INTERVALS_FIELD_DESC);
         {
           oprot.writeListBegin(new TList(TType.STRUCT, this.row_intervals.size()));
-          for (RowInterval _iter9 : this.row_intervals)          {
-            _iter9.write(oprot);
+          for (RowInterval _iter12 : this.row_intervals)          {
+            _iter12.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -772,8 +870,8 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
         oprot.writeFieldBegin(CELL_INTERVALS_FIELD_DESC);
         {
           oprot.writeListBegin(new TList(TType.STRUCT, this.cell_intervals.size()));
-          for (CellInterval _iter10 : this.cell_intervals)          {
-            _iter10.write(oprot);
+          for (CellInterval _iter13 : this.cell_intervals)          {
+            _iter13.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -810,8 +908,21 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
         oprot.writeFieldBegin(COLUMNS_FIELD_DESC);
         {
           oprot.writeListBegin(new TList(TType.STRING, this.columns.size()));
-          for (String _iter11 : this.columns)          {
-            oprot.writeString(_iter11);
+          for (String _iter14 : this.columns)          {
+            oprot.writeString(_iter14);
+          }
+          oprot.writeListEnd();
+        }
+        oprot.writeFieldEnd();
+      }
+    }
+    if (this.filter != null) {
+      if (isSetFilter()) {
+        oprot.writeFieldBegin(FILTER_FIELD_DESC);
+        {
+          oprot.writeListBegin(new TList(TType.STRUCT, this.filter.size()));
+          for (FilterTerm _iter15 : this.filter)          {
+            _iter15.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -886,6 +997,16 @@ public class ScanSpec implements TBase, java.io.Serializable, Cloneable {
       }
       first = false;
     }
+    if (isSetFilter()) {
+      if (!first) sb.append(", ");
+      sb.append("filter:");
+      if (this.filter == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.filter);
+      }
+      first = false;
+    }
     sb.append(")");
     return sb.toString();
   }
@@ -832,6 +832,154 @@ sub write {
   return $xfer;
 }
 
+package Hypertable::ThriftGen::ClientService_next_cells_serialized_args;
+use Class::Accessor;
+use base('Class::Accessor');
+Hypertable::ThriftGen::ClientService_next_cells_serialized_args->mk_accessors( qw( scanner ) );
+sub new {
+my $classname = shift;
+my $self      = {};
+my $vals      = shift || {};
+$self->{scanner} = undef;
+  if (UNIVERSAL::isa($vals,'HASH')) {
+    if (defined $vals->{scanner}) {
+      $self->{scanner} = $vals->{scanner};
+    }
+  }
+return bless($self,$classname);
+}
+
+sub getName {
+  return 'ClientService_next_cells_serialized_args';
+}
+
+sub read {
+  my $self  = shift;
+  my $input = shift;
+  my $xfer  = 0;
+  my $fname;
+  my $ftype = 0;
+  my $fid   = 0;
+  $xfer += $input->readStructBegin(\$fname);
+  while (1) 
+  {
+    $xfer += $input->readFieldBegin(\$fname, \$ftype, \$fid);
+    if ($ftype == TType::STOP) {
+      last;
+    }
+    SWITCH: for($fid)
+    {
+      /^1$/ && do{      if ($ftype == TType::I64) {
+        $xfer += $input->readI64(\$self->{scanner});
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+        $xfer += $input->skip($ftype);
+    }
+    $xfer += $input->readFieldEnd();
+  }
+  $xfer += $input->readStructEnd();
+  return $xfer;
+}
+
+sub write {
+  my $self   = shift;
+  my $output = shift;
+  my $xfer   = 0;
+  $xfer += $output->writeStructBegin('ClientService_next_cells_serialized_args');
+  if (defined $self->{scanner}) {
+    $xfer += $output->writeFieldBegin('scanner', TType::I64, 1);
+    $xfer += $output->writeI64($self->{scanner});
+    $xfer += $output->writeFieldEnd();
+  }
+  $xfer += $output->writeFieldStop();
+  $xfer += $output->writeStructEnd();
+  return $xfer;
+}
+
+package Hypertable::ThriftGen::ClientService_next_cells_serialized_result;
+use Class::Accessor;
+use base('Class::Accessor');
+Hypertable::ThriftGen::ClientService_next_cells_serialized_result->mk_accessors( qw( success ) );
+sub new {
+my $classname = shift;
+my $self      = {};
+my $vals      = shift || {};
+$self->{success} = undef;
+$self->{e} = undef;
+  if (UNIVERSAL::isa($vals,'HASH')) {
+    if (defined $vals->{success}) {
+      $self->{success} = $vals->{success};
+    }
+    if (defined $vals->{e}) {
+      $self->{e} = $vals->{e};
+    }
+  }
+return bless($self,$classname);
+}
+
+sub getName {
+  return 'ClientService_next_cells_serialized_result';
+}
+
+sub read {
+  my $self  = shift;
+  my $input = shift;
+  my $xfer  = 0;
+  my $fname;
+  my $ftype = 0;
+  my $fid   = 0;
+  $xfer += $input->readStructBegin(\$fname);
+  while (1) 
+  {
+    $xfer += $input->readFieldBegin(\$fname, \$ftype, \$fid);
+    if ($ftype == TType::STOP) {
+      last;
+    }
+    SWITCH: for($fid)
+    {
+      /^0$/ && do{      if ($ftype == TType::STRING) {
+        $xfer += $input->readString(\$self->{success});
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+      /^1$/ && do{      if ($ftype == TType::STRUCT) {
+        $self->{e} = new Hypertable::ThriftGen::ClientException();
+        $xfer += $self->{e}->read($input);
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+        $xfer += $input->skip($ftype);
+    }
+    $xfer += $input->readFieldEnd();
+  }
+  $xfer += $input->readStructEnd();
+  return $xfer;
+}
+
+sub write {
+  my $self   = shift;
+  my $output = shift;
+  my $xfer   = 0;
+  $xfer += $output->writeStructBegin('ClientService_next_cells_serialized_result');
+  if (defined $self->{success}) {
+    $xfer += $output->writeFieldBegin('success', TType::STRING, 0);
+    $xfer += $output->writeString($self->{success});
+    $xfer += $output->writeFieldEnd();
+  }
+  if (defined $self->{e}) {
+    $xfer += $output->writeFieldBegin('e', TType::STRUCT, 1);
+    $xfer += $self->{e}->write($output);
+    $xfer += $output->writeFieldEnd();
+  }
+  $xfer += $output->writeFieldStop();
+  $xfer += $output->writeStructEnd();
+  return $xfer;
+}
+
 package Hypertable::ThriftGen::ClientService_next_row_args;
 use Class::Accessor;
 use base('Class::Accessor');
@@ -3156,6 +3304,169 @@ sub write {
   return $xfer;
 }
 
+package Hypertable::ThriftGen::ClientService_set_cells_serialized_args;
+use Class::Accessor;
+use base('Class::Accessor');
+Hypertable::ThriftGen::ClientService_set_cells_serialized_args->mk_accessors( qw( mutator cells flush ) );
+sub new {
+my $classname = shift;
+my $self      = {};
+my $vals      = shift || {};
+$self->{mutator} = undef;
+$self->{cells} = undef;
+$self->{flush} = 0;
+  if (UNIVERSAL::isa($vals,'HASH')) {
+    if (defined $vals->{mutator}) {
+      $self->{mutator} = $vals->{mutator};
+    }
+    if (defined $vals->{cells}) {
+      $self->{cells} = $vals->{cells};
+    }
+    if (defined $vals->{flush}) {
+      $self->{flush} = $vals->{flush};
+    }
+  }
+return bless($self,$classname);
+}
+
+sub getName {
+  return 'ClientService_set_cells_serialized_args';
+}
+
+sub read {
+  my $self  = shift;
+  my $input = shift;
+  my $xfer  = 0;
+  my $fname;
+  my $ftype = 0;
+  my $fid   = 0;
+  $xfer += $input->readStructBegin(\$fname);
+  while (1) 
+  {
+    $xfer += $input->readFieldBegin(\$fname, \$ftype, \$fid);
+    if ($ftype == TType::STOP) {
+      last;
+    }
+    SWITCH: for($fid)
+    {
+      /^1$/ && do{      if ($ftype == TType::I64) {
+        $xfer += $input->readI64(\$self->{mutator});
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+      /^2$/ && do{      if ($ftype == TType::STRING) {
+        $xfer += $input->readString(\$self->{cells});
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+      /^3$/ && do{      if ($ftype == TType::BOOL) {
+        $xfer += $input->readBool(\$self->{flush});
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+        $xfer += $input->skip($ftype);
+    }
+    $xfer += $input->readFieldEnd();
+  }
+  $xfer += $input->readStructEnd();
+  return $xfer;
+}
+
+sub write {
+  my $self   = shift;
+  my $output = shift;
+  my $xfer   = 0;
+  $xfer += $output->writeStructBegin('ClientService_set_cells_serialized_args');
+  if (defined $self->{mutator}) {
+    $xfer += $output->writeFieldBegin('mutator', TType::I64, 1);
+    $xfer += $output->writeI64($self->{mutator});
+    $xfer += $output->writeFieldEnd();
+  }
+  if (defined $self->{cells}) {
+    $xfer += $output->writeFieldBegin('cells', TType::STRING, 2);
+    $xfer += $output->writeString($self->{cells});
+    $xfer += $output->writeFieldEnd();
+  }
+  if (defined $self->{flush}) {
+    $xfer += $output->writeFieldBegin('flush', TType::BOOL, 3);
+    $xfer += $output->writeBool($self->{flush});
+    $xfer += $output->writeFieldEnd();
+  }
+  $xfer += $output->writeFieldStop();
+  $xfer += $output->writeStructEnd();
+  return $xfer;
+}
+
+package Hypertable::ThriftGen::ClientService_set_cells_serialized_result;
+use Class::Accessor;
+use base('Class::Accessor');
+Hypertable::ThriftGen::ClientService_set_cells_serialized_result->mk_accessors( qw( ) );
+sub new {
+my $classname = shift;
+my $self      = {};
+my $vals      = shift || {};
+$self->{e} = undef;
+  if (UNIVERSAL::isa($vals,'HASH')) {
+    if (defined $vals->{e}) {
+      $self->{e} = $vals->{e};
+    }
+  }
+return bless($self,$classname);
+}
+
+sub getName {
+  return 'ClientService_set_cells_serialized_result';
+}
+
+sub read {
+  my $self  = shift;
+  my $input = shift;
+  my $xfer  = 0;
+  my $fname;
+  my $ftype = 0;
+  my $fid   = 0;
+  $xfer += $input->readStructBegin(\$fname);
+  while (1) 
+  {
+    $xfer += $input->readFieldBegin(\$fname, \$ftype, \$fid);
+    if ($ftype == TType::STOP) {
+      last;
+    }
+    SWITCH: for($fid)
+    {
+      /^1$/ && do{      if ($ftype == TType::STRUCT) {
+        $self->{e} = new Hypertable::ThriftGen::ClientException();
+        $xfer += $self->{e}->read($input);
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+        $xfer += $input->skip($ftype);
+    }
+    $xfer += $input->readFieldEnd();
+  }
+  $xfer += $input->readStructEnd();
+  return $xfer;
+}
+
+sub write {
+  my $self   = shift;
+  my $output = shift;
+  my $xfer   = 0;
+  $xfer += $output->writeStructBegin('ClientService_set_cells_serialized_result');
+  if (defined $self->{e}) {
+    $xfer += $output->writeFieldBegin('e', TType::STRUCT, 1);
+    $xfer += $self->{e}->write($output);
+    $xfer += $output->writeFieldEnd();
+  }
+  $xfer += $output->writeFieldStop();
+  $xfer += $output->writeStructEnd();
+  return $xfer;
+}
+
 package Hypertable::ThriftGen::ClientService_flush_mutator_args;
 use Class::Accessor;
 use base('Class::Accessor');
@@ -3919,6 +4230,12 @@ sub next_cells_as_arrays{
 
   die 'implement interface';
 }
+sub next_cells_serialized{
+  my $self = shift;
+  my $scanner = shift;
+
+  die 'implement interface';
+}
 sub next_row{
   my $self = shift;
   my $scanner = shift;
@@ -4010,6 +4327,14 @@ sub set_cells_as_arrays{
 
   die 'implement interface';
 }
+sub set_cells_serialized{
+  my $self = shift;
+  my $mutator = shift;
+  my $cells = shift;
+  my $flush = shift;
+
+  die 'implement interface';
+}
 sub flush_mutator{
   my $self = shift;
   my $mutator = shift;
@@ -4093,6 +4418,14 @@ sub next_cells_as_arrays{
   return $self->{impl}->next_cells_as_arrays($scanner);
 }
 
+sub next_cells_serialized{
+  my $self = shift;
+  my $request = shift;
+
+  my $scanner = ($request->{'scanner'}) ? $request->{'scanner'} : undef;
+  return $self->{impl}->next_cells_serialized($scanner);
+}
+
 sub next_row{
   my $self = shift;
   my $request = shift;
@@ -4210,6 +4543,16 @@ sub set_cells_as_arrays{
   return $self->{impl}->set_cells_as_arrays($mutator, $cells);
 }
 
+sub set_cells_serialized{
+  my $self = shift;
+  my $request = shift;
+
+  my $mutator = ($request->{'mutator'}) ? $request->{'mutator'} : undef;
+  my $cells = ($request->{'cells'}) ? $request->{'cells'} : undef;
+  my $flush = ($request->{'flush'}) ? $request->{'flush'} : undef;
+  return $self->{impl}->set_cells_serialized($mutator, $cells, $flush);
+}
+
 sub flush_mutator{
   my $self = shift;
   my $request = shift;
@@ -4497,6 +4840,52 @@ sub recv_next_cells_as_arrays{
   }
   die "next_cells_as_arrays failed: unknown result";
 }
+sub next_cells_serialized{
+  my $self = shift;
+  my $scanner = shift;
+
+    $self->send_next_cells_serialized($scanner);
+  return $self->recv_next_cells_serialized();
+}
+
+sub send_next_cells_serialized{
+  my $self = shift;
+  my $scanner = shift;
+
+  $self->{output}->writeMessageBegin('next_cells_serialized', TMessageType::CALL, $self->{seqid});
+  my $args = new Hypertable::ThriftGen::ClientService_next_cells_serialized_args();
+  $args->{scanner} = $scanner;
+  $args->write($self->{output});
+  $self->{output}->writeMessageEnd();
+  $self->{output}->getTransport()->flush();
+}
+
+sub recv_next_cells_serialized{
+  my $self = shift;
+
+  my $rseqid = 0;
+  my $fname;
+  my $mtype = 0;
+
+  $self->{input}->readMessageBegin(\$fname, \$mtype, \$rseqid);
+  if ($mtype == TMessageType::EXCEPTION) {
+    my $x = new TApplicationException();
+    $x->read($self->{input});
+    $self->{input}->readMessageEnd();
+    die $x;
+  }
+  my $result = new Hypertable::ThriftGen::ClientService_next_cells_serialized_result();
+  $result->read($self->{input});
+  $self->{input}->readMessageEnd();
+
+  if (defined $result->{success} ) {
+    return $result->{success};
+  }
+  if (defined $result->{e}) {
+    die $result->{e};
+  }
+  die "next_cells_serialized failed: unknown result";
+}
 sub next_row{
   my $self = shift;
   my $scanner = shift;
@@ -5119,6 +5508,55 @@ sub recv_set_cells_as_arrays{
   }
   return;
 }
+sub set_cells_serialized{
+  my $self = shift;
+  my $mutator = shift;
+  my $cells = shift;
+  my $flush = shift;
+
+    $self->send_set_cells_serialized($mutator, $cells, $flush);
+  $self->recv_set_cells_serialized();
+}
+
+sub send_set_cells_serialized{
+  my $self = shift;
+  my $mutator = shift;
+  my $cells = shift;
+  my $flush = shift;
+
+  $self->{output}->writeMessageBegin('set_cells_serialized', TMessageType::CALL, $self->{seqid});
+  my $args = new Hypertable::ThriftGen::ClientService_set_cells_serialized_args();
+  $args->{mutator} = $mutator;
+  $args->{cells} = $cells;
+  $args->{flush} = $flush;
+  $args->write($self->{output});
+  $self->{output}->writeMessageEnd();
+  $self->{output}->getTransport()->flush();
+}
+
+sub recv_set_cells_serialized{
+  my $self = shift;
+
+  my $rseqid = 0;
+  my $fname;
+  my $mtype = 0;
+
+  $self->{input}->readMessageBegin(\$fname, \$mtype, \$rseqid);
+  if ($mtype == TMessageType::EXCEPTION) {
+    my $x = new TApplicationException();
+    $x->read($self->{input});
+    $self->{input}->readMessageEnd();
+    die $x;
+  }
+  my $result = new Hypertable::ThriftGen::ClientService_set_cells_serialized_result();
+  $result->read($self->{input});
+  $self->{input}->readMessageEnd();
+
+  if (defined $result->{e}) {
+    die $result->{e};
+  }
+  return;
+}
 sub flush_mutator{
   my $self = shift;
   my $mutator = shift;
@@ -5457,6 +5895,22 @@ $output->writeMessageBegin('next_cells_as_arrays', TMessageType::REPLY, $seqid);
 $result->write($output);
 $output->getTransport()->flush();
 }
+sub process_next_cells_serialized{
+my $self = shift;
+my ($seqid, $input, $output) = @_;
+my $args = new Hypertable::ThriftGen::ClientService_next_cells_serialized_args();
+$args->read($input);
+$input->readMessageEnd();
+my $result = new Hypertable::ThriftGen::ClientService_next_cells_serialized_result();
+eval {
+$result->{success} = $self->{handler}->next_cells_serialized($args->scanner);
+}; if( UNIVERSAL::isa($@,'ClientException') ){ 
+$result->{e} = $@;
+}
+$output->writeMessageBegin('next_cells_serialized', TMessageType::REPLY, $seqid);
+$result->write($output);
+$output->getTransport()->flush();
+}
 sub process_next_row{
 my $self = shift;
 my ($seqid, $input, $output) = @_;
@@ -5665,6 +6119,22 @@ $output->writeMessageBegin('set_cells_as_arrays', TMessageType::REPLY, $seqid);
 $result->write($output);
 $output->getTransport()->flush();
 }
+sub process_set_cells_serialized{
+my $self = shift;
+my ($seqid, $input, $output) = @_;
+my $args = new Hypertable::ThriftGen::ClientService_set_cells_serialized_args();
+$args->read($input);
+$input->readMessageEnd();
+my $result = new Hypertable::ThriftGen::ClientService_set_cells_serialized_result();
+eval {
+$self->{handler}->set_cells_serialized($args->mutator, $args->cells, $args->flush);
+}; if( UNIVERSAL::isa($@,'ClientException') ){ 
+$result->{e} = $@;
+}
+$output->writeMessageBegin('set_cells_serialized', TMessageType::REPLY, $seqid);
+$result->write($output);
+$output->getTransport()->flush();
+}
 sub process_flush_mutator{
 my $self = shift;
 my ($seqid, $input, $output) = @_;
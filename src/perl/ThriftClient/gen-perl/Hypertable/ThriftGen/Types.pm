@@ -8,6 +8,16 @@ use strict;
 use warnings;
 use Thrift;
 
+package Hypertable::ThriftGen::FilterOp;
+use constant QUALIFIER_EXACT => 1;
+use constant QUALIFIER_PREFIX => 2;
+use constant QUALIFIER_REGEX => 3;
+use constant VALUE_EXACT => 4;
+use constant VALUE_PREFIX => 5;
+use constant VALUE_REGEX => 6;
+use constant AND => 7;
+use constant OR => 8;
+use constant NOT => 9;
 package Hypertable::ThriftGen::CellFlag;
 use constant DELETE_ROW => 0;
 use constant DELETE_CF => 1;
@@ -267,10 +277,91 @@ sub write {
   return $xfer;
 }
 
+package Hypertable::ThriftGen::FilterTerm;
+use Class::Accessor;
+use base('Class::Accessor');
+Hypertable::ThriftGen::FilterTerm->mk_accessors( qw( op pattern ) );
+sub new {
+my $classname = shift;
+my $self      = {};
+my $vals      = shift || {};
+$self->{op} = undef;
+$self->{pattern} = undef;
+  if (UNIVERSAL::isa($vals,'HASH')) {
+    if (defined $vals->{op}) {
+      $self->{op} = $vals->{op};
+    }
+    if (defined $vals->{pattern}) {
+      $self->{pattern} = $vals->{pattern};
+    }
+  }
+return bless($self,$classname);
+}
+
+sub getName {
+  return 'FilterTerm';
+}
+
+sub read {
+  my $self  = shift;
+  my $input = shift;
+  my $xfer  = 0;
+  my $fname;
+  my $ftype = 0;
+  my $fid   = 0;
+  $xfer += $input->readStructBegin(\$fname);
+  while (1) 
+  {
+    $xfer += $input->readFieldBegin(\$fname, \$ftype, \$fid);
+    if ($ftype == TType::STOP) {
+      last;
+    }
+    SWITCH: for($fid)
+    {
+      /^1$/ && do{      if ($ftype == TType::I32) {
+        $xfer += $input->readI32(\$self->{op});
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+      /^2$/ && do{      if ($ftype == TType::STRING) {
+        $xfer += $input->readString(\$self->{pattern});
+      } else {
+        $xfer += $input->skip($ftype);
+      }
+      last; };
+        $xfer += $input->skip($ftype);
+    }
+    $xfer += $input->readFieldEnd();
+  }
+  $xfer += $input->readStructEnd();
+  return $xfer;
+}
+
+sub write {
+  my $self   = shift;
+  my $output = shift;
+  my $xfer   = 0;
+  $xfer += $output->writeStructBegin('FilterTerm');
+  if (defined $self->{op}) {
+    $xfer += $output->writeFieldBegin('op', TType::I32, 1);
+    $xfer += $output->writeI32($self->{op});
+    $xfer += $output->writeFieldEnd();
+  }
+  if (defined $self->{pattern}) {
+    $xfer += $output->writeFieldBegin('pattern', TType::STRING, 2);
+    $xfer += $output->writeString($self->{pattern});
+    $xfer += $output->writeFieldEnd();
+  }
+  $xfer += $output->writeFieldStop();
+  $xfer += $output->writeStructEnd();
+  return $xfer;
+}
+
 package Hypertable::ThriftGen::ScanSpec;
 use Class::Accessor;
 use base('Class::Accessor');
-Hypertable::ThriftGen::ScanSpec->mk_accessors( qw( row_intervals cell_intervals return_deletes revs row_limit start_time end_time columns ) );
+Hypertable::ThriftGen::ScanSpec->mk_accessors( qw( row_intervals cell_intervals return_deletes revs row_limit start_time end_time columns filter ) );
 sub new {
 my $classname = shift;
 my $self      = {};
@@ -283,6 +374,7 @@ $self->{row_limit} = 0;
 $self->{start_time} = undef;
 $self->{end_time} = undef;
 $self->{columns} = undef;
+$self->{filter} = undef;
   if (UNIVERSAL::isa($vals,'HASH')) {
     if (defined $vals->{row_intervals}) {
       $self->{row_intervals} = $vals->{row_intervals};
@@ -308,6 +400,9 @@ $self->{columns} = undef;
     if (defined $vals->{columns}) {
       $self->{columns} = $vals->{columns};
     }
+    if (defined $vals->{filter}) {
+      $self->{filter} = $vals->{filter};
+    }
   }
 return bless($self,$classname);
 }
@@ -417,6 +512,25 @@ sub read {
       } else {
         $xfer += $input->skip($ftype);
       }
+      last; };
+      /^9$/ && do{      if ($ftype == TType::LIST) {
+        {
+          my $_size21 = 0;
+          $self->{filter} = [];
+          my $_etype24 = 0;
+          $xfer += $input->readListBegin(\$_etype24, \$_size21);
+          for (my $_i25 = 0; $_i25 < $_size21; ++$_i25)
+          {
+            my $elem26 = undef;
+            $elem26 = new Hypertable::ThriftGen::FilterTerm();
+            $xfer += $elem26->read($input);
+            push(@{$self->{filter}},$elem26);
+          }
+          $xfer += $input->readListEnd();
+        }
+      } else {
+        $xfer += $input->skip($ftype);
+      }
       last; };
         $xfer += $input->skip($ftype);
     }
@@ -498,6 +612,20 @@ sub write {
     }
     $xfer += $output->writeFieldEnd();
   }
+  if (defined $self->{filter}) {
+    $xfer += $output->writeFieldBegin('filter', TType::LIST, 9);
+    {
+      $output->writeListBegin(TType::STRUCT, scalar(@{$self->{filter}}));
+      {
+        foreach my $iter27 (@{$self->{filter}}) 
+        {
+          $xfer += ${iter27}->write($output);
+        }
+      }
+      $output->writeListEnd();
+    }
+    $xfer += $output->writeFieldEnd();
+  }
   $xfer += $output->writeFieldStop();
   $xfer += $output->writeStructEnd();
   return $xfer;
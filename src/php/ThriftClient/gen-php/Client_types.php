@@ -7,6 +7,41 @@
 include_once $GLOBALS['THRIFT_ROOT'].'/Thrift.php';
 
 
+$GLOBALS['Hypertable_ThriftGen_E_FilterOp'] = array(
+  'QUALIFIER_EXACT' => 1,
+  'QUALIFIER_PREFIX' => 2,
+  'QUALIFIER_REGEX' => 3,
+  'VALUE_EXACT' => 4,
+  'VALUE_PREFIX' => 5,
+  'VALUE_REGEX' => 6,
+  'AND' => 7,
+  'OR' => 8,
+  'NOT' => 9,
+);
+
+final class Hypertable_ThriftGen_FilterOp {
+  const QUALIFIER_EXACT = 1;
+  const QUALIFIER_PREFIX = 2;
+  const QUALIFIER_REGEX = 3;
+  const VALUE_EXACT = 4;
+  const VALUE_PREFIX = 5;
+  const VALUE_REGEX = 6;
+  const AND = 7;
+  const OR = 8;
+  const NOT = 9;
+  static public $__names = array(
+    1 => 'QUALIFIER_EXACT',
+    2 => 'QUALIFIER_PREFIX',
+    3 => 'QUALIFIER_REGEX',
+    4 => 'VALUE_EXACT',
+    5 => 'VALUE_PREFIX',
+    6 => 'VALUE_REGEX',
+    7 => 'AND',
+    8 => 'OR',
+    9 => 'NOT',
+  );
+}
+
 $GLOBALS['Hypertable_ThriftGen_E_CellFlag'] = array(
   'DELETE_ROW' => 0,
   'DELETE_CF' => 1,
@@ -342,6 +377,98 @@ class Hypertable_ThriftGen_CellInterval {
 
 }
 
+class Hypertable_ThriftGen_FilterTerm {
+  static $_TSPEC;
+
+  public $op = null;
+  public $pattern = null;
+
+  public function __construct($vals=null) {
+    if (!isset(self::$_TSPEC)) {
+      self::$_TSPEC = array(
+        1 => array(
+          'var' => 'op',
+          'type' => TType::I32,
+          ),
+        2 => array(
+          'var' => 'pattern',
+          'type' => TType::STRING,
+          ),
+        );
+    }
+    if (is_array($vals)) {
+      if (isset($vals['op'])) {
+        $this->op = $vals['op'];
+      }
+      if (isset($vals['pattern'])) {
+        $this->pattern = $vals['pattern'];
+      }
+    }
+  }
+
+  public function getName() {
+    return 'FilterTerm';
+  }
+
+  public function read($input)
+  {
+    $xfer = 0;
+    $fname = null;
+    $ftype = 0;
+    $fid = 0;
+    $xfer += $input->readStructBegin($fname);
+    while (true)
+    {
+      $xfer += $input->readFieldBegin($fname, $ftype, $fid);
+      if ($ftype == TType::STOP) {
+        break;
+      }
+      switch ($fid)
+      {
+        case 1:
+          if ($ftype == TType::I32) {
+            $xfer += $input->readI32($this->op);
+          } else {
+            $xfer += $input->skip($ftype);
+          }
+          break;
+        case 2:
+          if ($ftype == TType::STRING) {
+            $xfer += $input->readString($this->pattern);
+          } else {
+            $xfer += $input->skip($ftype);
+          }
+          break;
+        default:
+          $xfer += $input->skip($ftype);
+          break;
+      }
+      $xfer += $input->readFieldEnd();
+    }
+    $xfer += $input->readStructEnd();
+    return $xfer;
+  }
+
+  public function write($output) {
+    $xfer = 0;
+    $xfer += $output->writeStructBegin('FilterTerm');
+    if ($this->op !== null) {
+      $xfer += $output->writeFieldBegin('op', TType::I32, 1);
+      $xfer += $output->writeI32($this->op);
+      $xfer += $output->writeFieldEnd();
+    }
+    if ($this->pattern !== null) {
+      $xfer += $output->writeFieldBegin('pattern', TType::STRING, 2);
+      $xfer += $output->writeString($this->pattern);
+      $xfer += $output->writeFieldEnd();
+    }
+    $xfer += $output->writeFieldStop();
+    $xfer += $output->writeStructEnd();
+    return $xfer;
+  }
+
+}
+
 class Hypertable_ThriftGen_ScanSpec {
   static $_TSPEC;
 
@@ -353,6 +480,7 @@ class Hypertable_ThriftGen_ScanSpec {
   public $start_time = null;
   public $end_time = null;
   public $columns = null;
+  public $filter = null;
 
   public function __construct($vals=null) {
     if (!isset(self::$_TSPEC)) {
@@ -403,6 +531,15 @@ class Hypertable_ThriftGen_ScanSpec {
             'type' => TType::STRING,
             ),
           ),
+        9 => array(
+          'var' => 'filter',
+          'type' => TType::LST,
+          'etype' => TType::STRUCT,
+          'elem' => array(
+            'type' => TType::STRUCT,
+            'class' => 'Hypertable_ThriftGen_FilterTerm',
+            ),
+          ),
         );
     }
     if (is_array($vals)) {
@@ -430,6 +567,9 @@ class Hypertable_ThriftGen_ScanSpec {
       if (isset($vals['columns'])) {
         $this->columns = $vals['columns'];
       }
+      if (isset($vals['filter'])) {
+        $this->filter = $vals['filter'];
+      }
     }
   }
 
@@ -540,6 +680,24 @@ class Hypertable_ThriftGen_ScanSpec {
             $xfer += $input->skip($ftype);
           }
           break;
+        case 9:
+          if ($ftype == TType::LST) {
+            $this->filter = array();
+            $_size21 = 0;
+            $_etype24 = 0;
+            $xfer += $input->readListBegin($_etype24, $_size21);
+            for ($_i25 = 0; $_i25 < $_size21; ++$_i25)
+            {
+              $elem26 = null;
+              $elem26 = new Hypertable_ThriftGen_FilterTerm();
+              $xfer += $elem26->read($input);
+              $this->filter []= $elem26;
+            }
+            $xfer += $input->readListEnd();
+          } else {
+            $xfer += $input->skip($ftype);
+          }
+          break;
         default:
           $xfer += $input->skip($ftype);
           break;
@@ -629,6 +787,23 @@ class Hypertable_ThriftGen_ScanSpec {
       }
       $xfer += $output->writeFieldEnd();
     }
+    if ($this->filter !== null) {
+      if (!is_array($this->filter)) {
+        throw new TProtocolException('Bad type in structure.', TProtocolException::INVALID_DATA);
+      }
+      $xfer += $output->writeFieldBegin('filter', TType::LST, 9);
+      {
+        $output->writeListBegin(TType::STRUCT, count($this->filter));
+        {
+          foreach ($this->filter as $iter27)
+          {
+            $xfer += $iter27->write($output);
+          }
+        }
+        $output->writeListEnd();
+      }
+      $xfer += $output->writeFieldEnd();
+    }
     $xfer += $output->writeFieldStop();
     $xfer += $output->writeStructEnd();
     return $xfer;
@@ -81,6 +81,20 @@ class Iface:
     """
     pass
 
+  def next_cells_serialized(self, scanner):
+    """
+    Alternative interface returning a block of cells in the serialized
+    cells encoding, which avoids creating an object per cell
+    
+    @param scanner - scanner id
+    
+    @return a block of cells, containing no cells at the end of the scan
+    
+    Parameters:
+     - scanner
+    """
+    pass
+
   def next_row(self, scanner):
     """
     Iterate over rows of a scanner
@@ -253,6 +267,24 @@ class Iface:
     """
     pass
 
+  def set_cells_serialized(self, mutator, cells, flush):
+    """
+    Alternative interface taking a block of cells in the serialized cells
+    encoding
+    
+    @param mutator - mutator id
+    
+    @param cells - a block of serialized cells
+    
+    @param flush - whether to flush the mutator after adding the cells
+    
+    Parameters:
+     - mutator
+     - cells
+     - flush
+    """
+    pass
+
   def flush_mutator(self, mutator):
     """
     Flush mutator buffers
@@ -507,6 +539,45 @@ class Client(Iface):
       raise result.e
     raise TApplicationException(TApplicationException.MISSING_RESULT, "next_cells_as_arrays failed: unknown result");
 
+  def next_cells_serialized(self, scanner):
+    """
+    Alternative interface returning a block of cells in the serialized
+    cells encoding, which avoids creating an object per cell
+    
+    @param scanner - scanner id
+    
+    @return a block of cells, containing no cells at the end of the scan
+    
+    Parameters:
+     - scanner
+    """
+    self.send_next_cells_serialized(scanner)
+    return self.recv_next_cells_serialized()
+
+  def send_next_cells_serialized(self, scanner):
+    self._oprot.writeMessageBegin('next_cells_serialized', TMessageType.CALL, self._seqid)
+    args = next_cells_serialized_args()
+    args.scanner = scanner
+    args.write(self._oprot)
+    self._oprot.writeMessageEnd()
+    self._oprot.trans.flush()
+
+  def recv_next_cells_serialized(self, ):
+    (fname, mtype, rseqid) = self._iprot.readMessageBegin()
+    if mtype == TMessageType.EXCEPTION:
+      x = TApplicationException()
+      x.read(self._iprot)
+      self._iprot.readMessageEnd()
+      raise x
+    result = next_cells_serialized_result()
+    result.read(self._iprot)
+    self._iprot.readMessageEnd()
+    if result.success != None:
+      return result.success
+    if result.e != None:
+      raise result.e
+    raise TApplicationException(TApplicationException.MISSING_RESULT, "next_cells_serialized failed: unknown result");
+
   def next_row(self, scanner):
     """
     Iterate over rows of a scanner
@@ -1007,6 +1078,49 @@ class Client(Iface):
       raise result.e
     return
 
+  def set_cells_serialized(self, mutator, cells, flush):
+    """
+    Alternative interface taking a block of cells in the serialized cells
+    encoding
+    
+    @param mutator - mutator id
+    
+    @param cells - a block of serialized cells
+    
+    @param flush - whether to flush the mutator after adding the cells
+    
+    Parameters:
+     - mutator
+     - cells
+     - flush
+    """
+    self.send_set_cells_serialized(mutator, cells, flush)
+    self.recv_set_cells_serialized()
+
+  def send_set_cells_serialized(self, mutator, cells, flush):
+    self._oprot.writeMessageBegin('set_cells_serialized', TMessageType.CALL, self._seqid)
+    args = set_cells_serialized_args()
+    args.mutator = mutator
+    args.cells = cells
+    args.flush = flush
+    args.write(self._oprot)
+    self._oprot.writeMessageEnd()
+    self._oprot.trans.flush()
+
+  def recv_set_cells_serialized(self, ):
+    (fname, mtype, rseqid) = self._iprot.readMessageBegin()
+    if mtype == TMessageType.EXCEPTION:
+      x = TApplicationException()
+      x.read(self._iprot)
+      self._iprot.readMessageEnd()
+      raise x
+    result = set_cells_serialized_result()
+    result.read(self._iprot)
+    self._iprot.readMessageEnd()
+    if result.e != None:
+      raise result.e
+    return
+
   def flush_mutator(self, mutator):
     """
     Flush mutator buffers
@@ -1195,6 +1309,7 @@ class Processor(Iface, TProcessor):
     self._processMap["close_scanner"] = Processor.process_close_scanner
     self._processMap["next_cells"] = Processor.process_next_cells
     self._processMap["next_cells_as_arrays"] = Processor.process_next_cells_as_arrays
+    self._processMap["next_cells_serialized"] = Processor.process_next_cells_serialized
     self._processMap["next_row"] = Processor.process_next_row
     self._processMap["next_row_as_arrays"] = Processor.process_next_row_as_arrays
     self._processMap["get_row"] = Processor.process_get_row
@@ -1208,6 +1323,7 @@ class Processor(Iface, TProcessor):
     self._processMap["set_cell_as_array"] = Processor.process_set_cell_as_array
     self._processMap["set_cells"] = Processor.process_set_cells
     self._processMap["set_cells_as_arrays"] = Processor.process_set_cells_as_arrays
+    self._processMap["set_cells_serialized"] = Processor.process_set_cells_serialized
     self._processMap["flush_mutator"] = Processor.process_flush_mutator
     self._processMap["get_table_id"] = Processor.process_get_table_id
     self._processMap["get_schema"] = Processor.process_get_schema
@@ -1299,6 +1415,20 @@ class Processor(Iface, TProcessor):
     oprot.writeMessageEnd()
     oprot.trans.flush()
 
+  def process_next_cells_serialized(self, seqid, iprot, oprot):
+    args = next_cells_serialized_args()
+    args.read(iprot)
+    iprot.readMessageEnd()
+    result = next_cells_serialized_result()
+    try:
+      result.success = self._handler.next_cells_serialized(args.scanner)
+    except ClientException, e:
+      result.e = e
+    oprot.writeMessageBegin("next_cells_serialized", TMessageType.REPLY, seqid)
+    result.write(oprot)
+    oprot.writeMessageEnd()
+    oprot.trans.flush()
+
   def process_next_row(self, seqid, iprot, oprot):
     args = next_row_args()
     args.read(iprot)
@@ -1481,6 +1611,20 @@ class Processor(Iface, TProcessor):
     oprot.writeMessageEnd()
     oprot.trans.flush()
 
+  def process_set_cells_serialized(self, seqid, iprot, oprot):
+    args = set_cells_serialized_args()
+    args.read(iprot)
+    iprot.readMessageEnd()
+    result = set_cells_serialized_result()
+    try:
+      self._handler.set_cells_serialized(args.mutator, args.cells, args.flush)
+    except ClientException, e:
+      result.e = e
+    oprot.writeMessageBegin("set_cells_serialized", TMessageType.REPLY, seqid)
+    result.write(oprot)
+    oprot.writeMessageEnd()
+    oprot.trans.flush()
+
   def process_flush_mutator(self, seqid, iprot, oprot):
     args = flush_mutator_args()
     args.read(iprot)
@@ -2025,11 +2169,11 @@ class next_cells_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype24, _size21) = iprot.readListBegin()
-          for _i25 in xrange(_size21):
-            _elem26 = Cell()
-            _elem26.read(iprot)
-            self.success.append(_elem26)
+          (_etype31, _size28) = iprot.readListBegin()
+          for _i32 in xrange(_size28):
+            _elem33 = Cell()
+            _elem33.read(iprot)
+            self.success.append(_elem33)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -2052,8 +2196,8 @@ class next_cells_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.STRUCT, len(self.success))
-      for iter27 in self.success:
-        iter27.write(oprot)
+      for iter34 in self.success:
+        iter34.write(oprot)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     if self.e != None:
@@ -2158,15 +2302,15 @@ class next_cells_as_arrays_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype31, _size28) = iprot.readListBegin()
-          for _i32 in xrange(_size28):
-            _elem33 = []
-            (_etype37, _size34) = iprot.readListBegin()
-            for _i38 in xrange(_size34):
-              _elem39 = iprot.readString();
-              _elem33.append(_elem39)
+          (_etype38, _size35) = iprot.readListBegin()
+          for _i39 in xrange(_size35):
+            _elem40 = []
+            (_etype44, _size41) = iprot.readListBegin()
+            for _i45 in xrange(_size41):
+              _elem46 = iprot.readString();
+              _elem40.append(_elem46)
             iprot.readListEnd()
-            self.success.append(_elem33)
+            self.success.append(_elem40)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -2189,10 +2333,10 @@ class next_cells_as_arrays_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.LIST, len(self.success))
-      for iter40 in self.success:
-        oprot.writeListBegin(TType.STRING, len(iter40))
-        for iter41 in iter40:
-          oprot.writeString(iter41)
+      for iter47 in self.success:
+        oprot.writeListBegin(TType.STRING, len(iter47))
+        for iter48 in iter47:
+          oprot.writeString(iter48)
         oprot.writeListEnd()
       oprot.writeListEnd()
       oprot.writeFieldEnd()
@@ -2214,6 +2358,130 @@ class next_cells_as_arrays_result:
   def __ne__(self, other):
     return not (self == other)
 
+class next_cells_serialized_args:
+  """
+  Attributes:
+   - scanner
+  """
+
+  thrift_spec = (
+    None, # 0
+    (1, TType.I64, 'scanner', None, None, ), # 1
+  )
+
+  def __init__(self, scanner=None,):
+    self.scanner = scanner
+
+  def read(self, iprot):
+    if iprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None and fastbinary is not None:
+      fastbinary.decode_binary(self, iprot.trans, (self.__class__, self.thrift_spec))
+      return
+    iprot.readStructBegin()
+    while True:
+      (fname, ftype, fid) = iprot.readFieldBegin()
+      if ftype == TType.STOP:
+        break
+      if fid == 1:
+        if ftype == TType.I64:
+          self.scanner = iprot.readI64();
+        else:
+          iprot.skip(ftype)
+      else:
+        iprot.skip(ftype)
+      iprot.readFieldEnd()
+    iprot.readStructEnd()
+
+  def write(self, oprot):
+    if oprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and self.thrift_spec is not None and fastbinary is not None:
+      oprot.trans.write(fastbinary.encode_binary(self, (self.__class__, self.thrift_spec)))
+      return
+    oprot.writeStructBegin('next_cells_serialized_args')
+    if self.scanner != None:
+      oprot.writeFieldBegin('scanner', TType.I64, 1)
+      oprot.writeI64(self.scanner)
+      oprot.writeFieldEnd()
+    oprot.writeFieldStop()
+    oprot.writeStructEnd()
+
+  def __repr__(self):
+    L = ['%s=%r' % (key, value)
+      for key, value in self.__dict__.iteritems()]
+    return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+  def __eq__(self, other):
+    return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+  def __ne__(self, other):
+    return not (self == other)
+
+class next_cells_serialized_result:
+  """
+  Attributes:
+   - success
+   - e
+  """
+
+  thrift_spec = (
+    (0, TType.STRING, 'success', None, None, ), # 0
+    (1, TType.STRUCT, 'e', (ClientException, ClientException.thrift_spec), None, ), # 1
+  )
+
+  def __init__(self, success=None, e=None,):
+    self.success = success
+    self.e = e
+
+  def read(self, iprot):
+    if iprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None and fastbinary is not None:
+      fastbinary.decode_binary(self, iprot.trans, (self.__class__, self.thrift_spec))
+      return
+    iprot.readStructBegin()
+    while True:
+      (fname, ftype, fid) = iprot.readFieldBegin()
+      if ftype == TType.STOP:
+        break
+      if fid == 0:
+        if ftype == TType.STRING:
+          self.success = iprot.readString();
+        else:
+          iprot.skip(ftype)
+      elif fid == 1:
+        if ftype == TType.STRUCT:
+          self.e = ClientException()
+          self.e.read(iprot)
+        else:
+          iprot.skip(ftype)
+      else:
+        iprot.skip(ftype)
+      iprot.readFieldEnd()
+    iprot.readStructEnd()
+
+  def write(self, oprot):
+    if oprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and self.thrift_spec is not None and fastbinary is not None:
+      oprot.trans.write(fastbinary.encode_binary(self, (self.__class__, self.thrift_spec)))
+      return
+    oprot.writeStructBegin('next_cells_serialized_result')
+    if self.success != None:
+      oprot.writeFieldBegin('success', TType.STRING, 0)
+      oprot.writeString(self.success)
+      oprot.writeFieldEnd()
+    if self.e != None:
+      oprot.writeFieldBegin('e', TType.STRUCT, 1)
+      self.e.write(oprot)
+      oprot.writeFieldEnd()
+    oprot.writeFieldStop()
+    oprot.writeStructEnd()
+
+  def __repr__(self):
+    L = ['%s=%r' % (key, value)
+      for key, value in self.__dict__.iteritems()]
+    return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+  def __eq__(self, other):
+    return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+  def __ne__(self, other):
+    return not (self == other)
+
 class next_row_args:
   """
   Attributes:
@@ -2298,11 +2566,11 @@ class next_row_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype45, _size42) = iprot.readListBegin()
-          for _i46 in xrange(_size42):
-            _elem47 = Cell()
-            _elem47.read(iprot)
-            self.success.append(_elem47)
+          (_etype52, _size49) = iprot.readListBegin()
+          for _i53 in xrange(_size49):
+            _elem54 = Cell()
+            _elem54.read(iprot)
+            self.success.append(_elem54)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -2325,8 +2593,8 @@ class next_row_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.STRUCT, len(self.success))
-      for iter48 in self.success:
-        iter48.write(oprot)
+      for iter55 in self.success:
+        iter55.write(oprot)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     if self.e != None:
@@ -2431,15 +2699,15 @@ class next_row_as_arrays_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype52, _size49) = iprot.readListBegin()
-          for _i53 in xrange(_size49):
-            _elem54 = []
-            (_etype58, _size55) = iprot.readListBegin()
-            for _i59 in xrange(_size55):
-              _elem60 = iprot.readString();
-              _elem54.append(_elem60)
+          (_etype59, _size56) = iprot.readListBegin()
+          for _i60 in xrange(_size56):
+            _elem61 = []
+            (_etype65, _size62) = iprot.readListBegin()
+            for _i66 in xrange(_size62):
+              _elem67 = iprot.readString();
+              _elem61.append(_elem67)
             iprot.readListEnd()
-            self.success.append(_elem54)
+            self.success.append(_elem61)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -2462,10 +2730,10 @@ class next_row_as_arrays_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.LIST, len(self.success))
-      for iter61 in self.success:
-        oprot.writeListBegin(TType.STRING, len(iter61))
-        for iter62 in iter61:
-          oprot.writeString(iter62)
+      for iter68 in self.success:
+        oprot.writeListBegin(TType.STRING, len(iter68))
+        for iter69 in iter68:
+          oprot.writeString(iter69)
         oprot.writeListEnd()
       oprot.writeListEnd()
       oprot.writeFieldEnd()
@@ -2583,11 +2851,11 @@ class get_row_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype66, _size63) = iprot.readListBegin()
-          for _i67 in xrange(_size63):
-            _elem68 = Cell()
-            _elem68.read(iprot)
-            self.success.append(_elem68)
+          (_etype73, _size70) = iprot.readListBegin()
+          for _i74 in xrange(_size70):
+            _elem75 = Cell()
+            _elem75.read(iprot)
+            self.success.append(_elem75)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -2610,8 +2878,8 @@ class get_row_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.STRUCT, len(self.success))
-      for iter69 in self.success:
-        iter69.write(oprot)
+      for iter76 in self.success:
+        iter76.write(oprot)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     if self.e != None:
@@ -2728,15 +2996,15 @@ class get_row_as_arrays_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype73, _size70) = iprot.readListBegin()
-          for _i74 in xrange(_size70):
-            _elem75 = []
-            (_etype79, _size76) = iprot.readListBegin()
-            for _i80 in xrange(_size76):
-              _elem81 = iprot.readString();
-              _elem75.append(_elem81)
+          (_etype80, _size77) = iprot.readListBegin()
+          for _i81 in xrange(_size77):
+            _elem82 = []
+            (_etype86, _size83) = iprot.readListBegin()
+            for _i87 in xrange(_size83):
+              _elem88 = iprot.readString();
+              _elem82.append(_elem88)
             iprot.readListEnd()
-            self.success.append(_elem75)
+            self.success.append(_elem82)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -2759,10 +3027,10 @@ class get_row_as_arrays_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.LIST, len(self.success))
-      for iter82 in self.success:
-        oprot.writeListBegin(TType.STRING, len(iter82))
-        for iter83 in iter82:
-          oprot.writeString(iter83)
+      for iter89 in self.success:
+        oprot.writeListBegin(TType.STRING, len(iter89))
+        for iter90 in iter89:
+          oprot.writeString(iter90)
         oprot.writeListEnd()
       oprot.writeListEnd()
       oprot.writeFieldEnd()
@@ -3029,11 +3297,11 @@ class get_cells_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype87, _size84) = iprot.readListBegin()
-          for _i88 in xrange(_size84):
-            _elem89 = Cell()
-            _elem89.read(iprot)
-            self.success.append(_elem89)
+          (_etype94, _size91) = iprot.readListBegin()
+          for _i95 in xrange(_size91):
+            _elem96 = Cell()
+            _elem96.read(iprot)
+            self.success.append(_elem96)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -3056,8 +3324,8 @@ class get_cells_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.STRUCT, len(self.success))
-      for iter90 in self.success:
-        iter90.write(oprot)
+      for iter97 in self.success:
+        iter97.write(oprot)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     if self.e != None:
@@ -3175,15 +3443,15 @@ class get_cells_as_arrays_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype94, _size91) = iprot.readListBegin()
-          for _i95 in xrange(_size91):
-            _elem96 = []
-            (_etype100, _size97) = iprot.readListBegin()
-            for _i101 in xrange(_size97):
-              _elem102 = iprot.readString();
-              _elem96.append(_elem102)
+          (_etype101, _size98) = iprot.readListBegin()
+          for _i102 in xrange(_size98):
+            _elem103 = []
+            (_etype107, _size104) = iprot.readListBegin()
+            for _i108 in xrange(_size104):
+              _elem109 = iprot.readString();
+              _elem103.append(_elem109)
             iprot.readListEnd()
-            self.success.append(_elem96)
+            self.success.append(_elem103)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -3206,10 +3474,10 @@ class get_cells_as_arrays_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.LIST, len(self.success))
-      for iter103 in self.success:
-        oprot.writeListBegin(TType.STRING, len(iter103))
-        for iter104 in iter103:
-          oprot.writeString(iter104)
+      for iter110 in self.success:
+        oprot.writeListBegin(TType.STRING, len(iter110))
+        for iter111 in iter110:
+          oprot.writeString(iter111)
         oprot.writeListEnd()
       oprot.writeListEnd()
       oprot.writeFieldEnd()
@@ -3664,10 +3932,10 @@ class set_cell_as_array_args:
       elif fid == 2:
         if ftype == TType.LIST:
           self.cell = []
-          (_etype108, _size105) = iprot.readListBegin()
-          for _i109 in xrange(_size105):
-            _elem110 = iprot.readString();
-            self.cell.append(_elem110)
+          (_etype115, _size112) = iprot.readListBegin()
+          for _i116 in xrange(_size112):
+            _elem117 = iprot.readString();
+            self.cell.append(_elem117)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -3688,8 +3956,8 @@ class set_cell_as_array_args:
     if self.cell != None:
       oprot.writeFieldBegin('cell', TType.LIST, 2)
       oprot.writeListBegin(TType.STRING, len(self.cell))
-      for iter111 in self.cell:
-        oprot.writeString(iter111)
+      for iter118 in self.cell:
+        oprot.writeString(iter118)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     oprot.writeFieldStop()
@@ -3797,11 +4065,11 @@ class set_cells_args:
       elif fid == 2:
         if ftype == TType.LIST:
           self.cells = []
-          (_etype115, _size112) = iprot.readListBegin()
-          for _i116 in xrange(_size112):
-            _elem117 = Cell()
-            _elem117.read(iprot)
-            self.cells.append(_elem117)
+          (_etype122, _size119) = iprot.readListBegin()
+          for _i123 in xrange(_size119):
+            _elem124 = Cell()
+            _elem124.read(iprot)
+            self.cells.append(_elem124)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -3822,8 +4090,8 @@ class set_cells_args:
     if self.cells != None:
       oprot.writeFieldBegin('cells', TType.LIST, 2)
       oprot.writeListBegin(TType.STRUCT, len(self.cells))
-      for iter118 in self.cells:
-        iter118.write(oprot)
+      for iter125 in self.cells:
+        iter125.write(oprot)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     oprot.writeFieldStop()
@@ -3931,15 +4199,15 @@ class set_cells_as_arrays_args:
       elif fid == 2:
         if ftype == TType.LIST:
           self.cells = []
-          (_etype122, _size119) = iprot.readListBegin()
-          for _i123 in xrange(_size119):
-            _elem124 = []
-            (_etype128, _size125) = iprot.readListBegin()
-            for _i129 in xrange(_size125):
-              _elem130 = iprot.readString();
-              _elem124.append(_elem130)
+          (_etype129, _size126) = iprot.readListBegin()
+          for _i130 in xrange(_size126):
+            _elem131 = []
+            (_etype135, _size132) = iprot.readListBegin()
+            for _i136 in xrange(_size132):
+              _elem137 = iprot.readString();
+              _elem131.append(_elem137)
             iprot.readListEnd()
-            self.cells.append(_elem124)
+            self.cells.append(_elem131)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -3960,10 +4228,10 @@ class set_cells_as_arrays_args:
     if self.cells != None:
       oprot.writeFieldBegin('cells', TType.LIST, 2)
       oprot.writeListBegin(TType.LIST, len(self.cells))
-      for iter131 in self.cells:
-        oprot.writeListBegin(TType.STRING, len(iter131))
-        for iter132 in iter131:
-          oprot.writeString(iter132)
+      for iter138 in self.cells:
+        oprot.writeListBegin(TType.STRING, len(iter138))
+        for iter139 in iter138:
+          oprot.writeString(iter139)
         oprot.writeListEnd()
       oprot.writeListEnd()
       oprot.writeFieldEnd()
@@ -4038,6 +4306,143 @@ class set_cells_as_arrays_result:
   def __ne__(self, other):
     return not (self == other)
 
+class set_cells_serialized_args:
+  """
+  Attributes:
+   - mutator
+   - cells
+   - flush
+  """
+
+  thrift_spec = (
+    None, # 0
+    (1, TType.I64, 'mutator', None, None, ), # 1
+    (2, TType.STRING, 'cells', None, None, ), # 2
+    (3, TType.BOOL, 'flush', None, False, ), # 3
+  )
+
+  def __init__(self, mutator=None, cells=None, flush=thrift_spec[3][4],):
+    self.mutator = mutator
+    self.cells = cells
+    self.flush = flush
+
+  def read(self, iprot):
+    if iprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None and fastbinary is not None:
+      fastbinary.decode_binary(self, iprot.trans, (self.__class__, self.thrift_spec))
+      return
+    iprot.readStructBegin()
+    while True:
+      (fname, ftype, fid) = iprot.readFieldBegin()
+      if ftype == TType.STOP:
+        break
+      if fid == 1:
+        if ftype == TType.I64:
+          self.mutator = iprot.readI64();
+        else:
+          iprot.skip(ftype)
+      elif fid == 2:
+        if ftype == TType.STRING:
+          self.cells = iprot.readString();
+        else:
+          iprot.skip(ftype)
+      elif fid == 3:
+        if ftype == TType.BOOL:
+          self.flush = iprot.readBool();
+        else:
+          iprot.skip(ftype)
+      else:
+        iprot.skip(ftype)
+      iprot.readFieldEnd()
+    iprot.readStructEnd()
+
+  def write(self, oprot):
+    if oprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and self.thrift_spec is not None and fastbinary is not None:
+      oprot.trans.write(fastbinary.encode_binary(self, (self.__class__, self.thrift_spec)))
+      return
+    oprot.writeStructBegin('set_cells_serialized_args')
+    if self.mutator != None:
+      oprot.writeFieldBegin('mutator', TType.I64, 1)
+      oprot.writeI64(self.mutator)
+      oprot.writeFieldEnd()
+    if self.cells != None:
+      oprot.writeFieldBegin('cells', TType.STRING, 2)
+      oprot.writeString(self.cells)
+      oprot.writeFieldEnd()
+    if self.flush != None:
+      oprot.writeFieldBegin('flush', TType.BOOL, 3)
+      oprot.writeBool(self.flush)
+      oprot.writeFieldEnd()
+    oprot.writeFieldStop()
+    oprot.writeStructEnd()
+
+  def __repr__(self):
+    L = ['%s=%r' % (key, value)
+      for key, value in self.__dict__.iteritems()]
+    return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+  def __eq__(self, other):
+    return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+  def __ne__(self, other):
+    return not (self == other)
+
+class set_cells_serialized_result:
+  """
+  Attributes:
+   - e
+  """
+
+  thrift_spec = (
+    None, # 0
+    (1, TType.STRUCT, 'e', (ClientException, ClientException.thrift_spec), None, ), # 1
+  )
+
+  def __init__(self, e=None,):
+    self.e = e
+
+  def read(self, iprot):
+    if iprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None and fastbinary is not None:
+      fastbinary.decode_binary(self, iprot.trans, (self.__class__, self.thrift_spec))
+      return
+    iprot.readStructBegin()
+    while True:
+      (fname, ftype, fid) = iprot.readFieldBegin()
+      if ftype == TType.STOP:
+        break
+      if fid == 1:
+        if ftype == TType.STRUCT:
+          self.e = ClientException()
+          self.e.read(iprot)
+        else:
+          iprot.skip(ftype)
+      else:
+        iprot.skip(ftype)
+      iprot.readFieldEnd()
+    iprot.readStructEnd()
+
+  def write(self, oprot):
+    if oprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and self.thrift_spec is not None and fastbinary is not None:
+      oprot.trans.write(fastbinary.encode_binary(self, (self.__class__, self.thrift_spec)))
+      return
+    oprot.writeStructBegin('set_cells_serialized_result')
+    if self.e != None:
+      oprot.writeFieldBegin('e', TType.STRUCT, 1)
+      self.e.write(oprot)
+      oprot.writeFieldEnd()
+    oprot.writeFieldStop()
+    oprot.writeStructEnd()
+
+  def __repr__(self):
+    L = ['%s=%r' % (key, value)
+      for key, value in self.__dict__.iteritems()]
+    return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+  def __eq__(self, other):
+    return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+  def __ne__(self, other):
+    return not (self == other)
+
 class flush_mutator_args:
   """
   Attributes:
@@ -4465,10 +4870,10 @@ class get_tables_result:
       if fid == 0:
         if ftype == TType.LIST:
           self.success = []
-          (_etype136, _size133) = iprot.readListBegin()
-          for _i137 in xrange(_size133):
-            _elem138 = iprot.readString();
-            self.success.append(_elem138)
+          (_etype143, _size140) = iprot.readListBegin()
+          for _i144 in xrange(_size140):
+            _elem145 = iprot.readString();
+            self.success.append(_elem145)
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
@@ -4491,8 +4896,8 @@ class get_tables_result:
     if self.success != None:
       oprot.writeFieldBegin('success', TType.LIST, 0)
       oprot.writeListBegin(TType.STRING, len(self.success))
-      for iter139 in self.success:
-        oprot.writeString(iter139)
+      for iter146 in self.success:
+        oprot.writeString(iter146)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     if self.e != None:
@@ -42,6 +42,28 @@ class MutatorFlag:
   """
   NO_LOG_SYNC = 1
 
+class FilterOp:
+  """
+  Operators of a cell filter term
+  
+  Note for maintainers: the definition must be sync'ed with the
+  CellPredicate constants in src/cc/Hypertable/Lib/ScanSpec.h
+  
+  The QUALIFIER_* and VALUE_* terms test the column qualifier or the value
+  of a cell against their pattern, as an exact match, a prefix or a POSIX
+  extended regular expression.  AND, OR and NOT combine the results of the
+  preceding terms.
+  """
+  QUALIFIER_EXACT = 1
+  QUALIFIER_PREFIX = 2
+  QUALIFIER_REGEX = 3
+  VALUE_EXACT = 4
+  VALUE_PREFIX = 5
+  VALUE_REGEX = 6
+  AND = 7
+  OR = 8
+  NOT = 9
+
 class RowInterval:
   """
   Specifies a range of rows
@@ -290,6 +312,84 @@ class CellInterval:
   def __ne__(self, other):
     return not (self == other)
 
+class FilterTerm:
+  """
+  One term of a cell filter expression
+  
+  <dl>
+    <dt>op</dt>
+    <dd>The operator of the term</dd>
+  
+    <dt>pattern</dt>
+    <dd>The pattern of a QUALIFIER_* or VALUE_* term</dd>
+  </dl>
+  
+  Attributes:
+   - op
+   - pattern
+  """
+
+  thrift_spec = (
+    None, # 0
+    (1, TType.I32, 'op', None, None, ), # 1
+    (2, TType.STRING, 'pattern', None, None, ), # 2
+  )
+
+  def __init__(self, op=None, pattern=None,):
+    self.op = op
+    self.pattern = pattern
+
+  def read(self, iprot):
+    if iprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None and fastbinary is not None:
+      fastbinary.decode_binary(self, iprot.trans, (self.__class__, self.thrift_spec))
+      return
+    iprot.readStructBegin()
+    while True:
+      (fname, ftype, fid) = iprot.readFieldBegin()
+      if ftype == TType.STOP:
+        break
+      if fid == 1:
+        if ftype == TType.I32:
+          self.op = iprot.readI32();
+        else:
+          iprot.skip(ftype)
+      elif fid == 2:
+        if ftype == TType.STRING:
+          self.pattern = iprot.readString();
+        else:
+          iprot.skip(ftype)
+      else:
+        iprot.skip(ftype)
+      iprot.readFieldEnd()
+    iprot.readStructEnd()
+
+  def write(self, oprot):
+    if oprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and self.thrift_spec is not None and fastbinary is not None:
+      oprot.trans.write(fastbinary.encode_binary(self, (self.__class__, self.thrift_spec)))
+      return
+    oprot.writeStructBegin('FilterTerm')
+    if self.op != None:
+      oprot.writeFieldBegin('op', TType.I32, 1)
+      oprot.writeI32(self.op)
+      oprot.writeFieldEnd()
+    if self.pattern != None:
+      oprot.writeFieldBegin('pattern', TType.STRING, 2)
+      oprot.writeString(self.pattern)
+      oprot.writeFieldEnd()
+    oprot.writeFieldStop()
+    oprot.writeStructEnd()
+
+  def __repr__(self):
+    L = ['%s=%r' % (key, value)
+      for key, value in self.__dict__.iteritems()]
+    return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+  def __eq__(self, other):
+    return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+  def __ne__(self, other):
+    return not (self == other)
+
 class ScanSpec:
   """
   Specifies options for a scan
@@ -321,6 +421,11 @@ class ScanSpec:
   
     <dt>columns</dt>
     <dd>Specifies the names of the columns to return</dd>
+  
+    <dt>filter</dt>
+    <dd>A cell filter expression as a list of terms in postfix order, e.g.
+    [QUALIFIER_PREFIX 'a', VALUE_EXACT 'x', NOT, AND].  Cells that do not
+    match are dropped by the range servers</dd>
   </dl>
   
   Attributes:
@@ -332,6 +437,7 @@ class ScanSpec:
    - start_time
    - end_time
    - columns
+   - filter
   """
 
   thrift_spec = (
@@ -344,9 +450,10 @@ class ScanSpec:
     (6, TType.I64, 'start_time', None, None, ), # 6
     (7, TType.I64, 'end_time', None, None, ), # 7
     (8, TType.LIST, 'columns', (TType.STRING,None), None, ), # 8
+    (9, TType.LIST, 'filter', (TType.STRUCT,(FilterTerm, FilterTerm.thrift_spec)), None, ), # 9
   )
 
-  def __init__(self, row_intervals=None, cell_intervals=None, return_deletes=thrift_spec[3][4], revs=thrift_spec[4][4], row_limit=thrift_spec[5][4], start_time=None, end_time=None, columns=None,):
+  def __init__(self, row_intervals=None, cell_intervals=None, return_deletes=thrift_spec[3][4], revs=thrift_spec[4][4], row_limit=thrift_spec[5][4], start_time=None, end_time=None, columns=None, filter=None,):
     self.row_intervals = row_intervals
     self.cell_intervals = cell_intervals
     self.return_deletes = return_deletes
@@ -355,6 +462,7 @@ class ScanSpec:
     self.start_time = start_time
     self.end_time = end_time
     self.columns = columns
+    self.filter = filter
 
   def read(self, iprot):
     if iprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None and fastbinary is not None:
@@ -422,6 +530,17 @@ class ScanSpec:
           iprot.readListEnd()
         else:
           iprot.skip(ftype)
+      elif fid == 9:
+        if ftype == TType.LIST:
+          self.filter = []
+          (_etype21, _size18) = iprot.readListBegin()
+          for _i22 in xrange(_size18):
+            _elem23 = FilterTerm()
+            _elem23.read(iprot)
+            self.filter.append(_elem23)
+          iprot.readListEnd()
+        else:
+          iprot.skip(ftype)
       else:
         iprot.skip(ftype)
       iprot.readFieldEnd()
@@ -435,15 +554,15 @@ class ScanSpec:
     if self.row_intervals != None:
       oprot.writeFieldBegin('row_intervals', TType.LIST, 1)
       oprot.writeListBegin(TType.STRUCT, len(self.row_intervals))
-      for iter18 in self.row_intervals:
-        iter18.write(oprot)
+      for iter24 in self.row_intervals:
+        iter24.write(oprot)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     if self.cell_intervals != None:
       oprot.writeFieldBegin('cell_intervals', TType.LIST, 2)
       oprot.writeListBegin(TType.STRUCT, len(self.cell_intervals))
-      for iter19 in self.cell_intervals:
-        iter19.write(oprot)
+      for iter25 in self.cell_intervals:
+        iter25.write(oprot)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     if self.return_deletes != None:
@@ -469,8 +588,15 @@ class ScanSpec:
     if self.columns != None:
       oprot.writeFieldBegin('columns', TType.LIST, 8)
       oprot.writeListBegin(TType.STRING, len(self.columns))
-      for iter20 in self.columns:
-        oprot.writeString(iter20)
+      for iter26 in self.columns:
+        oprot.writeString(iter26)
+      oprot.writeListEnd()
+      oprot.writeFieldEnd()
+    if self.filter != None:
+      oprot.writeFieldBegin('filter', TType.LIST, 9)
+      oprot.writeListBegin(TType.STRUCT, len(self.filter))
+      for iter27 in self.filter:
+        iter27.write(oprot)
       oprot.writeListEnd()
       oprot.writeFieldEnd()
     oprot.writeFieldStop()
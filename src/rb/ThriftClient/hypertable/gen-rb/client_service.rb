@@ -91,6 +91,22 @@ require 'client_types'
                   raise ::Thrift::ApplicationException.new(::Thrift::ApplicationException::MISSING_RESULT, 'next_cells_as_arrays failed: unknown result')
                 end
 
+                def next_cells_serialized(scanner)
+                  send_next_cells_serialized(scanner)
+                  return recv_next_cells_serialized()
+                end
+
+                def send_next_cells_serialized(scanner)
+                  send_message('next_cells_serialized', Next_cells_serialized_args, :scanner => scanner)
+                end
+
+                def recv_next_cells_serialized()
+                  result = receive_message(Next_cells_serialized_result)
+                  return result.success unless result.success.nil?
+                  raise result.e unless result.e.nil?
+                  raise ::Thrift::ApplicationException.new(::Thrift::ApplicationException::MISSING_RESULT, 'next_cells_serialized failed: unknown result')
+                end
+
                 def next_row(scanner)
                   send_next_row(scanner)
                   return recv_next_row()
@@ -294,6 +310,21 @@ require 'client_types'
                   return
                 end
 
+                def set_cells_serialized(mutator, cells, flush)
+                  send_set_cells_serialized(mutator, cells, flush)
+                  recv_set_cells_serialized()
+                end
+
+                def send_set_cells_serialized(mutator, cells, flush)
+                  send_message('set_cells_serialized', Set_cells_serialized_args, :mutator => mutator, :cells => cells, :flush => flush)
+                end
+
+                def recv_set_cells_serialized()
+                  result = receive_message(Set_cells_serialized_result)
+                  raise result.e unless result.e.nil?
+                  return
+                end
+
                 def flush_mutator(mutator)
                   send_flush_mutator(mutator)
                   recv_flush_mutator()
@@ -432,6 +463,17 @@ require 'client_types'
                   write_result(result, oprot, 'next_cells_as_arrays', seqid)
                 end
 
+                def process_next_cells_serialized(seqid, iprot, oprot)
+                  args = read_args(iprot, Next_cells_serialized_args)
+                  result = Next_cells_serialized_result.new()
+                  begin
+                    result.success = @handler.next_cells_serialized(args.scanner)
+                  rescue Hypertable::ThriftGen::ClientException => e
+                    result.e = e
+                  end
+                  write_result(result, oprot, 'next_cells_serialized', seqid)
+                end
+
                 def process_next_row(seqid, iprot, oprot)
                   args = read_args(iprot, Next_row_args)
                   result = Next_row_result.new()
@@ -575,6 +617,17 @@ require 'client_types'
                   write_result(result, oprot, 'set_cells_as_arrays', seqid)
                 end
 
+                def process_set_cells_serialized(seqid, iprot, oprot)
+                  args = read_args(iprot, Set_cells_serialized_args)
+                  result = Set_cells_serialized_result.new()
+                  begin
+                    @handler.set_cells_serialized(args.mutator, args.cells, args.flush)
+                  rescue Hypertable::ThriftGen::ClientException => e
+                    result.e = e
+                  end
+                  write_result(result, oprot, 'set_cells_serialized', seqid)
+                end
+
                 def process_flush_mutator(seqid, iprot, oprot)
                   args = read_args(iprot, Flush_mutator_args)
                   result = Flush_mutator_result.new()
@@ -806,6 +859,40 @@ require 'client_types'
 
               end
 
+              class Next_cells_serialized_args
+                include ::Thrift::Struct
+                SCANNER = 1
+
+                ::Thrift::Struct.field_accessor self, :scanner
+                FIELDS = {
+                  SCANNER => {:type => ::Thrift::Types::I64, :name => 'scanner'}
+                }
+
+                def struct_fields; FIELDS; end
+
+                def validate
+                end
+
+              end
+
+              class Next_cells_serialized_result
+                include ::Thrift::Struct
+                SUCCESS = 0
+                E = 1
+
+                ::Thrift::Struct.field_accessor self, :success, :e
+                FIELDS = {
+                  SUCCESS => {:type => ::Thrift::Types::STRING, :name => 'success'},
+                  E => {:type => ::Thrift::Types::STRUCT, :name => 'e', :class => Hypertable::ThriftGen::ClientException}
+                }
+
+                def struct_fields; FIELDS; end
+
+                def validate
+                end
+
+              end
+
               class Next_row_args
                 include ::Thrift::Struct
                 SCANNER = 1
@@ -1264,6 +1351,42 @@ require 'client_types'
 
               end
 
+              class Set_cells_serialized_args
+                include ::Thrift::Struct
+                MUTATOR = 1
+                CELLS = 2
+                FLUSH = 3
+
+                ::Thrift::Struct.field_accessor self, :mutator, :cells, :flush
+                FIELDS = {
+                  MUTATOR => {:type => ::Thrift::Types::I64, :name => 'mutator'},
+                  CELLS => {:type => ::Thrift::Types::STRING, :name => 'cells'},
+                  FLUSH => {:type => ::Thrift::Types::BOOL, :name => 'flush', :default => false}
+                }
+
+                def struct_fields; FIELDS; end
+
+                def validate
+                end
+
+              end
+
+              class Set_cells_serialized_result
+                include ::Thrift::Struct
+                E = 1
+
+                ::Thrift::Struct.field_accessor self, :e
+                FIELDS = {
+                  E => {:type => ::Thrift::Types::STRUCT, :name => 'e', :class => Hypertable::ThriftGen::ClientException}
+                }
+
+                def struct_fields; FIELDS; end
+
+                def validate
+                end
+
+              end
+
               class Flush_mutator_args
                 include ::Thrift::Struct
                 MUTATOR = 1
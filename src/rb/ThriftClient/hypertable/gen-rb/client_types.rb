@@ -7,6 +7,20 @@
 
 module Hypertable
   module ThriftGen
+        module FilterOp
+          QUALIFIER_EXACT = 1
+          QUALIFIER_PREFIX = 2
+          QUALIFIER_REGEX = 3
+          VALUE_EXACT = 4
+          VALUE_PREFIX = 5
+          VALUE_REGEX = 6
+          AND = 7
+          OR = 8
+          NOT = 9
+          VALUE_MAP = {1 => "QUALIFIER_EXACT", 2 => "QUALIFIER_PREFIX", 3 => "QUALIFIER_REGEX", 4 => "VALUE_EXACT", 5 => "VALUE_PREFIX", 6 => "VALUE_REGEX", 7 => "AND", 8 => "OR", 9 => "NOT"}
+          VALID_VALUES = Set.new([QUALIFIER_EXACT, QUALIFIER_PREFIX, QUALIFIER_REGEX, VALUE_EXACT, VALUE_PREFIX, VALUE_REGEX, AND, OR, NOT]).freeze
+        end
+
         module CellFlag
           DELETE_ROW = 0
           DELETE_CF = 1
@@ -108,6 +122,37 @@ module Hypertable
 
         end
 
+        # One term of a cell filter expression
+        # 
+        # <dl>
+        #   <dt>op</dt>
+        #   <dd>The operator of the term</dd>
+        # 
+        #   <dt>pattern</dt>
+        #   <dd>The pattern of a QUALIFIER_* or VALUE_* term</dd>
+        # </dl>
+        class FilterTerm
+          include ::Thrift::Struct
+          OP = 1
+          PATTERN = 2
+
+          ::Thrift::Struct.field_accessor self, :op, :pattern
+          FIELDS = {
+            OP => {:type => ::Thrift::Types::I32, :name => 'op'},
+            PATTERN => {:type => ::Thrift::Types::STRING, :name => 'pattern', :optional => true}
+          }
+
+          def struct_fields; FIELDS; end
+
+          def validate
+            raise ::Thrift::ProtocolException.new(::Thrift::ProtocolException::UNKNOWN, 'Required field op is unset!') unless @op
+            unless @op.nil? || Hypertable::ThriftGen::FilterOp::VALID_VALUES.include?(@op)
+              raise ::Thrift::ProtocolException.new(::Thrift::ProtocolException::UNKNOWN, 'Invalid value of field op!')
+            end
+          end
+
+        end
+
         # Specifies options for a scan
         # 
         # <dl>
@@ -137,6 +182,11 @@ module Hypertable
         # 
         #   <dt>columns</dt>
         #   <dd>Specifies the names of the columns to return</dd>
+        # 
+        #   <dt>filter</dt>
+        #   <dd>A cell filter expression as a list of terms in postfix order, e.g.
+        #   [QUALIFIER_PREFIX 'a', VALUE_EXACT 'x', NOT, AND].  Cells that do not
+        #   match are dropped by the range servers</dd>
         # </dl>
         class ScanSpec
           include ::Thrift::Struct
@@ -148,8 +198,9 @@ module Hypertable
           START_TIME = 6
           END_TIME = 7
           COLUMNS = 8
+          FILTER = 9
 
-          ::Thrift::Struct.field_accessor self, :row_intervals, :cell_intervals, :return_deletes, :revs, :row_limit, :start_time, :end_time, :columns
+          ::Thrift::Struct.field_accessor self, :row_intervals, :cell_intervals, :return_deletes, :revs, :row_limit, :start_time, :end_time, :columns, :filter
           FIELDS = {
             ROW_INTERVALS => {:type => ::Thrift::Types::LIST, :name => 'row_intervals', :element => {:type => ::Thrift::Types::STRUCT, :class => Hypertable::ThriftGen::RowInterval}, :optional => true},
             CELL_INTERVALS => {:type => ::Thrift::Types::LIST, :name => 'cell_intervals', :element => {:type => ::Thrift::Types::STRUCT, :class => Hypertable::ThriftGen::CellInterval}, :optional => true},
@@ -158,7 +209,8 @@ module Hypertable
             ROW_LIMIT => {:type => ::Thrift::Types::I32, :name => 'row_limit', :default => 0, :optional => true},
             START_TIME => {:type => ::Thrift::Types::I64, :name => 'start_time', :optional => true},
             END_TIME => {:type => ::Thrift::Types::I64, :name => 'end_time', :optional => true},
-            COLUMNS => {:type => ::Thrift::Types::LIST, :name => 'columns', :element => {:type => ::Thrift::Types::STRING}, :optional => true}
+            COLUMNS => {:type => ::Thrift::Types::LIST, :name => 'columns', :element => {:type => ::Thrift::Types::STRING}, :optional => true},
+            FILTER => {:type => ::Thrift::Types::LIST, :name => 'filter', :element => {:type => ::Thrift::Types::STRUCT, :class => Hypertable::ThriftGen::FilterTerm}, :optional => true}
           }
 
           def struct_fields; FIELDS; end
@@ -0,0 +1,56 @@
+#!/bin/sh
+
+HT_HOME=${INSTALL_DIR:-"$HOME/hypertable/current"}
+HT_SHELL=$HT_HOME/bin/hypertable
+SCRIPT_DIR=`dirname $0`
+ROWS=${ROWS:-"50000"}
+
+fail() {
+  echo "Test failed: $1"
+  exit 1
+}
+
+$HT_HOME/bin/start-test-servers.sh --clear --no-thriftbroker \
+    --Hypertable.RangeServer.Range.SplitSize=400K
+
+# The seed rows split the tables into several ranges before the load, the
+# loaded rows fall in between and on top of them
+awk -v n=$ROWS 'BEGIN {
+  print "rowkey\tcolumnkey\tvalue";
+  for (i = 0; i < n; i += 2) printf("row%06d\ta\tseed%d\n", i, i);
+}' > seed.tsv
+awk -v n=$ROWS 'BEGIN {
+  print "rowkey\tcolumnkey\tvalue";
+  for (i = 0; i < n; i++) printf("row%06d\tb:q%d\tload%d\n", i, i % 3, i);
+  for (i = 1; i < n; i += 2) printf("row%06d\ta\tload%d\n", i, i);
+}' > load.tsv
+awk 'BEGIN {
+  print "rowkey\tcolumnkey\tvalue";
+  for (i = 0; i < 100; i++) printf("skew%03d\ta\tahead\n", i);
+}' > skew.tsv
+
+$HT_SHELL --batch < $SCRIPT_DIR/create-tables.hql || fail "create tables"
+
+$HT_HOME/bin/bulk_load --sort-memory=200000 --temp-dir=. bulk load.tsv \
+    || fail "bulk_load exited with $?"
+$HT_SHELL --batch < $SCRIPT_DIR/load-direct.hql || fail "LOAD DATA INFILE"
+
+# Updates made after the load have to win over the loaded cells
+$HT_SHELL --batch < $SCRIPT_DIR/update.hql || fail "update"
+
+$HT_SHELL --batch < $SCRIPT_DIR/dump-bulk.hql > bulk.dump
+$HT_SHELL --batch < $SCRIPT_DIR/dump-direct.hql > direct.dump
+[ `wc -l < bulk.dump` -gt $ROWS ] || fail "bulk table is short"
+diff bulk.dump direct.dump > /dev/null || fail "tables differ after the load"
+grep "^row000001.a.updated$" bulk.dump > /dev/null \
+    || fail "update after the load is hidden by the loaded cell"
+
+# CellStores written by a client whose clock runs ahead are rejected
+$HT_HOME/bin/bulk_load --clock-offset=60000000 bulk skew.tsv \
+    && fail "bulk_load with skewed revisions succeeded"
+$HT_SHELL --batch < $SCRIPT_DIR/dump-bulk.hql > bulk.dump
+diff bulk.dump direct.dump > /dev/null \
+    || fail "rejected CellStores were loaded"
+
+echo "Test passed."
+exit 0
@@ -0,0 +1,20 @@
+#!/bin/sh
+
+HT_HOME=${INSTALL_DIR:-"$HOME/hypertable/current"}
+
+# Small ranges so that the test table spans several of them and keeps
+# splitting while it grows
+$HT_HOME/bin/start-test-servers.sh --clear --no-thriftbroker \
+    --Hypertable.RangeServer.Range.SplitSize=200K \
+    --Hypertable.RangeServer.AccessGroup.MaxMemory=100K \
+    --Hypertable.RangeServer.Maintenance.Interval=100
+
+cd ${TEST_BIN_DIR}
+./get_rows_test
+if [ $? != 0 ] ; then
+  echo "Test failed, exiting ..."
+  exit 1
+fi
+
+echo "Test passed."
+exit 0
@@ -0,0 +1,79 @@
+#!/bin/sh
+
+HT_HOME=${INSTALL_DIR:-"$HOME/hypertable/current"}
+HT_SHELL=$HT_HOME/bin/hypertable
+SCRIPT_DIR=`dirname $0`
+RANGE_SIZE=${RANGE_SIZE:-"7M"}
+# time for the Master to notice the lost Hyperspace session of a dead server
+FAILOVER_WAIT=${FAILOVER_WAIT:-"90"}
+DIGEST="openssl dgst -md5"
+
+gen_test_data() {
+  seed=${DATA_SEED:-$$}
+  size=${DATA_SIZE:-"2000000"}
+  perl -e 'print "# rowkey\tcolumnkey\tvalue\n"' > data.header
+  perl -e 'srand('$seed'); for($i=0; $i<'$size'; ++$i) {
+    printf "row%07d\tcolumn%d\tvalue%d\n", $i, int(rand(3))+1, $i
+  }' > data.body
+  $DIGEST < data.body > data.md5
+}
+
+# Starts RangeServer number $1 listening on port $2
+start_range_server() {
+  pidfile=$HT_HOME/run/Hypertable.RangeServer.$1.pid
+  $HT_HOME/bin/Hypertable.RangeServer --verbose --pidfile=$pidfile \
+      --Hypertable.RangeServer.Port=$2 \
+      --Hypertable.RangeServer.Range.SplitSize=$RANGE_SIZE \
+      > rangeserver.output.$1 2>&1 &
+}
+
+stop_range_server() {
+  pidfile=$HT_HOME/run/Hypertable.RangeServer.$1.pid
+  if [ -f $pidfile ]; then
+    kill -9 `cat $pidfile`
+    rm -f $pidfile
+  fi
+}
+
+gen_test_data
+
+$HT_HOME/bin/start-test-servers.sh --no-rangeserver --no-thriftbroker --clear
+
+stop_range_server 1
+stop_range_server 2
+start_range_server 1 38060
+sleep 2
+start_range_server 2 38061
+sleep 2
+
+$HT_SHELL --batch < $SCRIPT_DIR/create-test-table.hql
+if [ $? != 0 ] ; then
+  echo "Unable to create table 'failover-test', exiting ..."
+  exit 1
+fi
+
+$HT_SHELL --Hypertable.Mutator.ScatterBuffer.FlushLimit.PerServer=100K \
+    --batch < $SCRIPT_DIR/load.hql
+if [ $? != 0 ] ; then
+  echo "Problem loading table 'failover-test', exiting ..."
+  exit 1
+fi
+
+# Kill the second server and let the Master reassign its ranges
+stop_range_server 2
+sleep $FAILOVER_WAIT
+
+$HT_SHELL -l error --batch < $SCRIPT_DIR/dump-test-table.hql > dbdump.raw
+if [ $? != 0 ] ; then
+  echo "Problem dumping table 'failover-test', exiting ..."
+  exit 1
+fi
+grep -v "hypertable" dbdump.raw > dbdump
+
+stop_range_server 1
+
+$DIGEST < dbdump > dbdump.md5
+diff data.md5 dbdump.md5 && exit 0
+
+echo "Test FAILED, dump of 'failover-test' differs from loaded data"
+exit 1